@@ -0,0 +1,174 @@
+// EN: Incremental aggregate accumulators and the GROUP BY hash aggregation shared by in-memory and streaming
+//     query execution
+// FR: Accumulateurs d'agrégats incrémentaux et agrégation par hachage GROUP BY partagés par l'exécution de
+//     requêtes en mémoire et en flux
+
+#pragma once
+
+#include "csv/query_engine.hpp"
+#include "csv/spill_directory.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: One aggregate fed value by value, so a scan never has to keep a column around. Results match
+//     QueryEngine::calculateAggregate(): SUM and AVG only count numeric cells, MIN and MAX compare numerically
+//     when both sides are numbers and as text otherwise, DISTINCT counts distinct values, GROUP_CONCAT joins
+//     with ','. NONE keeps the first value (non-aggregated column next to aggregates). Nothing added gives "".
+// FR: Un agrégat alimenté valeur par valeur, un parcours n'a donc jamais à conserver une colonne. Les résultats
+//     correspondent à QueryEngine::calculateAggregate() : SUM et AVG ne comptent que les cellules numériques,
+//     MIN et MAX comparent numériquement quand les deux côtés sont des nombres et comme du texte sinon,
+//     DISTINCT compte les valeurs distinctes, GROUP_CONCAT joint avec ','. NONE garde la première valeur
+//     (colonne non agrégée à côté d'agrégats). Sans valeur ajoutée le résultat est "".
+class AggregateAccumulator {
+public:
+    explicit AggregateAccumulator(AggregateFunction function = AggregateFunction::NONE) : function_(function) {}
+
+    void add(std::string_view value);
+    
+    // EN: Add a value whose numeric reading is already known (`numeric` false for text)
+    // FR: Ajoute une valeur dont la lecture numérique est déjà connue (`numeric` faux pour du texte)
+    void add(std::string_view value, bool numeric, double number);
+    
+    // EN: Fold in an accumulator of the same function fed with values that came after ours
+    // FR: Intègre un accumulateur de la même fonction alimenté avec des valeurs venues après les nôtres
+    void merge(const AggregateAccumulator& later);
+    
+    std::string result() const;
+    
+    // EN: Binary state, for spilled partial aggregates
+    // FR: État binaire, pour les agrégats partiels débordés
+    void save(std::ostream& out) const;
+    bool load(std::istream& in);
+    
+    // EN: Whether the function reads values as numbers (SUM, AVG, MIN, MAX)
+    // FR: Si la fonction lit les valeurs comme des nombres (SUM, AVG, MIN, MAX)
+    static bool needsNumber(AggregateFunction function);
+
+    AggregateFunction getFunction() const { return function_; }
+    size_t getCount() const { return count_; }
+
+private:
+    AggregateFunction function_;
+    size_t count_{0};               // EN: Values added / FR: Valeurs ajoutées
+    double sum_{0.0};               // EN: Sum of numeric values / FR: Somme des valeurs numériques
+    size_t numeric_count_{0};       // EN: Numeric values added / FR: Valeurs numériques ajoutées
+    std::string extreme_;           // EN: First value, MIN or MAX so far / FR: Première valeur, MIN ou MAX courant
+    bool extreme_numeric_{false};   // EN: extreme_ is a number / FR: extreme_ est un nombre
+    double extreme_number_{0.0};    // EN: Its value / FR: Sa valeur
+    std::set<std::string, std::less<>> distinct_;   // EN: Values seen by DISTINCT / FR: Valeurs vues par DISTINCT
+    std::string concat_;            // EN: GROUP_CONCAT output / FR: Sortie de GROUP_CONCAT
+    
+    bool replacesExtreme(std::string_view value, bool numeric, double number) const;
+};
+
+// EN: Hash aggregation for SELECT lists with aggregates, with or without GROUP BY. Rows are split into morsels
+//     of contiguous rows; each worker aggregates its morsel into a private partial table (no locking), and the
+//     partials are merged in row order into the main table, so results match a sequential scan (first value,
+//     GROUP_CONCAT order). Numeric readings are taken once per dictionary entry, or once per cell otherwise.
+//     When the main table grows past the memory budget, its partial groups are written to hash partitions on
+//     disk and merged partition by partition in finish(). Groups come out in order of first appearance; without
+//     GROUP BY there is exactly one output row, even over no rows.
+// FR: Agrégation par hachage des listes SELECT avec agrégats, avec ou sans GROUP BY. Les lignes sont découpées
+//     en morceaux de lignes contiguës ; chaque worker agrège son morceau dans une table partielle privée (sans
+//     verrou), et les partielles sont fusionnées dans l'ordre des lignes dans la table principale, les
+//     résultats correspondent donc à un parcours séquentiel (première valeur, ordre de GROUP_CONCAT). Les
+//     lectures numériques sont faites une fois par entrée de dictionnaire, ou une fois par cellule sinon.
+//     Quand la table principale dépasse le budget mémoire, ses groupes partiels sont écrits dans des partitions
+//     de hachage sur disque et fusionnés partition par partition dans finish(). Les groupes sortent dans
+//     l'ordre de première apparition ; sans GROUP BY il y a exactement une ligne de sortie, même sans ligne.
+class HashAggregation {
+public:
+    using Row = std::vector<std::string>;
+    
+    static constexpr size_t kMorselRows = size_t{1} << 16;
+    static constexpr size_t kSpillPartitions = 32;
+    static constexpr size_t kGroupOverheadBytes = 96;
+    
+    // EN: Morsels run on the calling thread plus up to `helpers` tasks of `pool`, usually the engine's shared scan
+    //     pool (nullptr = sequential)
+    // FR: Les morceaux s'exécutent sur le thread appelant plus au plus `helpers` tâches de `pool`, en général le
+    //     pool de parcours partagé du moteur (nullptr = séquentiel)
+    HashAggregation(std::vector<SelectColumn> columns, std::vector<std::string> group_by,
+                    size_t memory_budget_bytes, ThreadPool* pool = nullptr, size_t helpers = 0,
+                    std::filesystem::path spill_directory = std::filesystem::temp_directory_path());
+    ~HashAggregation();
+    
+    // EN: Aggregate `rows` (ascending) of `table`. May be called again with further tables (streamed chunks),
+    //     whose rows count as coming after every earlier one. IO_ERROR when a spill fails.
+    // FR: Agrège les lignes `rows` (croissantes) de `table`. Peut être rappelée avec d'autres tables (blocs en
+    //     flux), dont les lignes comptent comme venant après toutes les précédentes. IO_ERROR si un débordement
+    //     échoue.
+    QueryError add(const ColumnarTable& table, const std::vector<size_t>& rows);
+    
+    // EN: One row per group, values in SELECT order
+    // FR: Une ligne par groupe, valeurs dans l'ordre du SELECT
+    QueryError finish(std::vector<Row>& output);
+    
+    size_t getGroupCount() const { return group_count_; }
+    size_t getThreadCount() const { return threads_used_; }
+    size_t getPartitionCount() const { return spilled_bytes_ > 0 ? kSpillPartitions : 0; }
+    size_t getSpilledBytes() const { return spilled_bytes_; }
+    
+private:
+    struct KeyHash {
+        size_t operator()(std::string_view key) const { return std::hash<std::string_view>{}(key); }
+    };
+    
+    // EN: Groups of a partial table live in slots numbered in order of first appearance: the key maps to a
+    //     slot, and each slot owns `width` consecutive accumulators inside fixed-size blocks, which never move
+    //     once allocated
+    // FR: Les groupes d'une table partielle vivent dans des emplacements numérotés dans l'ordre de première
+    //     apparition : la clé mène à un emplacement, et chaque emplacement possède `largeur` accumulateurs
+    //     consécutifs dans des blocs de taille fixe, qui ne bougent plus une fois alloués
+    struct Partial {
+        static constexpr size_t kBlockSlots = 1024;
+        
+        StringHeap keys;
+        std::unordered_map<std::string_view, size_t, KeyHash> slots;
+        std::vector<std::string_view> slot_keys;
+        std::vector<uint64_t> first_rows;     // EN: Ordinal of the first row of each group / FR: Rang de la première ligne de chaque groupe
+        std::vector<std::unique_ptr<AggregateAccumulator[]>> blocks;
+        size_t bytes{0};
+        
+        size_t size() const { return first_rows.size(); }
+        AggregateAccumulator* group(size_t slot, size_t width) const {
+            return blocks[slot / kBlockSlots].get() + (slot % kBlockSlots) * width;
+        }
+        void clear();
+    };
+    struct Inputs;
+    
+    std::vector<SelectColumn> columns_;
+    std::vector<std::string> group_by_;
+    size_t memory_budget_bytes_;
+    ThreadPool* pool_;
+    size_t helpers_;
+    std::filesystem::path spill_parent_;
+    std::unique_ptr<SpillDirectory> directory_;
+    Partial main_;
+    uint64_t rows_seen_{0};
+    size_t group_count_{0};
+    size_t threads_used_{1};
+    size_t spilled_bytes_{0};
+    
+    size_t findOrAddGroup(Partial& partial, std::string_view key, uint64_t first_row) const;
+    void aggregateRange(const Inputs& inputs, const size_t* rows, size_t count, Partial& partial) const;
+    void mergeInto(Partial& target, const Partial& source) const;
+    void emitGroups(const Partial& partial, std::vector<Row>& output) const;
+    QueryError spill();
+};
+
+} // namespace CSV
+} // namespace BBP
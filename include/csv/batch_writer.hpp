@@ -17,6 +17,7 @@
 #include <atomic>
 #include <functional>
 #include <sstream>
+#include "csv/row_index.hpp"
 
 namespace BBP {
 namespace CSV {
@@ -95,6 +96,13 @@ struct WriterConfig {
     int compression_level{6};                            // EN: Compression level (1-9) / FR: Niveau de compression (1-9)
     bool compress_in_background{true};                   // EN: Compress in background thread / FR: Comprimer dans un thread en arrière-plan
     
+    // EN: Random access: write a RowIndex sidecar ("<file>.idx") on close, one checkpoint every N data rows
+    //     (0 = off). Only uncompressed file outputs are indexed, offsets into compressed data are not seekable.
+    // FR: Accès aléatoire : écrire un RowIndex annexe ("<fichier>.idx") à la fermeture, un point de reprise
+    //     toutes les N lignes de données (0 = désactivé). Seules les sorties fichier non compressées sont
+    //     indexées, les offsets dans des données compressées ne sont pas accessibles directement.
+    size_t row_index_stride{0};
+    
     // EN: Error handling and recovery
     // FR: Gestion d'erreur et récupération
     bool create_backup{false};              // EN: Create backup before overwriting / FR: Créer une sauvegarde avant écrasement
@@ -374,6 +382,10 @@ public:
     WriterStatistics getStatistics() const;
     void resetStatistics() { stats_.reset(); }
     
+    // EN: Row index of the current or last output (filled when row_index_stride > 0)
+    // FR: Index de lignes de la sortie courante ou précédente (rempli quand row_index_stride > 0)
+    const RowIndex& getRowIndex() const { return row_index_; }
+    
     // EN: Utility methods
     // FR: Méthodes utilitaires
     static std::string escapeField(const std::string& field, const WriterConfig& config = WriterConfig{});
@@ -405,6 +417,7 @@ private:
     // FR: Configuration et état
     WriterConfig config_;                           // EN: Writer configuration / FR: Configuration du writer
     std::string current_filename_;                  // EN: Current output filename / FR: Nom de fichier de sortie actuel
+    CompressionType compression_{CompressionType::NONE}; // EN: Compression of the open output, AUTO resolved / FR: Compression de la sortie ouverte, AUTO résolu
     bool file_open_{false};                        // EN: File open status / FR: État d'ouverture du fichier
     bool header_written_{false};                   // EN: Header written status / FR: État d'écriture de l'en-tête
     
@@ -440,6 +453,14 @@ private:
     // FR: Statistiques et surveillance
     WriterStatistics stats_;                       // EN: Performance statistics / FR: Statistiques de performance
     
+    // EN: Row index built while flushing
+    // FR: Index de lignes construit pendant les flushs
+    RowIndex row_index_;                           // EN: Offsets of every Kth data row / FR: Offsets d'une ligne de données sur K
+    uint64_t output_offset_{0};                    // EN: Uncompressed bytes written so far / FR: Octets non compressés écrits jusqu'ici
+    bool index_header_pending_{false};             // EN: Next formatted row is the header / FR: La prochaine ligne formatée est l'en-tête
+    
+    bool isIndexing() const { return config_.row_index_stride > 0 && compression_ == CompressionType::NONE; }
+    
     // EN: Internal methods
     // FR: Méthodes internes
     WriterError openFileInternal(const std::string& filename);
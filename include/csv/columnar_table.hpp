@@ -0,0 +1,161 @@
+// EN: Columnar in-memory table for the query engine: one contiguous column per field, dictionary encoding for
+//     low-cardinality columns and one string heap shared by every column
+// FR: Table colonnaire en mémoire pour le moteur de requêtes : une colonne contiguë par champ, encodage par
+//     dictionnaire des colonnes à faible cardinalité et un tas de chaînes partagé par toutes les colonnes
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Append-only string storage. Text is copied into large chunks that never move, so the returned views stay
+//     valid for the lifetime of the heap.
+// FR: Stockage de chaînes en ajout seul. Le texte est copié dans de grands blocs qui ne bougent jamais, les vues
+//     retournées restent donc valides pendant toute la durée de vie du tas.
+class StringHeap {
+public:
+    static constexpr size_t kDefaultChunkSize = 1 << 20;
+    static constexpr size_t kMinChunkSize = 4096;
+
+    explicit StringHeap(size_t chunk_size = kDefaultChunkSize) : chunk_size_(chunk_size) {}
+
+    // EN: Non-copyable (views point into the chunks)
+    // FR: Non copiable (les vues pointent dans les blocs)
+    StringHeap(const StringHeap&) = delete;
+    StringHeap& operator=(const StringHeap&) = delete;
+    StringHeap(StringHeap&&) noexcept = default;
+    StringHeap& operator=(StringHeap&&) noexcept = default;
+
+    // EN: Copy text into the heap and return a stable view of the copy (empty text is not stored)
+    // FR: Copie le texte dans le tas et retourne une vue stable de la copie (le texte vide n'est pas stocké)
+    std::string_view store(std::string_view text);
+
+    // EN: Accessors
+    // FR: Accesseurs
+    size_t getBytesUsed() const { return bytes_used_; }
+    size_t getBytesReserved() const { return bytes_reserved_; }
+
+private:
+    std::vector<std::unique_ptr<char[]>> chunks_;   // EN: Storage blocks / FR: Blocs de stockage
+    size_t chunk_size_;                             // EN: Size of a regular block / FR: Taille d'un bloc normal
+    size_t chunk_free_{0};                          // EN: Bytes left in the last block / FR: Octets restants dans le dernier bloc
+    char* cursor_{nullptr};                         // EN: Next free byte / FR: Prochain octet libre
+    size_t bytes_used_{0};                          // EN: Bytes handed out / FR: Octets distribués
+    size_t bytes_reserved_{0};                      // EN: Bytes allocated / FR: Octets alloués
+};
+
+// EN: Table stored column by column. Every column starts dictionary-encoded (16-bit codes into a list of distinct
+//     values, each stored once in the heap) and falls back to plain views into the heap as soon as it holds more
+//     distinct values than the dictionary limit. Low-cardinality columns such as scheme, status_code or
+//     cdn_provider therefore cost two bytes per row. Rows shorter than the header are padded with empty values,
+//     extra fields are dropped. Once built, a table is meant to be shared read-only (std::shared_ptr<const>).
+// FR: Table stockée colonne par colonne. Chaque colonne démarre encodée par dictionnaire (codes 16 bits vers une
+//     liste de valeurs distinctes, chacune stockée une fois dans le tas) et repasse à des vues simples dans le tas
+//     dès qu'elle contient plus de valeurs distinctes que la limite du dictionnaire. Les colonnes à faible
+//     cardinalité comme scheme, status_code ou cdn_provider coûtent donc deux octets par ligne. Les lignes plus
+//     courtes que l'en-tête sont complétées par des valeurs vides, les champs en trop sont ignorés. Une fois
+//     construite, une table est destinée à être partagée en lecture seule (std::shared_ptr<const>).
+class ColumnarTable {
+public:
+    using DictionaryCode = uint16_t;
+    static constexpr size_t kDefaultDictionaryLimit = 4096;
+    static constexpr size_t kMaxDictionaryLimit = 65536;
+
+    explicit ColumnarTable(std::vector<std::string> headers, size_t dictionary_limit = kDefaultDictionaryLimit);
+
+    // EN: Non-copyable (columns hold views into the heap), movable
+    // FR: Non copiable (les colonnes contiennent des vues dans le tas), déplaçable
+    ColumnarTable(const ColumnarTable&) = delete;
+    ColumnarTable& operator=(const ColumnarTable&) = delete;
+    ColumnarTable(ColumnarTable&&) noexcept = default;
+    ColumnarTable& operator=(ColumnarTable&&) noexcept = default;
+
+    // EN: Build a table from row-major data
+    // FR: Construit une table depuis des données en lignes
+    static std::shared_ptr<ColumnarTable> fromRows(const std::vector<std::string>& headers,
+                                                   const std::vector<std::vector<std::string>>& rows,
+                                                   size_t dictionary_limit = kDefaultDictionaryLimit);
+
+    // EN: Table building
+    // FR: Construction de la table
+    void reserve(size_t rows);
+    void appendRow(const std::vector<std::string>& row);
+    void appendRow(const std::vector<std::string_view>& row);
+
+    // EN: New table holding these rows followed by `rows`, leaving this one untouched so readers sharing it are
+    //     never disturbed. The column vectors are copied, the text is not: the new table keeps the heaps of this
+    //     one alive and stores only the appended text in a heap of its own.
+    // FR: Nouvelle table contenant ces lignes suivies de `rows`, celle-ci restant intacte pour que les lecteurs
+    //     qui la partagent ne soient jamais perturbés. Les vecteurs de colonnes sont copiés, le texte non : la
+    //     nouvelle table garde en vie les tas de celle-ci et ne stocke que le texte ajouté dans un tas à elle.
+    std::shared_ptr<ColumnarTable> extended(const std::vector<std::vector<std::string>>& rows) const;
+
+    // EN: Shape and headers
+    // FR: Forme et en-têtes
+    const std::vector<std::string>& getHeaders() const { return headers_; }
+    size_t getRowCount() const { return row_count_; }
+    size_t getColumnCount() const { return columns_.size(); }
+    int getColumnIndex(const std::string& name) const;
+
+    // EN: Extra name for an existing column, such as "table.column" after a join; ignored when the name is taken
+    // FR: Nom supplémentaire d'une colonne existante, comme "table.colonne" après une jointure ; ignoré si le nom est pris
+    void addColumnAlias(const std::string& alias, size_t column);
+
+    // EN: Value access (empty view when out of range); views are valid for the lifetime of the table
+    // FR: Accès aux valeurs (vue vide si hors limites) ; les vues sont valides pendant la durée de vie de la table
+    std::string_view getValue(size_t row, size_t column) const {
+        if (column >= columns_.size() || row >= row_count_) {
+            return {};
+        }
+        const Column& col = columns_[column];
+        return col.dictionary_encoded ? col.dictionary[col.codes[row]] : col.values[row];
+    }
+    std::vector<std::string> getRow(size_t row) const;
+
+    // EN: Encoding details, for operators that work on codes rather than text
+    // FR: Détails d'encodage, pour les opérateurs travaillant sur les codes plutôt que sur le texte
+    bool isDictionaryEncoded(size_t column) const { return columns_.at(column).dictionary_encoded; }
+    const std::vector<std::string_view>& getDictionary(size_t column) const { return columns_.at(column).dictionary; }
+    const std::vector<DictionaryCode>& getCodes(size_t column) const { return columns_.at(column).codes; }
+    const std::vector<std::string_view>& getValues(size_t column) const { return columns_.at(column).values; }
+    size_t getDictionaryLimit() const { return dictionary_limit_; }
+
+    // EN: Bytes held by the heap, the columns and the dictionaries
+    // FR: Octets détenus par le tas, les colonnes et les dictionnaires
+    size_t getMemoryUsage() const;
+
+private:
+    // EN: One column, either codes into a dictionary or plain views
+    // FR: Une colonne, soit des codes vers un dictionnaire soit des vues simples
+    struct Column {
+        bool dictionary_encoded{true};
+        std::vector<DictionaryCode> codes;                                // EN: Per-row codes / FR: Codes par ligne
+        std::vector<std::string_view> dictionary;                         // EN: Distinct values / FR: Valeurs distinctes
+        std::unordered_map<std::string_view, DictionaryCode> lookup;      // EN: Value to code / FR: Valeur vers code
+        std::vector<std::string_view> values;                             // EN: Per-row views when plain / FR: Vues par ligne si simple
+    };
+
+    std::vector<std::string> headers_;                          // EN: Column names / FR: Noms des colonnes
+    std::unordered_map<std::string, size_t> column_index_;      // EN: Name to column / FR: Nom vers colonne
+    std::vector<Column> columns_;                               // EN: Column storage / FR: Stockage des colonnes
+    std::shared_ptr<StringHeap> heap_;                          // EN: Shared text storage / FR: Stockage de texte partagé
+    std::vector<std::shared_ptr<const StringHeap>> base_heaps_; // EN: Heaps of the tables this one extends / FR: Tas des tables que celle-ci prolonge
+    size_t row_count_{0};                                       // EN: Rows appended / FR: Lignes ajoutées
+    size_t dictionary_limit_;                                   // EN: Max distinct values per dictionary / FR: Valeurs distinctes max par dictionnaire
+
+    template<typename Row>
+    void appendFields(const Row& row);
+    void appendValue(Column& column, std::string_view value);
+    void convertToPlain(Column& column);
+};
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,139 @@
+// EN: Streaming gzip/zlib decompression for CSV inputs, inflated on a background thread into double buffers
+// FR: Décompression gzip/zlib en streaming pour les entrées CSV, inflatée sur un thread d'arrière-plan dans un double buffer
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Compression format of an input file, detected from its magic bytes
+// FR: Format de compression d'un fichier d'entrée, détecté par ses octets magiques
+enum class InputCompression {
+    NONE,           // EN: Plain file / FR: Fichier brut
+    GZIP,           // EN: gzip member(s) (1f 8b) / FR: Membre(s) gzip (1f 8b)
+    ZLIB            // EN: zlib stream(s) (RFC 1950 header, as written by BatchWriter) / FR: Flux zlib (en-tête RFC 1950, tel qu'écrit par BatchWriter)
+};
+
+// EN: Inflates a gzip or zlib file on a background thread. The inflater fills one buffer while the consumer
+//     reads the other, so decompression overlaps with parsing. Concatenated members (one per BatchWriter
+//     flush) and a raw UTF-8 BOM in front of the compressed data are both accepted.
+// FR: Inflate un fichier gzip ou zlib sur un thread d'arrière-plan. L'inflateur remplit un buffer pendant que
+//     le consommateur lit l'autre, donc la décompression se superpose au parsing. Les membres concaténés (un
+//     par flush de BatchWriter) et un BOM UTF-8 brut devant les données compressées sont acceptés.
+class DecompressingReader {
+public:
+    // EN: Default size of each decompressed buffer and of the compressed read chunk
+    // FR: Taille par défaut de chaque buffer décompressé et du bloc compressé lu
+    static constexpr size_t kDefaultBufferSize = 1 << 20;
+    static constexpr size_t kInputChunkSize = 256 * 1024;
+
+    explicit DecompressingReader(size_t buffer_size = kDefaultBufferSize);
+    ~DecompressingReader();
+
+    // EN: Non-copyable, non-movable (the inflate thread points back at this object)
+    // FR: Non copiable, non déplaçable (le thread d'inflate pointe vers cet objet)
+    DecompressingReader(const DecompressingReader&) = delete;
+    DecompressingReader& operator=(const DecompressingReader&) = delete;
+
+    // EN: Open the file and start inflating; returns false and sets the last error if it cannot be read
+    // FR: Ouvre le fichier et démarre l'inflate ; retourne false et renseigne la dernière erreur s'il est illisible
+    bool open(const std::string& file_path);
+    void close();
+
+    // EN: Next block of decompressed bytes, valid until the following call. Blocks until the inflater has
+    //     produced it; returns false at end of input or on error (see hasError()).
+    // FR: Bloc suivant d'octets décompressés, valide jusqu'à l'appel suivant. Bloque jusqu'à ce que l'inflateur
+    //     l'ait produit ; retourne false en fin d'entrée ou en cas d'erreur (voir hasError()).
+    bool next(const char*& data, size_t& size);
+
+    // EN: Accessors
+    // FR: Accesseurs
+    bool isOpen() const { return is_open_; }
+    bool hasError() const;
+    std::string getLastError() const;
+    size_t getCompressedBytesRead() const { return compressed_bytes_read_.load(std::memory_order_relaxed); }
+    size_t getDecompressedBytes() const { return decompressed_bytes_.load(std::memory_order_relaxed); }
+
+    // EN: Format detection on a file or on its first bytes (a leading UTF-8 BOM is skipped)
+    // FR: Détection du format sur un fichier ou sur ses premiers octets (un BOM UTF-8 initial est ignoré)
+    static InputCompression detect(const std::string& file_path);
+    static InputCompression detect(const unsigned char* data, size_t size);
+    static bool isCompressed(const std::string& file_path) { return detect(file_path) != InputCompression::NONE; }
+
+private:
+    // EN: One decompressed buffer of the pair
+    // FR: Un buffer décompressé de la paire
+    struct Buffer {
+        std::unique_ptr<char[]> data;
+        size_t size{0};
+    };
+
+    size_t buffer_size_;                        // EN: Capacity of each buffer / FR: Capacité de chaque buffer
+    std::array<Buffer, 2> buffers_;             // EN: Double buffer shared with the inflate thread / FR: Double buffer partagé avec le thread d'inflate
+    size_t produced_{0};                        // EN: Buffers filled by the inflater / FR: Buffers remplis par l'inflateur
+    size_t consumed_{0};                        // EN: Buffers released by the consumer / FR: Buffers libérés par le consommateur
+    bool holding_{false};                       // EN: Consumer currently holds a buffer / FR: Le consommateur détient un buffer
+    bool finished_{false};                      // EN: Inflater reached end of input or failed / FR: L'inflateur a atteint la fin ou échoué
+    bool stop_requested_{false};                // EN: close() asks the inflater to quit / FR: close() demande à l'inflateur de s'arrêter
+    std::string last_error_;                    // EN: Last error message / FR: Dernier message d'erreur
+    mutable std::mutex mutex_;                  // EN: Guards the hand-off state above / FR: Protège l'état de transfert ci-dessus
+    std::condition_variable buffer_ready_;      // EN: Signalled when a buffer is filled / FR: Signalée quand un buffer est rempli
+    std::condition_variable buffer_free_;       // EN: Signalled when a buffer is released / FR: Signalée quand un buffer est libéré
+    std::thread inflate_thread_;                // EN: Background inflater / FR: Inflateur en arrière-plan
+    std::atomic<size_t> compressed_bytes_read_{0};  // EN: Compressed bytes read so far / FR: Octets compressés lus jusqu'ici
+    std::atomic<size_t> decompressed_bytes_{0};     // EN: Bytes inflated so far / FR: Octets inflatés jusqu'ici
+    bool is_open_{false};                       // EN: Open flag / FR: Flag d'ouverture
+
+    void inflateWorker(std::FILE* file);
+    bool acquireBuffer(Buffer*& buffer);
+    void publishBuffer(size_t size);
+    void finish(const std::string& error);
+};
+
+// EN: std::streambuf over a DecompressingReader; get area points straight into the decompressed buffers
+// FR: std::streambuf sur un DecompressingReader ; la zone de lecture pointe directement dans les buffers décompressés
+class DecompressingStreamBuf : public std::streambuf {
+public:
+    explicit DecompressingStreamBuf(DecompressingReader& reader) : reader_(reader) {}
+
+protected:
+    int_type underflow() override;
+
+private:
+    DecompressingReader& reader_;
+};
+
+// EN: Input stream reading a compressed file as plain text; failbit is set if the file cannot be opened
+// FR: Flux d'entrée lisant un fichier compressé comme du texte brut ; failbit est positionné si le fichier ne s'ouvre pas
+class DecompressingIStream : public std::istream {
+public:
+    explicit DecompressingIStream(const std::string& file_path, size_t buffer_size = DecompressingReader::kDefaultBufferSize);
+
+    bool is_open() const { return reader_->isOpen(); }
+    const DecompressingReader& reader() const { return *reader_; }
+
+private:
+    std::unique_ptr<DecompressingReader> reader_;
+    std::unique_ptr<DecompressingStreamBuf> buffer_;
+};
+
+// EN: Open a CSV input for line-based readers: a DecompressingIStream for gzip/zlib files, an ifstream otherwise.
+//     Check the stream state (operator!) to detect open failures.
+// FR: Ouvre une entrée CSV pour les lecteurs ligne par ligne : un DecompressingIStream pour les fichiers gzip/zlib,
+//     un ifstream sinon. Vérifier l'état du flux (operator!) pour détecter les échecs d'ouverture.
+std::unique_ptr<std::istream> openCsvInput(const std::string& file_path);
+
+} // namespace CSV
+} // namespace BBP
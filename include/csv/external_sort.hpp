@@ -0,0 +1,153 @@
+// EN: ORDER BY operators: external merge sort for more rows than fit in memory (sorted runs spilled to disk,
+//     then a k-way merge) and Top-K selection for ORDER BY ... LIMIT
+// FR: Opérateurs ORDER BY : tri fusion externe pour plus de lignes que la mémoire n'en contient (séquences
+//     triées débordées sur disque, puis fusion k-voies) et sélection Top-K pour ORDER BY ... LIMIT
+
+#pragma once
+
+#include "csv/query_engine.hpp"
+#include "csv/spill_directory.hpp"
+#include "csv/top_k.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: ORDER BY comparison of result rows: equal values fall through to the next key, two numbers compare
+//     numerically, anything else compares as text. The numeric reading of each sort cell is computed once per
+//     row (makeKey) instead of inside every comparison. QueryResult::sortBy() and the Top-K paths use it too.
+// FR: Comparaison ORDER BY de lignes de résultat : des valeurs égales passent à la clé suivante, deux nombres se
+//     comparent numériquement, le reste comme du texte. La lecture numérique de chaque cellule de tri est
+//     calculée une fois par ligne (makeKey) au lieu de l'être dans chaque comparaison. QueryResult::sortBy() et
+//     les chemins Top-K l'utilisent aussi.
+class RowOrder {
+public:
+    using Row = std::vector<std::string>;
+    using Key = std::vector<std::optional<double>>;
+
+    RowOrder(const std::vector<std::string>& headers, const std::vector<OrderByColumn>& order_by);
+
+    // EN: False when a sort column is not among the headers
+    // FR: Faux quand une colonne de tri n'est pas dans les en-têtes
+    bool valid() const { return valid_; }
+
+    Key makeKey(const Row& row) const;
+    bool less(const Row& a, const Key& key_a, const Row& b, const Key& key_b) const;
+    
+    // EN: Order of two values of sort key `i` given their texts and numeric readings: negative, zero or positive
+    //     in ORDER BY order (zero for equal texts or equal numbers)
+    // FR: Ordre de deux valeurs de la clé de tri `i` données par leurs textes et lectures numériques : négatif,
+    //     nul ou positif dans l'ordre ORDER BY (nul pour des textes ou des nombres égaux)
+    int compare(size_t i, std::string_view a, const std::optional<double>& number_a,
+                std::string_view b, const std::optional<double>& number_b) const;
+    
+    size_t getKeyCount() const { return columns_.size(); }
+    size_t getColumn(size_t i) const { return columns_[i]; }
+
+private:
+    std::vector<size_t> columns_;           // EN: Sort column per key / FR: Colonne de tri par clé
+    std::vector<bool> descending_;          // EN: Direction per key / FR: Direction par clé
+    bool valid_{true};
+};
+
+// EN: Sort rows within a memory budget. Rows are buffered until the budget is reached, then the buffer is
+//     stable-sorted and written to a run file; finish() merges the runs with a heap, earlier runs first on
+//     ties, so the output is a stable sort of the input. Without any spill, finish() sorts in memory.
+// FR: Trie des lignes dans un budget mémoire. Les lignes sont mises en tampon jusqu'au budget, puis le tampon
+//     est trié de façon stable et écrit dans un fichier de séquence ; finish() fusionne les séquences avec un
+//     tas, les séquences antérieures d'abord en cas d'égalité, la sortie est donc un tri stable de l'entrée.
+//     Sans débordement, finish() trie en mémoire.
+class ExternalSorter {
+public:
+    using Row = RowOrder::Row;
+    using RowSink = std::function<bool(Row&& row)>;   // EN: Returns false to stop / FR: Retourne faux pour arrêter
+
+    ExternalSorter(RowOrder order, size_t memory_budget_bytes,
+                   std::filesystem::path spill_directory = std::filesystem::temp_directory_path());
+
+    // EN: Add a row; IO_ERROR when a run cannot be written
+    // FR: Ajoute une ligne ; IO_ERROR si une séquence ne peut être écrite
+    QueryError add(Row row);
+
+    // EN: Deliver every row in order to `sink`; the sorter is empty afterwards
+    // FR: Transmet chaque ligne dans l'ordre à `sink` ; le trieur est vide ensuite
+    QueryError finish(const RowSink& sink);
+
+    size_t getRowCount() const { return row_count_; }
+    size_t getRunCount() const { return run_count_; }
+    size_t getSpilledBytes() const { return spilled_bytes_; }
+
+private:
+    struct Entry {
+        Row row;
+        RowOrder::Key key;
+    };
+
+    RowOrder order_;
+    size_t memory_budget_bytes_;
+    std::filesystem::path spill_parent_;
+    std::unique_ptr<SpillDirectory> directory_;
+    std::vector<Entry> buffer_;
+    size_t buffered_bytes_{0};
+    size_t row_count_{0};
+    size_t run_count_{0};
+    size_t spilled_bytes_{0};
+
+    void sortBuffer();
+    QueryError spillRun();
+};
+
+// EN: ORDER BY ... LIMIT over result rows: only the first k rows are kept, in a TopK heap ordered by RowOrder
+//     then by arrival, so take() gives the same rows as a stable sort followed by a slice
+// FR: ORDER BY ... LIMIT sur des lignes de résultat : seules les k premières lignes sont gardées, dans un tas
+//     TopK ordonné par RowOrder puis par arrivée, take() donne donc les mêmes lignes qu'un tri stable suivi
+//     d'une découpe
+class RowTopK {
+public:
+    using Row = RowOrder::Row;
+    
+    RowTopK(RowOrder order, size_t k);
+    
+    void add(Row row);
+    
+    // EN: Kept rows in order; the selector is empty afterwards
+    // FR: Lignes gardées dans l'ordre ; le sélecteur est vide ensuite
+    std::vector<Row> take();
+    
+    size_t getRowCount() const { return row_count_; }
+    
+private:
+    struct Entry {
+        Row row;
+        RowOrder::Key key;
+        size_t sequence;
+    };
+    struct EntryLess {
+        const RowOrder* order;
+        bool operator()(const Entry& a, const Entry& b) const;
+    };
+    
+    std::unique_ptr<RowOrder> order_;     // EN: Stable address for the comparator / FR: Adresse stable pour le comparateur
+    TopK<Entry, EntryLess> top_;
+    size_t row_count_{0};
+};
+
+// EN: The first `k` of `rows` (ascending positions in `table`) in ORDER BY order, ties kept in row order.
+//     Sort key i of `order` reads table column `columns[i]`; numeric readings are taken once per dictionary
+//     entry, or once per candidate row, and rows that cannot enter the top are never copied.
+// FR: Les `k` premières lignes de `rows` (positions croissantes dans `table`) dans l'ordre ORDER BY, égalités
+//     gardées dans l'ordre des lignes. La clé de tri i de `order` lit la colonne `columns[i]` de la table ; les
+//     lectures numériques sont faites une fois par entrée de dictionnaire, ou une fois par ligne candidate, et
+//     les lignes qui ne peuvent entrer dans le haut ne sont jamais copiées.
+std::vector<size_t> selectTopRows(const ColumnarTable& table, const std::vector<size_t>& rows,
+                                  const RowOrder& order, const std::vector<size_t>& columns, size_t k);
+
+} // namespace CSV
+} // namespace BBP
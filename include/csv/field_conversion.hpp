@@ -0,0 +1,189 @@
+// EN: Allocation-free, exception-free conversion of CSV field slices to typed values with std::from_chars
+//     (strtod under the C locale for floating-point types where the standard library lacks them)
+// FR: Conversion sans allocation ni exception de tranches de champs CSV en valeurs typées avec std::from_chars
+//     (strtod sous la locale C pour les types flottants là où la bibliothèque standard ne les a pas)
+
+#pragma once
+
+#include <charconv>
+#include <cerrno>
+#include <cmath>
+#include <clocale>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <version>
+
+// EN: std::from_chars for floating-point types is missing from Apple libc++ before LLVM 20, which leaves
+//     __cpp_lib_to_chars undefined; strtod under the C locale stands in for it there
+// FR: std::from_chars pour les types flottants manque dans la libc++ d'Apple avant LLVM 20, qui laisse
+//     __cpp_lib_to_chars indéfini ; strtod sous la locale C le remplace alors
+#ifndef BBP_CSV_FLOAT_FROM_CHARS
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define BBP_CSV_FLOAT_FROM_CHARS 1
+#else
+#define BBP_CSV_FLOAT_FROM_CHARS 0
+#endif
+#endif
+
+#if !BBP_CSV_FLOAT_FROM_CHARS
+#include <locale.h>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+#endif
+
+namespace BBP {
+namespace CSV {
+
+// EN: Field text with surrounding spaces and tabs removed
+// FR: Texte du champ sans les espaces et tabulations qui l'entourent
+inline std::string_view trimField(std::string_view field) noexcept {
+    size_t begin = 0;
+    size_t end = field.size();
+    while (begin < end && (field[begin] == ' ' || field[begin] == '\t')) {
+        ++begin;
+    }
+    while (end > begin && (field[end - 1] == ' ' || field[end - 1] == '\t')) {
+        --end;
+    }
+    return field.substr(begin, end - begin);
+}
+
+// EN: Parse the whole of `text` as a floating-point number the way std::from_chars does (no leading space or
+//     '+', no hexadecimal, out-of-range values rejected); `value` is left untouched on failure
+// FR: Analyse tout `text` comme un nombre flottant à la manière de std::from_chars (ni espace ni '+' initial,
+//     pas d'hexadécimal, valeurs hors limites rejetées) ; `value` n'est pas modifié en cas d'échec
+template<typename T>
+bool parseFloatingPoint(std::string_view text, T& value) noexcept {
+    static_assert(std::is_floating_point_v<T>, "parseFloatingPoint needs a floating-point type");
+    if (text.empty()) {
+        return false;
+    }
+#if BBP_CSV_FLOAT_FROM_CHARS
+    T parsed{};
+    const char* end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, parsed);
+    if (ec != std::errc() || ptr != end) {
+        return false;
+    }
+    value = parsed;
+    return true;
+#else
+    // EN: strtod accepts more than from_chars: leading spaces, a sign of '+' and hexadecimal are refused first
+    // FR: strtod accepte plus que from_chars : espaces initiaux, signe '+' et hexadécimal sont refusés d'abord
+    if (text.front() == '+' || text.front() == ' ' || text.front() == '\t' || text.front() == '\n' ||
+        text.front() == '\r' || text.front() == '\v' || text.front() == '\f' ||
+        text.find_first_of("xX") != std::string_view::npos) {
+        return false;
+    }
+    
+    // EN: strtod reads up to a NUL, so the field is copied; short fields stay on the stack
+    // FR: strtod lit jusqu'à un NUL, le champ est donc copié ; les champs courts restent sur la pile
+    char local[128];
+    std::unique_ptr<char[]> heap;
+    char* buffer = local;
+    if (text.size() >= sizeof(local)) {
+        heap.reset(new (std::nothrow) char[text.size() + 1]);
+        if (!heap) {
+            return false;
+        }
+        buffer = heap.get();
+    }
+    text.copy(buffer, text.size());
+    buffer[text.size()] = '\0';
+    
+    static const locale_t c_locale = newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+    char* end = nullptr;
+    errno = 0;
+    T parsed{};
+    if constexpr (std::is_same_v<T, float>) {
+        parsed = strtof_l(buffer, &end, c_locale);
+    } else if constexpr (std::is_same_v<T, double>) {
+        parsed = strtod_l(buffer, &end, c_locale);
+    } else {
+        parsed = strtold_l(buffer, &end, c_locale);
+    }
+    // EN: Like from_chars, subnormal results are kept; only overflow and underflow to zero are out of range
+    // FR: Comme avec from_chars, les résultats sous-normaux sont gardés ; seuls le dépassement et le
+    //     soupassement vers zéro sont hors limites
+    if (end != buffer + text.size() || (errno == ERANGE && (parsed == T{0} || std::isinf(parsed)))) {
+        return false;
+    }
+    value = parsed;
+    return true;
+#endif
+}
+
+// EN: Convert a field to T and return true on success; `value` is left untouched on failure. Supported types are
+//     integers, float/double, bool (true/false, 1/0, yes/no, on/off) and std::string_view (returned as is).
+//     Numbers must fill the whole field apart from surrounding spaces: "12abc", "12.5" as an integer, empty
+//     fields and out-of-range values are rejected. A leading '+' is accepted.
+// FR: Convertit un champ en T et retourne true en cas de succès ; `value` n'est pas modifié en cas d'échec. Types
+//     supportés : entiers, float/double, bool (true/false, 1/0, yes/no, on/off) et std::string_view (retourné tel
+//     quel). Les nombres doivent occuper tout le champ hormis les espaces autour : "12abc", "12.5" comme entier,
+//     les champs vides et les valeurs hors limites sont rejetés. Un '+' initial est accepté.
+template<typename T>
+bool parseField(std::string_view field, T& value) noexcept {
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        value = field;
+        return true;
+    } else if constexpr (std::is_same_v<T, bool>) {
+        const std::string_view text = trimField(field);
+        if (text == "true" || text == "1" || text == "yes" || text == "on") {
+            value = true;
+            return true;
+        }
+        if (text == "false" || text == "0" || text == "no" || text == "off") {
+            value = false;
+            return true;
+        }
+        return false;
+    } else if constexpr (std::is_integral_v<T> || std::is_floating_point_v<T>) {
+        std::string_view text = trimField(field);
+        if (!text.empty() && text.front() == '+') {
+            text.remove_prefix(1);
+            // EN: from_chars would accept "+-5" once the '+' is gone
+            // FR: from_chars accepterait "+-5" une fois le '+' retiré
+            if (!text.empty() && text.front() == '-') {
+                return false;
+            }
+        }
+        if (text.empty()) {
+            return false;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            return parseFloatingPoint(text, value);
+        } else {
+            T parsed{};
+            const char* end = text.data() + text.size();
+            auto [ptr, ec] = std::from_chars(text.data(), end, parsed);
+            if (ec != std::errc() || ptr != end) {
+                return false;
+            }
+            value = parsed;
+            return true;
+        }
+    } else {
+        static_assert(sizeof(T) == 0, "Unsupported type for field conversion");
+        return false;
+    }
+}
+
+// EN: Convenience form returning std::nullopt when the field does not convert
+// FR: Forme pratique retournant std::nullopt quand le champ ne se convertit pas
+template<typename T>
+std::optional<T> parseFieldAs(std::string_view field) noexcept {
+    T value{};
+    if (!parseField(field, value)) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,99 @@
+// EN: Build/probe hash join between two columnar tables, with a partitioned (Grace) spill path
+// FR: Jointure par hachage construction/sondage entre deux tables colonnaires, avec repli partitionné (Grace) sur disque
+
+#pragma once
+
+#include "csv/columnar_table.hpp"
+#include "csv/query_engine.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Equi-join of one key column per side. The side with fewer rows is hashed (build side) and the other one
+//     streams through the hash table (probe side); outer joins keep track of unmatched build rows and emit them
+//     at the end, so any join type works whichever side is built. Keys that are empty or spelled NULL/null never
+//     match. When the estimated hash table exceeds the memory budget, both key columns are first partitioned by
+//     hash into spill files and each partition is then joined on its own, keeping one partition in memory at
+//     a time. The budget is not a hard bound: a skewed key that sends most rows to one partition still loads
+//     that whole partition. Without ORDER BY the output follows the probe side order for an in-memory join and
+//     is unspecified once the join is partitioned.
+// FR: Équi-jointure sur une colonne clé de chaque côté. Le côté ayant le moins de lignes est haché (côté
+//     construction) et l'autre passe dans la table de hachage (côté sondage) ; les jointures externes suivent
+//     les lignes de construction sans correspondance et les émettent à la fin, donc chaque type de jointure
+//     fonctionne quel que soit le côté construit. Les clés vides ou écrites NULL/null ne correspondent jamais.
+//     Quand la table de hachage estimée dépasse le budget mémoire, les deux colonnes clés sont d'abord
+//     partitionnées par hachage dans des fichiers de débordement puis chaque partition est jointe séparément,
+//     une seule partition restant en mémoire à la fois. Le budget n'est pas une borne stricte : une clé
+//     déséquilibrée qui envoie la plupart des lignes dans une partition charge quand même toute cette partition.
+//     Sans ORDER BY la sortie suit l'ordre du côté sondage pour une jointure en mémoire et n'est pas spécifiée
+//     une fois la jointure partitionnée.
+class HashJoin {
+public:
+    static constexpr size_t kNoRow = std::numeric_limits<size_t>::max();
+    static constexpr size_t kEntryOverheadBytes = 64;   // EN: Hash node + chain + flags per build row / FR: Nœud de hachage + chaînage + drapeaux par ligne construite
+    static constexpr size_t kMaxPartitions = 64;
+
+    // EN: Joined row pairs; kNoRow on the side an outer join pads with NULL
+    // FR: Paires de lignes jointes ; kNoRow du côté qu'une jointure externe complète par NULL
+    struct Pairs {
+        std::vector<size_t> left;
+        std::vector<size_t> right;
+    };
+
+    HashJoin(JoinClause::Type type, size_t memory_budget_bytes,
+             std::filesystem::path spill_directory = std::filesystem::temp_directory_path());
+
+    // EN: Join left[left_column] = right[right_column] into `pairs`; IO_ERROR when spill files cannot be used
+    // FR: Joint left[left_column] = right[right_column] dans `pairs` ; IO_ERROR si les fichiers de débordement sont inutilisables
+    QueryError execute(const ColumnarTable& left, size_t left_column,
+                       const ColumnarTable& right, size_t right_column, Pairs& pairs);
+
+    // EN: Planning helpers, shared with EXPLAIN
+    // FR: Aides à la planification, partagées avec EXPLAIN
+    static bool buildOnLeft(size_t left_rows, size_t right_rows) { return left_rows < right_rows; }
+    static size_t estimateBuildBytes(const ColumnarTable& table, size_t column);
+    static size_t partitionCount(size_t build_bytes, size_t memory_budget_bytes);
+
+    // EN: What the last execute() did
+    // FR: Ce qu'a fait le dernier execute()
+    bool builtLeft() const { return built_left_; }
+    size_t getPartitionCount() const { return partitions_; }      // EN: 0 when joined in memory / FR: 0 si jointure en mémoire
+    size_t getSpilledBytes() const { return spilled_bytes_; }
+
+private:
+    JoinClause::Type type_;
+    size_t memory_budget_bytes_;
+    std::filesystem::path spill_directory_;
+    bool built_left_{false};
+    size_t partitions_{0};
+    size_t spilled_bytes_{0};
+
+    // EN: One side of the join as seen by the algorithm
+    // FR: Un côté de la jointure tel que vu par l'algorithme
+    struct Side {
+        const ColumnarTable* table;
+        size_t column;
+        bool keep_unmatched;    // EN: Outer on this side / FR: Externe de ce côté
+    };
+
+    void joinInMemory(const Side& build, const Side& probe, Pairs& pairs) const;
+    QueryError joinPartitioned(const Side& build, const Side& probe, Pairs& pairs);
+    void emit(size_t build_row, size_t probe_row, Pairs& pairs) const;
+};
+
+// EN: Materialize joined pairs as one table: the columns of `left` then those of `right`, named by `headers`,
+//     with NULL cells on the padded side of outer rows
+// FR: Matérialise les paires jointes en une table : les colonnes de `left` puis celles de `right`, nommées par
+//     `headers`, avec des cellules NULL du côté complété des lignes externes
+std::shared_ptr<ColumnarTable> materializeJoin(const ColumnarTable& left, const ColumnarTable& right,
+                                               const HashJoin::Pairs& pairs, std::vector<std::string> headers,
+                                               size_t dictionary_limit = ColumnarTable::kDefaultDictionaryLimit);
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,131 @@
+// EN: Compressed positional inverted index for FULL_TEXT columns: delta + varint postings with skip entries,
+//     galloping intersection for AND and phrase queries, heap union for OR
+// FR: Index inversé positionnel compressé pour les colonnes FULL_TEXT : listes delta + varint avec entrées de
+//     saut, intersection galopante pour AND et les phrases, union par tas pour OR
+
+#pragma once
+
+#include "csv/query_engine.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Encoded postings of one term: the rows holding it in ascending order, each with the token positions of the
+//     term in that row.
+//       varint row_count, varint skip_count
+//       skip_count x (uint64 previous_row, uint64 offset)   entry k * kSkipInterval (k >= 1), for galloping
+//       row_count x entry: varint row delta, varint position count, varint position deltas
+//     A rare term costs a few bytes in all; a frequent one about two bytes per row and one per extra position.
+// FR: Liste encodée d'un terme : les lignes qui le contiennent en ordre croissant, chacune avec les positions de
+//     token du terme dans la ligne.
+//       varint row_count, varint skip_count
+//       skip_count x (uint64 previous_row, uint64 offset)   entrée k * kSkipInterval (k >= 1), pour galoper
+//       row_count x entrée : varint delta de ligne, varint nombre de positions, varint deltas de positions
+//     Un terme rare coûte quelques octets en tout ; un terme fréquent environ deux octets par ligne et un par
+//     position supplémentaire.
+class PostingEncoder {
+public:
+    static constexpr size_t kSkipInterval = 64;
+
+    // EN: Rows in ascending order, positions ascending within a row
+    // FR: Lignes en ordre croissant, positions croissantes dans une ligne
+    void add(size_t row, uint32_t position);
+    std::string finish();
+
+private:
+    std::string entries_;
+    std::vector<uint64_t> skips_;           // EN: (previous_row, offset) pairs / FR: Paires (previous_row, offset)
+    std::vector<uint32_t> positions_;       // EN: Positions of the open row / FR: Positions de la ligne ouverte
+    size_t open_row_{0};
+    size_t previous_row_{0};
+    size_t row_count_{0};
+
+    void flushRow();
+};
+
+// EN: Forward reader of encoded postings; seek() gallops over the skip entries before decoding
+// FR: Lecteur en avant d'une liste encodée ; seek() galope sur les entrées de saut avant de décoder
+class PostingCursor {
+public:
+    explicit PostingCursor(std::string_view encoded);
+
+    bool atEnd() const { return at_end_; }
+    size_t row() const { return row_; }
+    size_t getRowCount() const { return row_count_; }
+
+    void next();
+
+    // EN: Move to the first row >= target (never backwards)
+    // FR: Avance à la première ligne >= target (jamais en arrière)
+    void seek(size_t target);
+
+    // EN: Token positions of the term in the current row
+    // FR: Positions de token du terme dans la ligne courante
+    void positions(std::vector<uint32_t>& out) const;
+
+private:
+    const uint8_t* skips_{nullptr};
+    const uint8_t* entries_{nullptr};
+    const uint8_t* end_{nullptr};
+    const uint8_t* next_{nullptr};          // EN: Next entry to decode / FR: Prochaine entrée à décoder
+    const uint8_t* positions_at_{nullptr};  // EN: Position deltas of the current row / FR: Deltas de positions de la ligne courante
+    size_t row_count_{0};
+    size_t skip_count_{0};
+    size_t index_{0};                       // EN: Entry number of the current row / FR: Numéro d'entrée de la ligne courante
+    size_t row_{0};
+    size_t position_count_{0};
+    bool at_end_{true};
+
+    uint64_t skipValue(size_t skip, size_t field) const;
+    void decode(size_t previous_row);
+};
+
+// EN: Rows matching `mode` over the encoded postings of the query terms, in ascending order. ALL_TERMS and PHRASE
+//     leapfrog the cursors from the rarest list, galloping each one to the current candidate; PHRASE then needs
+//     the terms at consecutive positions, in the order of `postings`. ANY_TERM merges the lists through a heap.
+// FR: Lignes satisfaisant `mode` sur les listes encodées des termes de la requête, en ordre croissant. ALL_TERMS
+//     et PHRASE font progresser les curseurs en saute-mouton depuis la liste la plus rare, chacun galopant
+//     jusqu'au candidat courant ; PHRASE exige ensuite les termes à des positions consécutives, dans l'ordre de
+//     `postings`. ANY_TERM fusionne les listes par un tas.
+std::vector<size_t> matchPostings(const std::vector<std::string_view>& postings, TextMatch mode);
+
+// EN: Term dictionary of a column: built row by row, then frozen into sorted terms and one buffer of encoded
+//     postings
+// FR: Dictionnaire des termes d'une colonne : construit ligne par ligne, puis figé en termes triés et un tampon
+//     unique de listes encodées
+class InvertedIndex {
+public:
+    // EN: Building: the tokens of each row, rows in ascending order, then finish()
+    // FR: Construction : les tokens de chaque ligne, lignes en ordre croissant, puis finish()
+    void add(size_t row, const std::vector<std::string>& tokens);
+    void finish();
+
+    // EN: Encoded postings of `term` (empty when absent)
+    // FR: Liste encodée de `term` (vide si absent)
+    std::string_view find(std::string_view term) const;
+
+    // EN: Accessors (after finish())
+    // FR: Accesseurs (après finish())
+    size_t getTermCount() const { return term_offsets_.empty() ? 0 : term_offsets_.size() - 1; }
+    std::string_view getTerm(size_t i) const;
+    std::string_view getPostings(size_t i) const;
+    size_t getPostingCount() const { return posting_count_; }
+    size_t getMemoryUsage() const;
+
+private:
+    std::unordered_map<std::string, PostingEncoder> building_;
+    std::string terms_;                     // EN: Sorted terms, concatenated / FR: Termes triés, concaténés
+    std::string postings_;                  // EN: Encoded postings in term order / FR: Listes encodées dans l'ordre des termes
+    std::vector<size_t> term_offsets_;
+    std::vector<size_t> posting_offsets_;
+    size_t posting_count_{0};               // EN: (row, position) pairs indexed / FR: Paires (ligne, position) indexées
+};
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,64 @@
+// EN: Read-only memory-mapped file wrapper used by the zero-copy CSV parsing paths
+// FR: Wrapper de fichier mappé en mémoire en lecture seule utilisé par les chemins de parsing CSV zero-copy
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Access pattern hints forwarded to madvise()
+// FR: Indications de motif d'accès transmises à madvise()
+enum class MappingAdvice {
+    NORMAL,         // EN: No particular hint / FR: Aucune indication particulière
+    SEQUENTIAL,     // EN: Pages read once, front to back / FR: Pages lues une fois, du début à la fin
+    RANDOM,         // EN: Random access (index lookups) / FR: Accès aléatoire (recherches d'index)
+    WILL_NEED       // EN: Prefetch pages now / FR: Précharger les pages maintenant
+};
+
+// EN: RAII read-only mapping of a whole file. Empty files are valid and map to an empty view.
+// FR: Mapping RAII en lecture seule d'un fichier entier. Les fichiers vides sont valides et donnent une vue vide.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // EN: Non-copyable, movable
+    // FR: Non copiable, déplaçable
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // EN: Map the file; returns false and sets the last error on failure
+    // FR: Mappe le fichier ; retourne false et renseigne la dernière erreur en cas d'échec
+    bool open(const std::string& file_path, MappingAdvice advice = MappingAdvice::SEQUENTIAL);
+    void close();
+
+    // EN: Apply an access hint to the whole mapping or to a byte range of it
+    // FR: Applique une indication d'accès à tout le mapping ou à une plage d'octets
+    void advise(MappingAdvice advice);
+    void advise(MappingAdvice advice, size_t offset, size_t length);
+
+    // EN: Accessors
+    // FR: Accesseurs
+    bool isOpen() const { return is_open_; }
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::string_view view() const { return std::string_view(data_, size_); }
+    const std::string& getPath() const { return path_; }
+    const std::string& getLastError() const { return last_error_; }
+
+private:
+    const char* data_{nullptr};             // EN: Start of the mapping / FR: Début du mapping
+    size_t size_{0};                        // EN: Mapped length in bytes / FR: Longueur mappée en octets
+    bool is_open_{false};                   // EN: Open flag (true for empty files too) / FR: Flag d'ouverture (vrai aussi pour fichiers vides)
+    std::string path_;                      // EN: Source file path / FR: Chemin du fichier source
+    std::string last_error_;                // EN: Last error message / FR: Dernier message d'erreur
+};
+
+} // namespace CSV
+} // namespace BBP
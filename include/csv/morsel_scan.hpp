@@ -0,0 +1,41 @@
+// EN: Morsel-driven parallel execution of table scans on a shared BBP::ThreadPool
+// FR: Exécution parallèle par morceaux des parcours de table sur un BBP::ThreadPool partagé
+
+#pragma once
+
+#include "infrastructure/threading/thread_pool.hpp"
+#include <cstddef>
+#include <functional>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Rows per morsel of a table scan: a multiple of the filter batch, small enough for threads to balance
+//     uneven selectivity, large enough to amortize claiming it
+// FR: Lignes par morceau d'un parcours de table : un multiple du lot du filtre, assez petit pour que les threads
+//     équilibrent une sélectivité inégale, assez grand pour amortir sa réclamation
+constexpr size_t kScanMorselRows = 16 * 1024;
+
+// EN: Split [0, item_count) into fixed morsels of `morsel_size` items and run body(morsel, begin, end) on each,
+//     on the calling thread plus up to `helpers` tasks of `pool` (nullptr = calling thread only). Threads claim
+//     morsels from a shared counter, so a slow morsel never holds the others back; a body writes its output to
+//     the slot of its morsel number, which keeps results in table order without a merge sort. Returns the
+//     number of threads that took part. The first exception thrown by a body is rethrown once every thread
+//     has stopped.
+// FR: Découpe [0, item_count) en morceaux fixes de `morsel_size` éléments et exécute body(morceau, début, fin)
+//     sur chacun, sur le thread appelant plus au plus `helpers` tâches de `pool` (nullptr = thread appelant
+//     seul). Les threads réclament les morceaux à un compteur partagé, un morceau lent ne retient donc jamais
+//     les autres ; un corps écrit sa sortie dans la case de son numéro de morceau, ce qui garde les résultats
+//     dans l'ordre de la table sans tri de fusion. Retourne le nombre de threads ayant participé. La première
+//     exception levée par un corps est relancée une fois tous les threads arrêtés.
+size_t forEachMorsel(ThreadPool* pool, size_t helpers, size_t item_count, size_t morsel_size,
+                     const std::function<void(size_t morsel, size_t begin, size_t end)>& body);
+
+// EN: Number of morsels forEachMorsel() cuts `item_count` items into
+// FR: Nombre de morceaux en lesquels forEachMorsel() découpe `item_count` éléments
+inline size_t morselCount(size_t item_count, size_t morsel_size) {
+    return (item_count + morsel_size - 1) / morsel_size;
+}
+
+} // namespace CSV
+} // namespace BBP
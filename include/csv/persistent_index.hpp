@@ -0,0 +1,104 @@
+// EN: On-disk IndexManager indexes: sorted keys and row-id postings saved next to the CSV and memory-mapped back
+// FR: Index d'IndexManager sur disque : clés triées et listes de lignes enregistrées à côté du CSV puis remappées
+
+#pragma once
+
+#include "csv/mapped_file.hpp"
+#include "csv/query_engine.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Fingerprint `csv_file` into `source` (size, mtime, then a hash of the whole mapped content, which reads
+//     the file once at memory speed, far cheaper than parsing it). False when the file cannot be read.
+// FR: Relève l'empreinte de `csv_file` dans `source` (taille, mtime, puis une empreinte de tout le contenu mappé,
+//     qui lit le fichier une fois à la vitesse mémoire, bien moins cher que de l'analyser). Faux si le fichier
+//     ne peut être lu.
+bool readIndexSource(const std::string& csv_file, IndexSource& source);
+
+// EN: One index of one column, stored as a single file in native byte order (a local cache, not an exchange
+//     format):
+//       header      magic, version, index type, source fingerprint, row/key/posting counts, name sizes,
+//                   tokenizer options
+//       names       column name, then tokenizer name (FULL_TEXT only), both checked by open(); the two together
+//                   are padded to 8 bytes
+//       key_offsets key_count + 1 offsets into the key bytes
+//       postings    key_count + 1 offsets into the postings, then the postings of every key: uint32 row ids in
+//                   ascending order, or for FULL_TEXT the bytes encoded by PostingEncoder; padded to 8 bytes
+//       keys        the distinct keys (values or tokens) concatenated in byte order
+//     open() maps the file and checks it against the table's source without reading the postings: a lookup is
+//     a binary search over the keys that touches O(log n) pages.
+// FR: Un index d'une colonne, stocké dans un seul fichier en ordre d'octets natif (un cache local, pas un
+//     format d'échange) :
+//       en-tête     magic, version, type d'index, empreinte de la source, nombres de lignes/clés/entrées, tailles
+//                   des noms, options du tokeniseur
+//       noms        nom de la colonne, puis nom du tokeniseur (FULL_TEXT seulement), tous deux vérifiés par
+//                   open() ; les deux ensemble sont complétés à 8 octets
+//       key_offsets key_count + 1 offsets dans les octets des clés
+//       postings    key_count + 1 offsets dans les listes, puis la liste de chaque clé : numéros de lignes
+//                   uint32 croissants, ou pour FULL_TEXT les octets encodés par PostingEncoder ; complété à 8 octets
+//       clés        les clés distinctes (valeurs ou tokens) concaténées dans l'ordre des octets
+//     open() mappe le fichier et le vérifie contre la source de la table sans lire les listes : une recherche
+//     est une dichotomie sur les clés qui touche O(log n) pages.
+class PersistentIndex {
+public:
+    // EN: A key and its rows, or its encoded postings, as handed to save() in ascending key order
+    // FR: Une clé et ses lignes, ou sa liste encodée, telles que passées à save() dans l'ordre croissant des clés
+    using Entry = std::pair<std::string_view, const std::vector<size_t>*>;
+    using EncodedEntry = std::pair<std::string_view, std::string_view>;
+
+    // EN: Index file of `column` of a table read from `csv_file`: "<csv_file>.<column>.<type>.bbpidx"
+    // FR: Fichier d'index de `column` d'une table lue depuis `csv_file` : "<csv_file>.<column>.<type>.bbpidx"
+    static std::string pathFor(const std::string& csv_file, const std::string& column, IndexType type);
+
+    // EN: Write the index (temporary file then rename). INDEX_ERROR for more rows than uint32 row ids hold,
+    //     IO_ERROR when the file cannot be written.
+    // FR: Écrit l'index (fichier temporaire puis renommage). INDEX_ERROR pour plus de lignes que des numéros
+    //     uint32 n'en contiennent, IO_ERROR si le fichier ne peut être écrit.
+    static QueryError save(const std::string& index_path, const IndexSource& source, const IndexConfig& config,
+                           size_t row_count, const std::vector<Entry>& entries);
+    static QueryError save(const std::string& index_path, const IndexSource& source, const IndexConfig& config,
+                           size_t row_count, const std::vector<EncodedEntry>& entries);
+
+    // EN: Map an index file; false when it is missing, malformed, built with other options or for another
+    //     version of the source (different size, mtime, content hash or row count)
+    // FR: Mappe un fichier d'index ; faux s'il manque, est malformé, a été construit avec d'autres options ou
+    //     pour une autre version de la source (taille, mtime, empreinte ou nombre de lignes différents)
+    bool open(const std::string& index_path, const IndexSource& source, const IndexConfig& config,
+              size_t row_count);
+
+    // EN: Rows holding `key` in ascending order (empty when absent)
+    // FR: Lignes contenant `key` en ordre croissant (vide si absente)
+    std::vector<size_t> find(std::string_view key) const;
+    
+    // EN: Encoded postings of `key` in a FULL_TEXT index (empty when absent)
+    // FR: Liste encodée de `key` dans un index FULL_TEXT (vide si absente)
+    std::string_view findEncoded(std::string_view key) const;
+
+    // EN: Accessors
+    // FR: Accesseurs
+    bool isOpen() const { return file_.isOpen(); }
+    size_t getKeyCount() const { return key_count_; }
+    std::string_view getKey(size_t i) const;
+    size_t getMappedBytes() const { return file_.size(); }
+
+private:
+    MappedFile file_;                       // EN: The whole index file / FR: Tout le fichier d'index
+    size_t key_count_{0};                   // EN: Distinct keys / FR: Clés distinctes
+    const char* key_offsets_{nullptr};      // EN: uint64[key_count + 1] / FR: uint64[key_count + 1]
+    const char* posting_offsets_{nullptr};  // EN: uint64[key_count + 1] / FR: uint64[key_count + 1]
+    const char* postings_{nullptr};         // EN: uint32 row ids or encoded bytes / FR: Numéros de lignes uint32 ou octets encodés
+    const char* keys_{nullptr};             // EN: Concatenated keys / FR: Clés concaténées
+    
+    size_t lowerBound(std::string_view key) const;
+    bool postingRange(size_t key, uint64_t& begin, uint64_t& end) const;
+};
+
+} // namespace CSV
+} // namespace BBP
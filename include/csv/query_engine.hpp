@@ -13,9 +13,14 @@
 #include <chrono>
 #include <mutex>
 #include <atomic>
+#include <type_traits>
 #include <variant>
+#include "csv/columnar_table.hpp"
 
 namespace BBP {
+
+class ThreadPool;
+
 namespace CSV {
 
 // EN: Forward declarations
@@ -23,6 +28,14 @@ namespace CSV {
 class QueryResult;
 class QueryExecutor;
 class IndexManager;
+class PersistentIndex;
+class InvertedIndex;
+class ZoneMap;
+class TableStatistics;
+class ResultCache;
+struct SourceSignature;
+struct PlanNode;
+struct QueryPlan;
 
 // EN: SQL operator types for query processing
 // FR: Types d'opérateurs SQL pour traitement de requêtes
@@ -61,6 +74,14 @@ enum class IndexType {
     COMPOSITE          // EN: Multi-column composite index / FR: Index composé multi-colonnes
 };
 
+// EN: How the terms of a full-text search combine
+// FR: Façon dont se combinent les termes d'une recherche texte intégral
+enum class TextMatch {
+    ALL_TERMS = 0,     // EN: Every term in the cell / FR: Chaque terme dans la cellule
+    ANY_TERM,          // EN: At least one term / FR: Au moins un terme
+    PHRASE             // EN: The terms consecutive and in order / FR: Les termes consécutifs et dans l'ordre
+};
+
 // EN: Aggregation function types
 // FR: Types de fonctions d'agrégation
 enum class AggregateFunction {
@@ -111,6 +132,16 @@ struct WhereCondition {
     LogicalOperator logical_op = LogicalOperator::AND;  // EN: Logical connector / FR: Connecteur logique
 };
 
+// EN: Position of a "?" placeholder in the WHERE clause, in the order the placeholders are written
+// FR: Position d'un paramètre « ? » dans la clause WHERE, dans l'ordre où les paramètres sont écrits
+struct QueryParameter {
+    enum class Slot { VALUE, RANGE_START, RANGE_END, IN_VALUE, PATTERN };
+    
+    size_t condition = 0;                  // EN: Index in SqlQuery::where / FR: Indice dans SqlQuery::where
+    Slot slot = Slot::VALUE;
+    size_t in_index = 0;                   // EN: Position in the IN list / FR: Position dans la liste IN
+};
+
 // EN: SQL SELECT column specification
 // FR: Spécification de colonne SELECT SQL
 struct SelectColumn {
@@ -154,6 +185,7 @@ struct SqlQuery {
     // FR: Fonctionnalités avancées
     std::vector<JoinClause> joins;         // EN: JOIN clauses / FR: Clauses JOIN
     bool distinct_query = false;           // EN: SELECT DISTINCT / FR: SELECT DISTINCT
+    std::vector<QueryParameter> parameters;  // EN: Unbound "?" placeholders / FR: Paramètres « ? » non liés
     
     // EN: Query metadata
     // FR: Métadonnées de requête
@@ -172,6 +204,17 @@ struct IndexConfig {
     std::string tokenizer = "standard";    // EN: Tokenizer for full-text index / FR: Tokeniseur pour index texte intégral
 };
 
+// EN: CSV file a loaded table was read from, fingerprinted before the read: persisted indexes of the table are
+//     only reused while the file still has this size, modification time and content hash
+// FR: Fichier CSV d'où une table chargée a été lue, relevé avant la lecture : les index persistés de la table
+//     ne sont réutilisés que tant que le fichier garde cette taille, date de modification et empreinte de contenu
+struct IndexSource {
+    std::string csv_file;                  // EN: Source file path / FR: Chemin du fichier source
+    uint64_t size = 0;                     // EN: File size in bytes / FR: Taille du fichier en octets
+    int64_t mtime = 0;                     // EN: Modification time (file clock ticks) / FR: Date de modification (ticks de l'horloge fichier)
+    uint64_t content_hash = 0;             // EN: Hash of the whole content / FR: Empreinte de tout le contenu
+};
+
 // EN: Query execution statistics
 // FR: Statistiques d'exécution de requête
 struct QueryStatistics {
@@ -181,10 +224,12 @@ struct QueryStatistics {
     size_t rows_examined = 0;              // EN: Total rows examined / FR: Nombre total de lignes examinées
     size_t rows_returned = 0;              // EN: Rows returned in result / FR: Lignes retournées dans le résultat
     size_t indexes_used = 0;               // EN: Number of indexes used / FR: Nombre d'index utilisés
+    size_t blocks_skipped = 0;             // EN: Row blocks a scan skipped through zone maps / FR: Blocs de lignes sautés par un parcours grâce aux zone maps
     size_t memory_used_bytes = 0;          // EN: Memory used during execution / FR: Mémoire utilisée pendant l'exécution
     bool query_cached = false;             // EN: Whether result was cached / FR: Si le résultat était en cache
     std::vector<std::string> index_hits;   // EN: Indexes that were used / FR: Index qui ont été utilisés
     std::string execution_plan;            // EN: Query execution plan / FR: Plan d'exécution de requête
+    std::shared_ptr<const PlanNode> plan_tree;  // EN: Operators with estimated and actual rows / FR: Opérateurs avec lignes estimées et réelles
 };
 
 // EN: Query result container
@@ -202,8 +247,8 @@ public:
     void addRow(std::vector<std::string>&& row);
     
     const std::vector<std::string>& getHeaders() const { return headers_; }
-    const std::vector<std::vector<std::string>>& getRows() const { return rows_; }
-    size_t getRowCount() const { return rows_.size(); }
+    const std::vector<std::vector<std::string>>& getRows() const { return rows(); }
+    size_t getRowCount() const { return rows().size(); }
     size_t getColumnCount() const { return headers_.size(); }
     
     // EN: Data access by index
@@ -235,16 +280,25 @@ public:
     void setStatistics(const QueryStatistics& stats) { statistics_ = stats; }
     const QueryStatistics& getStatistics() const { return statistics_; }
     
-    bool isEmpty() const { return rows_.empty(); }
+    bool isEmpty() const { return rows().empty(); }
     void clear();
     
 private:
+    using Rows = std::vector<std::vector<std::string>>;
+    
     std::vector<std::string> headers_;
-    std::vector<std::vector<std::string>> rows_;
+    
+    // EN: Shared by the copies of a result, so a cached result is handed out without copying its rows; cloned
+    //     by the first write while shared
+    // FR: Partagées par les copies d'un résultat, un résultat en cache est donc rendu sans copier ses lignes ;
+    //     clonées par la première écriture tant qu'elles sont partagées
+    std::shared_ptr<Rows> rows_;
     std::unordered_map<std::string, size_t> column_index_map_;
     QueryStatistics statistics_;
     
     void buildColumnIndexMap();
+    const Rows& rows() const;
+    Rows& mutableRows();
 };
 
 // EN: SQL query parser
@@ -285,6 +339,10 @@ private:
     QueryError parseLimit(const std::string& sql, size_t& pos, SqlQuery& query);
     QueryError parseJoin(const std::string& sql, size_t& pos, SqlQuery& query);
     
+    // EN: Consume a "?" placeholder for the given slot of the condition being parsed, if one is there
+    // FR: Consomme un paramètre « ? » pour l'emplacement donné de la condition en cours d'analyse, s'il y en a un
+    bool parsePlaceholder(const std::string& sql, size_t& pos, SqlQuery& query, QueryParameter parameter);
+    
     // EN: Token parsing utilities
     // FR: Utilitaires d'analyse de tokens
     std::string parseIdentifier(const std::string& sql, size_t& pos);
@@ -308,7 +366,7 @@ public:
     // EN: Constructor
     // FR: Constructeur
     IndexManager() = default;
-    ~IndexManager() = default;
+    ~IndexManager();
     
     // EN: Index creation and management
     // FR: Création et gestion d'index
@@ -325,6 +383,13 @@ public:
     std::vector<size_t> findRowsByPattern(const std::string& table, const std::string& column,
                                          const std::string& pattern, bool regex = false) const;
     
+    // EN: Rows of a FULL_TEXT indexed column matching the terms of `text` (split by the index tokenizer), in
+    //     ascending order; empty when the column has no FULL_TEXT index
+    // FR: Lignes d'une colonne indexée FULL_TEXT correspondant aux termes de `text` (découpé par le tokeniseur de
+    //     l'index), en ordre croissant ; vide si la colonne n'a pas d'index FULL_TEXT
+    std::vector<size_t> findRowsByText(const std::string& table, const std::string& column,
+                                      const std::string& text, TextMatch mode) const;
+    
     // EN: Index optimization
     // FR: Optimisation d'index
     void optimizeIndexes(const std::string& table);
@@ -336,53 +401,128 @@ public:
     size_t getIndexMemoryUsage(const std::string& table) const;
     std::vector<std::string> getIndexedColumns(const std::string& table) const;
     
-    // EN: Data loading for indexing
-    // FR: Chargement de données pour indexation
+    // EN: Data loading for indexing. The columnar overload shares the caller's table instead of copying it.
+    // FR: Chargement de données pour indexation. La surcharge colonnaire partage la table de l'appelant au lieu de la copier.
     QueryError loadTableData(const std::string& table, const std::vector<std::string>& headers,
                             const std::vector<std::vector<std::string>>& data);
+    QueryError loadTableData(const std::string& table, std::shared_ptr<const ColumnarTable> data);
+    std::shared_ptr<const ColumnarTable> getTableData(const std::string& table) const;
+    
+    // EN: Table read from `source`: each index created on it is memory-mapped from its file next to the CSV when
+    //     that file matches the source, and otherwise built in memory then saved there for the next session
+    // FR: Table lue depuis `source` : chaque index créé dessus est mappé depuis son fichier à côté du CSV quand ce
+    //     fichier correspond à la source, sinon construit en mémoire puis enregistré là pour la session suivante
+    QueryError loadTableData(const std::string& table, std::shared_ptr<const ColumnarTable> data, IndexSource source);
+    bool isIndexMapped(const std::string& table, const std::string& column) const;
     void clearTableData(const std::string& table);
     
+    // EN: Append rows to a loaded table and bring its indexes up to date by indexing only those rows. The
+    //     extended table and indexes are built aside, then published at once, so lookups running meanwhile keep
+    //     reading the previous snapshot without waiting. A table read from a file no longer matches it
+    //     afterwards: its mapped indexes move to memory and nothing is saved for it anymore.
+    // FR: Ajoute des lignes à une table chargée et met ses index à jour en n'indexant que ces lignes. La table et
+    //     les index étendus sont construits à part, puis publiés d'un coup, les recherches en cours lisent donc
+    //     l'instantané précédent sans attendre. Une table lue depuis un fichier ne lui correspond plus ensuite :
+    //     ses index mappés passent en mémoire et plus rien n'est enregistré pour elle.
+    QueryError appendRows(const std::string& table, const std::vector<std::vector<std::string>>& rows);
+    
 private:
-    // EN: Internal index structures
-    // FR: Structures d'index internes
-    struct HashIndex {
-        std::unordered_map<std::string, std::vector<size_t>> value_to_rows;
+    // EN: Internal index structures. Each one is an immutable segment indexing a range of rows with absolute
+    //     row numbers.
+    // FR: Structures d'index internes. Chacune est un segment immuable indexant une plage de lignes avec des
+    //     numéros de ligne absolus.
+    struct IndexSegment {
+        size_t first_row = 0;
+        size_t row_count = 0;
         size_t memory_usage = 0;
     };
     
-    struct BTreeIndex {
+    struct HashIndex : IndexSegment {
+        std::unordered_map<std::string, std::vector<size_t>> value_to_rows;
+    };
+    
+    struct BTreeIndex : IndexSegment {
         std::map<std::string, std::vector<size_t>> value_to_rows;
-        size_t memory_usage = 0;
     };
     
-    struct FullTextIndex {
-        std::unordered_map<std::string, std::vector<size_t>> token_to_rows;
-        std::string tokenizer;
-        bool case_sensitive;
-        size_t memory_usage = 0;
+    struct FullTextIndex : IndexSegment {
+        std::unique_ptr<InvertedIndex> postings;   // EN: Compressed positional postings / FR: Listes positionnelles compressées
+    };
+    
+    // EN: Published state of an index: its segments over consecutive row ranges, oldest first. An append copies
+    //     the segment list, adds a segment for the new rows, then rebuilds the two newest segments into one for
+    //     as long as the newer is at least half the size of the older. Segments thus grow geometrically: a
+    //     lookup reads O(log n) of them and each row is indexed O(log n) times over all appends.
+    // FR: État publié d'un index : ses segments sur des plages de lignes consécutives, du plus ancien au plus
+    //     récent. Un ajout copie la liste, ajoute un segment pour les nouvelles lignes, puis reconstruit les deux
+    //     segments les plus récents en un seul tant que le plus récent fait au moins la moitié de l'autre. Les
+    //     segments grandissent donc géométriquement : une recherche en lit O(log n) et chaque ligne est indexée
+    //     O(log n) fois sur l'ensemble des ajouts.
+    template<typename Segment>
+    struct IndexSnapshot {
+        std::vector<std::shared_ptr<const Segment>> segments;
     };
     
-    // EN: Table data and indexes
-    // FR: Données de table et index
-    std::unordered_map<std::string, std::vector<std::string>> table_headers_;
-    std::unordered_map<std::string, std::vector<std::vector<std::string>>> table_data_;
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unique_ptr<HashIndex>>> hash_indexes_;
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unique_ptr<BTreeIndex>>> btree_indexes_;
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unique_ptr<FullTextIndex>>> fulltext_indexes_;
+    template<typename Segment>
+    using SnapshotMap = std::unordered_map<std::string, std::unordered_map<std::string,
+                                                                           std::shared_ptr<const IndexSnapshot<Segment>>>>;
+    
+    // EN: Table data (shared with the engine) and index snapshots. index_mutex_ is only held to look up or swap
+    //     them; writers (loads, index creation, appends) are serialized by write_mutex_, taken first.
+    // FR: Données de table (partagées avec le moteur) et instantanés d'index. index_mutex_ n'est tenu que pour
+    //     les trouver ou les échanger ; les écrivains (chargements, créations d'index, ajouts) sont sérialisés par
+    //     write_mutex_, pris en premier.
+    std::unordered_map<std::string, std::shared_ptr<const ColumnarTable>> table_data_;
+    SnapshotMap<HashIndex> hash_indexes_;
+    SnapshotMap<BTreeIndex> btree_indexes_;
+    SnapshotMap<FullTextIndex> fulltext_indexes_;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::shared_ptr<const PersistentIndex>>> mapped_indexes_;
     std::unordered_map<std::string, std::unordered_map<std::string, IndexConfig>> index_configs_;
+    std::unordered_map<std::string, IndexSource> index_sources_;
     
     mutable std::mutex index_mutex_;
+    std::mutex write_mutex_;
     
     // EN: Helper functions
     // FR: Fonctions d'aide
     QueryError buildHashIndex(const std::string& table, const std::string& column);
     QueryError buildBTreeIndex(const std::string& table, const std::string& column);
     QueryError buildFullTextIndex(const std::string& table, const std::string& column);
+    QueryError saveIndex(const std::string& table, const IndexConfig& config) const;
+    
+    // EN: Segment indexing rows [first_row, first_row + row_count) of a column
+    // FR: Segment indexant les lignes [first_row, first_row + row_count) d'une colonne
+    std::shared_ptr<const HashIndex> buildHashSegment(const ColumnarTable& data, size_t column, size_t first_row,
+                                                      size_t row_count) const;
+    std::shared_ptr<const BTreeIndex> buildBTreeSegment(const ColumnarTable& data, size_t column, size_t first_row,
+                                                        size_t row_count) const;
+    std::shared_ptr<const FullTextIndex> buildFullTextSegment(const ColumnarTable& data, size_t column,
+                                                              const IndexConfig& config, size_t first_row,
+                                                              size_t row_count) const;
     
     std::vector<std::string> tokenizeText(const std::string& text, const std::string& tokenizer, bool case_sensitive) const;
-    size_t calculateIndexMemory(const std::string& table, const std::string& column) const;
 };
 
+// EN: A query parsed, checked and planned once by QueryEngine::prepare(), then run with different values for
+//     its "?" placeholders. Immutable, so one statement can be executed from several threads.
+// FR: Une requête analysée, vérifiée et planifiée une fois par QueryEngine::prepare(), puis exécutée avec
+//     différentes valeurs pour ses paramètres « ? ». Immuable, une instruction peut donc être exécutée depuis
+//     plusieurs threads.
+class PreparedStatement {
+public:
+    const std::string& getSql() const { return query_.raw_sql; }
+    size_t getParameterCount() const { return query_.parameters.size(); }
+    
+private:
+    friend class QueryEngine;
+    
+    SqlQuery query_;                                   // EN: Placeholders hold a neutral text value / FR: Les paramètres contiennent une valeur textuelle neutre
+    std::shared_ptr<const QueryPlan> plan_;            // EN: Null for attached tables / FR: Nul pour les tables attachées
+    std::shared_ptr<const ColumnarTable> planned_for_; // EN: Table the plan was chosen for / FR: Table pour laquelle le plan a été choisi
+};
+
+using PreparedHandle = std::shared_ptr<const PreparedStatement>;
+
 // EN: Main query execution engine
 // FR: Moteur d'exécution de requêtes principal
 class QueryEngine {
@@ -395,26 +535,73 @@ public:
         size_t index_cache_size = 10;      // EN: Number of indexes to cache / FR: Nombre d'index à mettre en cache
         bool enable_query_cache = true;    // EN: Enable result caching / FR: Activer la mise en cache des résultats
         size_t query_cache_size = 100;     // EN: Number of queries to cache / FR: Nombre de requêtes à mettre en cache
+        size_t query_cache_bytes = 64 * 1024 * 1024;  // EN: Memory bound of the cached results / FR: Borne mémoire des résultats en cache
         bool auto_index = true;            // EN: Automatically create indexes / FR: Créer automatiquement des index
         std::chrono::seconds query_timeout{300};  // EN: Query execution timeout / FR: Délai d'expiration d'exécution de requête
+        size_t dictionary_limit = ColumnarTable::kDefaultDictionaryLimit;  // EN: Distinct values kept dictionary-encoded per column (0 = off) / FR: Valeurs distinctes encodées par dictionnaire par colonne (0 = désactivé)
+        size_t worker_threads = 0;         // EN: Threads for parallel operators (0 = hardware concurrency) / FR: Threads des opérateurs parallèles (0 = concurrence matérielle)
+        bool persist_indexes = false;      // EN: Keep indexes of loaded CSV files in .bbpidx files next to them / FR: Garder les index des fichiers CSV chargés dans des fichiers .bbpidx à côté d'eux
+        size_t zone_map_block_rows = 65536;  // EN: Rows per zone map block for scan skipping (0 = off) / FR: Lignes par bloc de zone map pour sauter des blocs (0 = désactivé)
+        bool collect_statistics = true;    // EN: Column statistics at registration for the cost-based planner / FR: Statistiques de colonnes à l'enregistrement pour le planificateur par coût
     };
     
     explicit QueryEngine(const Config& config);
-    ~QueryEngine() = default;
+    ~QueryEngine();
     
     // EN: Table management
     // FR: Gestion des tables
     QueryError loadTable(const std::string& table_name, const std::string& csv_file);
     QueryError registerTable(const std::string& table_name, const std::vector<std::string>& headers,
                             const std::vector<std::vector<std::string>>& data);
+    QueryError registerTable(const std::string& table_name, std::shared_ptr<const ColumnarTable> table);
     void unloadTable(const std::string& table_name);
+    
+    // EN: Append rows to a loaded table while it is being queried: its indexes index only the new rows, zone
+    //     maps extend on the next scan and cached results of the table are dropped. Queries already running keep
+    //     the rows they started with; planner statistics are collected again once the table grew by a quarter.
+    // FR: Ajoute des lignes à une table chargée pendant qu'elle est interrogée : ses index n'indexent que les
+    //     nouvelles lignes, les zone maps s'étendent au parcours suivant et les résultats en cache de la table
+    //     sont retirés. Les requêtes déjà en cours gardent les lignes avec lesquelles elles ont commencé ; les
+    //     statistiques du planificateur sont collectées à nouveau une fois la table grandie d'un quart.
+    QueryError appendRows(const std::string& table_name, const std::vector<std::vector<std::string>>& rows);
+    
+    // EN: Out-of-core table: the file is not loaded, every query on it streams the file through the parser with
+    //     the WHERE filter, projection and aggregation applied batch by batch and ORDER BY sorted externally
+    //     within max_memory_mb. JOIN clauses need loaded tables.
+    // FR: Table hors mémoire : le fichier n'est pas chargé, chaque requête le parcourt en flux via le parser avec
+    //     le filtre WHERE, la projection et l'agrégation appliqués lot par lot et ORDER BY trié en externe dans
+    //     max_memory_mb. Les clauses JOIN demandent des tables chargées.
+    QueryError attachTable(const std::string& table_name, const std::string& csv_file);
     std::vector<std::string> getTableNames() const;
+    std::shared_ptr<const ColumnarTable> getTable(const std::string& table_name) const;
     
     // EN: Query execution
     // FR: Exécution de requêtes
     QueryResult execute(const std::string& sql);
     QueryResult execute(const SqlQuery& query);
     
+    // EN: Prepared statements: "?" stands for a value in WHERE (comparisons, BETWEEN bounds, IN lists, LIKE
+    //     patterns). prepare() returns nullptr when the query does not parse or reads an unknown table or
+    //     column. Executions bypass the result cache; the plan is chosen again only if the table was replaced.
+    // FR: Instructions préparées : « ? » remplace une valeur dans WHERE (comparaisons, bornes BETWEEN, listes
+    //     IN, motifs LIKE). prepare() retourne nullptr quand la requête ne s'analyse pas ou lit une table ou une
+    //     colonne inconnue. Les exécutions contournent le cache de résultats ; le plan n'est choisi à nouveau
+    //     que si la table a été remplacée.
+    PreparedHandle prepare(const std::string& sql);
+    QueryResult execute(const PreparedHandle& statement, const std::vector<QueryValue>& parameters);
+    
+    template<typename... Params>
+        requires (sizeof...(Params) != 1 || !(std::is_same_v<std::decay_t<Params>, std::vector<QueryValue>> || ...))
+    QueryResult execute(const PreparedHandle& statement, Params&&... parameters) {
+        return execute(statement, std::vector<QueryValue>{QueryValue(std::forward<Params>(parameters))...});
+    }
+    
+    // EN: Full-text search on a FULL_TEXT indexed column: every column of the matching rows, in table order
+    // FR: Recherche texte intégral sur une colonne indexée FULL_TEXT : toutes les colonnes des lignes
+    //     correspondantes, dans l'ordre de la table
+    QueryResult searchText(const std::string& table, const std::string& column, const std::string& text,
+                           TextMatch mode = TextMatch::ALL_TERMS);
+    
     // EN: Index management
     // FR: Gestion d'index
     QueryError createIndex(const std::string& table, const IndexConfig& config);
@@ -425,6 +612,13 @@ public:
     // FR: Optimisation de requêtes
     std::string explainQuery(const std::string& sql);
     std::string explainQuery(const SqlQuery& query);
+    
+    // EN: Run the query (bypassing the cache) and render its operator tree with estimated and actual rows and
+    //     the time spent in each operator; execute() answers "EXPLAIN ANALYZE <query>" with these lines
+    // FR: Exécute la requête (sans le cache) et rend son arbre d'opérateurs avec les lignes estimées et réelles
+    //     et le temps passé dans chaque opérateur ; execute() répond à « EXPLAIN ANALYZE <requête> » avec ces
+    //     lignes
+    std::string explainAnalyze(const std::string& sql);
     void optimizeTable(const std::string& table);
     
     // EN: Cache management
@@ -458,15 +652,41 @@ private:
     QueryParser parser_;
     IndexManager index_manager_;
     
-    // EN: Table storage
-    // FR: Stockage des tables
-    std::unordered_map<std::string, std::vector<std::string>> table_headers_;
-    std::unordered_map<std::string, std::vector<std::vector<std::string>>> table_data_;
+    // EN: Table storage, one columnar copy shared with the index manager
+    // FR: Stockage des tables, une copie colonnaire partagée avec le gestionnaire d'index
+    std::unordered_map<std::string, std::shared_ptr<const ColumnarTable>> tables_;
+    std::unordered_map<std::string, std::string> attached_tables_;    // EN: Streamed tables and their file / FR: Tables en flux et leur fichier
+    std::unordered_map<std::string, std::string> table_files_;        // EN: Loaded tables and their file / FR: Tables chargées et leur fichier
+    
+    // EN: Registration of each loaded table, from a counter bumped at every registerTable; guarded by
+    //     table_mutex_. It tells zone maps built for a replaced table from those of its successor.
+    // FR: Enregistrement de chaque table chargée, d'un compteur incrémenté à chaque registerTable ; protégé par
+    //     table_mutex_. Il distingue les zone maps construites pour une table remplacée de celles de la suivante.
+    std::unordered_map<std::string, uint64_t> table_registrations_;
+    uint64_t registration_counter_{0};
+    
+    // EN: Zone maps per table and column, built on the first scan filtering that column, for the registration
+    //     they were built from; guarded by zone_map_mutex_, since queries scan without table_mutex_
+    // FR: Zone maps par table et colonne, construites au premier parcours filtrant cette colonne, pour
+    //     l'enregistrement dont elles proviennent ; protégées par zone_map_mutex_, car les requêtes parcourent
+    //     sans table_mutex_
+    struct TableZoneMaps {
+        uint64_t registration{0};
+        std::unordered_map<std::string, std::unique_ptr<ZoneMap>> columns;
+    };
+    std::unordered_map<std::string, TableZoneMaps> zone_maps_;
+    std::mutex zone_map_mutex_;
     
-    // EN: Query cache
-    // FR: Cache de requêtes
-    mutable std::unordered_map<std::string, QueryResult> query_cache_;
-    mutable std::unordered_map<std::string, std::chrono::system_clock::time_point> cache_timestamps_;
+    // EN: Planner statistics per registered table; guarded by table_mutex_
+    // FR: Statistiques du planificateur par table enregistrée ; protégées par table_mutex_
+    std::unordered_map<std::string, std::shared_ptr<const TableStatistics>> table_statistics_;
+    
+    // EN: Query cache keyed by SQL text; guarded by cache_mutex_. The generation moves on at every invalidation,
+    //     so a result computed across one is not cached.
+    // FR: Cache de requêtes indexé par le texte SQL ; protégé par cache_mutex_. La génération avance à chaque
+    //     invalidation, un résultat calculé pendant l'une d'elles n'est donc pas mis en cache.
+    std::unique_ptr<ResultCache> query_cache_;
+    uint64_t cache_generation_{0};
     
     // EN: Statistics
     // FR: Statistiques
@@ -475,37 +695,102 @@ private:
     mutable std::mutex cache_mutex_;
     mutable std::mutex table_mutex_;
     
+    // EN: Tables a query reads, copied out under table_mutex_ so the query runs without it: appends publish new
+    //     snapshots meanwhile and the query keeps reading the ones it took. A JOIN table that is not loaded is
+    //     nullptr; the statistics are those of the FROM table then of each JOIN table, nullptr when not collected.
+    // FR: Tables lues par une requête, copiées sous table_mutex_ pour que la requête s'exécute sans lui : les
+    //     ajouts publient de nouveaux instantanés pendant ce temps et la requête garde ceux qu'elle a pris. Une
+    //     table de JOIN non chargée vaut nullptr ; les statistiques sont celles de la table FROM puis de chaque
+    //     table de JOIN, nullptr quand elles ne sont pas collectées.
+    struct QuerySources {
+        std::shared_ptr<const ColumnarTable> table;
+        uint64_t registration{0};
+        std::vector<std::shared_ptr<const ColumnarTable>> joined;
+        std::vector<std::shared_ptr<const TableStatistics>> statistics;
+    };
+    
+    // EN: Sources of a query on a registered table (`table` is nullptr otherwise). Called with table_mutex_ held.
+    // FR: Sources d'une requête sur une table enregistrée (`table` vaut nullptr sinon). Appelé avec table_mutex_
+    //     verrouillé.
+    QuerySources takeSources(const SqlQuery& query) const;
+    
+    // EN: Helper threads of the morsel-parallel scans, created on first use and shared by every query
+    // FR: Threads assistants des parcours parallèles par morceaux, créés au premier usage et partagés par toutes
+    //     les requêtes
+    mutable std::mutex pool_mutex_;
+    mutable std::unique_ptr<ThreadPool> scan_pool_;
+    
+    // EN: Register a table, with the file it was read from when its indexes are persisted
+    // FR: Enregistre une table, avec le fichier d'où elle a été lue quand ses index sont persistés
+    QueryError registerTable(const std::string& table_name, std::shared_ptr<const ColumnarTable> table,
+                             const IndexSource* source);
+    
     // EN: Query execution helpers
     // FR: Aides à l'exécution de requêtes
-    QueryResult executeInternal(const SqlQuery& query);
+    QueryResult executeInternal(const SqlQuery& query, const PreparedStatement* prepared = nullptr);
     QueryResult executeSelect(const SqlQuery& query);
-    
-    // EN: Condition evaluation
-    // FR: Évaluation des conditions
-    bool evaluateWhere(const std::vector<std::string>& row, const std::vector<std::string>& headers,
-                      const std::vector<WhereCondition>& conditions) const;
-    bool evaluateCondition(const std::string& value, const WhereCondition& condition) const;
+    QueryResult executeStreaming(const SqlQuery& query, const std::string& csv_file) const;
+    
+    // EN: Replace `source` by the FROM table joined with every JOIN clause, left to right; columns are named
+    //     "table.column", or just "column" when no other joined table has it
+    // FR: Remplace `source` par la table FROM jointe à chaque clause JOIN, de gauche à droite ; les colonnes sont
+    //     nommées "table.colonne", ou juste "colonne" quand aucune autre table jointe ne l'a
+    QueryError executeJoins(const SqlQuery& query, const QuerySources& sources,
+                            std::shared_ptr<const ColumnarTable>& source, std::string& plan,
+                            QueryPlan& operators) const;
+    
+    // EN: Estimated operator pipeline of a query on a registered table, with its access path: the indexed
+    //     equality with the lowest estimated cost when it beats the (zone map pruned) scan
+    // FR: Pipeline d'opérateurs estimé d'une requête sur une table enregistrée, avec son chemin d'accès :
+    //     l'égalité indexée de plus faible coût estimé quand elle bat le parcours (élagué par les zone maps)
+    QueryPlan planQuery(const SqlQuery& query, const QuerySources& sources);
+    
+    // EN: Row ranges a full scan of a registered table must read for an AND-only WHERE clause: blocks where the
+    //     zone map of some condition rules out every row are left out. `block_count` is 0 when zone maps do not
+    //     apply (disabled, a single block, no condition they can bound, or a table replaced since `registration`)
+    // FR: Plages de lignes qu'un parcours complet d'une table enregistrée doit lire pour une clause WHERE faite
+    //     de AND : les blocs où la zone map d'une condition exclut toutes les lignes sont écartés. `block_count`
+    //     vaut 0 quand les zone maps ne s'appliquent pas (désactivées, un seul bloc, aucune condition qu'elles
+    //     sachent borner, ou une table remplacée depuis `registration`)
+    std::vector<std::pair<size_t, size_t>> pruneScanBlocks(const std::string& table_name, uint64_t registration,
+                                                           const ColumnarTable& table,
+                                                           const std::vector<WhereCondition>& where,
+                                                           size_t& block_count, size_t& blocks_skipped);
     
     // EN: Aggregation functions
     // FR: Fonctions d'agrégation
-    QueryResult applyAggregation(const QueryResult& intermediate_result, const SqlQuery& query);
+    QueryResult applyAggregation(const ColumnarTable& table, const std::vector<size_t>& rows,
+                                 const SqlQuery& query, std::string& plan) const;
     std::string calculateAggregate(const std::vector<std::string>& values, AggregateFunction func) const;
+    size_t workerThreadCount() const;
+    
+    // EN: Scan pool with workerThreadCount() - 1 helpers (the querying thread is the last worker); nullptr when a
+    //     single thread is configured
+    // FR: Pool de parcours avec workerThreadCount() - 1 assistants (le thread de la requête est le dernier
+    //     travailleur) ; nullptr quand un seul thread est configuré
+    ThreadPool* scanPool() const;
     
     // EN: Sorting and limiting
     // FR: Tri et limitation
     void applySorting(QueryResult& result, const std::vector<OrderByColumn>& order_by) const;
     QueryResult applyLimitOffset(const QueryResult& result, size_t limit, size_t offset) const;
+    void applyTopK(QueryResult& result, const std::vector<OrderByColumn>& order_by, size_t limit, size_t offset) const;
     
     // EN: Utility functions
     // FR: Fonctions utilitaires
     std::string generateCacheKey(const SqlQuery& query) const;
-    bool shouldUseIndex(const std::string& table, const std::string& column) const;
-    std::vector<size_t> optimizedRowSelection(const std::string& table, const std::vector<WhereCondition>& conditions);
     
     // EN: Memory management
     // FR: Gestion de la mémoire
     size_t estimateMemoryUsage() const;
-    void cleanupCache();
+    
+    // EN: Drop the cached results reading `table`; called whenever the table is replaced or removed
+    // FR: Retire les résultats en cache lisant `table` ; appelé chaque fois que la table est remplacée ou retirée
+    void invalidateCachedResults(const std::string& table);
+    
+    // EN: Source file signatures of the tables a query reads, taken before it runs
+    // FR: Signatures des fichiers sources des tables lues par une requête, relevées avant son exécution
+    std::vector<SourceSignature> readSources(const SqlQuery& query) const;
     
     void updateStatistics(const QueryResult& result, std::chrono::milliseconds execution_time) const;
 };
@@ -535,6 +820,8 @@ namespace QueryUtils {
     // FR: Utilitaires CSV
     QueryError loadCsvFile(const std::string& filename, std::vector<std::string>& headers,
                           std::vector<std::vector<std::string>>& data);
+    QueryError loadCsvTable(const std::string& filename, std::shared_ptr<ColumnarTable>& table,
+                           size_t dictionary_limit = ColumnarTable::kDefaultDictionaryLimit);
     QueryError saveCsvFile(const std::string& filename, const QueryResult& result);
     
     // EN: Validation utilities
@@ -0,0 +1,169 @@
+// EN: Cost-based planning: per-column statistics collected at load time, selectivity and cost estimates, and
+//     the operator tree reported by explainQuery() and EXPLAIN ANALYZE
+// FR: Planification par coût : statistiques par colonne collectées au chargement, estimations de sélectivité et
+//     de coût, et l'arbre d'opérateurs rapporté par explainQuery() et EXPLAIN ANALYZE
+
+#pragma once
+
+#include "csv/columnar_table.hpp"
+#include "csv/query_engine.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Statistics of one column: null and numeric counts, distinct values (exact for dictionary-encoded columns,
+//     a HyperLogLog sketch otherwise) and an equi-depth histogram of the numeric values, built from a sample
+// FR: Statistiques d'une colonne : nombres de nuls et de numériques, valeurs distinctes (exactes pour les
+//     colonnes encodées par dictionnaire, un croquis HyperLogLog sinon) et un histogramme équi-profondeur des
+//     valeurs numériques, construit sur un échantillon
+class ColumnStatistics {
+public:
+    static constexpr size_t kSketchBits = 11;
+    static constexpr size_t kHistogramBuckets = 32;
+    static constexpr size_t kHistogramSample = 16384;
+
+    static ColumnStatistics collect(const ColumnarTable& table, size_t column);
+
+    // EN: Estimated fraction of the rows satisfying `condition` (a condition on this column), in [0, 1]. Follows
+    //     CompiledPredicate: numeric comparisons against numeric cells, text otherwise, NULL only for IS NULL.
+    // FR: Fraction estimée des lignes satisfaisant `condition` (une condition sur cette colonne), dans [0, 1].
+    //     Suit CompiledPredicate : comparaisons numériques sur les cellules numériques, textuelles sinon, NULL
+    //     seulement pour IS NULL.
+    double selectivity(const WhereCondition& condition) const;
+
+    // EN: Guess for a column without statistics: rare equalities, a third of the rows for the rest
+    // FR: Estimation pour une colonne sans statistiques : égalités rares, un tiers des lignes pour le reste
+    static double defaultSelectivity(const WhereCondition& condition);
+
+    // EN: Accessors
+    // FR: Accesseurs
+    size_t getRowCount() const { return row_count_; }
+    size_t getNullCount() const { return null_count_; }
+    size_t getNumericCount() const { return numeric_count_; }
+    size_t getDistinctCount() const { return distinct_count_; }
+    const std::vector<double>& getHistogramBounds() const { return bounds_; }
+
+private:
+    size_t row_count_{0};
+    size_t null_count_{0};
+    size_t numeric_count_{0};
+    size_t distinct_count_{0};
+    std::vector<double> bounds_;    // EN: kHistogramBuckets + 1 quantiles, min to max / FR: kHistogramBuckets + 1 quantiles, du min au max
+
+    double equalsFraction(const QueryValue& value) const;
+    double compareFraction(const QueryValue& value, SqlOperator op) const;
+
+    // EN: Fraction of the numeric values below `x` (or at most `x` when inclusive), interpolated in its bucket
+    // FR: Fraction des valeurs numériques sous `x` (ou au plus `x` si inclusif), interpolée dans son seau
+    double numericFractionBelow(double x, bool inclusive) const;
+};
+
+// EN: Statistics of every column of a table, collected once when it is registered
+// FR: Statistiques de chaque colonne d'une table, collectées une fois à son enregistrement
+class TableStatistics {
+public:
+    // EN: One column per task on `pool` (nullptr = calling thread only)
+    // FR: Une colonne par tâche sur `pool` (nullptr = thread appelant seul)
+    static std::shared_ptr<const TableStatistics> collect(const ColumnarTable& table, ThreadPool* pool = nullptr,
+                                                          size_t helpers = 0);
+
+    size_t getRowCount() const { return row_count_; }
+    const ColumnStatistics* find(const std::string& column) const;
+
+    // EN: Estimated fraction of the rows satisfying a whole WHERE clause, conditions taken as independent:
+    //     AND multiplies, OR adds minus the overlap, left to right like CompiledFilter
+    // FR: Fraction estimée des lignes satisfaisant une clause WHERE entière, conditions supposées indépendantes :
+    //     AND multiplie, OR additionne moins le recouvrement, de gauche à droite comme CompiledFilter
+    double selectivity(const std::vector<WhereCondition>& where) const;
+
+private:
+    size_t row_count_{0};
+    std::vector<std::string> headers_;
+    std::vector<ColumnStatistics> columns_;
+};
+
+// EN: Selectivity of a WHERE clause combined as TableStatistics::selectivity() does, with the statistics of
+//     each column from `lookup`; a column it returns nullptr for gets ColumnStatistics::defaultSelectivity()
+// FR: Sélectivité d'une clause WHERE combinée comme le fait TableStatistics::selectivity(), avec les
+//     statistiques de chaque colonne fournies par `lookup` ; une colonne pour laquelle il retourne nullptr reçoit
+//     ColumnStatistics::defaultSelectivity()
+double clauseSelectivity(const std::vector<WhereCondition>& where,
+                         const std::function<const ColumnStatistics*(const std::string&)>& lookup);
+
+// EN: Relative operator costs, in units of one row read by a vectorized scan
+// FR: Coûts relatifs des opérateurs, en unités d'une ligne lue par un parcours vectorisé
+struct PlanCost {
+    static constexpr double kScanRow = 1.0;           // EN: Read and filter one row in a batch / FR: Lire et filtrer une ligne dans un lot
+    static constexpr double kIndexProbe = 20.0;       // EN: One index lookup / FR: Une recherche d'index
+    static constexpr double kIndexRow = 4.0;          // EN: Fetch and re-check one candidate row / FR: Lire et revérifier une ligne candidate
+    static constexpr double kHashRow = 2.0;           // EN: Build or probe one hash table row / FR: Construire ou sonder une ligne de table de hachage
+    static constexpr double kProjectCell = 0.2;       // EN: Materialize one result cell / FR: Matérialiser une cellule de résultat
+};
+
+// EN: One operator of a plan with its estimates and, after EXPLAIN ANALYZE, what it actually produced. Inputs
+//     are the operators it reads from (a join reads two).
+// FR: Un opérateur d'un plan avec ses estimations et, après EXPLAIN ANALYZE, ce qu'il a réellement produit. Les
+//     entrées sont les opérateurs qu'il lit (une jointure en lit deux).
+struct PlanNode {
+    enum class Kind { SCAN, INDEX_LOOKUP, HASH_JOIN, FILTER, AGGREGATE, TOP_K, PROJECT, DISTINCT, SORT, LIMIT };
+
+    Kind kind{Kind::SCAN};
+    std::string label;                          // EN: "Seq Scan on probe", "Hash Join (inner)"... / FR: « Seq Scan on probe », « Hash Join (inner) »...
+    std::vector<std::string> details;           // EN: Filter, index condition, zone maps... / FR: Filtre, condition d'index, zone maps...
+    double estimated_rows{0.0};
+    double estimated_cost{0.0};                 // EN: Including the inputs / FR: Entrées comprises
+    bool executed{false};
+    size_t actual_rows{0};
+    double actual_ms{0.0};
+    std::vector<PlanNode> inputs;
+
+    // EN: Indented tree, root first; `analyze` adds the actual rows and time of every operator
+    // FR: Arbre indenté, racine d'abord ; `analyze` ajoute les lignes et le temps réels de chaque opérateur
+    std::string render(bool analyze) const;
+};
+
+// EN: Pipeline of a single-table (or joined) query: stages in execution order, each reading the previous one
+// FR: Pipeline d'une requête sur une table (ou jointe) : étapes dans l'ordre d'exécution, chacune lisant la précédente
+struct QueryPlan {
+    std::vector<PlanNode> stages;
+
+    // EN: Access path: the WHERE condition answered by an index, or -1 for a scan
+    // FR: Chemin d'accès : la condition WHERE résolue par un index, ou -1 pour un parcours
+    int index_condition{-1};
+
+    // EN: Row ranges of the scan after zone map pruning
+    // FR: Plages de lignes du parcours après élagage par zone maps
+    std::vector<std::pair<size_t, size_t>> scan_ranges;
+    size_t block_count{0};
+    size_t blocks_skipped{0};
+    
+    // EN: The scan reads an AND-only WHERE clause, so zone maps may prune it (once its values are known)
+    // FR: Le parcours lit une clause WHERE faite de AND, les zone maps peuvent donc l'élaguer (une fois ses
+    //     valeurs connues)
+    bool prunable{false};
+
+    PlanNode* find(PlanNode::Kind kind);
+    PlanNode& add(PlanNode::Kind kind, std::string label, double rows, double cost);
+
+    // EN: Stages folded into a tree: each stage gets the previous one as its first input
+    // FR: Étapes repliées en arbre : chaque étape reçoit la précédente comme première entrée
+    PlanNode tree() const;
+};
+
+// EN: Text of a WHERE condition as written ("status_code BETWEEN 500 AND 599")
+// FR: Texte d'une condition WHERE telle qu'écrite (« status_code BETWEEN 500 AND 599 »)
+std::string describeCondition(const WhereCondition& condition);
+
+// EN: Text of a WHERE clause with its connectors, leaving out the condition at `skip` (-1 = none)
+// FR: Texte d'une clause WHERE avec ses connecteurs, sans la condition d'indice `skip` (-1 = aucune)
+std::string describeWhere(const std::vector<WhereCondition>& where, int skip = -1);
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,138 @@
+// EN: WHERE conditions compiled once per query into typed predicates evaluated over columnar tables
+// FR: Conditions WHERE compilées une fois par requête en prédicats typés évalués sur les tables colonnaires
+
+#pragma once
+
+#include "csv/columnar_table.hpp"
+#include "csv/query_engine.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: SQL LIKE pattern compiled once: '%' matches any run of characters, '_' exactly one. Patterns made of a
+//     single literal with '%' only at the ends (exact, prefix, suffix, contains) use direct comparisons or a
+//     substring search; the others use an iterative wildcard match without backtracking blow-up.
+// FR: Motif SQL LIKE compilé une fois : '%' correspond à toute suite de caractères, '_' à exactement un. Les
+//     motifs formés d'un seul littéral avec '%' seulement aux extrémités (exact, préfixe, suffixe, contenu)
+//     utilisent des comparaisons directes ou une recherche de sous-chaîne ; les autres une correspondance
+//     itérative des jokers sans explosion de retours arrière.
+class LikeMatcher {
+public:
+    explicit LikeMatcher(std::string_view pattern);
+
+    bool matches(std::string_view text) const;
+
+private:
+    enum class Shape { EXACT, PREFIX, SUFFIX, CONTAINS, ANY, WILDCARD };
+
+    Shape shape_;
+    std::string literal_;   // EN: Literal for the simple shapes, whole pattern otherwise / FR: Littéral des formes simples, motif complet sinon
+};
+
+// EN: Numeric reading of a cell, with the same rules as QueryUtils::isNumeric() (optional '-', digits, at most
+//     one '.') but without allocation
+// FR: Lecture numérique d'une cellule, avec les mêmes règles que QueryUtils::isNumeric() (un '-' optionnel, des
+//     chiffres, au plus un '.') mais sans allocation
+bool parseNumericCell(std::string_view text, double& value) noexcept;
+
+// EN: One WHERE condition bound to a table column. Constants are parsed once at compile time and each cell is
+//     read at most once as a number. Comparisons are numeric when both sides are numeric, textual otherwise;
+//     cells spelled NULL/null are null and only match IS NULL. On dictionary-encoded columns the predicate is
+//     evaluated once per distinct value and rows are answered from their code.
+//     evaluateBatch() tests up to kBatchSize consecutive rows at once into a bitmask, with a kernel chosen at
+//     compile time: code lookup for dictionary columns, parse-then-compare over a contiguous double buffer for
+//     numeric constants, length check + memcmp for text equality, the generic closure otherwise.
+// FR: Une condition WHERE liée à une colonne de table. Les constantes sont analysées une fois à la compilation
+//     et chaque cellule est lue au plus une fois comme nombre. Les comparaisons sont numériques quand les deux
+//     côtés sont numériques, textuelles sinon ; les cellules écrites NULL/null sont nulles et ne correspondent
+//     qu'à IS NULL. Sur les colonnes encodées par dictionnaire le prédicat est évalué une fois par valeur
+//     distincte et les lignes sont résolues par leur code.
+//     evaluateBatch() teste jusqu'à kBatchSize lignes consécutives d'un coup dans un masque de bits, avec un noyau
+//     choisi à la compilation : lecture des codes pour les colonnes à dictionnaire, analyse puis comparaison sur
+//     un buffer contigu de doubles pour les constantes numériques, test de longueur + memcmp pour l'égalité
+//     textuelle, la fermeture générique sinon.
+class CompiledPredicate {
+public:
+    using ValueTest = std::function<bool(std::string_view)>;
+    static constexpr size_t kBatchSize = 1024;
+    using BatchMask = std::array<uint64_t, kBatchSize / 64>;
+
+    // EN: Compile a condition against a table; std::nullopt when the column does not exist
+    // FR: Compile une condition pour une table ; std::nullopt si la colonne n'existe pas
+    static std::optional<CompiledPredicate> compile(const WhereCondition& condition, const ColumnarTable& table);
+
+    // EN: Closure testing one cell value, without binding to a table
+    // FR: Fermeture testant une valeur de cellule, sans liaison à une table
+    static ValueTest compileValueTest(const WhereCondition& condition);
+
+    bool matches(const ColumnarTable& table, size_t row) const {
+        if (codes_ != nullptr) {
+            return dictionary_matches_[(*codes_)[row]] != 0;
+        }
+        return test_(table.getValue(row, column_));
+    }
+
+    // EN: Set bit i of `mask` when row begin + i matches, for i < count (count <= kBatchSize); other bits are cleared
+    // FR: Met le bit i de `mask` quand la ligne begin + i correspond, pour i < count (count <= kBatchSize) ; les autres bits sont effacés
+    void evaluateBatch(const ColumnarTable& table, size_t begin, size_t count, BatchMask& mask) const;
+
+    size_t getColumn() const { return column_; }
+
+private:
+    // EN: Batch kernel selected from the column encoding and the constant types
+    // FR: Noyau de lot choisi selon l'encodage de la colonne et le type des constantes
+    enum class Kernel { GENERIC, DICTIONARY, NUMERIC, NUMERIC_RANGE, TEXT_EQUALS, TEXT_NOT_EQUALS };
+
+    size_t column_{0};                                          // EN: Bound column / FR: Colonne liée
+    ValueTest test_;                                            // EN: Typed cell test / FR: Test typé de cellule
+    Kernel kernel_{Kernel::GENERIC};                            // EN: Batch kernel / FR: Noyau de lot
+    SqlOperator op_{SqlOperator::EQUALS};                       // EN: Operator for NUMERIC / FR: Opérateur pour NUMERIC
+    double low_{0.0};                                           // EN: Numeric constant or range start / FR: Constante numérique ou début de plage
+    double high_{0.0};                                          // EN: Range end / FR: Fin de plage
+    std::string text_;                                          // EN: Text constant for TEXT_* / FR: Constante texte pour TEXT_*
+    const std::vector<ColumnarTable::DictionaryCode>* codes_{nullptr};  // EN: Column codes when dictionary-encoded / FR: Codes de la colonne si encodée
+    std::vector<uint8_t> dictionary_matches_;                   // EN: Result per dictionary entry / FR: Résultat par entrée du dictionnaire
+};
+
+// EN: A whole WHERE clause compiled against a table. Conditions combine left to right, each with the connector
+//     written before it (AND, OR); conditions on unknown columns are ignored.
+// FR: Une clause WHERE complète compilée pour une table. Les conditions se combinent de gauche à droite, chacune
+//     avec le connecteur écrit devant elle (AND, OR) ; les conditions sur des colonnes inconnues sont ignorées.
+class CompiledFilter {
+public:
+    CompiledFilter(const std::vector<WhereCondition>& conditions, const ColumnarTable& table);
+
+    bool matches(size_t row) const;
+
+    // EN: Append the matching rows of [begin, end) to `rows`, evaluated batch by batch: each predicate fills a
+    //     bitmask, connectors combine the masks word by word, and the set bits become the selection vector.
+    //     An AND stops evaluating once a batch has no row left.
+    // FR: Ajoute à `rows` les lignes correspondantes de [begin, end), évaluées lot par lot : chaque prédicat
+    //     remplit un masque de bits, les connecteurs combinent les masques mot par mot, et les bits à un forment
+    //     le vecteur de sélection. Un AND cesse d'évaluer dès qu'un lot n'a plus de ligne.
+    void selectRows(size_t begin, size_t end, std::vector<size_t>& rows) const;
+
+    // EN: True when no condition applies (every row matches)
+    // FR: Vrai quand aucune condition ne s'applique (toutes les lignes correspondent)
+    bool empty() const { return predicates_.empty(); }
+
+    // EN: True when the conditions are only joined by AND, so any one of them may narrow the candidate rows
+    // FR: Vrai quand les conditions ne sont jointes que par AND, chacune peut donc réduire les lignes candidates
+    bool isConjunctive() const { return conjunctive_; }
+
+private:
+    const ColumnarTable& table_;                    // EN: Filtered table / FR: Table filtrée
+    std::vector<CompiledPredicate> predicates_;     // EN: Compiled conditions / FR: Conditions compilées
+    std::vector<LogicalOperator> connectors_;       // EN: Connector before each condition / FR: Connecteur devant chaque condition
+    bool conjunctive_{true};                        // EN: Only AND connectors / FR: Seulement des connecteurs AND
+};
+
+} // namespace CSV
+} // namespace BBP
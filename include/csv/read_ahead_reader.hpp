@@ -0,0 +1,92 @@
+// EN: Asynchronous read-ahead of plain files into a ring of large buffers, filled by pread() on a background thread
+// FR: Lecture anticipée asynchrone de fichiers bruts dans un anneau de grands buffers, remplis par pread() sur un thread d'arrière-plan
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Keeps up to N buffers filled ahead of the consumer, so disk (or network storage) latency overlaps with
+//     parsing. The reader thread issues sequential pread() calls of one buffer each; the consumer walks the
+//     ring with next() and hands each buffer back on the following call.
+// FR: Garde jusqu'à N buffers remplis en avance sur le consommateur, pour que la latence du disque (ou du
+//     stockage réseau) se superpose au parsing. Le thread de lecture émet des pread() séquentiels d'un buffer
+//     chacun ; le consommateur parcourt l'anneau avec next() et rend chaque buffer à l'appel suivant.
+class ReadAheadReader {
+public:
+    // EN: Defaults and bounds for the ring
+    // FR: Valeurs par défaut et bornes de l'anneau
+    static constexpr size_t kDefaultBufferCount = 4;
+    static constexpr size_t kDefaultBufferSize = 4 << 20;
+    static constexpr size_t kMinBufferCount = 2;
+    static constexpr size_t kMinBufferSize = 64 * 1024;
+
+    explicit ReadAheadReader(size_t buffer_count = kDefaultBufferCount, size_t buffer_size = kDefaultBufferSize);
+    ~ReadAheadReader();
+
+    // EN: Non-copyable, non-movable (the reader thread points back at this object)
+    // FR: Non copiable, non déplaçable (le thread de lecture pointe vers cet objet)
+    ReadAheadReader(const ReadAheadReader&) = delete;
+    ReadAheadReader& operator=(const ReadAheadReader&) = delete;
+
+    // EN: Open the file and start reading ahead; returns false and sets the last error if it cannot be opened
+    // FR: Ouvre le fichier et démarre la lecture anticipée ; retourne false et renseigne la dernière erreur s'il ne s'ouvre pas
+    bool open(const std::string& file_path);
+    void close();
+
+    // EN: Next block of file bytes, valid until the following call. Blocks until the reader thread has filled
+    //     it; returns false at end of file or on error (see hasError()).
+    // FR: Bloc suivant d'octets du fichier, valide jusqu'à l'appel suivant. Bloque jusqu'à ce que le thread de
+    //     lecture l'ait rempli ; retourne false en fin de fichier ou en cas d'erreur (voir hasError()).
+    bool next(const char*& data, size_t& size);
+
+    // EN: Accessors. getStallCount() counts next() calls that had to wait for I/O, i.e. reads not hidden.
+    // FR: Accesseurs. getStallCount() compte les appels à next() qui ont dû attendre l'E/S, donc les lectures non masquées.
+    bool isOpen() const { return is_open_; }
+    bool hasError() const;
+    std::string getLastError() const;
+    size_t getBufferCount() const { return buffers_.size(); }
+    size_t getBufferSize() const { return buffer_size_; }
+    size_t getBytesRead() const { return bytes_read_.load(std::memory_order_relaxed); }
+    size_t getStallCount() const { return stall_count_.load(std::memory_order_relaxed); }
+
+private:
+    // EN: One buffer of the ring
+    // FR: Un buffer de l'anneau
+    struct Buffer {
+        std::unique_ptr<char[]> data;
+        size_t size{0};
+    };
+
+    size_t buffer_size_;                        // EN: Capacity of each buffer / FR: Capacité de chaque buffer
+    std::vector<Buffer> buffers_;               // EN: Ring shared with the reader thread / FR: Anneau partagé avec le thread de lecture
+    size_t produced_{0};                        // EN: Buffers filled by the reader / FR: Buffers remplis par le lecteur
+    size_t consumed_{0};                        // EN: Buffers released by the consumer / FR: Buffers libérés par le consommateur
+    bool holding_{false};                       // EN: Consumer currently holds a buffer / FR: Le consommateur détient un buffer
+    bool finished_{false};                      // EN: Reader reached end of file or failed / FR: Le lecteur a atteint la fin ou échoué
+    bool stop_requested_{false};                // EN: close() asks the reader to quit / FR: close() demande au lecteur de s'arrêter
+    std::string last_error_;                    // EN: Last error message / FR: Dernier message d'erreur
+    mutable std::mutex mutex_;                  // EN: Guards the hand-off state above / FR: Protège l'état de transfert ci-dessus
+    std::condition_variable buffer_ready_;      // EN: Signalled when a buffer is filled / FR: Signalée quand un buffer est rempli
+    std::condition_variable buffer_free_;       // EN: Signalled when a buffer is released / FR: Signalée quand un buffer est libéré
+    std::thread reader_thread_;                 // EN: Background reader / FR: Lecteur en arrière-plan
+    std::atomic<size_t> bytes_read_{0};         // EN: Bytes read so far / FR: Octets lus jusqu'ici
+    std::atomic<size_t> stall_count_{0};        // EN: Consumer waits on I/O / FR: Attentes du consommateur sur l'E/S
+    bool is_open_{false};                       // EN: Open flag / FR: Flag d'ouverture
+
+    void readWorker(int fd);
+    void finish(const std::string& error);
+};
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,89 @@
+// EN: Byte-bounded LRU cache of query results, kept as shared immutable snapshots and dropped when a table they
+//     read is re-registered or its source file changes
+// FR: Cache LRU borné en octets de résultats de requêtes, gardés comme instantanés immuables partagés et retirés
+//     quand une table qu'ils lisent est réenregistrée ou que son fichier source change
+
+#pragma once
+
+#include "csv/query_engine.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: A table read by a cached result, with the size and modification time of its source file when the result
+//     was computed (empty file for tables registered from memory)
+// FR: Une table lue par un résultat en cache, avec la taille et la date de modification de son fichier source
+//     au calcul du résultat (fichier vide pour les tables enregistrées depuis la mémoire)
+struct SourceSignature {
+    std::string table;
+    std::string csv_file;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+
+    // EN: Signature of `table` read from `csv_file` now; size and mtime stay 0 when the file cannot be read
+    // FR: Signature de `table` lue maintenant depuis `csv_file` ; taille et date restent à 0 si le fichier est illisible
+    static SourceSignature read(const std::string& table, const std::string& csv_file);
+
+    // EN: Whether the source file still has the same size and modification time
+    // FR: Si le fichier source a toujours la même taille et la même date de modification
+    bool isCurrent() const;
+};
+
+// EN: LRU list plus key map, so lookups, insertions and evictions are O(1). Not synchronized: the engine guards
+//     it with its cache mutex.
+// FR: Liste LRU plus table de clés, les recherches, insertions et évictions sont donc en O(1). Non synchronisé :
+//     le moteur le protège avec son mutex de cache.
+class ResultCache {
+public:
+    ResultCache(size_t max_bytes, size_t max_entries);
+
+    // EN: Cached result of `key`, now the most recently used, or nullptr; an entry whose source files changed is
+    //     dropped instead
+    // FR: Résultat en cache de `key`, désormais le plus récemment utilisé, ou nullptr ; une entrée dont les
+    //     fichiers sources ont changé est retirée à la place
+    std::shared_ptr<const QueryResult> find(const std::string& key);
+
+    // EN: Least recently used entries are evicted until both bounds hold; a result larger than the byte bound
+    //     is not kept
+    // FR: Les entrées les moins récemment utilisées sont évincées jusqu'à respecter les deux bornes ; un résultat
+    //     plus grand que la borne en octets n'est pas gardé
+    void insert(const std::string& key, std::shared_ptr<const QueryResult> result, std::vector<SourceSignature> sources);
+
+    void invalidateTable(const std::string& table);
+    void clear();
+
+    // EN: Accessors
+    // FR: Accesseurs
+    size_t size() const { return entries_.size(); }
+    size_t getBytes() const { return bytes_; }
+
+    // EN: Heap bytes held by a result's rows
+    // FR: Octets de tas tenus par les lignes d'un résultat
+    static size_t estimateBytes(const QueryResult& result);
+
+private:
+    struct Entry {
+        std::string key;
+        std::shared_ptr<const QueryResult> result;
+        std::vector<SourceSignature> sources;
+        size_t bytes{0};
+    };
+
+    size_t max_bytes_;
+    size_t max_entries_;
+    size_t bytes_{0};
+    std::list<Entry> entries_;    // EN: Most recently used first / FR: Le plus récemment utilisé en premier
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+
+    void erase(std::list<Entry>::iterator it);
+};
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,75 @@
+// EN: Monotonic arena backing the field storage of parsed rows, with heap allocation accounting
+// FR: Arène monotone portant le stockage des champs des lignes analysées, avec comptage des allocations tas
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Pass-through memory resource counting the allocations that reach its upstream (the general heap by default)
+// FR: Ressource mémoire transparente comptant les allocations qui atteignent sa ressource amont (le tas par défaut)
+class CountingMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit CountingMemoryResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+        : upstream_(upstream) {}
+
+    // EN: Accessors
+    // FR: Accesseurs
+    size_t getAllocationCount() const { return allocation_count_.load(std::memory_order_relaxed); }
+    size_t getBytesAllocated() const { return bytes_allocated_.load(std::memory_order_relaxed); }
+    void resetCounters();
+
+private:
+    std::pmr::memory_resource* upstream_;           // EN: Where allocations are forwarded / FR: Destination des allocations
+    std::atomic<size_t> allocation_count_{0};       // EN: Allocations forwarded / FR: Allocations transmises
+    std::atomic<size_t> bytes_allocated_{0};        // EN: Bytes requested from upstream / FR: Octets demandés en amont
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// EN: Per-parse row storage. With a non-zero size, rows are carved out of a monotonic arena whose first block is
+//     allocated once; rewind() drops everything carved so far, in O(1) as long as the rows fitted in that block.
+//     With size 0 rows go straight to the heap. Either way every heap allocation is counted.
+// FR: Stockage des lignes d'un parsing. Avec une taille non nulle, les lignes sont découpées dans une arène
+//     monotone dont le premier bloc est alloué une seule fois ; rewind() abandonne tout ce qui a été découpé, en
+//     O(1) tant que les lignes tenaient dans ce bloc. Avec une taille 0 les lignes vont directement sur le tas.
+//     Dans les deux cas chaque allocation sur le tas est comptée.
+class RowArena {
+public:
+    explicit RowArena(size_t arena_size);
+    ~RowArena();
+
+    // EN: Non-copyable, non-movable (row allocators point at this object)
+    // FR: Non copiable, non déplaçable (les allocateurs des lignes pointent vers cet objet)
+    RowArena(const RowArena&) = delete;
+    RowArena& operator=(const RowArena&) = delete;
+
+    // EN: Resource rows allocate from
+    // FR: Ressource depuis laquelle les lignes allouent
+    std::pmr::memory_resource* resource() { return arena_ ? static_cast<std::pmr::memory_resource*>(&*arena_) : &heap_; }
+
+    // EN: Release every row allocated since the last rewind (no-op without arena)
+    // FR: Libère toutes les lignes allouées depuis le dernier rewind (sans effet sans arène)
+    void rewind();
+
+    // EN: Accessors
+    // FR: Accesseurs
+    bool isArena() const { return arena_.has_value(); }
+    size_t getHeapAllocations() const { return heap_.getAllocationCount(); }
+
+private:
+    CountingMemoryResource heap_;                               // EN: Counted general heap / FR: Tas général compté
+    size_t block_size_;                                         // EN: Size of the initial arena block / FR: Taille du bloc initial de l'arène
+    void* block_{nullptr};                                      // EN: Initial arena block / FR: Bloc initial de l'arène
+    std::optional<std::pmr::monotonic_buffer_resource> arena_;  // EN: Arena over the initial block / FR: Arène sur le bloc initial
+};
+
+} // namespace CSV
+} // namespace BBP
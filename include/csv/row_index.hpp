@@ -0,0 +1,106 @@
+// EN: Sparse byte-offset row index for random access into large CSV files, persisted as a compact sidecar
+// FR: Index creux des offsets de lignes pour l'accès aléatoire aux gros fichiers CSV, persisté dans un fichier annexe compact
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: A run of consecutive data rows and the bytes holding them. Rows are numbered from 0 (the header row is
+//     not a data row); offsets are absolute in the file and always fall on a row boundary, outside quotes.
+// FR: Une suite de lignes de données consécutives et les octets qui les contiennent. Les lignes sont numérotées
+//     à partir de 0 (l'en-tête n'est pas une ligne de données) ; les offsets sont absolus dans le fichier et
+//     tombent toujours sur une limite de ligne, hors quotes.
+struct RowRange {
+    uint64_t first_row{0};          // EN: Data row starting at begin_offset / FR: Ligne de données débutant à begin_offset
+    uint64_t row_count{0};          // EN: Data rows in the range / FR: Lignes de données dans la plage
+    uint64_t begin_offset{0};       // EN: First byte of the range / FR: Premier octet de la plage
+    uint64_t end_offset{UINT64_MAX}; // EN: One past the last byte (UINT64_MAX = end of file) / FR: Un après le dernier octet (UINT64_MAX = fin de fichier)
+};
+
+// EN: Byte offset of every Kth data row. Checkpoints are delta-encoded as varints in the sidecar (a few bytes
+//     per checkpoint), and the sidecar records the size and modification time of the file it describes so a
+//     stale index is never used.
+// FR: Offset en octets d'une ligne de données sur K. Les points de reprise sont encodés en deltas varint dans le
+//     fichier annexe (quelques octets par point), qui enregistre la taille et la date de modification du fichier
+//     décrit pour ne jamais utiliser un index périmé.
+class RowIndex {
+public:
+    // EN: Default checkpoint stride in data rows
+    // FR: Pas par défaut entre points de reprise, en lignes de données
+    static constexpr size_t kDefaultStride = 1024;
+
+    explicit RowIndex(size_t stride = kDefaultStride);
+
+    // EN: Building: call addRow() with the start offset of every data row, in file order, then finish()
+    // FR: Construction : appeler addRow() avec l'offset de début de chaque ligne de données, dans l'ordre, puis finish()
+    void reset(size_t stride);
+    void addRow(uint64_t row_offset) {
+        if (row_count_ % stride_ == 0) {
+            checkpoints_.push_back(row_offset);
+        }
+        ++row_count_;
+    }
+    void finish(uint64_t file_size, int64_t file_mtime);
+
+    // EN: Record the size and modification time of `csv_path` as the described file
+    // FR: Enregistre la taille et la date de modification de `csv_path` comme fichier décrit
+    bool finish(const std::string& csv_path);
+
+    // EN: Lookups. locate() returns the range from the checkpoint at or before `row` to the end of the file;
+    //     the caller skips row - first_row rows from there.
+    // FR: Recherches. locate() retourne la plage du point de reprise au plus tard à `row` jusqu'à la fin du
+    //     fichier ; l'appelant saute row - first_row lignes depuis là.
+    RowRange locate(uint64_t row) const;
+
+    // EN: Rows whose checkpoint-aligned start lies in [begin, end); consecutive byte ranges give disjoint,
+    //     contiguous row ranges
+    // FR: Lignes dont le début aligné sur un point de reprise est dans [begin, end) ; des plages d'octets
+    //     consécutives donnent des plages de lignes disjointes et contiguës
+    RowRange rangeForBytes(uint64_t begin, uint64_t end) const;
+
+    // EN: Cut the file into at most `parts` row ranges of similar byte size, for parallel workers
+    // FR: Découpe le fichier en au plus `parts` plages de lignes de taille similaire, pour des workers parallèles
+    std::vector<RowRange> split(size_t parts) const;
+
+    // EN: Sidecar persistence (written to a temporary file then renamed)
+    // FR: Persistance du fichier annexe (écrit dans un fichier temporaire puis renommé)
+    bool save(const std::string& index_path) const;
+    bool load(const std::string& index_path);
+
+    // EN: True if the index was built for the current content of `csv_path` (same size and mtime)
+    // FR: Vrai si l'index a été construit pour le contenu actuel de `csv_path` (même taille et mtime)
+    bool matches(const std::string& csv_path) const;
+
+    // EN: Sidecar location for a CSV file: "<csv_path>.idx"
+    // FR: Emplacement du fichier annexe d'un CSV : "<csv_path>.idx"
+    static std::string sidecarPath(const std::string& csv_path);
+
+    // EN: Accessors
+    // FR: Accesseurs
+    size_t getStride() const { return stride_; }
+    uint64_t getRowCount() const { return row_count_; }
+    uint64_t getFileSize() const { return file_size_; }
+    size_t getCheckpointCount() const { return checkpoints_.size(); }
+    uint64_t getCheckpointOffset(size_t checkpoint) const { return checkpoints_[checkpoint]; }
+    bool empty() const { return row_count_ == 0; }
+    const std::string& getLastError() const { return last_error_; }
+
+private:
+    size_t stride_;                         // EN: Data rows between checkpoints / FR: Lignes de données entre points de reprise
+    uint64_t row_count_{0};                 // EN: Data rows indexed / FR: Lignes de données indexées
+    uint64_t file_size_{0};                 // EN: Size of the described file / FR: Taille du fichier décrit
+    int64_t file_mtime_{0};                 // EN: Modification time of the described file / FR: Date de modification du fichier décrit
+    std::vector<uint64_t> checkpoints_;     // EN: Start offset of rows 0, K, 2K, ... / FR: Offset de début des lignes 0, K, 2K, ...
+    mutable std::string last_error_;        // EN: Last error message / FR: Dernier message d'erreur
+
+    static bool fileFingerprint(const std::string& csv_path, uint64_t& size, int64_t& mtime);
+};
+
+} // namespace CSV
+} // namespace BBP
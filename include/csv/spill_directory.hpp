@@ -0,0 +1,39 @@
+// EN: Temporary directory for operators that spill to disk (hash join partitions, sort runs)
+// FR: Répertoire temporaire pour les opérateurs qui débordent sur disque (partitions de jointure, séquences de tri)
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Uniquely named directory created under `parent` and removed with everything in it on destruction.
+//     valid() is false when it could not be created.
+// FR: Répertoire au nom unique créé sous `parent` et supprimé avec tout son contenu à la destruction.
+//     valid() est faux s'il n'a pas pu être créé.
+class SpillDirectory {
+public:
+    SpillDirectory(const std::filesystem::path& parent, const std::string& prefix);
+    ~SpillDirectory();
+
+    SpillDirectory(const SpillDirectory&) = delete;
+    SpillDirectory& operator=(const SpillDirectory&) = delete;
+
+    bool valid() const { return !path_.empty(); }
+    const std::filesystem::path& path() const { return path_; }
+
+    // EN: Path of the numbered file `name`_`index`.bin inside the directory
+    // FR: Chemin du fichier numéroté `name`_`index`.bin dans le répertoire
+    std::filesystem::path file(const std::string& name, size_t index) const {
+        return path_ / (name + "_" + std::to_string(index) + ".bin");
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+} // namespace CSV
+} // namespace BBP
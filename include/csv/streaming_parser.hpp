@@ -4,6 +4,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <functional>
 #include <memory>
@@ -17,6 +18,13 @@
 #include <thread>
 #include <atomic>
 #include <iomanip>
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include "csv/field_conversion.hpp"
+#include "csv/row_arena.hpp"
+#include "csv/row_index.hpp"
+#include "csv/structural_scanner.hpp"
 
 namespace BBP {
 namespace CSV {
@@ -25,6 +33,7 @@ namespace CSV {
 // FR: Déclarations anticipées
 class StreamingParser;
 class ParsedRow;
+class RowView;
 class ParserStatistics;
 
 // EN: Encoding types supported by the parser
@@ -67,22 +76,61 @@ struct ParserConfig {
     EncodingType encoding{EncodingType::AUTO_DETECT}; // EN: Input file encoding / FR: Encodage du fichier d'entrée
     bool enable_parallel_processing{false}; // EN: Enable multi-threaded parsing / FR: Activer le parsing multi-thread
     size_t thread_count{0};                 // EN: Number of threads (0 = auto-detect) / FR: Nombre de threads (0 = auto-détection)
+    size_t parallel_chunk_size{4194304};    // EN: Bytes per parallel parsing chunk (4MB default) / FR: Octets par chunk de parsing parallèle (4MB par défaut)
+    bool use_memory_mapping{false};         // EN: parseFile() goes through mmap with zero-copy field views / FR: parseFile() passe par mmap avec vues de champs zero-copy
+    size_t read_ahead_buffers{0};           // EN: Buffers a reader thread keeps filled ahead of the tokenizer in parseFile() when not memory-mapping (0 = blocking reads, at least 2 otherwise) / FR: Buffers qu'un thread de lecture garde remplis en avance sur le tokenizer dans parseFile() hors mmap (0 = lectures bloquantes, au moins 2 sinon)
+    size_t read_ahead_buffer_size{4194304}; // EN: Bytes per read-ahead buffer (4MB default, 1-8MB recommended) / FR: Octets par buffer de lecture anticipée (4MB par défaut, 1-8MB recommandé)
+    size_t row_index_stride{0};             // EN: parseFile() writes a RowIndex sidecar with one checkpoint every N data rows (0 = off) / FR: parseFile() écrit un RowIndex annexe avec un point de reprise toutes les N lignes de données (0 = désactivé)
+    bool decompress_input{true};            // EN: Inflate gzip/zlib files (detected by magic bytes) on the fly / FR: Inflate à la volée les fichiers gzip/zlib (détectés par octets magiques)
+    ScannerBackend scanner_backend{ScannerBackend::AUTO}; // EN: Structural scanner implementation / FR: Implémentation du scanner structurel
+    size_t batch_size{4096};                // EN: Rows per RowBatch delivered to the batch callback / FR: Lignes par RowBatch transmis au callback de lot
+    size_t row_arena_size{0};               // EN: Bytes of the monotonic arena holding ParsedRow fields, rewound after each row callback (0 = general heap) / FR: Octets de l'arène monotone portant les champs des ParsedRow, rembobinée après chaque callback de ligne (0 = tas général)
+    std::vector<std::string> projected_columns;     // EN: Columns to materialize, by header name (empty = all) / FR: Colonnes à matérialiser, par nom d'en-tête (vide = toutes)
+    std::vector<size_t> projected_column_indices;   // EN: Columns to materialize, by 0-based index (empty = all) / FR: Colonnes à matérialiser, par index base 0 (vide = toutes)
     
     // EN: Default constructor with sensible defaults
     // FR: Constructeur par défaut avec valeurs par défaut sensées
     ParserConfig() = default;
 };
 
+// EN: Header names and their column index, built once per parse and shared by every row and batch
+// FR: Noms d'en-têtes et leur index de colonne, construits une fois par parsing et partagés par toutes les lignes et lots
+struct HeaderIndex : std::enable_shared_from_this<HeaderIndex> {
+    std::vector<std::string> names;                     // EN: Header names in column order / FR: Noms d'en-têtes dans l'ordre des colonnes
+    std::unordered_map<std::string, size_t> positions;  // EN: Header name to column index / FR: Nom d'en-tête vers index de colonne
+    
+    explicit HeaderIndex(std::vector<std::string> header_names);
+    
+    // EN: Column index of a header (first occurrence wins for duplicates)
+    // FR: Index de colonne d'un en-tête (la première occurrence l'emporte pour les doublons)
+    std::optional<size_t> find(const std::string& header) const;
+};
+
 // EN: Represents a parsed CSV row with field access methods
 // FR: Représente une ligne CSV analysée avec méthodes d'accès aux champs
 class ParsedRow {
 public:
+    // EN: Field storage; its allocator is the general heap unless the parser placed the row in its arena
+    // FR: Stockage des champs ; son allocateur est le tas général sauf si le parser a placé la ligne dans son arène
+    using FieldList = std::pmr::vector<std::pmr::string>;
+    
     // EN: Constructor
     // FR: Constructeur
-    ParsedRow(size_t row_number, std::vector<std::string> fields, std::vector<std::string> headers = {});
+    ParsedRow(size_t row_number, const std::vector<std::string>& fields, std::vector<std::string> headers = {});
+    
+    // EN: Constructor sharing an existing header index (no per-row header copy)
+    // FR: Constructeur partageant un index d'en-têtes existant (pas de copie d'en-têtes par ligne)
+    ParsedRow(size_t row_number, const std::vector<std::string>& fields, std::shared_ptr<const HeaderIndex> headers);
+    
+    // EN: Constructor copying field slices into storage taken from `resource`
+    // FR: Constructeur copiant des tranches de champs dans un stockage pris sur `resource`
+    ParsedRow(size_t row_number, const std::vector<std::string_view>& fields, std::shared_ptr<const HeaderIndex> headers,
+              std::pmr::memory_resource* resource = std::pmr::get_default_resource());
     
-    // EN: Copy constructor and assignment
-    // FR: Constructeur de copie et assignation
+    // EN: Copy constructor and assignment; copies always allocate from the default resource, so a row copied
+    //     inside a callback outlives the parser arena
+    // FR: Constructeur de copie et assignation ; les copies allouent toujours depuis la ressource par défaut, une
+    //     ligne copiée dans un callback survit donc à l'arène du parser
     ParsedRow(const ParsedRow& other) = default;
     ParsedRow& operator=(const ParsedRow& other) = default;
     ParsedRow(ParsedRow&& other) noexcept = default;
@@ -92,28 +140,41 @@ public:
     // FR: Destructeur
     ~ParsedRow() = default;
     
-    // EN: Field access by index
-    // FR: Accès aux champs par index
-    const std::string& operator[](size_t index) const;
-    const std::string& getField(size_t index) const;
+    // EN: Field access by index; the returned strings are copies owned by the caller (empty when out of range)
+    // FR: Accès aux champs par index ; les chaînes retournées sont des copies possédées par l'appelant (vides si
+    //     hors limites)
+    std::string operator[](size_t index) const;
+    std::string getField(size_t index) const;
     std::optional<std::string> getFieldSafe(size_t index) const;
     
     // EN: Field access by header name (if headers are available)
     // FR: Accès aux champs par nom d'en-tête (si en-têtes disponibles)
-    const std::string& operator[](const std::string& header) const;
-    const std::string& getField(const std::string& header) const;
+    std::string operator[](const std::string& header) const;
+    std::string getField(const std::string& header) const;
     std::optional<std::string> getFieldSafe(const std::string& header) const;
     
+    // EN: Field access without copy (empty view when out of range or unknown). The views, like getFieldList(),
+    //     point into this row: a row handed to the row callback with row_arena_size > 0 lives in the parser
+    //     arena, which is rewound for the next row, so they are only valid until the callback returns. Copy the
+    //     row, or use the owning accessors, to keep a field longer.
+    // FR: Accès aux champs sans copie (vue vide si hors limites ou inconnu). Les vues, comme getFieldList(),
+    //     pointent dans cette ligne : une ligne transmise au callback de ligne avec row_arena_size > 0 vit dans
+    //     l'arène du parser, rembobinée pour la ligne suivante, elles ne sont donc valides que jusqu'au retour du
+    //     callback. Copier la ligne, ou utiliser les accesseurs possédants, pour garder un champ plus longtemps.
+    std::string_view getFieldView(size_t index) const;
+    std::string_view getFieldView(const std::string& header) const;
+    const FieldList& getFieldList() const { return fields_; }
+    
     // EN: Row information
     // FR: Informations sur la ligne
     size_t getRowNumber() const { return row_number_; }
     size_t getFieldCount() const { return fields_.size(); }
-    const std::vector<std::string>& getFields() const { return fields_; }
-    const std::vector<std::string>& getHeaders() const { return headers_; }
-    bool hasHeaders() const { return !headers_.empty(); }
+    std::vector<std::string> getFields() const;
+    const std::vector<std::string>& getHeaders() const;
+    bool hasHeaders() const { return headers_ != nullptr && !headers_->names.empty(); }
     
-    // EN: Field type conversion helpers
-    // FR: Assistants de conversion de type de champ
+    // EN: Field type conversion helpers (see parseField() for the accepted formats; std::string copies the field)
+    // FR: Assistants de conversion de type de champ (voir parseField() pour les formats acceptés ; std::string copie le champ)
     template<typename T>
     std::optional<T> getFieldAs(size_t index) const;
     
@@ -131,13 +192,173 @@ public:
     
 private:
     size_t row_number_;                     // EN: 1-based row number / FR: Numéro de ligne base 1
-    std::vector<std::string> fields_;       // EN: Field values / FR: Valeurs des champs
-    std::vector<std::string> headers_;      // EN: Header names / FR: Noms des en-têtes
-    std::unordered_map<std::string, size_t> header_map_; // EN: Header name to index mapping / FR: Mappage nom d'en-tête vers index
+    FieldList fields_;                      // EN: Field values / FR: Valeurs des champs
+    std::shared_ptr<const HeaderIndex> headers_; // EN: Shared header names and index / FR: Noms et index d'en-têtes partagés
+    
+    // EN: Column index of a header, if headers are available
+    // FR: Index de colonne d'un en-tête, si des en-têtes sont disponibles
+    std::optional<size_t> findHeader(const std::string& header) const;
+};
+
+// EN: Zero-copy view of a parsed row. Fields are slices of the parser input (or of a per-row scratch
+//     buffer for quoted fields with escaped quotes) and are only valid during the callback invocation.
+// FR: Vue zero-copy d'une ligne analysée. Les champs sont des tranches de l'entrée du parser (ou d'un buffer
+//     temporaire par ligne pour les champs quotés avec quotes échappées) et ne sont valides que pendant le callback.
+class RowView {
+public:
+    // EN: Constructor
+    // FR: Constructeur
+    RowView(size_t row_number, const std::vector<std::string_view>& fields, const HeaderIndex* headers = nullptr)
+        : row_number_(row_number), fields_(&fields), headers_(headers) {}
+
+    // EN: Field access by index (empty view when out of range)
+    // FR: Accès aux champs par index (vue vide si hors limites)
+    std::string_view operator[](size_t index) const { return getField(index); }
+    std::string_view getField(size_t index) const;
+
+    // EN: Field access by header name (empty view when unknown)
+    // FR: Accès aux champs par nom d'en-tête (vue vide si inconnu)
+    std::string_view operator[](const std::string& header) const { return getField(header); }
+    std::string_view getField(const std::string& header) const;
+    std::optional<size_t> getFieldIndex(const std::string& header) const;
+
+    // EN: Typed field access with std::from_chars, no copy and no exception (see parseField())
+    // FR: Accès typé aux champs avec std::from_chars, sans copie ni exception (voir parseField())
+    template<typename T>
+    std::optional<T> getFieldAs(size_t index) const {
+        if (index >= fields_->size()) {
+            return std::nullopt;
+        }
+        return parseFieldAs<T>((*fields_)[index]);
+    }
+
+    template<typename T>
+    std::optional<T> getFieldAs(const std::string& header) const {
+        auto index = getFieldIndex(header);
+        if (!index.has_value()) {
+            return std::nullopt;
+        }
+        return getFieldAs<T>(index.value());
+    }
+
+    // EN: Row information
+    // FR: Informations sur la ligne
+    size_t getRowNumber() const { return row_number_; }
+    size_t getFieldCount() const { return fields_->size(); }
+    const std::vector<std::string_view>& getFields() const { return *fields_; }
+    bool hasHeaders() const { return headers_ != nullptr && !headers_->names.empty(); }
+
+    // EN: Copy the row out of the parser buffers
+    // FR: Copie la ligne hors des buffers du parser
+    ParsedRow toParsedRow() const;
+
+private:
+    size_t row_number_;                                         // EN: 1-based row number / FR: Numéro de ligne base 1
+    const std::vector<std::string_view>* fields_;               // EN: Field slices / FR: Tranches des champs
+    const HeaderIndex* headers_;                                // EN: Shared header index / FR: Index d'en-têtes partagé
+};
+
+// EN: Columnar batch of parsed rows. Every field of every row is copied once into a single byte buffer and
+//     each column is a vector of (offset, length) spans into it, so filling a reused batch allocates nothing
+//     in steady state. Rows shorter than the widest row read as empty fields past their own field count.
+// FR: Lot colonnaire de lignes analysées. Chaque champ de chaque ligne est copié une fois dans un unique buffer
+//     d'octets et chaque colonne est un vecteur de plages (offset, longueur) dans ce buffer ; remplir un lot
+//     réutilisé n'alloue donc rien en régime établi. Les lignes plus courtes que la plus large lisent des
+//     champs vides au-delà de leur propre nombre de champs.
+class RowBatch {
+public:
+    // EN: Location of one field in the batch buffer
+    // FR: Emplacement d'un champ dans le buffer du lot
+    struct FieldSpan {
+        uint32_t offset{0};
+        uint32_t length{0};
+    };
+    
+    // EN: Largest buffer a batch can address with 32-bit offsets
+    // FR: Plus grand buffer qu'un lot peut adresser avec des offsets 32 bits
+    static constexpr size_t kMaxBufferSize = UINT32_MAX;
+    
+    // EN: Constructor
+    // FR: Constructeur
+    explicit RowBatch(std::shared_ptr<const HeaderIndex> headers = nullptr) : headers_(std::move(headers)) {}
+    
+    // EN: Batch building (used by the parser)
+    // FR: Construction du lot (utilisée par le parser)
+    void appendRow(size_t row_number, const std::vector<std::string_view>& fields);
+    void appendRow(size_t row_number, const std::vector<std::string>& fields);
+    void setHeaders(std::shared_ptr<const HeaderIndex> headers) { headers_ = std::move(headers); }
+    void clear();
+    
+    // EN: Batch information
+    // FR: Informations sur le lot
+    size_t getRowCount() const { return row_numbers_.size(); }
+    size_t getColumnCount() const { return column_count_; }
+    bool empty() const { return row_numbers_.empty(); }
+    size_t getByteSize() const { return buffer_.size(); }
+    
+    // EN: Row information
+    // FR: Informations sur une ligne
+    size_t getRowNumber(size_t row) const { return row_numbers_[row]; }
+    size_t getFieldCount(size_t row) const { return field_counts_[row]; }
+    
+    // EN: Field access (empty view when out of range); views are valid while the batch is unchanged
+    // FR: Accès aux champs (vue vide si hors limites) ; les vues sont valides tant que le lot n'est pas modifié
+    std::string_view getField(size_t row, size_t column) const;
+    std::string_view getField(size_t row, const std::string& header) const;
+    std::optional<size_t> getColumnIndex(const std::string& header) const;
+    
+    // EN: Typed field access with std::from_chars, no copy and no exception (see parseField())
+    // FR: Accès typé aux champs avec std::from_chars, sans copie ni exception (voir parseField())
+    template<typename T>
+    std::optional<T> getFieldAs(size_t row, size_t column) const {
+        if (row >= row_numbers_.size() || column >= column_count_) {
+            return std::nullopt;
+        }
+        return parseFieldAs<T>(view(columns_[column][row]));
+    }
+    
+    // EN: Typed column extraction: convert a whole column into a contiguous vector in one pass. `values` gets
+    //     one entry per row (reusing its capacity); fields that do not convert, including missing ones, are set
+    //     to `fallback` and flagged 0 in `valid` when given. Returns the number of converted fields.
+    // FR: Extraction typée de colonne : convertit toute une colonne en un vecteur contigu en une passe. `values`
+    //     reçoit une entrée par ligne (en réutilisant sa capacité) ; les champs qui ne se convertissent pas, y
+    //     compris absents, valent `fallback` et sont marqués 0 dans `valid` s'il est fourni. Retourne le nombre
+    //     de champs convertis.
+    template<typename T>
+    size_t extractColumn(size_t column, std::vector<T>& values, std::vector<uint8_t>* valid = nullptr, T fallback = T{}) const;
+    
+    template<typename T>
+    size_t extractColumn(const std::string& header, std::vector<T>& values, std::vector<uint8_t>* valid = nullptr, T fallback = T{}) const {
+        auto column = getColumnIndex(header);
+        return extractColumn(column.value_or(column_count_), values, valid, fallback);
+    }
+    
+    // EN: Raw columnar access
+    // FR: Accès colonnaire brut
+    const std::vector<FieldSpan>& getColumn(size_t column) const { return columns_[column]; }
+    std::string_view view(const FieldSpan& span) const { return std::string_view(buffer_.data() + span.offset, span.length); }
+    const std::string& getBuffer() const { return buffer_; }
+    
+    // EN: Shared header index
+    // FR: Index d'en-têtes partagé
+    const std::vector<std::string>& getHeaders() const;
+    const std::shared_ptr<const HeaderIndex>& getHeaderIndex() const { return headers_; }
+    bool hasHeaders() const { return headers_ != nullptr && !headers_->names.empty(); }
     
-    // EN: Initialize header mapping
-    // FR: Initialise le mappage des en-têtes
-    void initializeHeaderMap();
+    // EN: Copy one row out of the batch
+    // FR: Copie une ligne hors du lot
+    ParsedRow toParsedRow(size_t row) const;
+    
+private:
+    std::shared_ptr<const HeaderIndex> headers_;     // EN: Shared header index / FR: Index d'en-têtes partagé
+    std::string buffer_;                             // EN: Field bytes of all rows / FR: Octets des champs de toutes les lignes
+    std::vector<std::vector<FieldSpan>> columns_;    // EN: Per-column spans (storage kept across clear()) / FR: Plages par colonne (stockage conservé entre clear())
+    size_t column_count_{0};                         // EN: Columns in use / FR: Colonnes utilisées
+    std::vector<size_t> row_numbers_;                // EN: 1-based row numbers / FR: Numéros de ligne base 1
+    std::vector<uint32_t> field_counts_;             // EN: Field count per row / FR: Nombre de champs par ligne
+    
+    template<typename Field>
+    void appendFields(size_t row_number, const std::vector<Field>& fields);
 };
 
 // EN: Parser statistics and performance metrics
@@ -166,7 +387,9 @@ public:
     void incrementRowsSkipped() { rows_skipped_++; }
     void incrementRowsWithErrors() { rows_with_errors_++; }
     void addBytesRead(size_t bytes) { bytes_read_ += bytes; }
+    void addFieldsSkipped(size_t count) { fields_skipped_ += count; }
     void recordFieldCount(size_t count);
+    void addHeapAllocations(size_t count) { heap_allocations_ += count; }
     
     // EN: Getters
     // FR: Accesseurs
@@ -174,6 +397,7 @@ public:
     size_t getRowsSkipped() const { return rows_skipped_; }
     size_t getRowsWithErrors() const { return rows_with_errors_; }
     size_t getBytesRead() const { return bytes_read_; }
+    size_t getFieldsSkipped() const { return fields_skipped_; }
     std::chrono::duration<double> getParsingDuration() const { return parsing_duration_; }
     double getRowsPerSecond() const;
     double getBytesPerSecond() const;
@@ -181,6 +405,13 @@ public:
     size_t getMinFieldCount() const { return min_field_count_; }
     size_t getMaxFieldCount() const { return max_field_count_; }
     
+    // EN: Memory: heap allocations (malloc calls) made to store ParsedRow fields, and the process peak resident
+    //     set size sampled when the last parse finished
+    // FR: Mémoire : allocations sur le tas (appels à malloc) faites pour stocker les champs des ParsedRow, et pic
+    //     de mémoire résidente du processus relevé à la fin du dernier parsing
+    size_t getHeapAllocations() const { return heap_allocations_; }
+    size_t getPeakRssBytes() const { return peak_rss_bytes_; }
+    
     // EN: Generate report
     // FR: Génère un rapport
     std::string generateReport() const;
@@ -190,18 +421,100 @@ private:
     std::atomic<size_t> rows_skipped_{0};       // EN: Number of skipped rows / FR: Nombre de lignes ignorées
     std::atomic<size_t> rows_with_errors_{0};   // EN: Number of rows with parsing errors / FR: Nombre de lignes avec erreurs de parsing
     std::atomic<size_t> bytes_read_{0};         // EN: Total bytes read from file / FR: Total d'octets lus du fichier
+    std::atomic<size_t> fields_skipped_{0};     // EN: Fields left unmaterialized by the projection / FR: Champs non matérialisés à cause de la projection
     std::chrono::high_resolution_clock::time_point start_time_; // EN: Parsing start time / FR: Heure de début du parsing
     std::chrono::duration<double> parsing_duration_{0};         // EN: Total parsing duration / FR: Durée totale du parsing
     std::atomic<size_t> total_field_count_{0};  // EN: Total field count for average calculation / FR: Nombre total de champs pour calcul moyenne
     std::atomic<size_t> min_field_count_{SIZE_MAX}; // EN: Minimum field count per row / FR: Nombre minimum de champs par ligne
     std::atomic<size_t> max_field_count_{0};    // EN: Maximum field count per row / FR: Nombre maximum de champs par ligne
+    std::atomic<size_t> heap_allocations_{0};   // EN: Heap allocations for row storage / FR: Allocations sur le tas pour le stockage des lignes
+    std::atomic<size_t> peak_rss_bytes_{0};     // EN: Process peak RSS at the end of parsing / FR: Pic RSS du processus en fin de parsing
     mutable std::mutex stats_mutex_;            // EN: Mutex for thread-safe statistics / FR: Mutex pour statistiques thread-safe
 };
 
-// EN: Row callback function type
-// FR: Type de fonction callback de ligne
+// EN: Reusable zero-copy row tokenizer over a contiguous byte range. Each instance owns its scanner and scratch
+//     buffers, so one tokenizer per thread can split independent row-aligned chunks of the same input.
+// FR: Tokenizer de lignes zero-copy réutilisable sur une plage d'octets contiguë. Chaque instance possède son
+//     scanner et ses buffers temporaires, donc un tokenizer par thread peut découper des chunks indépendants
+//     alignés sur les lignes d'une même entrée.
+class RowTokenizer {
+public:
+    // EN: Outcome of a tokenize() call
+    // FR: Résultat d'un appel à tokenize()
+    struct Result {
+        size_t bytes_consumed{0};       // EN: Absolute offset where tokenizing ended / FR: Offset absolu de fin du découpage
+        bool stopped{false};            // EN: The sink asked to stop / FR: Le récepteur a demandé l'arrêt
+        bool unterminated_quote{false}; // EN: Input ended inside a quoted field / FR: L'entrée s'est terminée dans un champ quoté
+        size_t fields_skipped{0};       // EN: Fields dropped by the projection / FR: Champs écartés par la projection
+    };
+    
+    // EN: Bytes scanned per scanner call (keeps structural offsets in 32 bits and the index in cache)
+    // FR: Octets scannés par appel au scanner (garde les offsets structurels sur 32 bits et l'index en cache)
+    static constexpr size_t kScanWindowSize = 1 << 20;
+    
+    // EN: Constructor
+    // FR: Constructeur
+    explicit RowTokenizer(const ParserConfig& config = ParserConfig{});
+    
+    // EN: Split the rows of data[begin, end) and call sink(fields, row_end_offset) for each one; the field views
+    //     are valid during the call only. Blank lines are skipped. Returning false from the sink stops. With
+    //     end_of_input false, a trailing row without line terminator is left alone and bytes_consumed points
+    //     at its start, so the caller can carry it over to the next block.
+    // FR: Découpe les lignes de data[begin, end) et appelle sink(champs, offset_fin_ligne) pour chacune ; les vues
+    //     ne sont valides que pendant l'appel. Les lignes vides sont ignorées. Retourner false arrête. Avec
+    //     end_of_input à false, une dernière ligne sans fin de ligne est laissée telle quelle et bytes_consumed
+    //     pointe sur son début, pour que l'appelant la reporte sur le bloc suivant.
+    template<typename RowSink>
+    Result tokenize(const char* data, size_t begin, size_t end, RowSink&& sink, bool end_of_input = true);
+    
+    // EN: Materialize only the given source columns, in that order; rows then always have columns.size()
+    //     fields. Other fields are skipped by the scanner and never decoded. Empty = every column.
+    // FR: Ne matérialise que les colonnes source données, dans cet ordre ; les lignes ont alors toujours
+    //     columns.size() champs. Les autres champs sont sautés par le scanner et jamais décodés. Vide = toutes.
+    void setProjection(const std::vector<size_t>& columns);
+    bool hasProjection() const { return !projection_slots_.empty(); }
+    
+    // EN: First row start after `pos`, given the quote state at `pos` (end if there is none)
+    // FR: Premier début de ligne après `pos`, selon l'état des quotes à `pos` (end s'il n'y en a pas)
+    size_t findNextRowStart(const char* data, size_t pos, size_t end, bool in_quotes);
+    
+    // EN: Decode a raw field span with parseRow() semantics; unescaped bytes are appended to `scratch`
+    // FR: Décode une plage brute de champ avec la sémantique de parseRow() ; les octets déséchappés vont dans `scratch`
+    static std::string_view decodeField(std::string_view raw, size_t quote_count, const ParserConfig& config, std::string& scratch);
+    
+private:
+    ParserConfig config_;                                // EN: Tokenizer configuration / FR: Configuration du tokenizer
+    StructuralScanner scanner_;                          // EN: SIMD structural-character scanner / FR: Scanner SIMD des caractères structurels
+    std::vector<StructuralIndex> structurals_;           // EN: Structurals of the current scan window / FR: Structurels de la fenêtre de scan courante
+    std::vector<std::string_view> field_views_;          // EN: Field slices of the current row / FR: Tranches des champs de la ligne courante
+    std::string row_scratch_;                            // EN: Unescaped field bytes of the current row / FR: Octets de champs déséchappés de la ligne courante
+    std::vector<std::pair<size_t, std::pair<size_t, size_t>>> scratch_fields_; // EN: (field index, (offset, length)) into row_scratch_ / FR: (index de champ, (offset, longueur)) dans row_scratch_
+    std::vector<size_t> projection_slots_;               // EN: Output slot per source column (kSkippedColumn = dropped) / FR: Emplacement de sortie par colonne source (kSkippedColumn = écartée)
+    size_t projected_count_{0};                          // EN: Fields per projected row / FR: Champs par ligne projetée
+    size_t column_{0};                                   // EN: Source column of the next field / FR: Colonne source du prochain champ
+    size_t fields_skipped_{0};                           // EN: Fields dropped in the current tokenize() call / FR: Champs écartés dans l'appel tokenize() courant
+    
+    static constexpr size_t kSkippedColumn = SIZE_MAX;
+    
+    void appendField(const char* begin, const char* end, size_t quote_count);
+    void resolveScratchFields();
+    void resetRow();
+};
+
+// EN: Row callback function type. Returning false skips the row, on every parsing path; use a RowViewCallback or a
+//     BatchCallback, or stopParsing(), to end the parse early.
+// FR: Type de fonction callback de ligne. Retourner false ignore la ligne, sur tous les chemins de parsing ;
+//     utiliser un RowViewCallback ou un BatchCallback, ou stopParsing(), pour terminer le parsing plus tôt.
 using RowCallback = std::function<bool(const ParsedRow& row, ParserError error)>;
 
+// EN: Zero-copy row callback function type (memory-mapped mode). Returning false stops parsing.
+// FR: Type de fonction callback de ligne zero-copy (mode mappé en mémoire). Retourner false arrête le parsing.
+using RowViewCallback = std::function<bool(const RowView& row, ParserError error)>;
+
+// EN: Batch callback function type. The batch is reused after the call returns. Returning false stops parsing.
+// FR: Type de fonction callback de lot. Le lot est réutilisé après le retour de l'appel. Retourner false arrête le parsing.
+using BatchCallback = std::function<bool(const RowBatch& batch, ParserError error)>;
+
 // EN: Progress callback function type (called periodically with current progress)
 // FR: Type de fonction callback de progression (appelée périodiquement avec progression actuelle)
 using ProgressCallback = std::function<void(size_t rows_processed, size_t bytes_read, double progress_percent)>;
@@ -244,15 +557,47 @@ public:
     // EN: Callback registration
     // FR: Enregistrement des callbacks
     void setRowCallback(RowCallback callback) { row_callback_ = std::move(callback); }
+    void setRowViewCallback(RowViewCallback callback) { row_view_callback_ = std::move(callback); }
+    void setBatchCallback(BatchCallback callback) { batch_callback_ = std::move(callback); }
     void setProgressCallback(ProgressCallback callback) { progress_callback_ = std::move(callback); }
     void setErrorCallback(ErrorCallback callback) { error_callback_ = std::move(callback); }
     
-    // EN: Main parsing methods
-    // FR: Méthodes principales de parsing
+    // EN: Main parsing methods. parseFile() and parseFileAsync() read gzip/zlib files transparently (see
+    //     ParserConfig::decompress_input); rows are cut with the zero-copy tokenizer while a background thread
+    //     inflates the next block.
+    // FR: Méthodes principales de parsing. parseFile() et parseFileAsync() lisent les fichiers gzip/zlib de façon
+    //     transparente (voir ParserConfig::decompress_input) ; les lignes sont découpées par le tokenizer
+    //     zero-copy pendant qu'un thread d'arrière-plan inflate le bloc suivant.
     ParserError parseFile(const std::string& file_path);
     ParserError parseStream(std::istream& stream);
     ParserError parseString(const std::string& csv_content);
     
+    // EN: Memory-mapped zero-copy parsing (madvise(MADV_SEQUENTIAL)). Rows go to the view callback as slices of
+    //     the mapping; the ParsedRow callback, if set, receives materialized copies. Either callback returning
+    //     false stops parsing. With enable_parallel_processing, chunks are tokenized on a thread pool and rows
+    //     are still delivered in file order on the calling thread.
+    // FR: Parsing zero-copy mappé en mémoire (madvise(MADV_SEQUENTIAL)). Les lignes vont au callback de vue sous
+    //     forme de tranches du mapping ; le callback ParsedRow, s'il est défini, reçoit des copies matérialisées.
+    //     Un callback retournant false arrête le parsing. Avec enable_parallel_processing, les chunks sont
+    //     découpés sur un pool de threads et les lignes restent transmises dans l'ordre du fichier sur le
+    //     thread appelant.
+    ParserError parseFileMapped(const std::string& file_path);
+    
+    // EN: Random access through a RowIndex. parseFileRange() parses one range (e.g. from RowIndex::split());
+    //     parseFileFromRow() starts at data row `first_row` (0-based, header excluded) and delivers at most
+    //     `row_count` rows (0 = to the end), jumping through the "<file>.idx" sidecar when it is valid for the
+    //     file. The header row is always read first. Rows keep their file-wide row numbers.
+    // FR: Accès aléatoire via un RowIndex. parseFileRange() parse une plage (par ex. issue de RowIndex::split()) ;
+    //     parseFileFromRow() démarre à la ligne de données `first_row` (base 0, en-tête exclu) et transmet au
+    //     plus `row_count` lignes (0 = jusqu'à la fin), en sautant via l'annexe "<fichier>.idx" quand elle est
+    //     valide pour le fichier. L'en-tête est toujours lu d'abord. Les lignes gardent leur numéro dans le fichier.
+    ParserError parseFileRange(const std::string& file_path, const RowRange& range);
+    ParserError parseFileFromRow(const std::string& file_path, size_t first_row, size_t row_count = 0);
+    
+    // EN: Row index built by the last parseFile() with row_index_stride > 0
+    // FR: Index de lignes construit par le dernier parseFile() avec row_index_stride > 0
+    const RowIndex& getRowIndex() const { return row_index_; }
+    
     // EN: Async parsing methods (returns immediately, parsing happens in background)
     // FR: Méthodes de parsing asynchrone (retourne immédiatement, parsing en arrière-plan)
     ParserError parseFileAsync(const std::string& file_path);
@@ -275,6 +620,10 @@ public:
     const ParserStatistics& getStatistics() const { return stats_; }
     void resetStatistics() { stats_.reset(); }
     
+    // EN: Header names of the last parse (empty without a header row)
+    // FR: Noms d'en-têtes du dernier parsing (vide sans ligne d'en-tête)
+    const std::vector<std::string>& getHeaders() const;
+    
     // EN: Utility methods
     // FR: Méthodes utilitaires
     static EncodingType detectEncoding(const std::string& file_path);
@@ -290,6 +639,8 @@ public:
 private:
     ParserConfig config_;                   // EN: Parser configuration / FR: Configuration du parser
     RowCallback row_callback_;              // EN: Row processing callback / FR: Callback de traitement de ligne
+    RowViewCallback row_view_callback_;     // EN: Zero-copy row callback / FR: Callback de ligne zero-copy
+    BatchCallback batch_callback_;          // EN: Columnar batch callback / FR: Callback de lot colonnaire
     ProgressCallback progress_callback_;    // EN: Progress reporting callback / FR: Callback de rapport de progression
     ErrorCallback error_callback_;          // EN: Error handling callback / FR: Callback de gestion d'erreur
     ParserStatistics stats_;                // EN: Parsing statistics / FR: Statistiques de parsing
@@ -309,7 +660,16 @@ private:
     size_t buffer_pos_{0};                  // EN: Current position in buffer / FR: Position actuelle dans le buffer
     size_t buffer_size_{0};                 // EN: Current buffer size / FR: Taille actuelle du buffer
     std::string current_row_;               // EN: Current row being parsed / FR: Ligne actuelle en cours de parsing
-    std::vector<std::string> headers_;      // EN: Cached header names / FR: Noms d'en-têtes mis en cache
+    std::shared_ptr<const HeaderIndex> headers_; // EN: Header index shared with rows and batches / FR: Index d'en-têtes partagé avec les lignes et lots
+    RowBatch batch_;                        // EN: Batch being filled for the batch callback / FR: Lot en cours de remplissage pour le callback de lot
+    std::vector<size_t> projection_;        // EN: Resolved source columns of the projection / FR: Colonnes source résolues de la projection
+    RowTokenizer tokenizer_;                // EN: Zero-copy tokenizer for the mapped path / FR: Tokenizer zero-copy pour le chemin mappé
+    std::vector<std::string_view> field_views_; // EN: Row reassembled from a parallel chunk / FR: Ligne reconstituée depuis un chunk parallèle
+    RowIndex row_index_;                    // EN: Row index built during the last mapped parse / FR: Index de lignes construit pendant le dernier parsing mappé
+    const char* index_data_{nullptr};       // EN: Mapping being indexed (null = no indexing) / FR: Mapping en cours d'indexation (null = pas d'indexation)
+    size_t index_size_{0};                  // EN: Size of the indexed mapping / FR: Taille du mapping indexé
+    size_t index_next_row_start_{0};        // EN: Start offset of the next row to index / FR: Offset de début de la prochaine ligne à indexer
+    std::unique_ptr<RowArena> row_arena_;   // EN: Storage of the ParsedRow handed to the row callback / FR: Stockage des ParsedRow passées au callback de ligne
     
     // EN: Parsing state
     // FR: État du parsing
@@ -335,6 +695,36 @@ private:
     ParserError fillBuffer(std::istream& stream);
     std::string extractNextRow();
     
+    // EN: Zero-copy tokenizer over a contiguous byte range
+    // FR: Tokenizer zero-copy sur une plage d'octets contiguë
+    ParserError parseMappedRange(const char* data, size_t size);
+    size_t parseMappedPrologue(const char* data, size_t size, ParserError& result);
+    ParserError parseMappedSlice(const std::string& file_path, const RowRange& range, size_t skip_rows, size_t max_rows);
+    ParserError parseCompressedFile(const std::string& file_path);
+    ParserError parseFileReadAhead(const std::string& file_path);
+    template<typename BlockReader>
+    ParserError parseBlocks(const std::string& file_path, BlockReader& reader, const std::string& failure_message);
+    ParserError parseMappedRangeParallel(const char* data, size_t begin, size_t size, size_t thread_count);
+    bool deliverRowView(const std::vector<std::string_view>& fields, size_t bytes_consumed);
+    void indexRow(size_t row_end);
+    bool dispatchRowView(size_t row_number, const std::vector<std::string_view>& fields);
+    void deliverParsedRow(size_t row_number, const std::vector<std::string_view>& fields);
+    size_t resolveThreadCount() const;
+    size_t parseMappedHeader(const char* data, size_t begin, size_t size, ParserError& result);
+    void reportUnterminatedQuote(ParserError& result);
+    
+    // EN: Column projection
+    // FR: Projection de colonnes
+    bool hasProjectionConfig() const { return !config_.projected_columns.empty() || !config_.projected_column_indices.empty(); }
+    ParserError applyProjection();
+    
+    // EN: Columnar batch delivery
+    // FR: Transmission des lots colonnaires
+    void setHeaders(std::vector<std::string> names);
+    template<typename Field>
+    bool appendToBatch(size_t row_number, const std::vector<Field>& fields);
+    bool flushBatch();
+    
     // EN: Encoding handling
     // FR: Gestion d'encodage
     ParserError handleEncoding(std::istream& stream);
@@ -353,56 +743,141 @@ private:
     // FR: Gestion d'état de parsing thread-safe
     void setParsingState(bool parsing, bool paused = false);
     bool checkShouldStop() const;
+    bool waitWhilePaused();
 };
 
+// EN: Template implementation of the zero-copy tokenizer loop
+// FR: Implémentation template de la boucle du tokenizer zero-copy
+template<typename RowSink>
+RowTokenizer::Result RowTokenizer::tokenize(const char* data, size_t begin, size_t end, RowSink&& sink, bool end_of_input) {
+    Result result;
+    fields_skipped_ = 0;
+    resetRow();
+    
+    const char delimiter = config_.delimiter;
+    size_t row_start = begin;
+    size_t skipped_before_row = 0;
+    size_t field_start = begin;
+    size_t quote_count = 0;
+    bool in_quotes = false;
+    
+    for (size_t window = begin; window < end; window += kScanWindowSize) {
+        size_t window_size = std::min(kScanWindowSize, end - window);
+        structurals_.clear();
+        size_t trailing_quotes = scanner_.scan(data + window, window_size, in_quotes, structurals_);
+        
+        for (const auto& structural : structurals_) {
+            size_t at = window + structural.offset;
+            quote_count += structural.quote_count;
+            
+            if (data[at] == delimiter) {
+                appendField(data + field_start, data + at, quote_count);
+            } else {
+                if (at != field_start || column_ > 0) {
+                    appendField(data + field_start, data + at, quote_count);
+                    resolveScratchFields();
+                    bool keep_going = sink(static_cast<const std::vector<std::string_view>&>(field_views_), at + 1);
+                    resetRow();
+                    if (!keep_going) {
+                        result.stopped = true;
+                        result.bytes_consumed = at + 1;
+                        result.fields_skipped = fields_skipped_;
+                        return result;
+                    }
+                }
+                // EN: Empty lines and the second half of CRLF emit nothing; either way the next row starts here
+                // FR: Les lignes vides et la seconde moitié de CRLF n'émettent rien ; la ligne suivante commence ici
+                row_start = at + 1;
+                skipped_before_row = fields_skipped_;
+            }
+            
+            field_start = at + 1;
+            quote_count = 0;
+        }
+        quote_count += trailing_quotes;
+    }
+    
+    // EN: Incomplete last row of a block: hand it back untouched, its skipped fields are counted next time
+    // FR: Dernière ligne incomplète d'un bloc : rendue intacte, ses champs écartés seront comptés la prochaine fois
+    if (!end_of_input) {
+        resetRow();
+        result.bytes_consumed = row_start;
+        result.fields_skipped = skipped_before_row;
+        return result;
+    }
+    
+    // EN: Last row without a trailing line terminator
+    // FR: Dernière ligne sans fin de ligne finale
+    if (field_start < end || column_ > 0) {
+        if (in_quotes) {
+            result.unterminated_quote = true;
+        } else {
+            appendField(data + field_start, data + end, quote_count);
+            resolveScratchFields();
+            result.stopped = !sink(static_cast<const std::vector<std::string_view>&>(field_views_), end);
+        }
+        resetRow();
+    }
+    
+    result.bytes_consumed = end;
+    result.fields_skipped = fields_skipped_;
+    return result;
+}
+
 // EN: Template implementations for type conversion
 // FR: Implémentations de template pour conversion de type
 template<typename T>
 std::optional<T> ParsedRow::getFieldAs(size_t index) const {
-    auto field = getFieldSafe(index);
-    if (!field.has_value()) {
+    if (index >= fields_.size()) {
         return std::nullopt;
     }
-    
-    try {
-        if constexpr (std::is_same_v<T, int>) {
-            return std::stoi(field.value());
-        } else if constexpr (std::is_same_v<T, long>) {
-            return std::stol(field.value());
-        } else if constexpr (std::is_same_v<T, long long>) {
-            return std::stoll(field.value());
-        } else if constexpr (std::is_same_v<T, float>) {
-            return std::stof(field.value());
-        } else if constexpr (std::is_same_v<T, double>) {
-            return std::stod(field.value());
-        } else if constexpr (std::is_same_v<T, bool>) {
-            const std::string& value = field.value();
-            if (value == "true" || value == "1" || value == "yes" || value == "on") {
-                return true;
-            } else if (value == "false" || value == "0" || value == "no" || value == "off") {
-                return false;
-            }
-            return std::nullopt;
-        } else if constexpr (std::is_same_v<T, std::string>) {
-            return field.value();
-        } else {
-            // EN: Unsupported type
-            // FR: Type non supporté
-            static_assert(sizeof(T) == 0, "Unsupported type for field conversion");
-            return std::nullopt;
-        }
-    } catch (...) {
-        return std::nullopt;
+    if constexpr (std::is_same_v<T, std::string>) {
+        return std::string(fields_[index]);
+    } else {
+        return parseFieldAs<T>(fields_[index]);
     }
 }
 
 template<typename T>
 std::optional<T> ParsedRow::getFieldAs(const std::string& header) const {
-    auto it = header_map_.find(header);
-    if (it == header_map_.end()) {
+    auto index = findHeader(header);
+    if (!index.has_value()) {
         return std::nullopt;
     }
-    return getFieldAs<T>(it->second);
+    return getFieldAs<T>(index.value());
+}
+
+template<typename T>
+size_t RowBatch::extractColumn(size_t column, std::vector<T>& values, std::vector<uint8_t>* valid, T fallback) const {
+    const size_t rows = row_numbers_.size();
+    values.resize(rows);
+    if (valid != nullptr) {
+        valid->resize(rows);
+    }
+    if (column >= column_count_) {
+        std::fill(values.begin(), values.end(), fallback);
+        if (valid != nullptr) {
+            std::fill(valid->begin(), valid->end(), uint8_t{0});
+        }
+        return 0;
+    }
+    
+    // EN: Straight walk over the column spans; the buffer is read once, in row order
+    // FR: Parcours direct des plages de la colonne ; le buffer est lu une fois, dans l'ordre des lignes
+    const std::vector<FieldSpan>& spans = columns_[column];
+    const char* base = buffer_.data();
+    size_t converted = 0;
+    for (size_t row = 0; row < rows; ++row) {
+        const bool ok = parseField(std::string_view(base + spans[row].offset, spans[row].length), values[row]);
+        if (!ok) {
+            values[row] = fallback;
+        }
+        if (valid != nullptr) {
+            (*valid)[row] = ok ? 1 : 0;
+        }
+        converted += ok ? 1 : 0;
+    }
+    return converted;
 }
 
 } // namespace CSV
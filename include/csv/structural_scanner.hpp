@@ -0,0 +1,78 @@
+// EN: Vectorized CSV structural-character scanner (delimiters, quotes, line ends) with runtime SIMD dispatch
+// FR: Scanner vectorisé des caractères structurels CSV (délimiteurs, quotes, fins de ligne) avec dispatch SIMD à l'exécution
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Scanner implementations. AUTO picks the widest one the CPU supports.
+// FR: Implémentations du scanner. AUTO choisit la plus large supportée par le CPU.
+enum class ScannerBackend {
+    AUTO,           // EN: Best available at runtime / FR: Meilleure disponible à l'exécution
+    SCALAR,         // EN: Portable byte loop, shift-based prefix XOR / FR: Boucle octet portable, XOR préfixe par décalages
+    SSE42,          // EN: 4 x 16-byte compares + CLMUL prefix XOR / FR: 4 x comparaisons 16 octets + XOR préfixe CLMUL
+    AVX2            // EN: 2 x 32-byte compares + CLMUL prefix XOR / FR: 2 x comparaisons 32 octets + XOR préfixe CLMUL
+};
+
+// EN: One unquoted delimiter or line terminator found by the scanner
+// FR: Un délimiteur ou une fin de ligne hors quotes trouvé par le scanner
+struct StructuralIndex {
+    uint32_t offset;        // EN: Byte offset relative to the scanned range / FR: Offset en octets relatif à la plage scannée
+    uint32_t quote_count;   // EN: Quote characters since the previous structural / FR: Caractères quote depuis le structurel précédent
+};
+
+// EN: Per-64-byte-block classification masks (bit i = byte i of the block)
+// FR: Masques de classification par bloc de 64 octets (bit i = octet i du bloc)
+struct BlockMasks {
+    uint64_t quotes{0};         // EN: Quote characters / FR: Caractères quote
+    uint64_t delimiters{0};     // EN: Delimiter characters / FR: Caractères délimiteurs
+    uint64_t newlines{0};       // EN: '\n' and '\r' / FR: '\n' et '\r'
+    uint64_t inside_quotes{0};  // EN: Bytes inside a quoted section / FR: Octets dans une section quotée
+};
+
+// EN: Finds field and row boundaries 64 bytes at a time. Quote state is resolved with a prefix XOR over the
+//     quote bitmask, so doubled quotes ("") need no special casing: they toggle the state twice.
+// FR: Trouve les limites de champs et de lignes 64 octets à la fois. L'état des quotes est résolu par un XOR
+//     préfixe sur le masque des quotes, donc les quotes doublées ("") ne demandent aucun cas particulier.
+class StructuralScanner {
+public:
+    // EN: Constructor (falls back to SCALAR if the requested backend is not supported by this CPU)
+    // FR: Constructeur (repli sur SCALAR si le backend demandé n'est pas supporté par ce CPU)
+    explicit StructuralScanner(char delimiter = ',', char quote_char = '"', ScannerBackend backend = ScannerBackend::AUTO);
+
+    // EN: Append every unquoted delimiter/line terminator of [data, data + size) to `out`. `in_quotes` carries
+    //     the quote state in and out so a large input can be scanned in consecutive windows. Returns the number
+    //     of quote characters after the last structural. `size` must fit in 32 bits.
+    // FR: Ajoute chaque délimiteur/fin de ligne hors quotes de [data, data + size) à `out`. `in_quotes` transporte
+    //     l'état des quotes en entrée et en sortie pour scanner une grosse entrée par fenêtres consécutives.
+    //     Retourne le nombre de quotes après le dernier structurel. `size` doit tenir sur 32 bits.
+    size_t scan(const char* data, size_t size, bool& in_quotes, std::vector<StructuralIndex>& out) const;
+
+    // EN: Classify `block_count` full 64-byte blocks and resolve their quote masks
+    // FR: Classifie `block_count` blocs complets de 64 octets et résout leurs masques de quotes
+    void classify(const char* data, size_t block_count, bool& in_quotes, BlockMasks* out) const;
+
+    // EN: Backend information
+    // FR: Informations sur le backend
+    ScannerBackend getBackend() const { return backend_; }
+    static ScannerBackend detectBackend();
+    static bool isSupported(ScannerBackend backend);
+    static const char* backendName(ScannerBackend backend);
+
+private:
+    using ClassifyFunction = void (*)(const char* data, size_t block_count, char delimiter, char quote_char,
+                                      uint64_t& quote_carry, BlockMasks* out);
+
+    char delimiter_;                // EN: Field delimiter / FR: Délimiteur de champ
+    char quote_char_;               // EN: Quote character / FR: Caractère de quote
+    ScannerBackend backend_;        // EN: Resolved backend / FR: Backend résolu
+    ClassifyFunction classify_;     // EN: Backend block classifier / FR: Classifieur de blocs du backend
+};
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,62 @@
+// EN: Top-K selection for ORDER BY ... LIMIT: keeps the k first elements of a stream in a bounded heap
+// FR: Sélection Top-K pour ORDER BY ... LIMIT : garde les k premiers éléments d'un flux dans un tas borné
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: The k smallest elements under `Less`, held in a max-heap of at most k elements: an element enters only if
+//     it sorts before the current k-th, so a scan of n rows costs O(n log k) comparisons and O(k) memory instead
+//     of sorting all n. `Less` must be a strict total order (break ties on input position for a stable result).
+// FR: Les k plus petits éléments selon `Less`, tenus dans un tas max d'au plus k éléments : un élément n'entre
+//     que s'il se trie avant le k-ième courant, un parcours de n lignes coûte donc O(n log k) comparaisons et
+//     O(k) mémoire au lieu de trier les n. `Less` doit être un ordre total strict (départager les égalités par
+//     position d'entrée pour un résultat stable).
+template <typename T, typename Less>
+class TopK {
+public:
+    explicit TopK(size_t k, Less less = Less()) : k_(k), less_(std::move(less)) {
+        heap_.reserve(k);
+    }
+
+    // EN: Whether `value` would be kept right now; lets callers skip building elements that cannot enter
+    // FR: Si `value` serait gardé maintenant ; permet de ne pas construire des éléments qui ne peuvent entrer
+    bool admits(const T& value) const {
+        return heap_.size() < k_ || (k_ > 0 && less_(value, heap_.front()));
+    }
+
+    void push(T value) {
+        if (heap_.size() < k_) {
+            heap_.push_back(std::move(value));
+            std::push_heap(heap_.begin(), heap_.end(), less_);
+        } else if (admits(value)) {
+            std::pop_heap(heap_.begin(), heap_.end(), less_);
+            heap_.back() = std::move(value);
+            std::push_heap(heap_.begin(), heap_.end(), less_);
+        }
+    }
+
+    // EN: The kept elements in ascending order; the selector is empty afterwards
+    // FR: Les éléments gardés en ordre croissant ; le sélecteur est vide ensuite
+    std::vector<T> take() {
+        std::sort_heap(heap_.begin(), heap_.end(), less_);
+        return std::exchange(heap_, {});
+    }
+
+    size_t size() const { return heap_.size(); }
+    size_t capacity() const { return k_; }
+
+private:
+    size_t k_;
+    Less less_;
+    std::vector<T> heap_;
+};
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,100 @@
+// EN: Per-block column summaries (zone maps) with Bloom filters, letting full scans skip row blocks that no
+//     WHERE condition can match
+// FR: Résumés de colonne par bloc (zone maps) avec filtres de Bloom, permettant aux parcours complets de sauter
+//     les blocs de lignes qu'aucune condition WHERE ne peut satisfaire
+
+#pragma once
+
+#include "csv/columnar_table.hpp"
+#include "csv/query_engine.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+// EN: Bloom filter over 64-bit value hashes, sized for ~1% false positives at the given number of distinct
+//     values (10 bits and 7 probes per value, double hashing)
+// FR: Filtre de Bloom sur des empreintes 64 bits de valeurs, dimensionné pour ~1 % de faux positifs au nombre
+//     de valeurs distinctes donné (10 bits et 7 sondes par valeur, double hachage)
+class BloomFilter {
+public:
+    static constexpr size_t kBitsPerValue = 10;
+    static constexpr size_t kProbes = 7;
+
+    explicit BloomFilter(size_t distinct_values = 0);
+
+    static uint64_t hash(std::string_view value);
+
+    void add(uint64_t hash);
+    bool mayContain(uint64_t hash) const;
+
+    size_t getMemoryUsage() const { return bits_.capacity() * sizeof(uint64_t); }
+
+private:
+    std::vector<uint64_t> bits_;
+};
+
+// EN: Zone map of one column: for each block of `block_rows` rows, the null count, the numeric range of the
+//     cells that read as numbers, the text range of all non-null cells and a Bloom filter of their exact text.
+//     mayMatch() follows the comparison rules of CompiledPredicate (numeric when both sides are numbers, text
+//     otherwise, NULL cells only match IS NULL) and answers false only when no row of the block can satisfy
+//     the condition; operators it cannot bound (LIKE, REGEX, NOT_*, boolean constants) always may match.
+// FR: Zone map d'une colonne : pour chaque bloc de `block_rows` lignes, le nombre de nuls, la plage numérique
+//     des cellules lues comme nombres, la plage textuelle de toutes les cellules non nulles et un filtre de
+//     Bloom de leur texte exact. mayMatch() suit les règles de comparaison de CompiledPredicate (numérique quand
+//     les deux côtés sont des nombres, textuelle sinon, les cellules NULL ne satisfont que IS NULL) et ne répond
+//     faux que quand aucune ligne du bloc ne peut satisfaire la condition ; les opérateurs qu'il ne sait pas
+//     borner (LIKE, REGEX, NOT_*, constantes booléennes) peuvent toujours correspondre.
+class ZoneMap {
+public:
+    static constexpr size_t kDefaultBlockRows = size_t{1} << 16;
+
+    ZoneMap(const ColumnarTable& table, size_t column, size_t block_rows);
+
+    // EN: Catch up with rows appended to the table since the map was built: the last block is summarized again
+    //     when it was partial, then the new blocks are added
+    // FR: Rattrape les lignes ajoutées à la table depuis la construction de la carte : le dernier bloc est résumé
+    //     à nouveau s'il était partiel, puis les nouveaux blocs sont ajoutés
+    void extend(const ColumnarTable& table, size_t column);
+
+    // EN: Whether a condition on this column could prune blocks at all
+    // FR: Si une condition sur cette colonne peut élaguer des blocs
+    static bool canPrune(const WhereCondition& condition);
+
+    bool mayMatch(size_t block, const WhereCondition& condition) const;
+
+    // EN: Accessors
+    // FR: Accesseurs
+    size_t getBlockRows() const { return block_rows_; }
+    size_t getBlockCount() const { return blocks_.size(); }
+    size_t getRowCount() const { return row_count_; }
+    size_t getMemoryUsage() const;
+
+private:
+    struct Block {
+        size_t row_count{0};
+        size_t null_count{0};
+        size_t numeric_count{0};           // EN: Cells read as numbers / FR: Cellules lues comme nombres
+        double min_number{0.0};
+        double max_number{0.0};
+        std::string min_text;              // EN: Over all non-null cells / FR: Sur toutes les cellules non nulles
+        std::string max_text;
+        BloomFilter values;                // EN: Exact text of the non-null cells / FR: Texte exact des cellules non nulles
+    };
+
+    size_t block_rows_;
+    size_t row_count_{0};
+    std::vector<Block> blocks_;
+
+    void addBlocks(const ColumnarTable& table, size_t column);
+
+    static bool mayEqual(const Block& block, const QueryValue& value);
+    static bool mayCompare(const Block& block, const QueryValue& value, SqlOperator op);
+};
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,570 @@
+// EN: Aggregate accumulators and hash aggregation implementation
+// FR: Implémentation des accumulateurs d'agrégats et de l'agrégation par hachage
+
+#include "csv/aggregation.hpp"
+#include "csv/query_predicate.hpp"
+#include "csv/morsel_scan.hpp"
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <istream>
+#include <numeric>
+#include <ostream>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+template <typename T>
+void writeScalar(std::ostream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readScalar(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+void writeText(std::ostream& out, std::string_view text) {
+    writeScalar(out, static_cast<uint32_t>(text.size()));
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+// EN: Same text as std::to_string(double) ("%f"), without going through printf
+// FR: Même texte que std::to_string(double) ("%f"), sans passer par printf
+std::string formatNumber(double value) {
+    char buffer[64];
+    auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 6);
+    return error == std::errc() ? std::string(buffer, end) : std::to_string(value);
+}
+
+bool readText(std::istream& in, std::string& text) {
+    uint32_t size = 0;
+    if (!readScalar(in, size)) {
+        return false;
+    }
+    text.resize(size);
+    return static_cast<bool>(in.read(text.data(), size));
+}
+
+} // anonymous namespace
+
+// EN: AggregateAccumulator implementation
+// FR: Implémentation de AggregateAccumulator
+
+bool AggregateAccumulator::needsNumber(AggregateFunction function) {
+    return function == AggregateFunction::SUM || function == AggregateFunction::AVG ||
+           function == AggregateFunction::MIN || function == AggregateFunction::MAX;
+}
+
+void AggregateAccumulator::add(std::string_view value) {
+    double number = 0.0;
+    const bool numeric = needsNumber(function_) && parseNumericCell(value, number);
+    add(value, numeric, number);
+}
+
+bool AggregateAccumulator::replacesExtreme(std::string_view value, bool numeric, double number) const {
+    const bool is_min = function_ == AggregateFunction::MIN;
+    if (numeric && extreme_numeric_) {
+        return is_min ? number < extreme_number_ : number > extreme_number_;
+    }
+    return is_min ? value < std::string_view(extreme_) : value > std::string_view(extreme_);
+}
+
+void AggregateAccumulator::add(std::string_view value, bool numeric, double number) {
+    ++count_;
+    switch (function_) {
+        case AggregateFunction::COUNT:
+            break;
+
+        case AggregateFunction::SUM:
+        case AggregateFunction::AVG:
+            if (numeric) {
+                sum_ += number;
+                ++numeric_count_;
+            }
+            break;
+
+        case AggregateFunction::MIN:
+        case AggregateFunction::MAX:
+            if (count_ == 1 || replacesExtreme(value, numeric, number)) {
+                extreme_ = value;
+                extreme_numeric_ = numeric;
+                extreme_number_ = number;
+            }
+            break;
+
+        case AggregateFunction::DISTINCT:
+            if (distinct_.find(value) == distinct_.end()) {
+                distinct_.emplace(value);
+            }
+            break;
+
+        case AggregateFunction::GROUP_CONCAT:
+            if (count_ > 1) {
+                concat_ += ',';
+            }
+            concat_ += value;
+            break;
+
+        default:
+            if (count_ == 1) {
+                extreme_ = value;
+            }
+            break;
+    }
+}
+
+void AggregateAccumulator::merge(const AggregateAccumulator& later) {
+    if (later.count_ == 0) {
+        return;
+    }
+    if (count_ == 0) {
+        *this = later;
+        return;
+    }
+    switch (function_) {
+        case AggregateFunction::COUNT:
+            break;
+
+        case AggregateFunction::SUM:
+        case AggregateFunction::AVG:
+            sum_ += later.sum_;
+            numeric_count_ += later.numeric_count_;
+            break;
+
+        case AggregateFunction::MIN:
+        case AggregateFunction::MAX:
+            if (replacesExtreme(later.extreme_, later.extreme_numeric_, later.extreme_number_)) {
+                extreme_ = later.extreme_;
+                extreme_numeric_ = later.extreme_numeric_;
+                extreme_number_ = later.extreme_number_;
+            }
+            break;
+
+        case AggregateFunction::DISTINCT:
+            distinct_.insert(later.distinct_.begin(), later.distinct_.end());
+            break;
+
+        case AggregateFunction::GROUP_CONCAT:
+            concat_ += ',';
+            concat_ += later.concat_;
+            break;
+
+        default:
+            break;   // EN: The first value is ours / FR: La première valeur est la nôtre
+    }
+    count_ += later.count_;
+}
+
+void AggregateAccumulator::save(std::ostream& out) const {
+    writeScalar(out, static_cast<uint64_t>(count_));
+    writeScalar(out, sum_);
+    writeScalar(out, static_cast<uint64_t>(numeric_count_));
+    writeText(out, extreme_);
+    writeScalar(out, static_cast<uint8_t>(extreme_numeric_));
+    writeScalar(out, extreme_number_);
+    writeScalar(out, static_cast<uint64_t>(distinct_.size()));
+    for (const auto& value : distinct_) {
+        writeText(out, value);
+    }
+    writeText(out, concat_);
+}
+
+bool AggregateAccumulator::load(std::istream& in) {
+    uint64_t count = 0;
+    uint64_t numeric_count = 0;
+    uint8_t extreme_numeric = 0;
+    uint64_t distinct_count = 0;
+    if (!readScalar(in, count) || !readScalar(in, sum_) || !readScalar(in, numeric_count) ||
+        !readText(in, extreme_) || !readScalar(in, extreme_numeric) || !readScalar(in, extreme_number_) ||
+        !readScalar(in, distinct_count)) {
+        return false;
+    }
+    count_ = static_cast<size_t>(count);
+    numeric_count_ = static_cast<size_t>(numeric_count);
+    extreme_numeric_ = extreme_numeric != 0;
+    distinct_.clear();
+    std::string value;
+    for (uint64_t i = 0; i < distinct_count; ++i) {
+        if (!readText(in, value)) {
+            return false;
+        }
+        distinct_.insert(value);
+    }
+    return readText(in, concat_);
+}
+
+std::string AggregateAccumulator::result() const {
+    if (count_ == 0) {
+        return "";
+    }
+    switch (function_) {
+        case AggregateFunction::COUNT:        return std::to_string(count_);
+        case AggregateFunction::SUM:          return formatNumber(sum_);
+        case AggregateFunction::AVG:          return numeric_count_ > 0 ? formatNumber(sum_ / static_cast<double>(numeric_count_)) : "0";
+        case AggregateFunction::DISTINCT:     return std::to_string(distinct_.size());
+        case AggregateFunction::GROUP_CONCAT: return concat_;
+        default:                              return extreme_;
+    }
+}
+
+// EN: HashAggregation implementation
+// FR: Implémentation de HashAggregation
+
+// EN: Columns of one input table resolved once per add(): where each value comes from, and the numeric reading
+//     of every dictionary entry an aggregate needs as a number
+// FR: Colonnes d'une table d'entrée résolues une fois par add() : d'où vient chaque valeur, et la lecture
+//     numérique de chaque entrée de dictionnaire dont un agrégat a besoin comme nombre
+struct HashAggregation::Inputs {
+    struct Column {
+        size_t index;                 // EN: Table column, or column count when absent / FR: Colonne de la table, ou nombre de colonnes si absente
+        bool needs_number;
+        bool grows;                   // EN: DISTINCT / GROUP_CONCAT keep their values / FR: DISTINCT / GROUP_CONCAT gardent leurs valeurs
+        std::vector<uint8_t> code_numeric;
+        std::vector<double> code_number;
+    };
+    
+    const ColumnarTable* table;
+    uint64_t base;
+    std::vector<Column> columns;
+    std::vector<size_t> keys;
+    bool dictionary_key{false};       // EN: Single dictionary-encoded GROUP BY column / FR: Unique colonne GROUP BY encodée par dictionnaire
+};
+
+HashAggregation::HashAggregation(std::vector<SelectColumn> columns, std::vector<std::string> group_by,
+                                 size_t memory_budget_bytes, ThreadPool* pool, size_t helpers,
+                                 std::filesystem::path spill_directory)
+    : columns_(std::move(columns)), group_by_(std::move(group_by)), memory_budget_bytes_(memory_budget_bytes),
+      pool_(pool), helpers_(pool ? helpers : 0), spill_parent_(std::move(spill_directory)) {}
+
+HashAggregation::~HashAggregation() = default;
+
+void HashAggregation::Partial::clear() {
+    slots.clear();
+    slot_keys.clear();
+    first_rows.clear();
+    blocks.clear();
+    keys = StringHeap();
+    bytes = 0;
+}
+
+size_t HashAggregation::findOrAddGroup(Partial& partial, std::string_view key, uint64_t first_row) const {
+    auto it = partial.slots.find(key);
+    if (it != partial.slots.end()) {
+        return it->second;
+    }
+    const size_t slot = partial.size();
+    std::string_view stored = partial.keys.store(key);
+    partial.slots.emplace(stored, slot);
+    partial.slot_keys.push_back(stored);
+    partial.first_rows.push_back(first_row);
+    const size_t width = columns_.size();
+    if (slot % Partial::kBlockSlots == 0) {
+        partial.blocks.push_back(std::make_unique<AggregateAccumulator[]>(Partial::kBlockSlots * width));
+    }
+    AggregateAccumulator* accumulators = partial.group(slot, width);
+    for (size_t c = 0; c < width; ++c) {
+        accumulators[c] = AggregateAccumulator(columns_[c].aggregate);
+    }
+    partial.bytes += key.size() + kGroupOverheadBytes + width * sizeof(AggregateAccumulator);
+    return slot;
+}
+
+void HashAggregation::aggregateRange(const Inputs& inputs, const size_t* rows, size_t count,
+                                     Partial& partial) const {
+    const ColumnarTable& table = *inputs.table;
+    const size_t width = columns_.size();
+    
+    // EN: With a single dictionary-encoded key, each code is hashed once and then resolved through this cache
+    // FR: Avec une unique clé encodée par dictionnaire, chaque code est haché une fois puis résolu par ce cache
+    constexpr size_t kNoSlot = static_cast<size_t>(-1);
+    std::vector<size_t> code_slots;
+    if (inputs.dictionary_key) {
+        code_slots.assign(table.getDictionary(inputs.keys[0]).size(), kNoSlot);
+    }
+    
+    std::string key;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t row = rows[i];
+        size_t slot = 0;
+        if (inputs.dictionary_key) {
+            const ColumnarTable::DictionaryCode code = table.getCodes(inputs.keys[0])[row];
+            if (code_slots[code] == kNoSlot) {
+                code_slots[code] = findOrAddGroup(partial, table.getDictionary(inputs.keys[0])[code], inputs.base + row);
+            }
+            slot = code_slots[code];
+        } else if (inputs.keys.size() == 1) {
+            slot = findOrAddGroup(partial, table.getValue(row, inputs.keys[0]), inputs.base + row);
+        } else {
+            // EN: Several keys: length-prefixed values, so that no two key tuples collide
+            // FR: Plusieurs clés : valeurs préfixées par leur longueur, deux tuples de clés ne se confondent donc pas
+            key.clear();
+            for (size_t column : inputs.keys) {
+                std::string_view value = table.getValue(row, column);
+                const auto size = static_cast<uint32_t>(value.size());
+                key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+                key.append(value);
+            }
+            slot = findOrAddGroup(partial, key, inputs.base + row);
+        }
+        
+        AggregateAccumulator* accumulators = partial.group(slot, width);
+        for (size_t c = 0; c < width; ++c) {
+            const Inputs::Column& column = inputs.columns[c];
+            std::string_view value = table.getValue(row, column.index);
+            bool numeric = false;
+            double number = 0.0;
+            if (!column.code_numeric.empty()) {
+                const ColumnarTable::DictionaryCode code = table.getCodes(column.index)[row];
+                numeric = column.code_numeric[code] != 0;
+                number = column.code_number[code];
+            } else if (column.needs_number) {
+                numeric = parseNumericCell(value, number);
+            }
+            accumulators[c].add(value, numeric, number);
+            if (column.grows) {
+                partial.bytes += value.size();
+            }
+        }
+    }
+}
+
+void HashAggregation::mergeInto(Partial& target, const Partial& source) const {
+    // EN: Source slots are visited in order of first appearance, so new groups keep the target in that order too
+    // FR: Les emplacements source sont visités dans l'ordre de première apparition, les nouveaux groupes gardent
+    //     donc la cible dans cet ordre aussi
+    const size_t width = columns_.size();
+    const size_t group_bytes = kGroupOverheadBytes + width * sizeof(AggregateAccumulator);
+    size_t fixed_bytes = 0;
+    for (size_t slot = 0; slot < source.size(); ++slot) {
+        std::string_view key = source.slot_keys[slot];
+        fixed_bytes += key.size() + group_bytes;
+        const size_t known = target.size();
+        const size_t target_slot = findOrAddGroup(target, key, source.first_rows[slot]);
+        const AggregateAccumulator* from = source.group(slot, width);
+        AggregateAccumulator* into = target.group(target_slot, width);
+        if (target_slot >= known) {
+            std::copy(from, from + width, into);
+            continue;
+        }
+        target.first_rows[target_slot] = std::min(target.first_rows[target_slot], source.first_rows[slot]);
+        for (size_t c = 0; c < width; ++c) {
+            into[c].merge(from[c]);
+        }
+    }
+    target.bytes += source.bytes - fixed_bytes;
+}
+
+void HashAggregation::emitGroups(const Partial& partial, std::vector<Row>& output) const {
+    const size_t width = columns_.size();
+    for (size_t slot = 0; slot < partial.size(); ++slot) {
+        Row row;
+        row.reserve(width);
+        for (size_t c = 0; c < width; ++c) {
+            row.push_back(partial.group(slot, width)[c].result());
+        }
+        output.push_back(std::move(row));
+    }
+}
+
+QueryError HashAggregation::add(const ColumnarTable& table, const std::vector<size_t>& rows) {
+    Inputs inputs;
+    inputs.table = &table;
+    inputs.base = rows_seen_;
+    rows_seen_ += table.getRowCount();
+    for (const auto& select : columns_) {
+        Inputs::Column column;
+        int index = table.getColumnIndex(select.column);
+        column.index = index >= 0 ? static_cast<size_t>(index) : table.getColumnCount();
+        column.needs_number = AggregateAccumulator::needsNumber(select.aggregate);
+        column.grows = select.aggregate == AggregateFunction::DISTINCT ||
+                       select.aggregate == AggregateFunction::GROUP_CONCAT;
+        if (column.needs_number && index >= 0 && table.isDictionaryEncoded(column.index)) {
+            const auto& dictionary = table.getDictionary(column.index);
+            column.code_numeric.resize(dictionary.size());
+            column.code_number.resize(dictionary.size());
+            for (size_t code = 0; code < dictionary.size(); ++code) {
+                column.code_numeric[code] = parseNumericCell(dictionary[code], column.code_number[code]);
+            }
+        }
+        inputs.columns.push_back(std::move(column));
+    }
+    for (const auto& name : group_by_) {
+        int index = table.getColumnIndex(name);
+        inputs.keys.push_back(index >= 0 ? static_cast<size_t>(index) : table.getColumnCount());
+    }
+    if (inputs.keys.empty()) {
+        inputs.keys.push_back(table.getColumnCount());   // EN: One group keyed by "" / FR: Un seul groupe de clé ""
+    }
+    inputs.dictionary_key = group_by_.size() == 1 && inputs.keys[0] < table.getColumnCount() &&
+                            table.isDictionaryEncoded(inputs.keys[0]);
+    
+    auto overBudget = [this] { return memory_budget_bytes_ > 0 && main_.bytes > memory_budget_bytes_; };
+    const size_t morsels = (rows.size() + kMorselRows - 1) / kMorselRows;
+    size_t next = 0;
+    auto aggregateSequentially = [&] {
+        for (; next < morsels; ++next) {
+            const size_t begin = next * kMorselRows;
+            aggregateRange(inputs, rows.data() + begin, std::min(kMorselRows, rows.size() - begin), main_);
+            if (overBudget() && spill() != QueryError::SUCCESS) {
+                return QueryError::IO_ERROR;
+            }
+        }
+        return QueryError::SUCCESS;
+    };
+    if (helpers_ == 0 || morsels <= 1) {
+        return aggregateSequentially();
+    }
+    
+    // EN: Windows of morsels run on the shared pool through forEachMorsel, each into its own partial, and are
+    //     merged in row order. Merging costs as much as aggregating when partials barely reduce their rows
+    //     (nearly unique keys), so once a partial keeps more than half of its rows as groups, the remaining
+    //     morsels are aggregated on this thread.
+    // FR: Des fenêtres de morceaux s'exécutent sur le pool partagé via forEachMorsel, chacun dans sa propre
+    //     partielle, et sont fusionnées dans l'ordre des lignes. Fusionner coûte autant qu'agréger quand les
+    //     partielles réduisent à peine leurs lignes (clés presque uniques), donc dès qu'une partielle garde plus
+    //     de la moitié de ses lignes comme groupes, les morceaux restants sont agrégés sur ce thread.
+    const size_t window = (helpers_ + 1) * 2;
+    std::vector<std::unique_ptr<Partial>> partials(window);
+    bool parallel = true;
+    while (parallel && next < morsels) {
+        const size_t first = next;
+        const size_t count = std::min(window, morsels - first);
+        const size_t threads = forEachMorsel(pool_, helpers_, count, 1, [&](size_t slot, size_t, size_t) {
+            const size_t begin = (first + slot) * kMorselRows;
+            auto partial = std::make_unique<Partial>();
+            partial->keys = StringHeap(StringHeap::kMinChunkSize * 16);
+            aggregateRange(inputs, rows.data() + begin, std::min(kMorselRows, rows.size() - begin), *partial);
+            partials[slot] = std::move(partial);
+        });
+        threads_used_ = std::max(threads_used_, threads);
+        next += count;
+        for (size_t slot = 0; slot < count; ++slot) {
+            if (partials[slot]->size() * 2 > kMorselRows) {
+                parallel = false;
+            }
+            mergeInto(main_, *partials[slot]);
+            partials[slot].reset();
+            if (overBudget() && spill() != QueryError::SUCCESS) {
+                return QueryError::IO_ERROR;
+            }
+        }
+    }
+    return aggregateSequentially();
+}
+
+QueryError HashAggregation::spill() {
+    if (!directory_) {
+        directory_ = std::make_unique<SpillDirectory>(spill_parent_, "bbp_aggregate_");
+    }
+    if (!directory_->valid()) {
+        return QueryError::IO_ERROR;
+    }
+    
+    // EN: Partitions are appended to, so each holds its partial groups in the order they were flushed
+    // FR: Les partitions sont complétées en fin, chacune garde donc ses groupes partiels dans l'ordre des vidages
+    std::vector<std::ofstream> files(kSpillPartitions);
+    for (size_t p = 0; p < kSpillPartitions; ++p) {
+        files[p].open(directory_->file("groups", p), std::ios::binary | std::ios::app);
+        if (!files[p]) {
+            return QueryError::IO_ERROR;
+        }
+    }
+    const size_t width = columns_.size();
+    for (size_t slot = 0; slot < main_.size(); ++slot) {
+        std::string_view key = main_.slot_keys[slot];
+        const uint64_t hash = static_cast<uint64_t>(KeyHash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        std::ofstream& out = files[static_cast<size_t>(hash >> 59) % kSpillPartitions];
+        const std::streamoff start = out.tellp();
+        writeText(out, key);
+        writeScalar(out, main_.first_rows[slot]);
+        for (size_t c = 0; c < width; ++c) {
+            main_.group(slot, width)[c].save(out);
+        }
+        spilled_bytes_ += static_cast<size_t>(out.tellp() - start);
+    }
+    for (auto& file : files) {
+        file.close();
+        if (file.fail()) {
+            return QueryError::IO_ERROR;
+        }
+    }
+    main_.clear();
+    return QueryError::SUCCESS;
+}
+
+QueryError HashAggregation::finish(std::vector<Row>& output) {
+    output.clear();
+    
+    if (!directory_) {
+        output.reserve(main_.size() + 1);
+        emitGroups(main_, output);
+    } else {
+        if (main_.size() > 0 && spill() != QueryError::SUCCESS) {
+            return QueryError::IO_ERROR;
+        }
+        // EN: Partition by partition, fold the flushed partial groups back together in flush order; each
+        //     partition comes out in order of first appearance, and the partitions are then interleaved by first row
+        // FR: Partition par partition, refondre les groupes partiels vidés dans l'ordre des vidages ; chaque
+        //     partition sort dans l'ordre de première apparition, puis les partitions sont entrelacées par
+        //     première ligne
+        const size_t width = columns_.size();
+        std::vector<uint64_t> first_rows;
+        std::string key;
+        uint64_t first_row = 0;
+        std::vector<AggregateAccumulator> incoming;
+        for (const auto& column : columns_) {
+            incoming.emplace_back(column.aggregate);
+        }
+        for (size_t p = 0; p < kSpillPartitions; ++p) {
+            Partial groups;
+            std::ifstream in(directory_->file("groups", p), std::ios::binary);
+            while (in && readText(in, key)) {
+                if (!readScalar(in, first_row)) {
+                    return QueryError::IO_ERROR;
+                }
+                const size_t known = groups.size();
+                const size_t slot = findOrAddGroup(groups, key, first_row);
+                AggregateAccumulator* into = groups.group(slot, width);
+                for (size_t c = 0; c < width; ++c) {
+                    if (!(slot >= known ? into[c] : incoming[c]).load(in)) {
+                        return QueryError::IO_ERROR;
+                    }
+                    if (slot < known) {
+                        into[c].merge(incoming[c]);
+                    }
+                }
+            }
+            first_rows.insert(first_rows.end(), groups.first_rows.begin(), groups.first_rows.end());
+            emitGroups(groups, output);
+        }
+        directory_.reset();
+        
+        std::vector<size_t> permutation(output.size());
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::stable_sort(permutation.begin(), permutation.end(),
+                         [&first_rows](size_t a, size_t b) { return first_rows[a] < first_rows[b]; });
+        std::vector<Row> ordered;
+        ordered.reserve(output.size() + 1);
+        for (size_t index : permutation) {
+            ordered.push_back(std::move(output[index]));
+        }
+        output = std::move(ordered);
+    }
+    main_.clear();
+    group_count_ = output.size();
+    
+    if (output.empty() && group_by_.empty()) {
+        Row row;
+        for (const auto& column : columns_) {
+            row.push_back(AggregateAccumulator(column.aggregate).result());
+        }
+        output.push_back(std::move(row));
+    }
+    return QueryError::SUCCESS;
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -419,6 +419,7 @@ BatchWriter::~BatchWriter() {
 BatchWriter::BatchWriter(BatchWriter&& other) noexcept
     : config_(std::move(other.config_))
     , current_filename_(std::move(other.current_filename_))
+    , compression_(other.compression_)
     , file_open_(other.file_open_)
     , header_written_(other.header_written_)
     , output_stream_(std::move(other.output_stream_))
@@ -431,7 +432,10 @@ BatchWriter::BatchWriter(BatchWriter&& other) noexcept
     , background_thread_(std::move(other.background_thread_))
     , flush_callback_(std::move(other.flush_callback_))
     , error_callback_(std::move(other.error_callback_))
-    , progress_callback_(std::move(other.progress_callback_)) {
+    , progress_callback_(std::move(other.progress_callback_))
+    , row_index_(std::move(other.row_index_))
+    , output_offset_(other.output_offset_)
+    , index_header_pending_(other.index_header_pending_) {
     
     // EN: Transfer atomic state
     // FR: Transfère l'état atomique
@@ -464,6 +468,7 @@ BatchWriter& BatchWriter::operator=(BatchWriter&& other) noexcept {
         // FR: Déplace tous les membres
         config_ = std::move(other.config_);
         current_filename_ = std::move(other.current_filename_);
+        compression_ = other.compression_;
         file_open_ = other.file_open_;
         header_written_ = other.header_written_;
         output_stream_ = std::move(other.output_stream_);
@@ -477,6 +482,9 @@ BatchWriter& BatchWriter::operator=(BatchWriter&& other) noexcept {
         flush_callback_ = std::move(other.flush_callback_);
         error_callback_ = std::move(other.error_callback_);
         progress_callback_ = std::move(other.progress_callback_);
+        row_index_ = std::move(other.row_index_);
+        output_offset_ = other.output_offset_;
+        index_header_pending_ = other.index_header_pending_;
         
         // EN: Transfer atomic state
         // FR: Transfère l'état atomique
@@ -545,6 +553,10 @@ WriterError BatchWriter::openStream(std::ostream& stream) {
     file_open_ = true;
     header_written_ = false;
     current_filename_ = "<external_stream>";
+    compression_ = config_.compression == CompressionType::AUTO ? CompressionType::NONE : config_.compression;
+    row_index_.reset(config_.row_index_stride > 0 ? config_.row_index_stride : RowIndex::kDefaultStride);
+    output_offset_ = 0;
+    index_header_pending_ = false;
     
     stats_.startTiming();
     
@@ -583,6 +595,13 @@ WriterError BatchWriter::closeFile() {
     if (owns_stream_ && file_stream_) {
         file_stream_->close();
         file_stream_.reset();
+        
+        // EN: The sidecar is fingerprinted against the closed file, so it only matches this exact content
+        // FR: L'annexe prend l'empreinte du fichier fermé, elle ne correspond donc qu'à ce contenu exact
+        if (isIndexing() && (!row_index_.finish(current_filename_) ||
+                             !row_index_.save(RowIndex::sidecarPath(current_filename_)))) {
+            reportError(WriterError::FILE_WRITE_ERROR, "Cannot write row index: " + row_index_.getLastError());
+        }
     }
     
     output_stream_.reset();
@@ -612,6 +631,7 @@ WriterError BatchWriter::writeHeader(const std::vector<std::string>& headers) {
     }
     
     CsvRow header_row(headers);
+    index_header_pending_ = !headers.empty();
     WriterError result = writeRowInternal(header_row);
     if (result == WriterError::SUCCESS) {
         header_written_ = true;
@@ -889,6 +909,9 @@ WriterError BatchWriter::enableCompression(CompressionType type, int level) {
     
     config_.compression = type;
     config_.compression_level = level;
+    if (file_open_) {
+        compression_ = type == CompressionType::AUTO ? config_.detectCompressionFromFilename(current_filename_) : type;
+    }
     return WriterError::SUCCESS;
 }
 
@@ -896,6 +919,7 @@ WriterError BatchWriter::disableCompression() {
     // EN: Disable compression
     // FR: Désactive la compression
     config_.compression = CompressionType::NONE;
+    compression_ = CompressionType::NONE;
     return WriterError::SUCCESS;
 }
 
@@ -994,6 +1018,10 @@ WriterError BatchWriter::openFileInternal(const std::string& filename) {
         file_open_ = true;
         header_written_ = false;
         current_filename_ = filename;
+        compression_ = compression_type;
+        row_index_.reset(config_.row_index_stride > 0 ? config_.row_index_stride : RowIndex::kDefaultStride);
+        output_offset_ = 0;
+        index_header_pending_ = false;
         
         stats_.startTiming();
         
@@ -1004,6 +1032,7 @@ WriterError BatchWriter::openFileInternal(const std::string& filename) {
         if (config_.write_bom && config_.encoding == "UTF-8") {
             const char utf8_bom[] = {static_cast<char>(0xEF), static_cast<char>(0xBB), static_cast<char>(0xBF)};
             output_stream_->write(utf8_bom, 3);
+            output_offset_ = 3;
         }
         
         return WriterError::SUCCESS;
@@ -1029,7 +1058,15 @@ WriterError BatchWriter::flushInternal() {
     {
         std::lock_guard<std::mutex> lock(buffer_mutex_);
         
+        const bool indexing = isIndexing();
         for (const auto& row : row_buffer_) {
+            if (indexing) {
+                if (index_header_pending_) {
+                    index_header_pending_ = false;
+                } else {
+                    row_index_.addRow(output_offset_ + static_cast<uint64_t>(output.tellp()));
+                }
+            }
             output << formatRow(row) << config_.line_ending;
         }
         
@@ -1047,6 +1084,7 @@ WriterError BatchWriter::flushInternal() {
     WriterError write_result = compressAndWrite(data);
     
     if (write_result == WriterError::SUCCESS) {
+        output_offset_ += data.size();
         output_stream_->flush();
         stats_.incrementFlushCount();
         stats_.addBytesWritten(data.size());
@@ -1122,7 +1160,7 @@ WriterError BatchWriter::writeRowInternal(const CsvRow& row) {
 WriterError BatchWriter::compressAndWrite(const std::string& data) {
     // EN: Compress data if needed and write to stream
     // FR: Compresse les données si nécessaire et écrit vers le stream
-    if (config_.compression == CompressionType::NONE) {
+    if (compression_ == CompressionType::NONE) {
         // EN: No compression, write directly
         // FR: Pas de compression, écrit directement
         output_stream_->write(data.c_str(), data.size());
@@ -1137,7 +1175,7 @@ WriterError BatchWriter::compressAndWrite(const std::string& data) {
     // FR: Compresse et écrit
     auto compress_start = std::chrono::high_resolution_clock::now();
     
-    std::string compressed = compressString(data, config_.compression, config_.compression_level);
+    std::string compressed = compressString(data, compression_, config_.compression_level);
     if (compressed.empty()) {
         reportError(WriterError::COMPRESSION_ERROR, "Failed to compress data");
         return WriterError::COMPRESSION_ERROR;
@@ -0,0 +1,199 @@
+// EN: Columnar table and string heap implementation
+// FR: Implémentation de la table colonnaire et du tas de chaînes
+
+#include "csv/columnar_table.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace BBP {
+namespace CSV {
+
+// EN: StringHeap implementation
+// FR: Implémentation de StringHeap
+
+std::string_view StringHeap::store(std::string_view text) {
+    if (text.empty()) {
+        return {};
+    }
+    if (text.size() > chunk_size_ / 4) {
+        // EN: Oversized strings get a block of their own; the current block keeps its free space
+        // FR: Les chaînes trop grandes ont leur propre bloc ; le bloc courant garde son espace libre
+        chunks_.push_back(std::make_unique<char[]>(text.size()));
+        std::memcpy(chunks_.back().get(), text.data(), text.size());
+        bytes_reserved_ += text.size();
+        bytes_used_ += text.size();
+        return std::string_view(chunks_.back().get(), text.size());
+    }
+    if (text.size() > chunk_free_) {
+        // EN: Blocks double from kMinChunkSize up to the chunk size, so small tables stay small
+        // FR: Les blocs doublent de kMinChunkSize jusqu'à la taille de bloc, les petites tables restent donc petites
+        size_t block_size = std::max(text.size(), std::min(chunk_size_, std::max(kMinChunkSize, bytes_reserved_)));
+        chunks_.push_back(std::make_unique<char[]>(block_size));
+        cursor_ = chunks_.back().get();
+        chunk_free_ = block_size;
+        bytes_reserved_ += block_size;
+    }
+    std::memcpy(cursor_, text.data(), text.size());
+    std::string_view stored(cursor_, text.size());
+    cursor_ += text.size();
+    chunk_free_ -= text.size();
+    bytes_used_ += text.size();
+    return stored;
+}
+
+// EN: ColumnarTable implementation
+// FR: Implémentation de ColumnarTable
+
+ColumnarTable::ColumnarTable(std::vector<std::string> headers, size_t dictionary_limit)
+    : headers_(std::move(headers))
+    , columns_(headers_.size())
+    , heap_(std::make_shared<StringHeap>())
+    , dictionary_limit_(std::min(dictionary_limit, kMaxDictionaryLimit)) {
+    for (size_t i = 0; i < headers_.size(); ++i) {
+        column_index_.emplace(headers_[i], i);
+    }
+    if (dictionary_limit_ == 0) {
+        for (auto& column : columns_) {
+            column.dictionary_encoded = false;
+        }
+    }
+}
+
+std::shared_ptr<ColumnarTable> ColumnarTable::fromRows(const std::vector<std::string>& headers,
+                                                       const std::vector<std::vector<std::string>>& rows,
+                                                       size_t dictionary_limit) {
+    auto table = std::make_shared<ColumnarTable>(headers, dictionary_limit);
+    table->reserve(rows.size());
+    for (const auto& row : rows) {
+        table->appendRow(row);
+    }
+    return table;
+}
+
+std::shared_ptr<ColumnarTable> ColumnarTable::extended(const std::vector<std::vector<std::string>>& rows) const {
+    auto table = std::make_shared<ColumnarTable>(headers_, dictionary_limit_);
+    table->column_index_ = column_index_;
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        const Column& source = columns_[i];
+        Column& column = table->columns_[i];
+        column.dictionary_encoded = source.dictionary_encoded;
+        column.dictionary = source.dictionary;
+        column.lookup = source.lookup;
+    }
+    table->reserve(row_count_ + rows.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        const Column& source = columns_[i];
+        Column& column = table->columns_[i];
+        column.codes.insert(column.codes.end(), source.codes.begin(), source.codes.end());
+        column.values.insert(column.values.end(), source.values.begin(), source.values.end());
+    }
+    table->row_count_ = row_count_;
+    
+    // EN: The views copied above point into these heaps, which nobody writes to anymore
+    // FR: Les vues copiées ci-dessus pointent dans ces tas, que plus personne n'écrit
+    table->base_heaps_ = base_heaps_;
+    table->base_heaps_.push_back(heap_);
+    
+    for (const auto& row : rows) {
+        table->appendRow(row);
+    }
+    return table;
+}
+
+void ColumnarTable::reserve(size_t rows) {
+    for (auto& column : columns_) {
+        if (column.dictionary_encoded) {
+            column.codes.reserve(rows);
+        } else {
+            column.values.reserve(rows);
+        }
+    }
+}
+
+void ColumnarTable::appendRow(const std::vector<std::string>& row) {
+    appendFields(row);
+}
+
+void ColumnarTable::appendRow(const std::vector<std::string_view>& row) {
+    appendFields(row);
+}
+
+template<typename Row>
+void ColumnarTable::appendFields(const Row& row) {
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        appendValue(columns_[i], i < row.size() ? std::string_view(row[i]) : std::string_view());
+    }
+    ++row_count_;
+}
+
+void ColumnarTable::appendValue(Column& column, std::string_view value) {
+    if (column.dictionary_encoded) {
+        auto it = column.lookup.find(value);
+        if (it != column.lookup.end()) {
+            column.codes.push_back(it->second);
+            return;
+        }
+        if (column.dictionary.size() < dictionary_limit_) {
+            // EN: New distinct value: stored once, referenced by code from every row holding it
+            // FR: Nouvelle valeur distincte : stockée une fois, référencée par code depuis chaque ligne qui la contient
+            auto code = static_cast<DictionaryCode>(column.dictionary.size());
+            std::string_view stored = heap_->store(value);
+            column.dictionary.push_back(stored);
+            column.lookup.emplace(stored, code);
+            column.codes.push_back(code);
+            return;
+        }
+        convertToPlain(column);
+    }
+    column.values.push_back(heap_->store(value));
+}
+
+void ColumnarTable::convertToPlain(Column& column) {
+    // EN: Too many distinct values: expand the codes once, dictionary entries stay in the heap
+    // FR: Trop de valeurs distinctes : les codes sont développés une fois, les entrées du dictionnaire restent dans le tas
+    column.values.reserve(std::max(column.codes.capacity(), column.codes.size() + 1));
+    for (DictionaryCode code : column.codes) {
+        column.values.push_back(column.dictionary[code]);
+    }
+    column.dictionary_encoded = false;
+    std::vector<DictionaryCode>().swap(column.codes);
+    std::vector<std::string_view>().swap(column.dictionary);
+    std::unordered_map<std::string_view, DictionaryCode>().swap(column.lookup);
+}
+
+int ColumnarTable::getColumnIndex(const std::string& name) const {
+    auto it = column_index_.find(name);
+    return it != column_index_.end() ? static_cast<int>(it->second) : -1;
+}
+
+void ColumnarTable::addColumnAlias(const std::string& alias, size_t column) {
+    if (column < columns_.size()) {
+        column_index_.emplace(alias, column);
+    }
+}
+
+std::vector<std::string> ColumnarTable::getRow(size_t row) const {
+    std::vector<std::string> fields;
+    fields.reserve(columns_.size());
+    for (size_t column = 0; column < columns_.size(); ++column) {
+        fields.emplace_back(getValue(row, column));
+    }
+    return fields;
+}
+
+size_t ColumnarTable::getMemoryUsage() const {
+    size_t bytes = heap_->getBytesReserved();
+    for (const auto& heap : base_heaps_) {
+        bytes += heap->getBytesReserved();
+    }
+    for (const auto& column : columns_) {
+        bytes += column.codes.capacity() * sizeof(DictionaryCode);
+        bytes += column.dictionary.capacity() * sizeof(std::string_view);
+        bytes += column.lookup.size() * (sizeof(std::string_view) + sizeof(DictionaryCode) + sizeof(void*));
+        bytes += column.values.capacity() * sizeof(std::string_view);
+    }
+    return bytes;
+}
+
+} // namespace CSV
+} // namespace BBP
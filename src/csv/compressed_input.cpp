@@ -0,0 +1,334 @@
+// EN: Streaming gzip/zlib decompression implementation (zlib inflate on a background thread, double-buffered hand-off)
+// FR: Implémentation de la décompression gzip/zlib en streaming (inflate zlib sur un thread d'arrière-plan, transfert double buffer)
+
+#include "csv/compressed_input.hpp"
+#include <zlib.h>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+constexpr unsigned char kUtf8Bom[3] = {0xEF, 0xBB, 0xBF};
+
+// EN: Bytes read from the file head for format detection
+// FR: Octets lus en tête de fichier pour la détection du format
+constexpr size_t kDetectionProbeSize = 512;
+
+// EN: windowBits for inflateInit2(): 32 KB window, automatic gzip/zlib header detection
+// FR: windowBits pour inflateInit2() : fenêtre de 32 Ko, détection automatique de l'en-tête gzip/zlib
+constexpr int kAutoDetectWindowBits = 15 + 32;
+
+bool hasBom(const unsigned char* data, size_t size) {
+    return size >= 3 && std::memcmp(data, kUtf8Bom, 3) == 0;
+}
+
+// EN: Trial inflate of the probe: a plain text file whose first two bytes happen to form a valid zlib header
+//     fails here almost immediately
+// FR: Inflate d'essai de la sonde : un fichier texte dont les deux premiers octets forment par hasard un en-tête
+//     zlib valide échoue ici presque immédiatement
+bool inflatesCleanly(const unsigned char* data, size_t size) {
+    z_stream stream{};
+    if (inflateInit2(&stream, kAutoDetectWindowBits) != Z_OK) {
+        return false;
+    }
+    std::vector<unsigned char> sink(16 * 1024);
+    stream.next_in = const_cast<Bytef*>(data);
+    stream.avail_in = static_cast<uInt>(size);
+    int status = Z_OK;
+    while (status == Z_OK && stream.avail_in > 0) {
+        stream.next_out = sink.data();
+        stream.avail_out = static_cast<uInt>(sink.size());
+        status = inflate(&stream, Z_NO_FLUSH);
+    }
+    inflateEnd(&stream);
+    return status == Z_OK || status == Z_STREAM_END || status == Z_BUF_ERROR;
+}
+
+} // anonymous namespace
+
+DecompressingReader::DecompressingReader(size_t buffer_size)
+    : buffer_size_(buffer_size > 0 ? buffer_size : kDefaultBufferSize) {
+}
+
+DecompressingReader::~DecompressingReader() {
+    close();
+}
+
+bool DecompressingReader::open(const std::string& file_path) {
+    close();
+
+    std::FILE* file = std::fopen(file_path.c_str(), "rb");
+    if (file == nullptr) {
+        last_error_ = "open failed: " + std::string(std::strerror(errno));
+        return false;
+    }
+
+    for (auto& buffer : buffers_) {
+        if (!buffer.data) {
+            buffer.data = std::make_unique<char[]>(buffer_size_);
+        }
+        buffer.size = 0;
+    }
+    produced_ = 0;
+    consumed_ = 0;
+    holding_ = false;
+    finished_ = false;
+    stop_requested_ = false;
+    last_error_.clear();
+    compressed_bytes_read_ = 0;
+    decompressed_bytes_ = 0;
+
+    inflate_thread_ = std::thread(&DecompressingReader::inflateWorker, this, file);
+    is_open_ = true;
+    return true;
+}
+
+void DecompressingReader::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_ = true;
+    }
+    buffer_free_.notify_all();
+    if (inflate_thread_.joinable()) {
+        inflate_thread_.join();
+    }
+    is_open_ = false;
+}
+
+bool DecompressingReader::next(const char*& data, size_t& size) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (holding_) {
+        // EN: Hand the previous buffer back to the inflater
+        // FR: Rend le buffer précédent à l'inflateur
+        ++consumed_;
+        holding_ = false;
+        buffer_free_.notify_one();
+    }
+
+    buffer_ready_.wait(lock, [this] { return produced_ > consumed_ || finished_; });
+    if (produced_ == consumed_) {
+        return false;
+    }
+
+    const Buffer& buffer = buffers_[consumed_ % buffers_.size()];
+    data = buffer.data.get();
+    size = buffer.size;
+    holding_ = true;
+    return true;
+}
+
+bool DecompressingReader::hasError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !last_error_.empty();
+}
+
+std::string DecompressingReader::getLastError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return last_error_;
+}
+
+void DecompressingReader::inflateWorker(std::FILE* file) {
+    // EN: Read compressed chunks and inflate them into whichever buffer the consumer does not hold
+    // FR: Lit des blocs compressés et les inflate dans le buffer que le consommateur ne détient pas
+    z_stream stream{};
+    if (inflateInit2(&stream, kAutoDetectWindowBits) != Z_OK) {
+        std::fclose(file);
+        finish("inflateInit2 failed");
+        return;
+    }
+
+    std::vector<unsigned char> input(kInputChunkSize);
+    std::string error;
+    bool first_chunk = true;
+    bool member_open = false;   // EN: Inside a gzip member / zlib stream / FR: Dans un membre gzip / flux zlib
+
+    Buffer* output = nullptr;
+    if (!acquireBuffer(output)) {
+        inflateEnd(&stream);
+        std::fclose(file);
+        finish("");
+        return;
+    }
+    stream.next_out = reinterpret_cast<Bytef*>(output->data.get());
+    stream.avail_out = static_cast<uInt>(buffer_size_);
+
+    while (true) {
+        if (stream.avail_out == 0) {
+            publishBuffer(buffer_size_);
+            if (!acquireBuffer(output)) {
+                break;
+            }
+            stream.next_out = reinterpret_cast<Bytef*>(output->data.get());
+            stream.avail_out = static_cast<uInt>(buffer_size_);
+        }
+
+        if (stream.avail_in == 0) {
+            size_t read = std::fread(input.data(), 1, input.size(), file);
+            if (read == 0) {
+                if (std::ferror(file)) {
+                    error = "read failed: " + std::string(std::strerror(errno));
+                } else if (member_open) {
+                    error = "truncated compressed input";
+                }
+                break;
+            }
+            compressed_bytes_read_.fetch_add(read, std::memory_order_relaxed);
+            stream.next_in = input.data();
+            stream.avail_in = static_cast<uInt>(read);
+
+            // EN: BatchWriter writes the BOM uncompressed in front of the first stream
+            // FR: BatchWriter écrit le BOM non compressé devant le premier flux
+            if (first_chunk && hasBom(input.data(), read)) {
+                stream.next_in += 3;
+                stream.avail_in -= 3;
+            }
+            first_chunk = false;
+            if (stream.avail_in == 0) {
+                continue;
+            }
+        }
+
+        int status = inflate(&stream, Z_NO_FLUSH);
+        if (status == Z_STREAM_END) {
+            // EN: One member done; BatchWriter emits one stream per flush, so keep going on the same input
+            // FR: Un membre terminé ; BatchWriter émet un flux par flush, on continue donc sur la même entrée
+            inflateReset(&stream);
+            member_open = false;
+        } else if (status == Z_OK || status == Z_BUF_ERROR) {
+            member_open = true;
+        } else {
+            error = "inflate failed: " + std::string(stream.msg != nullptr ? stream.msg : zError(status));
+            break;
+        }
+    }
+
+    // EN: Hand over what is left before reporting the outcome
+    // FR: Transmet ce qui reste avant de signaler le résultat
+    if (output != nullptr) {
+        size_t pending = buffer_size_ - stream.avail_out;
+        if (pending > 0) {
+            publishBuffer(pending);
+        }
+    }
+
+    inflateEnd(&stream);
+    std::fclose(file);
+    finish(error);
+}
+
+bool DecompressingReader::acquireBuffer(Buffer*& buffer) {
+    // EN: Wait until one of the two buffers is neither filled nor held by the consumer
+    // FR: Attend qu'un des deux buffers ne soit ni rempli ni détenu par le consommateur
+    std::unique_lock<std::mutex> lock(mutex_);
+    buffer_free_.wait(lock, [this] { return stop_requested_ || produced_ - consumed_ < buffers_.size(); });
+    if (stop_requested_) {
+        buffer = nullptr;
+        return false;
+    }
+    buffer = &buffers_[produced_ % buffers_.size()];
+    return true;
+}
+
+void DecompressingReader::publishBuffer(size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers_[produced_ % buffers_.size()].size = size;
+        ++produced_;
+    }
+    decompressed_bytes_.fetch_add(size, std::memory_order_relaxed);
+    buffer_ready_.notify_one();
+}
+
+void DecompressingReader::finish(const std::string& error) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+        if (!error.empty()) {
+            last_error_ = error;
+        }
+    }
+    buffer_ready_.notify_all();
+}
+
+InputCompression DecompressingReader::detect(const std::string& file_path) {
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file) {
+        return InputCompression::NONE;
+    }
+    unsigned char probe[kDetectionProbeSize];
+    file.read(reinterpret_cast<char*>(probe), sizeof(probe));
+    return detect(probe, static_cast<size_t>(file.gcount()));
+}
+
+InputCompression DecompressingReader::detect(const unsigned char* data, size_t size) {
+    if (hasBom(data, size)) {
+        data += 3;
+        size -= 3;
+    }
+    if (size < 2) {
+        return InputCompression::NONE;
+    }
+
+    if (data[0] == 0x1F && data[1] == 0x8B) {
+        return InputCompression::GZIP;
+    }
+
+    // EN: zlib header: deflate with a 32 KB window (what compress2() writes), no preset dictionary and a
+    //     valid header checksum, confirmed by a trial inflate
+    // FR: En-tête zlib : deflate avec fenêtre de 32 Ko (ce qu'écrit compress2()), sans dictionnaire prédéfini
+    //     et avec une somme de contrôle d'en-tête valide, confirmé par un inflate d'essai
+    const unsigned header = (static_cast<unsigned>(data[0]) << 8) | data[1];
+    if (data[0] == 0x78 && (data[1] & 0x20) == 0 && header % 31 == 0 && inflatesCleanly(data, size)) {
+        return InputCompression::ZLIB;
+    }
+
+    return InputCompression::NONE;
+}
+
+DecompressingStreamBuf::int_type DecompressingStreamBuf::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+
+    const char* data = nullptr;
+    size_t size = 0;
+    if (!reader_.next(data, size)) {
+        // EN: Thrown exceptions set badbit on the owning istream, so corrupt input does not look like a clean EOF
+        // FR: Les exceptions levées positionnent badbit sur l'istream propriétaire, une entrée corrompue ne
+        //     ressemble donc pas à une fin de fichier normale
+        if (reader_.hasError()) {
+            throw std::runtime_error("Decompression failed: " + reader_.getLastError());
+        }
+        return traits_type::eof();
+    }
+
+    char* begin = const_cast<char*>(data);
+    setg(begin, begin, begin + size);
+    return traits_type::to_int_type(*gptr());
+}
+
+DecompressingIStream::DecompressingIStream(const std::string& file_path, size_t buffer_size)
+    : std::istream(nullptr)
+    , reader_(std::make_unique<DecompressingReader>(buffer_size))
+    , buffer_(std::make_unique<DecompressingStreamBuf>(*reader_)) {
+    rdbuf(buffer_.get());
+    if (!reader_->open(file_path)) {
+        setstate(std::ios::failbit);
+    }
+}
+
+std::unique_ptr<std::istream> openCsvInput(const std::string& file_path) {
+    if (DecompressingReader::isCompressed(file_path)) {
+        return std::make_unique<DecompressingIStream>(file_path);
+    }
+    return std::make_unique<std::ifstream>(file_path);
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -1,4 +1,5 @@
 #include "csv/delta_compression.hpp"
+#include "csv/compressed_input.hpp"
 #include "infrastructure/logging/logger.hpp"
 #include <sstream>
 #include <fstream>
@@ -1200,7 +1201,8 @@ std::vector<std::vector<std::string>> loadCsvFile(const std::string& filepath) {
     // EN: Load CSV file into memory
     // FR: Charger fichier CSV en mémoire
     std::vector<std::vector<std::string>> data;
-    std::ifstream file(filepath);
+    auto input = openCsvInput(filepath);
+    std::istream& file = *input;
     
     if (!file) {
         throw std::runtime_error("Cannot open file: " + filepath);
@@ -1212,6 +1214,12 @@ std::vector<std::vector<std::string>> loadCsvFile(const std::string& filepath) {
         data.push_back(row);
     }
     
+    // EN: badbit is set by a corrupt or truncated compressed input
+    // FR: badbit est positionné par une entrée compressée corrompue ou tronquée
+    if (file.bad()) {
+        throw std::runtime_error("Cannot read file: " + filepath);
+    }
+    
     return data;
 }
 
@@ -0,0 +1,306 @@
+// EN: External merge sort implementation
+// FR: Implémentation du tri fusion externe
+
+#include "csv/external_sort.hpp"
+#include "csv/query_predicate.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <queue>
+#include <utility>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+// EN: Run record: field count, then length and bytes of each field
+// FR: Enregistrement de séquence : nombre de champs, puis longueur et octets de chaque champ
+size_t writeRow(std::ofstream& out, const RowOrder::Row& row) {
+    const auto fields = static_cast<uint32_t>(row.size());
+    out.write(reinterpret_cast<const char*>(&fields), sizeof(fields));
+    size_t bytes = sizeof(fields);
+    for (const auto& field : row) {
+        const auto size = static_cast<uint32_t>(field.size());
+        out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        out.write(field.data(), static_cast<std::streamsize>(field.size()));
+        bytes += sizeof(size) + field.size();
+    }
+    return bytes;
+}
+
+bool readRow(std::ifstream& in, RowOrder::Row& row) {
+    uint32_t fields = 0;
+    if (!in.read(reinterpret_cast<char*>(&fields), sizeof(fields))) {
+        return false;
+    }
+    row.resize(fields);
+    for (auto& field : row) {
+        uint32_t size = 0;
+        if (!in.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+            return false;
+        }
+        field.resize(size);
+        if (!in.read(field.data(), size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+// EN: RowOrder implementation
+// FR: Implémentation de RowOrder
+
+RowOrder::RowOrder(const std::vector<std::string>& headers, const std::vector<OrderByColumn>& order_by) {
+    for (const auto& spec : order_by) {
+        auto it = std::find(headers.begin(), headers.end(), spec.column);
+        if (it == headers.end()) {
+            valid_ = false;
+        }
+        columns_.push_back(it != headers.end() ? static_cast<size_t>(it - headers.begin()) : 0);
+        descending_.push_back(spec.direction == SortDirection::DESC);
+    }
+}
+
+RowOrder::Key RowOrder::makeKey(const Row& row) const {
+    Key key(columns_.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        double number = 0.0;
+        if (columns_[i] < row.size() && parseNumericCell(row[columns_[i]], number)) {
+            key[i] = number;
+        }
+    }
+    return key;
+}
+
+int RowOrder::compare(size_t i, std::string_view a, const std::optional<double>& number_a,
+                      std::string_view b, const std::optional<double>& number_b) const {
+    if (a == b) {
+        return 0;
+    }
+    int order = 0;
+    if (number_a && number_b) {
+        order = *number_a < *number_b ? -1 : (*number_a > *number_b ? 1 : 0);
+    } else {
+        order = a < b ? -1 : 1;
+    }
+    return descending_[i] ? -order : order;
+}
+
+bool RowOrder::less(const Row& a, const Key& key_a, const Row& b, const Key& key_b) const {
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        const size_t column = columns_[i];
+        std::string_view value_a = column < a.size() ? std::string_view(a[column]) : std::string_view();
+        std::string_view value_b = column < b.size() ? std::string_view(b[column]) : std::string_view();
+        const int order = compare(i, value_a, key_a[i], value_b, key_b[i]);
+        if (order != 0) {
+            return order < 0;
+        }
+    }
+    return false;
+}
+
+// EN: ExternalSorter implementation
+// FR: Implémentation de ExternalSorter
+
+ExternalSorter::ExternalSorter(RowOrder order, size_t memory_budget_bytes, std::filesystem::path spill_directory)
+    : order_(std::move(order)), memory_budget_bytes_(memory_budget_bytes), spill_parent_(std::move(spill_directory)) {}
+
+QueryError ExternalSorter::add(Row row) {
+    size_t bytes = sizeof(Entry) + row.capacity() * sizeof(std::string) +
+                   row.size() * sizeof(std::optional<double>);
+    for (const auto& field : row) {
+        bytes += field.size();
+    }
+    RowOrder::Key key = order_.makeKey(row);
+    buffer_.push_back(Entry{std::move(row), std::move(key)});
+    buffered_bytes_ += bytes;
+    ++row_count_;
+
+    if (memory_budget_bytes_ > 0 && buffered_bytes_ > memory_budget_bytes_) {
+        return spillRun();
+    }
+    return QueryError::SUCCESS;
+}
+
+void ExternalSorter::sortBuffer() {
+    std::stable_sort(buffer_.begin(), buffer_.end(), [this](const Entry& a, const Entry& b) {
+        return order_.less(a.row, a.key, b.row, b.key);
+    });
+}
+
+QueryError ExternalSorter::spillRun() {
+    if (!directory_) {
+        directory_ = std::make_unique<SpillDirectory>(spill_parent_, "bbp_sort_");
+    }
+    if (!directory_->valid()) {
+        return QueryError::IO_ERROR;
+    }
+
+    sortBuffer();
+    std::ofstream out(directory_->file("run", run_count_), std::ios::binary | std::ios::trunc);
+    for (const auto& entry : buffer_) {
+        spilled_bytes_ += writeRow(out, entry.row);
+    }
+    out.close();
+    if (out.fail()) {
+        return QueryError::IO_ERROR;
+    }
+
+    ++run_count_;
+    buffer_.clear();
+    buffered_bytes_ = 0;
+    return QueryError::SUCCESS;
+}
+
+QueryError ExternalSorter::finish(const RowSink& sink) {
+    if (run_count_ == 0) {
+        sortBuffer();
+        for (auto& entry : buffer_) {
+            if (!sink(std::move(entry.row))) {
+                break;
+            }
+        }
+        buffer_.clear();
+        buffered_bytes_ = 0;
+        return QueryError::SUCCESS;
+    }
+
+    if (!buffer_.empty()) {
+        QueryError error = spillRun();
+        if (error != QueryError::SUCCESS) {
+            return error;
+        }
+    }
+
+    // EN: One open reader and one current row per run; the heap yields the run holding the smallest row
+    // FR: Un lecteur ouvert et une ligne courante par séquence ; le tas donne la séquence portant la plus petite ligne
+    std::vector<std::ifstream> runs(run_count_);
+    std::vector<Entry> heads(run_count_);
+    auto comes_after = [this, &heads](size_t a, size_t b) {
+        if (order_.less(heads[b].row, heads[b].key, heads[a].row, heads[a].key)) {
+            return true;
+        }
+        return !order_.less(heads[a].row, heads[a].key, heads[b].row, heads[b].key) && a > b;
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(comes_after)> heap(comes_after);
+    auto advance = [this, &runs, &heads, &heap](size_t run) {
+        if (readRow(runs[run], heads[run].row)) {
+            heads[run].key = order_.makeKey(heads[run].row);
+            heap.push(run);
+        }
+    };
+
+    for (size_t run = 0; run < run_count_; ++run) {
+        runs[run].open(directory_->file("run", run), std::ios::binary);
+        if (!runs[run]) {
+            return QueryError::IO_ERROR;
+        }
+        advance(run);
+    }
+    while (!heap.empty()) {
+        const size_t run = heap.top();
+        heap.pop();
+        if (!sink(std::move(heads[run].row))) {
+            break;
+        }
+        advance(run);
+    }
+
+    runs.clear();
+    directory_.reset();
+    return QueryError::SUCCESS;
+}
+
+// EN: RowTopK implementation
+// FR: Implémentation de RowTopK
+
+bool RowTopK::EntryLess::operator()(const Entry& a, const Entry& b) const {
+    if (order->less(a.row, a.key, b.row, b.key)) {
+        return true;
+    }
+    return !order->less(b.row, b.key, a.row, a.key) && a.sequence < b.sequence;
+}
+
+RowTopK::RowTopK(RowOrder order, size_t k)
+    : order_(std::make_unique<RowOrder>(std::move(order))), top_(k, EntryLess{order_.get()}) {}
+
+void RowTopK::add(Row row) {
+    RowOrder::Key key = order_->makeKey(row);
+    top_.push(Entry{std::move(row), std::move(key), row_count_++});
+}
+
+std::vector<RowTopK::Row> RowTopK::take() {
+    std::vector<Row> rows;
+    for (auto& entry : top_.take()) {
+        rows.push_back(std::move(entry.row));
+    }
+    return rows;
+}
+
+std::vector<size_t> selectTopRows(const ColumnarTable& table, const std::vector<size_t>& rows,
+                                  const RowOrder& order, const std::vector<size_t>& columns, size_t k) {
+    // EN: Numeric reading of every dictionary entry of the sort columns, once
+    // FR: Lecture numérique de chaque entrée de dictionnaire des colonnes de tri, une fois
+    const size_t key_count = columns.size();
+    std::vector<std::vector<std::optional<double>>> code_numbers(key_count);
+    for (size_t i = 0; i < key_count; ++i) {
+        if (columns[i] < table.getColumnCount() && table.isDictionaryEncoded(columns[i])) {
+            const auto& dictionary = table.getDictionary(columns[i]);
+            code_numbers[i].resize(dictionary.size());
+            for (size_t code = 0; code < dictionary.size(); ++code) {
+                double number = 0.0;
+                if (parseNumericCell(dictionary[code], number)) {
+                    code_numbers[i][code] = number;
+                }
+            }
+        }
+    }
+    auto readKey = [&](size_t row, RowOrder::Key& key) {
+        for (size_t i = 0; i < key_count; ++i) {
+            if (!code_numbers[i].empty()) {
+                key[i] = code_numbers[i][table.getCodes(columns[i])[row]];
+                continue;
+            }
+            double number = 0.0;
+            key[i] = parseNumericCell(table.getValue(row, columns[i]), number) ? std::optional<double>(number)
+                                                                                 : std::nullopt;
+        }
+    };
+    
+    struct Candidate {
+        size_t row;
+        RowOrder::Key key;
+    };
+    auto less = [&](const Candidate& a, const Candidate& b) {
+        for (size_t i = 0; i < key_count; ++i) {
+            const int compared = order.compare(i, table.getValue(a.row, columns[i]), a.key[i],
+                                               table.getValue(b.row, columns[i]), b.key[i]);
+            if (compared != 0) {
+                return compared < 0;
+            }
+        }
+        return a.row < b.row;
+    };
+    
+    TopK<Candidate, decltype(less)> top(std::min(k, rows.size()), less);
+    Candidate candidate{0, RowOrder::Key(key_count)};
+    for (size_t row : rows) {
+        candidate.row = row;
+        readKey(row, candidate.key);
+        if (top.admits(candidate)) {
+            top.push(std::exchange(candidate, Candidate{0, RowOrder::Key(key_count)}));
+        }
+    }
+    
+    std::vector<size_t> selected;
+    for (const auto& kept : top.take()) {
+        selected.push_back(kept.row);
+    }
+    return selected;
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,301 @@
+// EN: Hash join implementation
+// FR: Implémentation de la jointure par hachage
+
+#include "csv/hash_join.hpp"
+#include "csv/spill_directory.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+constexpr std::string_view kNullCell = "NULL";
+
+bool isJoinableKey(std::string_view key) {
+    return !key.empty() && key != "NULL" && key != "null";
+}
+
+// EN: Spill record: row number, key length, key bytes
+// FR: Enregistrement de débordement : numéro de ligne, longueur de clé, octets de la clé
+size_t writeRecord(std::ofstream& out, uint64_t row, std::string_view key) {
+    const auto size = static_cast<uint32_t>(key.size());
+    out.write(reinterpret_cast<const char*>(&row), sizeof(row));
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    out.write(key.data(), static_cast<std::streamsize>(key.size()));
+    return sizeof(row) + sizeof(size) + key.size();
+}
+
+bool readRecord(std::ifstream& in, uint64_t& row, std::string& key) {
+    uint32_t size = 0;
+    if (!in.read(reinterpret_cast<char*>(&row), sizeof(row)) ||
+        !in.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+        return false;
+    }
+    key.resize(size);
+    return static_cast<bool>(in.read(key.data(), size));
+}
+
+// EN: Partition from the high bits of a remixed hash, independent from the buckets of the per-partition tables
+// FR: Partition tirée des bits hauts d'un hachage remélangé, indépendante des seaux des tables par partition
+size_t partitionOf(std::string_view key, int shift) {
+    const uint64_t hash = static_cast<uint64_t>(std::hash<std::string_view>{}(key)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash >> shift);
+}
+
+} // anonymous namespace
+
+HashJoin::HashJoin(JoinClause::Type type, size_t memory_budget_bytes, std::filesystem::path spill_directory)
+    : type_(type), memory_budget_bytes_(memory_budget_bytes), spill_directory_(std::move(spill_directory)) {}
+
+size_t HashJoin::estimateBuildBytes(const ColumnarTable& table, size_t column) {
+    // EN: Per-row hashing overhead plus the key bytes a spilled partition copies
+    // FR: Surcoût de hachage par ligne plus les octets de clé qu'une partition débordée copie
+    size_t bytes = table.getRowCount() * kEntryOverheadBytes;
+    if (table.isDictionaryEncoded(column)) {
+        const auto& dictionary = table.getDictionary(column);
+        for (ColumnarTable::DictionaryCode code : table.getCodes(column)) {
+            bytes += dictionary[code].size();
+        }
+    } else {
+        for (std::string_view value : table.getValues(column)) {
+            bytes += value.size();
+        }
+    }
+    return bytes;
+}
+
+size_t HashJoin::partitionCount(size_t build_bytes, size_t memory_budget_bytes) {
+    if (memory_budget_bytes == 0 || build_bytes <= memory_budget_bytes) {
+        return 0;
+    }
+    // EN: Twice the strict minimum, so that a skewed partition still has a chance to fit
+    // FR: Deux fois le strict minimum, pour qu'une partition déséquilibrée ait encore une chance de tenir
+    const size_t needed = (build_bytes + memory_budget_bytes - 1) / memory_budget_bytes;
+    return std::clamp<size_t>(std::bit_ceil(2 * needed), 2, kMaxPartitions);
+}
+
+QueryError HashJoin::execute(const ColumnarTable& left, size_t left_column,
+                             const ColumnarTable& right, size_t right_column, Pairs& pairs) {
+    pairs.left.clear();
+    pairs.right.clear();
+    spilled_bytes_ = 0;
+
+    const Side left_side{&left, left_column, type_ == JoinClause::LEFT || type_ == JoinClause::FULL};
+    const Side right_side{&right, right_column, type_ == JoinClause::RIGHT || type_ == JoinClause::FULL};
+    built_left_ = buildOnLeft(left.getRowCount(), right.getRowCount());
+    const Side& build = built_left_ ? left_side : right_side;
+    const Side& probe = built_left_ ? right_side : left_side;
+
+    partitions_ = partitionCount(estimateBuildBytes(*build.table, build.column), memory_budget_bytes_);
+    if (partitions_ == 0) {
+        joinInMemory(build, probe, pairs);
+        return QueryError::SUCCESS;
+    }
+    return joinPartitioned(build, probe, pairs);
+}
+
+void HashJoin::emit(size_t build_row, size_t probe_row, Pairs& pairs) const {
+    pairs.left.push_back(built_left_ ? build_row : probe_row);
+    pairs.right.push_back(built_left_ ? probe_row : build_row);
+}
+
+void HashJoin::joinInMemory(const Side& build, const Side& probe, Pairs& pairs) const {
+    // EN: Build: one head per distinct key, rows sharing a key chained through `next` in ascending order
+    // FR: Construction : une tête par clé distincte, les lignes partageant une clé chaînées par `next` en ordre croissant
+    const ColumnarTable& build_table = *build.table;
+    const size_t build_rows = build_table.getRowCount();
+    std::unordered_map<std::string_view, size_t> heads;
+    heads.reserve(build_table.isDictionaryEncoded(build.column) ? build_table.getDictionary(build.column).size()
+                                                                : build_rows);
+    std::vector<size_t> next(build_rows, kNoRow);
+    for (size_t row = build_rows; row-- > 0;) {
+        std::string_view key = build_table.getValue(row, build.column);
+        if (!isJoinableKey(key)) {
+            continue;
+        }
+        auto [it, inserted] = heads.try_emplace(key, row);
+        if (!inserted) {
+            next[row] = it->second;
+            it->second = row;
+        }
+    }
+    std::vector<uint8_t> matched(build.keep_unmatched ? build_rows : 0, 0);
+
+    auto probeChain = [&](size_t probe_row, size_t head) {
+        if (head == kNoRow) {
+            if (probe.keep_unmatched) {
+                emit(kNoRow, probe_row, pairs);
+            }
+            return;
+        }
+        for (size_t row = head; row != kNoRow; row = next[row]) {
+            emit(row, probe_row, pairs);
+            if (build.keep_unmatched) {
+                matched[row] = 1;
+            }
+        }
+    };
+    auto lookup = [&heads](std::string_view key) {
+        if (!isJoinableKey(key)) {
+            return kNoRow;
+        }
+        auto it = heads.find(key);
+        return it != heads.end() ? it->second : kNoRow;
+    };
+
+    // EN: Probe: a dictionary-encoded key column is looked up once per distinct value
+    // FR: Sondage : une colonne clé encodée par dictionnaire est recherchée une fois par valeur distincte
+    const ColumnarTable& probe_table = *probe.table;
+    if (probe_table.isDictionaryEncoded(probe.column)) {
+        const auto& dictionary = probe_table.getDictionary(probe.column);
+        std::vector<size_t> code_heads(dictionary.size());
+        for (size_t code = 0; code < dictionary.size(); ++code) {
+            code_heads[code] = lookup(dictionary[code]);
+        }
+        const auto& codes = probe_table.getCodes(probe.column);
+        for (size_t row = 0; row < codes.size(); ++row) {
+            probeChain(row, code_heads[codes[row]]);
+        }
+    } else {
+        const auto& values = probe_table.getValues(probe.column);
+        for (size_t row = 0; row < values.size(); ++row) {
+            probeChain(row, lookup(values[row]));
+        }
+    }
+
+    for (size_t row = 0; row < matched.size(); ++row) {
+        if (!matched[row]) {
+            emit(row, kNoRow, pairs);
+        }
+    }
+}
+
+QueryError HashJoin::joinPartitioned(const Side& build, const Side& probe, Pairs& pairs) {
+    SpillDirectory directory(spill_directory_, "bbp_join_");
+    if (!directory.valid()) {
+        return QueryError::IO_ERROR;
+    }
+    const int shift = 64 - std::countr_zero(partitions_);
+
+    // EN: Pass 1: write every joinable key of a side to its partition file; rows whose key can never match are
+    //     settled right away
+    // FR: Passe 1 : écrire chaque clé joignable d'un côté dans son fichier de partition ; les lignes dont la clé
+    //     ne peut jamais correspondre sont réglées immédiatement
+    auto spill = [&](const Side& side, const char* name, bool is_build) {
+        std::vector<std::ofstream> files(partitions_);
+        for (size_t p = 0; p < partitions_; ++p) {
+            files[p].open(directory.file(name, p), std::ios::binary | std::ios::trunc);
+            if (!files[p]) {
+                return false;
+            }
+        }
+        const ColumnarTable& table = *side.table;
+        for (size_t row = 0; row < table.getRowCount(); ++row) {
+            std::string_view key = table.getValue(row, side.column);
+            if (isJoinableKey(key)) {
+                spilled_bytes_ += writeRecord(files[partitionOf(key, shift)], row, key);
+            } else if (side.keep_unmatched && is_build) {
+                emit(row, kNoRow, pairs);
+            } else if (side.keep_unmatched) {
+                emit(kNoRow, row, pairs);
+            }
+        }
+        for (auto& file : files) {
+            file.close();
+            if (file.fail()) {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (!spill(build, "build", true) || !spill(probe, "probe", false)) {
+        return QueryError::IO_ERROR;
+    }
+
+    // EN: Pass 2: partition by partition, hash the build keys (copied into a local heap) and stream the probe keys
+    // FR: Passe 2 : partition par partition, hacher les clés de construction (copiées dans un tas local) et faire
+    //     défiler les clés de sondage
+    uint64_t row = 0;
+    std::string key;
+    for (size_t p = 0; p < partitions_; ++p) {
+        StringHeap heap;
+        std::vector<size_t> rows;
+        std::vector<size_t> next;
+        std::unordered_map<std::string_view, size_t> heads;
+
+        std::ifstream build_file(directory.file("build", p), std::ios::binary);
+        if (!build_file) {
+            return QueryError::IO_ERROR;
+        }
+        while (readRecord(build_file, row, key)) {
+            const size_t local = rows.size();
+            rows.push_back(static_cast<size_t>(row));
+            next.push_back(kNoRow);
+            auto [it, inserted] = heads.try_emplace(heap.store(key), local);
+            if (!inserted) {
+                next[local] = it->second;
+                it->second = local;
+            }
+        }
+        std::vector<uint8_t> matched(build.keep_unmatched ? rows.size() : 0, 0);
+
+        std::ifstream probe_file(directory.file("probe", p), std::ios::binary);
+        if (!probe_file) {
+            return QueryError::IO_ERROR;
+        }
+        while (readRecord(probe_file, row, key)) {
+            auto it = heads.find(key);
+            if (it == heads.end()) {
+                if (probe.keep_unmatched) {
+                    emit(kNoRow, static_cast<size_t>(row), pairs);
+                }
+                continue;
+            }
+            for (size_t local = it->second; local != kNoRow; local = next[local]) {
+                emit(rows[local], static_cast<size_t>(row), pairs);
+                if (build.keep_unmatched) {
+                    matched[local] = 1;
+                }
+            }
+        }
+        for (size_t local = 0; local < matched.size(); ++local) {
+            if (!matched[local]) {
+                emit(rows[local], kNoRow, pairs);
+            }
+        }
+    }
+    return QueryError::SUCCESS;
+}
+
+std::shared_ptr<ColumnarTable> materializeJoin(const ColumnarTable& left, const ColumnarTable& right,
+                                               const HashJoin::Pairs& pairs, std::vector<std::string> headers,
+                                               size_t dictionary_limit) {
+    const size_t left_columns = left.getColumnCount();
+    const size_t right_columns = right.getColumnCount();
+    auto table = std::make_shared<ColumnarTable>(std::move(headers), dictionary_limit);
+    table->reserve(pairs.left.size());
+
+    std::vector<std::string_view> row(left_columns + right_columns);
+    for (size_t i = 0; i < pairs.left.size(); ++i) {
+        const size_t left_row = pairs.left[i];
+        const size_t right_row = pairs.right[i];
+        for (size_t c = 0; c < left_columns; ++c) {
+            row[c] = left_row == HashJoin::kNoRow ? kNullCell : left.getValue(left_row, c);
+        }
+        for (size_t c = 0; c < right_columns; ++c) {
+            row[left_columns + c] = right_row == HashJoin::kNoRow ? kNullCell : right.getValue(right_row, c);
+        }
+        table->appendRow(row);
+    }
+    return table;
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,358 @@
+// EN: Compressed inverted index implementation (delta + varint postings, skip entries, galloping search)
+// FR: Implémentation de l'index inversé compressé (listes delta + varint, entrées de saut, recherche galopante)
+
+#include "csv/inverted_index.hpp"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <queue>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+constexpr size_t kSkipBytes = 2 * sizeof(uint64_t);
+
+void putVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+// EN: Decode one varint, never reading at or past `end`; false on truncated input
+// FR: Décode un varint, sans jamais lire à partir de `end` ; faux sur une entrée tronquée
+bool getVarint(const uint8_t*& in, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; in < end && shift < 64; shift += 7) {
+        const uint8_t byte = *in++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+// EN: PostingEncoder implementation
+// FR: Implémentation de PostingEncoder
+
+void PostingEncoder::add(size_t row, uint32_t position) {
+    if (!positions_.empty() && row != open_row_) {
+        flushRow();
+    }
+    open_row_ = row;
+    positions_.push_back(position);
+}
+
+void PostingEncoder::flushRow() {
+    if (positions_.empty()) {
+        return;
+    }
+    if (row_count_ > 0 && row_count_ % kSkipInterval == 0) {
+        skips_.push_back(previous_row_);
+        skips_.push_back(entries_.size());
+    }
+    putVarint(entries_, open_row_ - previous_row_);
+    putVarint(entries_, positions_.size());
+    uint32_t previous_position = 0;
+    for (uint32_t position : positions_) {
+        putVarint(entries_, position - previous_position);
+        previous_position = position;
+    }
+    previous_row_ = open_row_;
+    ++row_count_;
+    positions_.clear();
+}
+
+std::string PostingEncoder::finish() {
+    flushRow();
+    std::string encoded;
+    const size_t skip_count = skips_.size() / 2;
+    encoded.reserve(20 + skip_count * kSkipBytes + entries_.size());
+    putVarint(encoded, row_count_);
+    putVarint(encoded, skip_count);
+    encoded.append(reinterpret_cast<const char*>(skips_.data()), skips_.size() * sizeof(uint64_t));
+    encoded += entries_;
+    *this = PostingEncoder();
+    return encoded;
+}
+
+// EN: PostingCursor implementation
+// FR: Implémentation de PostingCursor
+
+PostingCursor::PostingCursor(std::string_view encoded) {
+    const auto* in = reinterpret_cast<const uint8_t*>(encoded.data());
+    end_ = in + encoded.size();
+    uint64_t row_count = 0;
+    uint64_t skip_count = 0;
+    if (!getVarint(in, end_, row_count) || !getVarint(in, end_, skip_count) ||
+        skip_count > static_cast<size_t>(end_ - in) / kSkipBytes) {
+        return;
+    }
+    row_count_ = row_count;
+    skip_count_ = skip_count;
+    skips_ = in;
+    entries_ = in + skip_count_ * kSkipBytes;
+    next_ = entries_;
+    if (row_count_ > 0) {
+        at_end_ = false;
+        decode(0);
+    }
+}
+
+uint64_t PostingCursor::skipValue(size_t skip, size_t field) const {
+    uint64_t value = 0;
+    std::memcpy(&value, skips_ + skip * kSkipBytes + field * sizeof(value), sizeof(value));
+    return value;
+}
+
+void PostingCursor::decode(size_t previous_row) {
+    const uint8_t* in = next_;
+    uint64_t delta = 0;
+    uint64_t count = 0;
+    if (!getVarint(in, end_, delta) || !getVarint(in, end_, count)) {
+        at_end_ = true;
+        return;
+    }
+    row_ = previous_row + delta;
+    position_count_ = count;
+    positions_at_ = in;
+    // EN: Step over the position deltas without decoding them
+    // FR: Passer les deltas de positions sans les décoder
+    for (uint64_t i = 0; i < count; ++i) {
+        while (in < end_ && (*in & 0x80)) {
+            ++in;
+        }
+        if (in == end_) {
+            at_end_ = true;
+            return;
+        }
+        ++in;
+    }
+    next_ = in;
+}
+
+void PostingCursor::next() {
+    if (at_end_) {
+        return;
+    }
+    if (++index_ >= row_count_) {
+        at_end_ = true;
+        return;
+    }
+    decode(row_);
+}
+
+void PostingCursor::seek(size_t target) {
+    if (at_end_ || row_ >= target) {
+        return;
+    }
+
+    // EN: Skip j (1-based) starts entry j * kSkipInterval after row previous(j). Gallop to bracket the last skip
+    //     with previous(j) < target, then bisect; every row before that skip is below the target.
+    // FR: Le saut j (base 1) commence l'entrée j * kSkipInterval après la ligne previous(j). Galoper pour encadrer
+    //     le dernier saut avec previous(j) < target, puis dichotomie ; toute ligne avant ce saut est sous la cible.
+    const size_t block = index_ / PostingEncoder::kSkipInterval;
+    size_t low = block;
+    size_t high = block + 1;
+    for (size_t step = 1; high <= skip_count_ && skipValue(high - 1, 0) < target; step *= 2) {
+        low = high;
+        high = block + 2 * step;
+    }
+    high = std::min(high, skip_count_ + 1);
+    while (high - low > 1) {
+        const size_t middle = low + (high - low) / 2;
+        if (skipValue(middle - 1, 0) < target) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    if (low > block) {
+        const uint64_t offset = skipValue(low - 1, 1);
+        if (offset >= static_cast<size_t>(end_ - entries_)) {
+            at_end_ = true;
+            return;
+        }
+        next_ = entries_ + offset;
+        index_ = low * PostingEncoder::kSkipInterval;
+        decode(skipValue(low - 1, 0));
+    }
+
+    while (!at_end_ && row_ < target) {
+        next();
+    }
+}
+
+void PostingCursor::positions(std::vector<uint32_t>& out) const {
+    out.clear();
+    const uint8_t* in = positions_at_;
+    uint64_t position = 0;
+    for (size_t i = 0; i < position_count_; ++i) {
+        uint64_t delta = 0;
+        if (!getVarint(in, end_, delta)) {
+            return;
+        }
+        position += delta;
+        out.push_back(static_cast<uint32_t>(position));
+    }
+}
+
+std::vector<size_t> matchPostings(const std::vector<std::string_view>& postings, TextMatch mode) {
+    std::vector<size_t> rows;
+    if (postings.empty()) {
+        return rows;
+    }
+    std::vector<PostingCursor> cursors;
+    cursors.reserve(postings.size());
+    for (std::string_view encoded : postings) {
+        cursors.emplace_back(encoded);
+    }
+
+    if (mode == TextMatch::ANY_TERM) {
+        auto later = [&cursors](size_t a, size_t b) { return cursors[a].row() > cursors[b].row(); };
+        std::priority_queue<size_t, std::vector<size_t>, decltype(later)> heap(later);
+        for (size_t i = 0; i < cursors.size(); ++i) {
+            if (!cursors[i].atEnd()) {
+                heap.push(i);
+            }
+        }
+        while (!heap.empty()) {
+            const size_t i = heap.top();
+            heap.pop();
+            if (rows.empty() || rows.back() != cursors[i].row()) {
+                rows.push_back(cursors[i].row());
+            }
+            cursors[i].next();
+            if (!cursors[i].atEnd()) {
+                heap.push(i);
+            }
+        }
+        return rows;
+    }
+
+    // EN: Rarest list first: it proposes the candidates, the others gallop to them
+    // FR: Liste la plus rare d'abord : elle propose les candidats, les autres galopent jusqu'à eux
+    std::vector<size_t> order(cursors.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&cursors](size_t a, size_t b) {
+        return cursors[a].getRowCount() < cursors[b].getRowCount();
+    });
+    PostingCursor& lead = cursors[order.front()];
+    if (lead.atEnd()) {
+        return rows;
+    }
+
+    std::vector<std::vector<uint32_t>> positions(mode == TextMatch::PHRASE ? cursors.size() : 0);
+    auto phraseAt = [&]() {
+        for (size_t i = 0; i < cursors.size(); ++i) {
+            cursors[i].positions(positions[i]);
+        }
+        for (uint32_t start : positions[0]) {
+            bool found = true;
+            for (size_t i = 1; i < cursors.size() && found; ++i) {
+                found = std::binary_search(positions[i].begin(), positions[i].end(),
+                                           static_cast<uint32_t>(start + i));
+            }
+            if (found) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    size_t target = lead.row();
+    while (true) {
+        bool aligned = true;
+        for (size_t i : order) {
+            cursors[i].seek(target);
+            if (cursors[i].atEnd()) {
+                return rows;
+            }
+            if (cursors[i].row() > target) {
+                target = cursors[i].row();
+                aligned = false;
+                break;
+            }
+        }
+        if (!aligned) {
+            continue;
+        }
+        if (mode != TextMatch::PHRASE || phraseAt()) {
+            rows.push_back(target);
+        }
+        lead.next();
+        if (lead.atEnd()) {
+            return rows;
+        }
+        target = lead.row();
+    }
+}
+
+// EN: InvertedIndex implementation
+// FR: Implémentation d'InvertedIndex
+
+void InvertedIndex::add(size_t row, const std::vector<std::string>& tokens) {
+    for (size_t position = 0; position < tokens.size(); ++position) {
+        building_[tokens[position]].add(row, static_cast<uint32_t>(position));
+    }
+    posting_count_ += tokens.size();
+}
+
+void InvertedIndex::finish() {
+    std::vector<std::pair<const std::string, PostingEncoder>*> terms;
+    terms.reserve(building_.size());
+    for (auto& entry : building_) {
+        terms.push_back(&entry);
+    }
+    std::sort(terms.begin(), terms.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    term_offsets_.assign(1, 0);
+    posting_offsets_.assign(1, 0);
+    term_offsets_.reserve(terms.size() + 1);
+    posting_offsets_.reserve(terms.size() + 1);
+    for (auto* term : terms) {
+        terms_ += term->first;
+        postings_ += term->second.finish();
+        term_offsets_.push_back(terms_.size());
+        posting_offsets_.push_back(postings_.size());
+    }
+    terms_.shrink_to_fit();
+    postings_.shrink_to_fit();
+    std::unordered_map<std::string, PostingEncoder>().swap(building_);
+}
+
+std::string_view InvertedIndex::getTerm(size_t i) const {
+    return std::string_view(terms_).substr(term_offsets_[i], term_offsets_[i + 1] - term_offsets_[i]);
+}
+
+std::string_view InvertedIndex::getPostings(size_t i) const {
+    return std::string_view(postings_).substr(posting_offsets_[i], posting_offsets_[i + 1] - posting_offsets_[i]);
+}
+
+std::string_view InvertedIndex::find(std::string_view term) const {
+    size_t low = 0;
+    size_t high = getTermCount();
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (getTerm(middle) < term) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low < getTermCount() && getTerm(low) == term ? getPostings(low) : std::string_view();
+}
+
+size_t InvertedIndex::getMemoryUsage() const {
+    return sizeof(*this) + terms_.capacity() + postings_.capacity() +
+           (term_offsets_.capacity() + posting_offsets_.capacity()) * sizeof(size_t);
+}
+
+} // namespace CSV
+} // namespace BBP
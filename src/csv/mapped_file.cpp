@@ -0,0 +1,129 @@
+// EN: Read-only memory-mapped file wrapper implementation (POSIX mmap/madvise)
+// FR: Implémentation du wrapper de fichier mappé en mémoire en lecture seule (POSIX mmap/madvise)
+
+#include "csv/mapped_file.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+// EN: Translate our advice enum to the madvise() constant
+// FR: Traduit notre enum d'indication vers la constante madvise()
+int toMadvise(MappingAdvice advice) {
+    switch (advice) {
+        case MappingAdvice::SEQUENTIAL: return MADV_SEQUENTIAL;
+        case MappingAdvice::RANDOM:     return MADV_RANDOM;
+        case MappingAdvice::WILL_NEED:  return MADV_WILLNEED;
+        case MappingAdvice::NORMAL:
+        default:                        return MADV_NORMAL;
+    }
+}
+
+} // anonymous namespace
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0))
+    , is_open_(std::exchange(other.is_open_, false))
+    , path_(std::move(other.path_))
+    , last_error_(std::move(other.last_error_)) {
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        is_open_ = std::exchange(other.is_open_, false);
+        path_ = std::move(other.path_);
+        last_error_ = std::move(other.last_error_);
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string& file_path, MappingAdvice advice) {
+    close();
+    path_ = file_path;
+
+    int fd = ::open(file_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        last_error_ = "open failed: " + std::string(std::strerror(errno));
+        return false;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        last_error_ = "fstat failed: " + std::string(std::strerror(errno));
+        ::close(fd);
+        return false;
+    }
+
+    // EN: mmap() rejects zero-length mappings, an empty file is simply an empty view
+    // FR: mmap() refuse les mappings de longueur nulle, un fichier vide est simplement une vue vide
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ == 0) {
+        ::close(fd);
+        is_open_ = true;
+        return true;
+    }
+
+    void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    // EN: The mapping keeps its own reference to the file
+    // FR: Le mapping garde sa propre référence sur le fichier
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        last_error_ = "mmap failed: " + std::string(std::strerror(errno));
+        size_ = 0;
+        return false;
+    }
+
+    data_ = static_cast<const char*>(addr);
+    is_open_ = true;
+    advise(advice);
+    return true;
+}
+
+void MappedFile::close() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    is_open_ = false;
+}
+
+void MappedFile::advise(MappingAdvice advice) {
+    advise(advice, 0, size_);
+}
+
+void MappedFile::advise(MappingAdvice advice, size_t offset, size_t length) {
+    if (data_ == nullptr || offset >= size_) {
+        return;
+    }
+
+    // EN: madvise() needs a page-aligned start address
+    // FR: madvise() exige une adresse de début alignée sur une page
+    static const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    size_t aligned_offset = offset - (offset % page_size);
+    size_t aligned_length = std::min(length + (offset - aligned_offset), size_ - aligned_offset);
+
+    // EN: Advice is only a hint, failures are not fatal
+    // FR: L'indication n'est qu'un conseil, les échecs ne sont pas fatals
+    ::madvise(const_cast<char*>(data_) + aligned_offset, aligned_length, toMadvise(advice));
+}
+
+} // namespace CSV
+} // namespace BBP
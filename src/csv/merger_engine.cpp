@@ -2,6 +2,7 @@
 // FR: Implémentation du moteur de fusion CSV intelligent avec déduplication et stratégies de fusion avancées
 
 #include "csv/merger_engine.hpp"
+#include "csv/compressed_input.hpp"
 #include "infrastructure/logging/logger.hpp"
 #include <algorithm>
 #include <sstream>
@@ -699,8 +700,9 @@ MergeError MergerEngine::appendMerge(std::ostream& output_stream) {
                       "Processing " + source.name);
         
         try {
-            std::ifstream file(source.filepath);
-            if (!file.is_open()) {
+            auto input = openCsvInput(source.filepath);
+            std::istream& file = *input;
+            if (!file) {
                 reportError(MergeError::FILE_NOT_FOUND, "Cannot open file: " + source.filepath);
                 continue;
             }
@@ -730,7 +732,7 @@ MergeError MergerEngine::appendMerge(std::ostream& output_stream) {
                 stats_.incrementRowsProcessed();
             }
             
-            file.close();
+            input.reset();
             stats_.incrementFilesProcessed();
             
         } catch (const std::exception& e) {
@@ -955,8 +957,9 @@ bool MergerEngine::validateSchemaCompatibility() const {
 std::vector<std::string> MergerEngine::readCsvHeaders(const std::string& filepath, char delimiter) const {
     // EN: Read CSV headers from file
     // FR: Lit les en-têtes CSV du fichier
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
+    auto input = openCsvInput(filepath);
+    std::istream& file = *input;
+    if (!file) {
         throw std::runtime_error("Cannot open file: " + filepath);
     }
     
@@ -972,9 +975,10 @@ std::vector<std::vector<std::string>> MergerEngine::readCsvFile(const InputSourc
     // EN: Read entire CSV file into memory
     // FR: Lit le fichier CSV entier en mémoire
     std::vector<std::vector<std::string>> rows;
-    std::ifstream file(source.filepath);
+    auto input = openCsvInput(source.filepath);
+    std::istream& file = *input;
     
-    if (!file.is_open()) {
+    if (!file) {
         throw std::runtime_error("Cannot open file: " + source.filepath);
     }
     
@@ -998,6 +1002,12 @@ std::vector<std::vector<std::string>> MergerEngine::readCsvFile(const InputSourc
         rows.push_back(row);
     }
     
+    // EN: badbit is set by a corrupt or truncated compressed input
+    // FR: badbit est positionné par une entrée compressée corrompue ou tronquée
+    if (file.bad()) {
+        throw std::runtime_error("Cannot read file: " + source.filepath);
+    }
+    
     return rows;
 }
 
@@ -1177,8 +1187,9 @@ std::string detectEncoding(const std::string& /* filepath */) {
 char detectDelimiter(const std::string& filepath) {
     // EN: Detect CSV delimiter by analyzing first few lines
     // FR: Détecte le délimiteur CSV en analysant les premières lignes
-    std::ifstream file(filepath);
-    if (!file.is_open()) return ',';
+    auto input = openCsvInput(filepath);
+    std::istream& file = *input;
+    if (!file) return ',';
     
     std::string line;
     std::unordered_map<char, int> delimiter_counts;
@@ -0,0 +1,70 @@
+// EN: Morsel-driven scan execution implementation
+// FR: Implémentation de l'exécution des parcours par morceaux
+
+#include "csv/morsel_scan.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace BBP {
+namespace CSV {
+
+size_t forEachMorsel(ThreadPool* pool, size_t helpers, size_t item_count, size_t morsel_size,
+                     const std::function<void(size_t morsel, size_t begin, size_t end)>& body) {
+    const size_t morsels = morselCount(item_count, morsel_size);
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::atomic<size_t> participants{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto work = [&] {
+        bool participated = false;
+        for (size_t morsel = next.fetch_add(1); morsel < morsels && !failed; morsel = next.fetch_add(1)) {
+            participated = true;
+            try {
+                const size_t begin = morsel * morsel_size;
+                body(morsel, begin, std::min(item_count, begin + morsel_size));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+        if (participated) {
+            ++participants;
+        }
+    };
+
+    // EN: A helper that cannot be queued is simply not used: the calling thread always drains the morsels
+    // FR: Un assistant qui ne peut être mis en file n'est simplement pas utilisé : le thread appelant vide
+    //     toujours les morceaux
+    std::vector<std::future<void>> tasks;
+    if (pool) {
+        const size_t wanted = std::min(helpers, morsels > 0 ? morsels - 1 : 0);
+        for (size_t i = 0; i < wanted; ++i) {
+            try {
+                tasks.push_back(pool->submit(work));
+            } catch (const std::exception&) {
+                break;
+            }
+        }
+    }
+    work();
+    for (auto& task : tasks) {
+        task.wait();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return std::max<size_t>(1, participants);
+}
+
+} // namespace CSV
+} // namespace BBP
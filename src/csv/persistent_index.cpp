@@ -0,0 +1,346 @@
+// EN: Persistent index implementation (sorted keys, uint32 postings, size/mtime/content-hash validation)
+// FR: Implémentation des index persistants (clés triées, listes uint32, validation taille/mtime/empreinte)
+
+#include "csv/persistent_index.hpp"
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <system_error>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+constexpr char kMagic[8] = {'B', 'B', 'P', 'Q', 'I', 'D', 'X', '1'};
+constexpr uint32_t kVersion = 2;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t type;
+    uint64_t source_size;
+    int64_t source_mtime;
+    uint64_t source_hash;
+    uint64_t row_count;
+    uint64_t key_count;
+    uint64_t posting_count;
+    uint64_t key_bytes;
+    uint32_t column_size;
+    uint32_t tokenizer_size;
+    uint32_t case_sensitive;
+    uint32_t posting_width;
+};
+static_assert(sizeof(FileHeader) % 8 == 0, "sections after the header stay 8-byte aligned");
+
+size_t padded(size_t bytes) {
+    return (bytes + 7) & ~size_t{7};
+}
+
+uint64_t loadU64(const char* base, size_t i) {
+    uint64_t value = 0;
+    std::memcpy(&value, base + i * sizeof(value), sizeof(value));
+    return value;
+}
+
+// EN: Four independent multiply-rotate lanes over 32-byte stripes, then the tail byte by byte and a final
+//     avalanche; the lanes keep the loop at memory bandwidth
+// FR: Quatre voies multiplication-rotation indépendantes sur des bandes de 32 octets, puis la fin octet par
+//     octet et un mélange final ; les voies maintiennent la boucle à la bande passante mémoire
+uint64_t hashContent(std::string_view data) {
+    constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    uint64_t lanes[4] = {kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1};
+    size_t pos = 0;
+    for (; pos + 32 <= data.size(); pos += 32) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            lanes[lane] = std::rotl(lanes[lane] + loadU64(data.data() + pos, lane) * kPrime2, 31) * kPrime1;
+        }
+    }
+    uint64_t hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) +
+                    std::rotl(lanes[3], 18) + data.size();
+    for (; pos < data.size(); ++pos) {
+        hash = std::rotl(hash ^ (static_cast<uint8_t>(data[pos]) * kPrime1), 11) * kPrime2;
+    }
+    hash ^= hash >> 33;
+    hash *= kPrime2;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+// EN: Bytes per posting unit: uint32 row ids for value indexes, raw encoded bytes for FULL_TEXT
+// FR: Octets par unité de liste : numéros de lignes uint32 pour les index de valeurs, octets encodés pour FULL_TEXT
+uint32_t postingWidth(IndexType type) {
+    return type == IndexType::FULL_TEXT ? 1 : sizeof(uint32_t);
+}
+
+FileHeader makeHeader(const IndexSource& source, const IndexConfig& config, size_t row_count, uint32_t width) {
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.type = static_cast<uint32_t>(config.type);
+    header.source_size = source.size;
+    header.source_mtime = source.mtime;
+    header.source_hash = source.content_hash;
+    header.row_count = row_count;
+    header.column_size = static_cast<uint32_t>(config.column.size());
+    header.tokenizer_size = static_cast<uint32_t>(config.type == IndexType::FULL_TEXT ? config.tokenizer.size() : 0);
+    header.case_sensitive = config.case_sensitive ? 1 : 0;
+    header.posting_width = width;
+    return header;
+}
+
+// EN: Write every section of an index file; `units` gives the posting units of an entry and `write_postings`
+//     writes them
+// FR: Écrit chaque section d'un fichier d'index ; `units` donne les unités de liste d'une entrée et
+//     `write_postings` les écrit
+template <typename Entries, typename Units, typename WritePostings>
+QueryError writeIndexFile(const std::string& index_path, FileHeader header, const IndexConfig& config,
+                          const Entries& entries, Units units, WritePostings write_postings) {
+    std::vector<uint64_t> key_offsets{0};
+    std::vector<uint64_t> posting_offsets{0};
+    key_offsets.reserve(entries.size() + 1);
+    posting_offsets.reserve(entries.size() + 1);
+    for (const auto& entry : entries) {
+        key_offsets.push_back(key_offsets.back() + entry.first.size());
+        posting_offsets.push_back(posting_offsets.back() + units(entry));
+    }
+    header.key_count = entries.size();
+    header.key_bytes = key_offsets.back();
+    header.posting_count = posting_offsets.back();
+
+    const std::string temp_path = index_path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return QueryError::IO_ERROR;
+        }
+        const char zeros[8] = {};
+        auto write = [&out](const void* data, size_t bytes) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        };
+
+        write(&header, sizeof(header));
+        write(config.column.data(), header.column_size);
+        write(config.tokenizer.data(), header.tokenizer_size);
+        const size_t names = header.column_size + header.tokenizer_size;
+        write(zeros, padded(names) - names);
+        write(key_offsets.data(), key_offsets.size() * sizeof(uint64_t));
+        write(posting_offsets.data(), posting_offsets.size() * sizeof(uint64_t));
+        for (const auto& entry : entries) {
+            write_postings(out, entry);
+        }
+        const size_t posting_bytes = header.posting_count * header.posting_width;
+        write(zeros, padded(posting_bytes) - posting_bytes);
+        for (const auto& entry : entries) {
+            write(entry.first.data(), entry.first.size());
+        }
+
+        out.close();
+        if (out.fail()) {
+            std::error_code error;
+            std::filesystem::remove(temp_path, error);
+            return QueryError::IO_ERROR;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temp_path, index_path, error);
+    if (error) {
+        std::filesystem::remove(temp_path, error);
+        return QueryError::IO_ERROR;
+    }
+    return QueryError::SUCCESS;
+}
+
+const char* indexTypeName(IndexType type) {
+    switch (type) {
+        case IndexType::HASH: return "hash";
+        case IndexType::BTREE: return "btree";
+        case IndexType::FULL_TEXT: return "fulltext";
+        default: return "index";
+    }
+}
+
+} // anonymous namespace
+
+bool readIndexSource(const std::string& csv_file, IndexSource& source) {
+    std::error_code error;
+    const uint64_t size = std::filesystem::file_size(csv_file, error);
+    if (error) {
+        return false;
+    }
+    const auto write_time = std::filesystem::last_write_time(csv_file, error);
+    if (error) {
+        return false;
+    }
+    MappedFile file;
+    if (!file.open(csv_file, MappingAdvice::SEQUENTIAL) || file.size() != size) {
+        return false;
+    }
+
+    source.csv_file = csv_file;
+    source.size = size;
+    source.mtime = static_cast<int64_t>(write_time.time_since_epoch().count());
+    source.content_hash = hashContent(file.view());
+    return true;
+}
+
+std::string PersistentIndex::pathFor(const std::string& csv_file, const std::string& column, IndexType type) {
+    // EN: The column name is kept in the header too, so two names sanitized alike never share an index
+    // FR: Le nom de colonne est aussi gardé dans l'en-tête, deux noms assainis pareil ne partagent donc jamais un index
+    std::string name = column;
+    for (char& c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '-') {
+            c = '_';
+        }
+    }
+    return csv_file + "." + name + "." + indexTypeName(type) + ".bbpidx";
+}
+
+QueryError PersistentIndex::save(const std::string& index_path, const IndexSource& source, const IndexConfig& config,
+                                 size_t row_count, const std::vector<Entry>& entries) {
+    if (row_count > std::numeric_limits<uint32_t>::max()) {
+        return QueryError::INDEX_ERROR;
+    }
+    std::vector<uint32_t> block;
+    return writeIndexFile(
+        index_path, makeHeader(source, config, row_count, sizeof(uint32_t)), config, entries,
+        [](const Entry& entry) { return entry.second->size(); },
+        [&block](std::ofstream& out, const Entry& entry) {
+            block.assign(entry.second->begin(), entry.second->end());
+            out.write(reinterpret_cast<const char*>(block.data()),
+                      static_cast<std::streamsize>(block.size() * sizeof(uint32_t)));
+        });
+}
+
+QueryError PersistentIndex::save(const std::string& index_path, const IndexSource& source, const IndexConfig& config,
+                                 size_t row_count, const std::vector<EncodedEntry>& entries) {
+    return writeIndexFile(
+        index_path, makeHeader(source, config, row_count, 1), config, entries,
+        [](const EncodedEntry& entry) { return entry.second.size(); },
+        [](std::ofstream& out, const EncodedEntry& entry) {
+            out.write(entry.second.data(), static_cast<std::streamsize>(entry.second.size()));
+        });
+}
+
+bool PersistentIndex::open(const std::string& index_path, const IndexSource& source, const IndexConfig& config,
+                           size_t row_count) {
+    file_.close();
+    key_count_ = 0;
+
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(index_path, error) || !file_.open(index_path, MappingAdvice::RANDOM)) {
+        file_.close();
+        return false;
+    }
+
+    FileHeader header{};
+    const char* data = file_.data();
+    const size_t size = file_.size();
+    bool valid = size >= sizeof(header);
+    if (valid) {
+        std::memcpy(&header, data, sizeof(header));
+        const size_t tokenizer_size = config.type == IndexType::FULL_TEXT ? config.tokenizer.size() : 0;
+        valid = std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 && header.version == kVersion &&
+                header.type == static_cast<uint32_t>(config.type) &&
+                header.source_size == source.size && header.source_mtime == source.mtime &&
+                header.source_hash == source.content_hash && header.row_count == row_count &&
+                header.column_size == config.column.size() && header.tokenizer_size == tokenizer_size &&
+                header.case_sensitive == (config.case_sensitive ? 1u : 0u) &&
+                header.posting_width == postingWidth(config.type) && header.key_count < size && header.posting_count < size && header.key_bytes <= size;
+    }
+    if (valid) {
+        // EN: The sections must cover the file exactly
+        // FR: Les sections doivent couvrir exactement le fichier
+        const size_t names = header.column_size + header.tokenizer_size;
+        const size_t offsets = (header.key_count + 1) * sizeof(uint64_t);
+        const size_t key_offsets_at = sizeof(header) + padded(names);
+        const size_t postings_at = key_offsets_at + 2 * offsets;
+        const size_t keys_at = postings_at + padded(header.posting_count * header.posting_width);
+        valid = keys_at + header.key_bytes == size &&
+                std::string_view(data + sizeof(header), header.column_size) == config.column &&
+                std::string_view(data + sizeof(header) + header.column_size, header.tokenizer_size) ==
+                    std::string_view(config.tokenizer.data(), header.tokenizer_size);
+        if (valid) {
+            key_count_ = header.key_count;
+            key_offsets_ = data + key_offsets_at;
+            posting_offsets_ = key_offsets_ + offsets;
+            postings_ = data + postings_at;
+            keys_ = data + keys_at;
+            valid = loadU64(key_offsets_, key_count_) == header.key_bytes &&
+                    loadU64(posting_offsets_, key_count_) == header.posting_count;
+        }
+    }
+    if (!valid) {
+        file_.close();
+        key_count_ = 0;
+    }
+    return valid;
+}
+
+std::string_view PersistentIndex::getKey(size_t i) const {
+    const uint64_t begin = loadU64(key_offsets_, i);
+    const uint64_t end = loadU64(key_offsets_, i + 1);
+    // EN: Offsets are trusted only as far as they stay inside the key section
+    // FR: Les offsets ne sont crus que tant qu'ils restent dans la section des clés
+    const uint64_t key_bytes = loadU64(key_offsets_, key_count_);
+    if (begin > end || end > key_bytes) {
+        return {};
+    }
+    return std::string_view(keys_ + begin, end - begin);
+}
+
+size_t PersistentIndex::lowerBound(std::string_view key) const {
+    size_t low = 0;
+    size_t high = key_count_;
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (getKey(middle) < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+bool PersistentIndex::postingRange(size_t key, uint64_t& begin, uint64_t& end) const {
+    begin = loadU64(posting_offsets_, key);
+    end = loadU64(posting_offsets_, key + 1);
+    return begin <= end && end <= loadU64(posting_offsets_, key_count_);
+}
+
+std::vector<size_t> PersistentIndex::find(std::string_view key) const {
+    std::vector<size_t> rows;
+    const size_t i = lowerBound(key);
+    uint64_t begin = 0;
+    uint64_t end = 0;
+    if (i == key_count_ || getKey(i) != key || !postingRange(i, begin, end)) {
+        return rows;
+    }
+    rows.resize(end - begin);
+    for (size_t k = 0; k < rows.size(); ++k) {
+        uint32_t row = 0;
+        std::memcpy(&row, postings_ + (begin + k) * sizeof(row), sizeof(row));
+        rows[k] = row;
+    }
+    return rows;
+}
+
+std::string_view PersistentIndex::findEncoded(std::string_view key) const {
+    const size_t i = lowerBound(key);
+    uint64_t begin = 0;
+    uint64_t end = 0;
+    if (i == key_count_ || getKey(i) != key || !postingRange(i, begin, end)) {
+        return {};
+    }
+    return std::string_view(postings_ + begin, end - begin);
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -1,7 +1,19 @@
 #include "csv/query_engine.hpp"
+#include "csv/aggregation.hpp"
+#include "csv/external_sort.hpp"
+#include "csv/hash_join.hpp"
+#include "csv/inverted_index.hpp"
+#include "csv/morsel_scan.hpp"
+#include "csv/persistent_index.hpp"
+#include "csv/query_planner.hpp"
+#include "csv/query_predicate.hpp"
+#include "csv/result_cache.hpp"
+#include "csv/streaming_parser.hpp"
+#include "csv/zone_map.hpp"
 #include "infrastructure/logging/logger.hpp"
 #include <sstream>
 #include <fstream>
+#include <filesystem>
 #include <algorithm>
 #include <numeric>
 #include <thread>
@@ -24,28 +36,42 @@ QueryResult::QueryResult(std::vector<std::string> headers)
 }
 
 void QueryResult::addRow(const std::vector<std::string>& row) {
-    rows_.push_back(row);
+    mutableRows().push_back(row);
 }
 
 void QueryResult::addRow(std::vector<std::string>&& row) {
-    rows_.emplace_back(std::move(row));
+    mutableRows().emplace_back(std::move(row));
+}
+
+const QueryResult::Rows& QueryResult::rows() const {
+    static const Rows kNoRows;
+    return rows_ ? *rows_ : kNoRows;
+}
+
+QueryResult::Rows& QueryResult::mutableRows() {
+    if (!rows_) {
+        rows_ = std::make_shared<Rows>();
+    } else if (rows_.use_count() > 1) {
+        rows_ = std::make_shared<Rows>(*rows_);
+    }
+    return *rows_;
 }
 
 const std::vector<std::string>& QueryResult::getRow(size_t index) const {
-    if (index >= rows_.size()) {
+    if (index >= rows().size()) {
         throw std::out_of_range("Row index out of range");
     }
-    return rows_[index];
+    return rows()[index];
 }
 
 const std::string& QueryResult::getCell(size_t row, size_t col) const {
-    if (row >= rows_.size()) {
+    if (row >= rows().size()) {
         throw std::out_of_range("Row index out of range");
     }
     if (col >= headers_.size()) {
         throw std::out_of_range("Column index out of range");
     }
-    return rows_[row][col];
+    return rows()[row][col];
 }
 
 const std::string& QueryResult::getCell(size_t row, const std::string& column) const {
@@ -75,8 +101,8 @@ std::vector<std::string> QueryResult::getColumn(size_t index) const {
     }
     
     std::vector<std::string> column_data;
-    column_data.reserve(rows_.size());
-    for (const auto& row : rows_) {
+    column_data.reserve(rows().size());
+    for (const auto& row : rows()) {
         column_data.push_back(index < row.size() ? row[index] : "");
     }
     return column_data;
@@ -88,7 +114,8 @@ void QueryResult::sortBy(const std::string& column, SortDirection direction) {
         throw std::invalid_argument("Column not found for sorting: " + column);
     }
     
-    std::sort(rows_.begin(), rows_.end(), 
+    Rows& rows = mutableRows();
+    std::sort(rows.begin(), rows.end(), 
         [col_idx, direction](const std::vector<std::string>& a, const std::vector<std::string>& b) {
             const std::string& val_a = static_cast<size_t>(col_idx) < a.size() ? a[col_idx] : "";
             const std::string& val_b = static_cast<size_t>(col_idx) < b.size() ? b[col_idx] : "";
@@ -110,53 +137,46 @@ void QueryResult::sortBy(const std::string& column, SortDirection direction) {
 void QueryResult::sortBy(const std::vector<OrderByColumn>& sort_spec) {
     if (sort_spec.empty()) return;
     
-    // EN: Build column indices for sorting
-    // FR: Construire les indices de colonnes pour le tri
-    std::vector<int> col_indices;
-    for (const auto& spec : sort_spec) {
-        int idx = getColumnIndex(spec.column);
-        if (idx < 0) {
-            throw std::invalid_argument("Column not found for sorting: " + spec.column);
+    RowOrder order(headers_, sort_spec);
+    if (!order.valid()) {
+        for (const auto& spec : sort_spec) {
+            if (getColumnIndex(spec.column) < 0) {
+                throw std::invalid_argument("Column not found for sorting: " + spec.column);
+            }
         }
-        col_indices.push_back(idx);
     }
     
-    std::sort(rows_.begin(), rows_.end(),
-        [&col_indices, &sort_spec](const std::vector<std::string>& a, const std::vector<std::string>& b) {
-            for (size_t i = 0; i < col_indices.size(); ++i) {
-                int col_idx = col_indices[i];
-                const std::string& val_a = static_cast<size_t>(col_idx) < a.size() ? a[col_idx] : "";
-                const std::string& val_b = static_cast<size_t>(col_idx) < b.size() ? b[col_idx] : "";
-                
-                if (val_a == val_b) continue;
-                
-                // EN: Try numeric comparison first
-                // FR: Essayer d'abord la comparaison numérique
-                if (QueryUtils::isNumeric(val_a) && QueryUtils::isNumeric(val_b)) {
-                    double num_a = std::stod(val_a);
-                    double num_b = std::stod(val_b);
-                    bool result = sort_spec[i].direction == SortDirection::ASC ? (num_a < num_b) : (num_a > num_b);
-                    return result;
-                }
-                
-                // EN: Fall back to string comparison
-                // FR: Se rabattre sur la comparaison de chaînes
-                bool result = sort_spec[i].direction == SortDirection::ASC ? (val_a < val_b) : (val_a > val_b);
-                return result;
-            }
-            return false; // Equal
-        });
+    // EN: Sort keys are read once per row, then rows are permuted by a stable sort of their positions
+    // FR: Les clés de tri sont lues une fois par ligne, puis les lignes sont permutées par un tri stable de leurs positions
+    Rows& rows = mutableRows();
+    std::vector<RowOrder::Key> keys;
+    keys.reserve(rows.size());
+    for (const auto& row : rows) {
+        keys.push_back(order.makeKey(row));
+    }
+    std::vector<size_t> permutation(rows.size());
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::stable_sort(permutation.begin(), permutation.end(), [&rows, &order, &keys](size_t a, size_t b) {
+        return order.less(rows[a], keys[a], rows[b], keys[b]);
+    });
+    
+    Rows sorted;
+    sorted.reserve(rows.size());
+    for (size_t index : permutation) {
+        sorted.push_back(std::move(rows[index]));
+    }
+    rows = std::move(sorted);
 }
 
 QueryResult QueryResult::slice(size_t offset, size_t limit) const {
     QueryResult result(headers_);
     result.statistics_ = statistics_;
     
-    size_t start = std::min(offset, rows_.size());
-    size_t end = std::min(start + limit, rows_.size());
+    size_t start = std::min(offset, rows().size());
+    size_t end = std::min(start + limit, rows().size());
     
     for (size_t i = start; i < end; ++i) {
-        result.addRow(rows_[i]);
+        result.addRow(rows()[i]);
     }
     
     return result;
@@ -175,7 +195,7 @@ std::string QueryResult::toCSV() const {
     
     // EN: Write data rows
     // FR: Écrire les lignes de données
-    for (const auto& row : rows_) {
+    for (const auto& row : rows()) {
         for (size_t i = 0; i < row.size(); ++i) {
             if (i > 0) oss << ",";
             oss << "\"" << row[i] << "\"";
@@ -195,15 +215,15 @@ std::string QueryResult::toJSON() const {
     std::ostringstream oss;
     oss << "{\"data\":[";
     
-    for (size_t row_idx = 0; row_idx < rows_.size(); ++row_idx) {
+    for (size_t row_idx = 0; row_idx < rows().size(); ++row_idx) {
         if (row_idx > 0) oss << ",";
         oss << "{";
         
         for (size_t col_idx = 0; col_idx < headers_.size(); ++col_idx) {
             if (col_idx > 0) oss << ",";
             oss << "\"" << headers_[col_idx] << "\":\"";
-            if (col_idx < rows_[row_idx].size()) {
-                oss << rows_[row_idx][col_idx];
+            if (col_idx < rows()[row_idx].size()) {
+                oss << rows()[row_idx][col_idx];
             }
             oss << "\"";
         }
@@ -211,12 +231,12 @@ std::string QueryResult::toJSON() const {
         oss << "}";
     }
     
-    oss << "],\"count\":" << rows_.size() << "}";
+    oss << "],\"count\":" << rows().size() << "}";
     return oss.str();
 }
 
 std::string QueryResult::toTable() const {
-    if (rows_.empty()) {
+    if (rows().empty()) {
         return "Empty result set\n";
     }
     
@@ -225,7 +245,7 @@ std::string QueryResult::toTable() const {
     std::vector<size_t> widths(headers_.size());
     for (size_t i = 0; i < headers_.size(); ++i) {
         widths[i] = headers_[i].length();
-        for (const auto& row : rows_) {
+        for (const auto& row : rows()) {
             if (i < row.size()) {
                 widths[i] = std::max(widths[i], row[i].length());
             }
@@ -261,7 +281,7 @@ std::string QueryResult::toTable() const {
     
     // EN: Data rows
     // FR: Lignes de données
-    for (const auto& row : rows_) {
+    for (const auto& row : rows()) {
         oss << "|";
         for (size_t i = 0; i < headers_.size(); ++i) {
             std::string value = (i < row.size()) ? row[i] : "";
@@ -281,13 +301,13 @@ std::string QueryResult::toTable() const {
     }
     oss << "\n";
     
-    oss << "(" << rows_.size() << " row" << (rows_.size() != 1 ? "s" : "") << ")\n";
+    oss << "(" << rows().size() << " row" << (rows().size() != 1 ? "s" : "") << ")\n";
     
     return oss.str();
 }
 
 void QueryResult::clear() {
-    rows_.clear();
+    rows_.reset();
     statistics_ = QueryStatistics{};
 }
 
@@ -337,6 +357,9 @@ QueryError QueryParser::parse(const std::string& sql, SqlQuery& query) {
     error = parseFrom(sql, pos, query);
     if (error != QueryError::SUCCESS) return error;
     
+    error = parseJoin(sql, pos, query);
+    if (error != QueryError::SUCCESS) return error;
+    
     error = parseWhere(sql, pos, query);
     if (error != QueryError::SUCCESS) return error;
     
@@ -481,15 +504,21 @@ QueryError QueryParser::parseWhere(const std::string& sql, size_t& pos, SqlQuery
         condition.operator_ = parseOperator(sql, pos);
         
         skipWhitespace(sql, pos);
+        const size_t index = query.where.size();
+        using Slot = QueryParameter::Slot;
         if (condition.operator_ == SqlOperator::BETWEEN) {
-            condition.range_start = parseValue(sql, pos);
+            if (!parsePlaceholder(sql, pos, query, {index, Slot::RANGE_START, 0})) {
+                condition.range_start = parseValue(sql, pos);
+            }
             skipWhitespace(sql, pos);
             if (!matchKeyword(sql, pos, "AND")) {
                 setError("Expected AND in BETWEEN clause", pos);
                 return QueryError::SYNTAX_ERROR;
             }
             skipWhitespace(sql, pos);
-            condition.range_end = parseValue(sql, pos);
+            if (!parsePlaceholder(sql, pos, query, {index, Slot::RANGE_END, 0})) {
+                condition.range_end = parseValue(sql, pos);
+            }
         } else if (condition.operator_ == SqlOperator::IN || condition.operator_ == SqlOperator::NOT_IN) {
             skipWhitespace(sql, pos);
             if (pos >= sql.length() || sql[pos] != '(') {
@@ -502,7 +531,11 @@ QueryError QueryParser::parseWhere(const std::string& sql, size_t& pos, SqlQuery
             // FR: Analyser les valeurs IN
             while (pos < sql.length()) {
                 skipWhitespace(sql, pos);
-                condition.in_values.push_back(parseValue(sql, pos));
+                if (parsePlaceholder(sql, pos, query, {index, Slot::IN_VALUE, condition.in_values.size()})) {
+                    condition.in_values.emplace_back(nullptr);
+                } else {
+                    condition.in_values.push_back(parseValue(sql, pos));
+                }
                 skipWhitespace(sql, pos);
                 
                 if (pos >= sql.length()) {
@@ -521,11 +554,16 @@ QueryError QueryParser::parseWhere(const std::string& sql, size_t& pos, SqlQuery
                     return QueryError::SYNTAX_ERROR;
                 }
             }
-        } else if (condition.operator_ == SqlOperator::LIKE || condition.operator_ == SqlOperator::NOT_LIKE) {
-            QueryValue pattern_value = parseValue(sql, pos);
-            condition.pattern = std::get<std::string>(pattern_value);
+        } else if (condition.operator_ == SqlOperator::LIKE || condition.operator_ == SqlOperator::NOT_LIKE ||
+                   condition.operator_ == SqlOperator::REGEX) {
+            if (!parsePlaceholder(sql, pos, query, {index, Slot::PATTERN, 0})) {
+                QueryValue pattern_value = parseValue(sql, pos);
+                condition.pattern = QueryUtils::queryValueToString(pattern_value);
+            }
         } else if (condition.operator_ != SqlOperator::IS_NULL && condition.operator_ != SqlOperator::IS_NOT_NULL) {
-            condition.value = parseValue(sql, pos);
+            if (!parsePlaceholder(sql, pos, query, {index, Slot::VALUE, 0})) {
+                condition.value = parseValue(sql, pos);
+            }
         }
         
         query.where.push_back(condition);
@@ -679,14 +717,76 @@ QueryError QueryParser::parseLimit(const std::string& sql, size_t& pos, SqlQuery
     return QueryError::SUCCESS;
 }
 
-QueryError QueryParser::parseJoin(const std::string& /* sql */, size_t& /* pos */, SqlQuery& /* query */) {
-    // EN: JOIN parsing implementation would go here
-    // FR: L'implémentation de l'analyse JOIN irait ici
-    // EN: For now, return success (JOINs are advanced feature)
-    // FR: Pour l'instant, retourner succès (JOINs sont une fonctionnalité avancée)
+QueryError QueryParser::parseJoin(const std::string& sql, size_t& pos, SqlQuery& query) {
+    // EN: [INNER | LEFT [OUTER] | RIGHT [OUTER] | FULL [OUTER]] JOIN table ON column = column, repeated
+    // FR: [INNER | LEFT [OUTER] | RIGHT [OUTER] | FULL [OUTER]] JOIN table ON colonne = colonne, répété
+    while (pos < sql.length()) {
+        skipWhitespace(sql, pos);
+        
+        JoinClause join;
+        bool typed = true;
+        if (matchKeyword(sql, pos, "INNER")) {
+            join.type = JoinClause::INNER;
+        } else if (matchKeyword(sql, pos, "LEFT")) {
+            join.type = JoinClause::LEFT;
+        } else if (matchKeyword(sql, pos, "RIGHT")) {
+            join.type = JoinClause::RIGHT;
+        } else if (matchKeyword(sql, pos, "FULL")) {
+            join.type = JoinClause::FULL;
+        } else {
+            typed = false;
+        }
+        if (typed && join.type != JoinClause::INNER) {
+            matchKeyword(sql, pos, "OUTER");
+        }
+        
+        if (!matchKeyword(sql, pos, "JOIN")) {
+            if (typed) {
+                setError("Expected JOIN keyword", pos);
+                return QueryError::SYNTAX_ERROR;
+            }
+            return QueryError::SUCCESS; // EN: JOIN is optional / FR: JOIN est optionnel
+        }
+        
+        join.table = parseIdentifier(sql, pos);
+        if (join.table.empty()) {
+            setError("Expected table name after JOIN", pos);
+            return QueryError::SYNTAX_ERROR;
+        }
+        
+        if (!matchKeyword(sql, pos, "ON")) {
+            setError("Expected ON after JOIN table", pos);
+            return QueryError::SYNTAX_ERROR;
+        }
+        join.on_left = parseIdentifier(sql, pos);
+        skipWhitespace(sql, pos);
+        if (join.on_left.empty() || pos >= sql.length() || sql[pos] != '=') {
+            setError("Expected column = column after ON", pos);
+            return QueryError::SYNTAX_ERROR;
+        }
+        pos++; // EN: Skip '=' / FR: Ignorer '='
+        join.on_right = parseIdentifier(sql, pos);
+        if (join.on_right.empty()) {
+            setError("Expected column after '=' in ON", pos);
+            return QueryError::SYNTAX_ERROR;
+        }
+        
+        query.joins.push_back(join);
+    }
+    
     return QueryError::SUCCESS;
 }
 
+bool QueryParser::parsePlaceholder(const std::string& sql, size_t& pos, SqlQuery& query, QueryParameter parameter) {
+    skipWhitespace(sql, pos);
+    if (pos >= sql.length() || sql[pos] != '?') {
+        return false;
+    }
+    pos++;
+    query.parameters.push_back(parameter);
+    return true;
+}
+
 std::string QueryParser::parseIdentifier(const std::string& sql, size_t& pos) {
     skipWhitespace(sql, pos);
     
@@ -700,10 +800,10 @@ std::string QueryParser::parseIdentifier(const std::string& sql, size_t& pos) {
         return extractQuotedString(sql, pos);
     }
     
-    // EN: Handle regular identifiers and keywords
-    // FR: Gérer les identifiants normaux et les mots-clés
+    // EN: Handle regular identifiers and keywords ('.' for table-qualified columns)
+    // FR: Gérer les identifiants normaux et les mots-clés ('.' pour les colonnes qualifiées par leur table)
     while (pos < sql.length() && 
-           (std::isalnum(sql[pos]) || sql[pos] == '_' || sql[pos] == '*')) {
+           (std::isalnum(sql[pos]) || sql[pos] == '_' || sql[pos] == '*' || sql[pos] == '.')) {
         identifier += sql[pos];
         pos++;
     }
@@ -803,6 +903,7 @@ SqlOperator QueryParser::parseOperator(const std::string& sql, size_t& pos) {
         }
     }
     if (matchKeyword(sql, pos, "BETWEEN")) return SqlOperator::BETWEEN;
+    if (matchKeyword(sql, pos, "REGEX")) return SqlOperator::REGEX;
     
     // EN: Single character operators
     // FR: Opérateurs à un caractère
@@ -1019,30 +1120,10 @@ bool compareValues(const QueryValue& a, const QueryValue& b, SqlOperator op) {
                 return std::stod(str_a) >= std::stod(str_b);
             }
             return str_a >= str_b;
-        case SqlOperator::LIKE: {
-            // EN: Simple LIKE implementation with % and _ wildcards
-            // FR: Implémentation simple de LIKE avec caractères génériques % et _
-            std::regex pattern(str_b);
-            std::string regex_pattern = str_b;
-            // EN: Replace SQL wildcards with regex equivalents
-            // FR: Remplacer les caractères génériques SQL par leurs équivalents regex
-            size_t pos = 0;
-            while ((pos = regex_pattern.find('%', pos)) != std::string::npos) {
-                regex_pattern.replace(pos, 1, ".*");
-                pos += 2;
-            }
-            pos = 0;
-            while ((pos = regex_pattern.find('_', pos)) != std::string::npos) {
-                regex_pattern.replace(pos, 1, ".");
-                pos += 1;
-            }
-            try {
-                std::regex regex_obj(regex_pattern);
-                return std::regex_match(str_a, regex_obj);
-            } catch (...) {
-                return str_a.find(str_b) != std::string::npos;
-            }
-        }
+        case SqlOperator::LIKE:
+            // EN: % and _ wildcards, matched directly without building a regex
+            // FR: Caractères génériques % et _, comparés directement sans construire de regex
+            return LikeMatcher(str_b).matches(str_a);
         case SqlOperator::NOT_LIKE:
             return !compareValues(a, b, SqlOperator::LIKE);
         default:
@@ -1152,45 +1233,77 @@ std::string formatNumber(size_t number) {
 
 QueryError loadCsvFile(const std::string& filename, std::vector<std::string>& headers,
                       std::vector<std::vector<std::string>>& data) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
+    // EN: Zero-copy mapped parse delivered in columnar batches; each row is materialized exactly once.
+    //     gzip/zlib files are inflated on the fly by the parser.
+    // FR: Parsing mappé zero-copy transmis en lots colonnaires ; chaque ligne est matérialisée une seule fois.
+    //     Les fichiers gzip/zlib sont inflatés à la volée par le parser.
+    CSV::ParserConfig parser_config;
+    parser_config.use_memory_mapping = true;
+    parser_config.trim_whitespace = false;
+    CSV::StreamingParser parser(parser_config);
+    
+    parser.setBatchCallback([&data](const CSV::RowBatch& batch, CSV::ParserError /*error*/) {
+        data.reserve(data.size() + batch.getRowCount());
+        for (size_t row = 0; row < batch.getRowCount(); ++row) {
+            std::vector<std::string> fields;
+            fields.reserve(batch.getFieldCount(row));
+            for (size_t column = 0; column < batch.getFieldCount(row); ++column) {
+                fields.emplace_back(batch.getField(row, column));
+            }
+            data.push_back(std::move(fields));
+        }
+        return true;
+    });
+    
+    CSV::ParserError error = parser.parseFile(filename);
+    if (error == CSV::ParserError::FILE_NOT_FOUND) {
         return QueryError::FILE_NOT_FOUND;
     }
+    if (error != CSV::ParserError::SUCCESS) {
+        return QueryError::IO_ERROR;
+    }
     
-    std::string line;
-    bool first_line = true;
-    
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-        
-        std::vector<std::string> row;
-        std::string field;
-        bool in_quotes = false;
-        
-        for (size_t i = 0; i < line.length(); ++i) {
-            char c = line[i];
-            
-            if (c == '"') {
-                in_quotes = !in_quotes;
-            } else if (c == ',' && !in_quotes) {
-                row.push_back(field);
-                field.clear();
-            } else {
-                field += c;
+    headers = parser.getHeaders();
+    return QueryError::SUCCESS;
+}
+
+QueryError loadCsvTable(const std::string& filename, std::shared_ptr<ColumnarTable>& table,
+                       size_t dictionary_limit) {
+    // EN: Same mapped batch parse as loadCsvFile, but fields go straight from the batch into the columns
+    //     without an intermediate row-major copy
+    // FR: Même parsing mappé par lots que loadCsvFile, mais les champs passent directement du lot aux colonnes
+    //     sans copie intermédiaire en lignes
+    CSV::ParserConfig parser_config;
+    parser_config.use_memory_mapping = true;
+    parser_config.trim_whitespace = false;
+    CSV::StreamingParser parser(parser_config);
+    
+    std::shared_ptr<ColumnarTable> loaded;
+    std::vector<std::string_view> fields;
+    parser.setBatchCallback([&](const CSV::RowBatch& batch, CSV::ParserError /*error*/) {
+        if (!loaded) {
+            loaded = std::make_shared<ColumnarTable>(batch.getHeaders(), dictionary_limit);
+        }
+        loaded->reserve(loaded->getRowCount() + batch.getRowCount());
+        for (size_t row = 0; row < batch.getRowCount(); ++row) {
+            fields.clear();
+            for (size_t column = 0; column < batch.getFieldCount(row); ++column) {
+                fields.push_back(batch.getField(row, column));
             }
+            loaded->appendRow(fields);
         }
-        
-        // EN: Add the last field / FR: Ajouter le dernier champ
-        row.push_back(field);
-        
-        if (first_line) {
-            headers = row;
-            first_line = false;
-        } else {
-            data.push_back(row);
-        }
+        return true;
+    });
+    
+    CSV::ParserError error = parser.parseFile(filename);
+    if (error == CSV::ParserError::FILE_NOT_FOUND) {
+        return QueryError::FILE_NOT_FOUND;
+    }
+    if (error != CSV::ParserError::SUCCESS) {
+        return QueryError::IO_ERROR;
     }
     
+    table = loaded ? std::move(loaded) : std::make_shared<ColumnarTable>(parser.getHeaders(), dictionary_limit);
     return QueryError::SUCCESS;
 }
 
@@ -1277,155 +1390,279 @@ std::vector<std::string> extractColumnNames(const std::string& sql) {
 
 } // namespace QueryUtils
 
+namespace {
+
+// EN: `snapshot` (nullptr = no segment yet) extended over the rows from the end of its last segment up to
+//     `row_count`, newest segments merged while the newer is at least half the older; `build(first, count)`
+//     indexes a row range. A fresh index always gets a segment, empty for an empty table, so a snapshot never
+//     has zero segments
+// FR: `snapshot` (nullptr = aucun segment encore) étendu aux lignes depuis la fin de son dernier segment
+//     jusqu'à `row_count`, les segments récents fusionnés tant que le plus récent fait au moins la moitié de
+//     l'autre ; `build(first, count)` indexe une plage de lignes. Un nouvel index reçoit toujours un segment,
+//     vide pour une table vide, donc un instantané n'a jamais zéro segment
+template<typename Snapshot, typename Build>
+std::shared_ptr<const Snapshot> extendSnapshot(const Snapshot* snapshot, size_t row_count, const Build& build) {
+    auto next = snapshot ? std::make_shared<Snapshot>(*snapshot) : std::make_shared<Snapshot>();
+    auto& segments = next->segments;
+    const size_t covered = segments.empty() ? 0 : segments.back()->first_row + segments.back()->row_count;
+    if (row_count > covered || segments.empty()) {
+        segments.push_back(build(covered, row_count - covered));
+    }
+    while (segments.size() >= 2 && segments.back()->row_count * 2 >= segments[segments.size() - 2]->row_count) {
+        const auto& older = segments[segments.size() - 2];
+        auto merged = build(older->first_row, older->row_count + segments.back()->row_count);
+        segments.pop_back();
+        segments.back() = std::move(merged);
+    }
+    return next;
+}
+
+// EN: Rows holding `value` in a hash or B-tree snapshot, ascending since the segments are in row order
+// FR: Lignes contenant `value` dans un instantané hash ou B-tree, croissantes car les segments sont dans l'ordre
+//     des lignes
+template<typename Snapshot>
+std::vector<size_t> findInSnapshot(const Snapshot& snapshot, const std::string& value) {
+    std::vector<size_t> rows;
+    for (const auto& segment : snapshot.segments) {
+        auto it = segment->value_to_rows.find(value);
+        if (it != segment->value_to_rows.end()) {
+            rows.insert(rows.end(), it->second.begin(), it->second.end());
+        }
+    }
+    return rows;
+}
+
+// EN: Snapshot of a table's column in `indexes`, or nullptr
+// FR: Instantané de la colonne d'une table dans `indexes`, ou nullptr
+template<typename Map>
+auto findSnapshot(const Map& indexes, const std::string& table, const std::string& column)
+    -> typename Map::mapped_type::mapped_type {
+    auto table_it = indexes.find(table);
+    if (table_it == indexes.end()) {
+        return nullptr;
+    }
+    auto column_it = table_it->second.find(column);
+    return column_it != table_it->second.end() ? column_it->second : nullptr;
+}
+
+// EN: Keys, row lists and hash nodes of a value index segment
+// FR: Clés, listes de lignes et nœuds de hachage d'un segment d'index de valeurs
+template<typename Values>
+size_t valueIndexMemory(const Values& values) {
+    size_t bytes = 0;
+    for (const auto& [key, rows] : values) {
+        bytes += sizeof(key) + key.capacity() + sizeof(rows) + rows.capacity() * sizeof(size_t) + 2 * sizeof(void*);
+    }
+    return bytes;
+}
+
+} // anonymous namespace
+
 // EN: IndexManager implementation
 // FR: Implémentation d'IndexManager
 
+IndexManager::~IndexManager() = default;
+
 QueryError IndexManager::createIndex(const std::string& table, const IndexConfig& config) {
+    std::lock_guard<std::mutex> write_lock(write_mutex_);
     std::lock_guard<std::mutex> lock(index_mutex_);
     
     // EN: Check if table exists
     // FR: Vérifier si la table existe
-    if (table_data_.find(table) == table_data_.end()) {
+    auto data_it = table_data_.find(table);
+    if (data_it == table_data_.end()) {
         return QueryError::FILE_NOT_FOUND;
     }
     
     // EN: Store index configuration
     // FR: Stocker la configuration d'index
     index_configs_[table][config.column] = config;
+    mapped_indexes_[table].erase(config.column);
+    
+    // EN: A current index file of a table read from disk is mapped instead of being rebuilt
+    // FR: Un fichier d'index à jour d'une table lue depuis le disque est mappé au lieu d'être reconstruit
+    auto source_it = index_sources_.find(table);
+    if (source_it != index_sources_.end()) {
+        auto mapped = std::make_shared<PersistentIndex>();
+        if (mapped->open(PersistentIndex::pathFor(source_it->second.csv_file, config.column, config.type),
+                         source_it->second, config, data_it->second->getRowCount())) {
+            mapped_indexes_[table][config.column] = std::move(mapped);
+            return QueryError::SUCCESS;
+        }
+    }
     
     // EN: Build the appropriate index type
     // FR: Construire le type d'index approprié
+    QueryError error = QueryError::INDEX_ERROR;
+    switch (config.type) {
+        case IndexType::HASH:
+            error = buildHashIndex(table, config.column);
+            break;
+        case IndexType::BTREE:
+            error = buildBTreeIndex(table, config.column);
+            break;
+        case IndexType::FULL_TEXT:
+            error = buildFullTextIndex(table, config.column);
+            break;
+        default:
+            return QueryError::INDEX_ERROR;
+    }
+    
+    // EN: Saving is best effort: a read-only directory only costs the rebuild next time
+    // FR: L'enregistrement est au mieux : un répertoire en lecture seule ne coûte que la reconstruction suivante
+    if (error == QueryError::SUCCESS && source_it != index_sources_.end()) {
+        saveIndex(table, config);
+    }
+    return error;
+}
+
+QueryError IndexManager::saveIndex(const std::string& table, const IndexConfig& config) const {
+    // EN: Called right after a build, so the index is a single segment over the whole table
+    // FR: Appelé juste après une construction, l'index est donc un segment unique sur toute la table
+    
+    // EN: Keys in byte order, each with its rows
+    // FR: Clés dans l'ordre des octets, chacune avec ses lignes
+    std::vector<PersistentIndex::Entry> entries;
+    auto collect = [&](const auto& indexes, const auto& member) {
+        auto it = indexes.find(config.column);
+        if (it != indexes.end()) {
+            const auto& values = (*it->second->segments.front()).*member;
+            entries.reserve(values.size());
+            for (const auto& [key, rows] : values) {
+                entries.emplace_back(key, &rows);
+            }
+        }
+    };
     switch (config.type) {
         case IndexType::HASH:
-            return buildHashIndex(table, config.column);
+            collect(hash_indexes_.at(table), &HashIndex::value_to_rows);
+            std::sort(entries.begin(), entries.end(),
+                      [](const auto& a, const auto& b) { return a.first < b.first; });
+            break;
         case IndexType::BTREE:
-            return buildBTreeIndex(table, config.column);
+            collect(btree_indexes_.at(table), &BTreeIndex::value_to_rows);
+            break;
         case IndexType::FULL_TEXT:
-            return buildFullTextIndex(table, config.column);
+            break;
         default:
             return QueryError::INDEX_ERROR;
     }
+    
+    const IndexSource& source = index_sources_.at(table);
+    const std::string path = PersistentIndex::pathFor(source.csv_file, config.column, config.type);
+    const size_t row_count = table_data_.at(table)->getRowCount();
+    if (config.type == IndexType::FULL_TEXT) {
+        // EN: Full-text postings are saved as encoded, already in term order
+        // FR: Les listes texte intégral sont enregistrées encodées, déjà dans l'ordre des termes
+        const InvertedIndex& postings = *fulltext_indexes_.at(table).at(config.column)->segments.front()->postings;
+        std::vector<PersistentIndex::EncodedEntry> encoded;
+        encoded.reserve(postings.getTermCount());
+        for (size_t i = 0; i < postings.getTermCount(); ++i) {
+            encoded.emplace_back(postings.getTerm(i), postings.getPostings(i));
+        }
+        return PersistentIndex::save(path, source, config, row_count, encoded);
+    }
+    return PersistentIndex::save(path, source, config, row_count, entries);
 }
 
 QueryError IndexManager::buildHashIndex(const std::string& table, const std::string& column) {
-    const auto& headers = table_headers_[table];
-    const auto& data = table_data_[table];
+    const auto& data = *table_data_[table];
     
     // EN: Find column index
     // FR: Trouver l'index de colonne
-    int col_idx = -1;
-    for (size_t i = 0; i < headers.size(); ++i) {
-        if (headers[i] == column) {
-            col_idx = static_cast<int>(i);
-            break;
-        }
-    }
+    int col_idx = data.getColumnIndex(column);
     
     if (col_idx < 0) {
         return QueryError::COLUMN_NOT_FOUND;
     }
     
-    // EN: Create hash index
-    // FR: Créer l'index hash
-    auto index = std::make_unique<HashIndex>();
-    
-    for (size_t row_idx = 0; row_idx < data.size(); ++row_idx) {
-        const auto& row = data[row_idx];
-        if (static_cast<size_t>(col_idx) < row.size()) {
-            const std::string& value = row[col_idx];
-            index->value_to_rows[value].push_back(row_idx);
-        }
-    }
-    
-    // EN: Calculate memory usage
-    // FR: Calculer l'utilisation mémoire
-    index->memory_usage = calculateIndexMemory(table, column);
-    
-    hash_indexes_[table][column] = std::move(index);
+    hash_indexes_[table][column] = extendSnapshot<IndexSnapshot<HashIndex>>(
+        nullptr, data.getRowCount(), [&](size_t first_row, size_t row_count) {
+            return buildHashSegment(data, static_cast<size_t>(col_idx), first_row, row_count);
+        });
     return QueryError::SUCCESS;
 }
 
 QueryError IndexManager::buildBTreeIndex(const std::string& table, const std::string& column) {
-    const auto& headers = table_headers_[table];
-    const auto& data = table_data_[table];
+    const auto& data = *table_data_[table];
     
     // EN: Find column index
     // FR: Trouver l'index de colonne
-    int col_idx = -1;
-    for (size_t i = 0; i < headers.size(); ++i) {
-        if (headers[i] == column) {
-            col_idx = static_cast<int>(i);
-            break;
-        }
-    }
+    int col_idx = data.getColumnIndex(column);
     
     if (col_idx < 0) {
         return QueryError::COLUMN_NOT_FOUND;
     }
     
-    // EN: Create B-tree index
-    // FR: Créer l'index B-tree
-    auto index = std::make_unique<BTreeIndex>();
-    
-    for (size_t row_idx = 0; row_idx < data.size(); ++row_idx) {
-        const auto& row = data[row_idx];
-        if (static_cast<size_t>(col_idx) < row.size()) {
-            const std::string& value = row[col_idx];
-            index->value_to_rows[value].push_back(row_idx);
-        }
-    }
-    
-    // EN: Calculate memory usage
-    // FR: Calculer l'utilisation mémoire
-    index->memory_usage = calculateIndexMemory(table, column);
-    
-    btree_indexes_[table][column] = std::move(index);
+    btree_indexes_[table][column] = extendSnapshot<IndexSnapshot<BTreeIndex>>(
+        nullptr, data.getRowCount(), [&](size_t first_row, size_t row_count) {
+            return buildBTreeSegment(data, static_cast<size_t>(col_idx), first_row, row_count);
+        });
     return QueryError::SUCCESS;
 }
 
 QueryError IndexManager::buildFullTextIndex(const std::string& table, const std::string& column) {
-    const auto& headers = table_headers_[table];
-    const auto& data = table_data_[table];
+    const auto& data = *table_data_[table];
     const auto& config = index_configs_[table][column];
     
     // EN: Find column index
     // FR: Trouver l'index de colonne
-    int col_idx = -1;
-    for (size_t i = 0; i < headers.size(); ++i) {
-        if (headers[i] == column) {
-            col_idx = static_cast<int>(i);
-            break;
-        }
-    }
+    int col_idx = data.getColumnIndex(column);
     
     if (col_idx < 0) {
         return QueryError::COLUMN_NOT_FOUND;
     }
     
-    // EN: Create full-text index
-    // FR: Créer l'index texte intégral
-    auto index = std::make_unique<FullTextIndex>();
-    index->tokenizer = config.tokenizer;
-    index->case_sensitive = config.case_sensitive;
-    
-    for (size_t row_idx = 0; row_idx < data.size(); ++row_idx) {
-        const auto& row = data[row_idx];
-        if (static_cast<size_t>(col_idx) < row.size()) {
-            const std::string& text = row[col_idx];
-            auto tokens = tokenizeText(text, config.tokenizer, config.case_sensitive);
-            
-            for (const auto& token : tokens) {
-                index->token_to_rows[token].push_back(row_idx);
-            }
-        }
+    fulltext_indexes_[table][column] = extendSnapshot<IndexSnapshot<FullTextIndex>>(
+        nullptr, data.getRowCount(), [&](size_t first_row, size_t row_count) {
+            return buildFullTextSegment(data, static_cast<size_t>(col_idx), config, first_row, row_count);
+        });
+    return QueryError::SUCCESS;
+}
+
+std::shared_ptr<const IndexManager::HashIndex> IndexManager::buildHashSegment(const ColumnarTable& data, size_t column,
+                                                                            size_t first_row, size_t row_count) const {
+    auto index = std::make_shared<HashIndex>();
+    index->first_row = first_row;
+    index->row_count = row_count;
+    for (size_t row_idx = first_row; row_idx < first_row + row_count; ++row_idx) {
+        index->value_to_rows[std::string(data.getValue(row_idx, column))].push_back(row_idx);
     }
+    index->memory_usage = valueIndexMemory(index->value_to_rows);
+    return index;
+}
+
+std::shared_ptr<const IndexManager::BTreeIndex> IndexManager::buildBTreeSegment(const ColumnarTable& data, size_t column,
+                                                                              size_t first_row, size_t row_count) const {
+    auto index = std::make_shared<BTreeIndex>();
+    index->first_row = first_row;
+    index->row_count = row_count;
+    for (size_t row_idx = first_row; row_idx < first_row + row_count; ++row_idx) {
+        index->value_to_rows[std::string(data.getValue(row_idx, column))].push_back(row_idx);
+    }
+    index->memory_usage = valueIndexMemory(index->value_to_rows);
+    return index;
+}
+
+std::shared_ptr<const IndexManager::FullTextIndex> IndexManager::buildFullTextSegment(const ColumnarTable& data,
+                                                                                    size_t column,
+                                                                                    const IndexConfig& config,
+                                                                                    size_t first_row,
+                                                                                    size_t row_count) const {
+    auto index = std::make_shared<FullTextIndex>();
+    index->first_row = first_row;
+    index->row_count = row_count;
+    index->postings = std::make_unique<InvertedIndex>();
+    for (size_t row_idx = first_row; row_idx < first_row + row_count; ++row_idx) {
+        index->postings->add(row_idx, tokenizeText(std::string(data.getValue(row_idx, column)), config.tokenizer,
+                                                   config.case_sensitive));
+    }
+    index->postings->finish();
     
-    // EN: Calculate memory usage
-    // FR: Calculer l'utilisation mémoire
-    index->memory_usage = calculateIndexMemory(table, column);
-    
-    fulltext_indexes_[table][column] = std::move(index);
-    return QueryError::SUCCESS;
+    // EN: The compressed postings are the whole index
+    // FR: Les listes compressées sont l'index entier
+    index->memory_usage = index->postings->getMemoryUsage();
+    return index;
 }
 
 std::vector<std::string> IndexManager::tokenizeText(const std::string& text, const std::string& tokenizer, bool case_sensitive) const {
@@ -1469,11 +1706,139 @@ std::vector<std::string> IndexManager::tokenizeText(const std::string& text, con
 
 QueryError IndexManager::loadTableData(const std::string& table, const std::vector<std::string>& headers,
                                       const std::vector<std::vector<std::string>>& data) {
+    return loadTableData(table, ColumnarTable::fromRows(headers, data));
+}
+
+QueryError IndexManager::loadTableData(const std::string& table, std::shared_ptr<const ColumnarTable> data) {
+    if (!data) {
+        return QueryError::EXECUTION_ERROR;
+    }
+    
+    std::lock_guard<std::mutex> write_lock(write_mutex_);
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    table_data_[table] = std::move(data);
+    index_sources_.erase(table);
+    mapped_indexes_.erase(table);
+    
+    return QueryError::SUCCESS;
+}
+
+QueryError IndexManager::loadTableData(const std::string& table, std::shared_ptr<const ColumnarTable> data,
+                                      IndexSource source) {
+    QueryError error = loadTableData(table, std::move(data));
+    if (error == QueryError::SUCCESS) {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        index_sources_[table] = std::move(source);
+    }
+    return error;
+}
+
+std::shared_ptr<const ColumnarTable> IndexManager::getTableData(const std::string& table) const {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    
+    auto it = table_data_.find(table);
+    return it != table_data_.end() ? it->second : nullptr;
+}
+
+void IndexManager::clearTableData(const std::string& table) {
+    std::lock_guard<std::mutex> write_lock(write_mutex_);
     std::lock_guard<std::mutex> lock(index_mutex_);
     
-    table_headers_[table] = headers;
-    table_data_[table] = data;
+    table_data_.erase(table);
+    hash_indexes_.erase(table);
+    btree_indexes_.erase(table);
+    fulltext_indexes_.erase(table);
+    mapped_indexes_.erase(table);
+    index_configs_.erase(table);
+    index_sources_.erase(table);
+}
+
+QueryError IndexManager::appendRows(const std::string& table, const std::vector<std::vector<std::string>>& rows) {
+    std::lock_guard<std::mutex> write_lock(write_mutex_);
+    
+    // EN: Writers are serialized, so what is read here stays current until the swap below
+    // FR: Les écrivains sont sérialisés, ce qui est lu ici reste donc à jour jusqu'à l'échange ci-dessous
+    std::shared_ptr<const ColumnarTable> current;
+    std::unordered_map<std::string, IndexConfig> configs;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        auto data_it = table_data_.find(table);
+        if (data_it == table_data_.end()) {
+            return QueryError::FILE_NOT_FOUND;
+        }
+        current = data_it->second;
+        auto config_it = index_configs_.find(table);
+        if (config_it != index_configs_.end()) {
+            configs = config_it->second;
+        }
+    }
+    if (rows.empty()) {
+        return QueryError::SUCCESS;
+    }
+    
+    // EN: Everything is built without the index lock: the extended table, then each index extended over the new
+    //     rows. A mapped index has no segment in memory, so it is rebuilt there over the whole table, once.
+    // FR: Tout est construit sans le verrou d'index : la table étendue, puis chaque index étendu aux nouvelles
+    //     lignes. Un index mappé n'a aucun segment en mémoire, il y est donc reconstruit sur toute la table, une fois.
+    std::shared_ptr<const ColumnarTable> extended = current->extended(rows);
+    const ColumnarTable& data = *extended;
+    const size_t row_count = data.getRowCount();
+    std::vector<std::pair<std::string, std::shared_ptr<const IndexSnapshot<HashIndex>>>> hash_updates;
+    std::vector<std::pair<std::string, std::shared_ptr<const IndexSnapshot<BTreeIndex>>>> btree_updates;
+    std::vector<std::pair<std::string, std::shared_ptr<const IndexSnapshot<FullTextIndex>>>> fulltext_updates;
+    for (const auto& [column, config] : configs) {
+        const int col_idx = data.getColumnIndex(column);
+        if (col_idx < 0) {
+            continue;
+        }
+        const size_t col = static_cast<size_t>(col_idx);
+        std::unique_lock<std::mutex> lock(index_mutex_);
+        const bool mapped = findSnapshot(mapped_indexes_, table, column) != nullptr;
+        switch (config.type) {
+            case IndexType::HASH: {
+                auto snapshot = mapped ? nullptr : findSnapshot(hash_indexes_, table, column);
+                lock.unlock();
+                hash_updates.emplace_back(column, extendSnapshot(snapshot.get(), row_count, [&](size_t first, size_t count) {
+                    return buildHashSegment(data, col, first, count);
+                }));
+                break;
+            }
+            case IndexType::BTREE: {
+                auto snapshot = mapped ? nullptr : findSnapshot(btree_indexes_, table, column);
+                lock.unlock();
+                btree_updates.emplace_back(column, extendSnapshot(snapshot.get(), row_count, [&](size_t first, size_t count) {
+                    return buildBTreeSegment(data, col, first, count);
+                }));
+                break;
+            }
+            case IndexType::FULL_TEXT: {
+                auto snapshot = mapped ? nullptr : findSnapshot(fulltext_indexes_, table, column);
+                lock.unlock();
+                fulltext_updates.emplace_back(column, extendSnapshot(snapshot.get(), row_count, [&](size_t first, size_t count) {
+                    return buildFullTextSegment(data, col, config, first, count);
+                }));
+                break;
+            }
+            default:
+                break;
+        }
+    }
     
+    // EN: Published together, so a lookup sees either the old table and indexes or the new ones
+    // FR: Publiés ensemble, une recherche voit donc soit l'ancienne table et les anciens index, soit les nouveaux
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    table_data_[table] = std::move(extended);
+    for (auto& [column, snapshot] : hash_updates) {
+        hash_indexes_[table][column] = std::move(snapshot);
+    }
+    for (auto& [column, snapshot] : btree_updates) {
+        btree_indexes_[table][column] = std::move(snapshot);
+    }
+    for (auto& [column, snapshot] : fulltext_updates) {
+        fulltext_indexes_[table][column] = std::move(snapshot);
+    }
+    mapped_indexes_.erase(table);
+    index_sources_.erase(table);
     return QueryError::SUCCESS;
 }
 
@@ -1486,96 +1851,197 @@ bool IndexManager::hasIndex(const std::string& table, const std::string& column)
     return table_it->second.find(column) != table_it->second.end();
 }
 
+bool IndexManager::isIndexMapped(const std::string& table, const std::string& column) const {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    return findSnapshot(mapped_indexes_, table, column) != nullptr;
+}
+
 std::vector<size_t> IndexManager::findRowsByIndex(const std::string& table, const std::string& column, 
                                                   const QueryValue& value) const {
-    std::lock_guard<std::mutex> lock(index_mutex_);
+    // EN: The snapshots are taken under the lock and searched without it, so an append never waits on a lookup
+    // FR: Les instantanés sont pris sous le verrou et parcourus sans lui, un ajout n'attend donc jamais une recherche
+    std::shared_ptr<const PersistentIndex> mapped;
+    std::shared_ptr<const IndexSnapshot<HashIndex>> hash;
+    std::shared_ptr<const IndexSnapshot<BTreeIndex>> btree;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        
+        // EN: A mapped value index replaces the in-memory ones of its column (a full-text one holds tokens, not values)
+        // FR: Un index de valeurs mappé remplace ceux en mémoire de sa colonne (un index texte intégral contient des
+        //     tokens, pas des valeurs)
+        mapped = findSnapshot(mapped_indexes_, table, column);
+        if (mapped && index_configs_.at(table).at(column).type == IndexType::FULL_TEXT) {
+            mapped = nullptr;
+        }
+        hash = findSnapshot(hash_indexes_, table, column);
+        btree = findSnapshot(btree_indexes_, table, column);
+    }
     
     std::string str_value = QueryUtils::queryValueToString(value);
+    if (mapped) {
+        return mapped->find(str_value);
+    }
     
     // EN: Try hash index first
     // FR: Essayer d'abord l'index hash
-    auto hash_table_it = hash_indexes_.find(table);
-    if (hash_table_it != hash_indexes_.end()) {
-        auto hash_col_it = hash_table_it->second.find(column);
-        if (hash_col_it != hash_table_it->second.end()) {
-            const auto& index = hash_col_it->second;
-            auto value_it = index->value_to_rows.find(str_value);
-            if (value_it != index->value_to_rows.end()) {
-                return value_it->second;
-            }
+    if (hash) {
+        std::vector<size_t> rows = findInSnapshot(*hash, str_value);
+        if (!rows.empty()) {
+            return rows;
         }
     }
     
     // EN: Try B-tree index
     // FR: Essayer l'index B-tree
-    auto btree_table_it = btree_indexes_.find(table);
-    if (btree_table_it != btree_indexes_.end()) {
-        auto btree_col_it = btree_table_it->second.find(column);
-        if (btree_col_it != btree_table_it->second.end()) {
-            const auto& index = btree_col_it->second;
-            auto value_it = index->value_to_rows.find(str_value);
-            if (value_it != index->value_to_rows.end()) {
-                return value_it->second;
-            }
-        }
+    if (btree) {
+        return findInSnapshot(*btree, str_value);
     }
     
     return {}; // EN: No matching rows found / FR: Aucune ligne correspondante trouvée
 }
 
-size_t IndexManager::calculateIndexMemory(const std::string& table_name, const std::string& /* column */) const {
-    // EN: Rough estimate of index memory usage
-    // FR: Estimation approximative de l'utilisation mémoire de l'index
-    size_t memory = 0;
+std::vector<size_t> IndexManager::findRowsByText(const std::string& table, const std::string& column,
+                                                const std::string& text, TextMatch mode) const {
+    IndexConfig config;
+    std::shared_ptr<const PersistentIndex> mapped;
+    std::shared_ptr<const IndexSnapshot<FullTextIndex>> in_memory;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        
+        auto config_table_it = index_configs_.find(table);
+        if (config_table_it == index_configs_.end()) {
+            return {};
+        }
+        auto config_it = config_table_it->second.find(column);
+        if (config_it == config_table_it->second.end() || config_it->second.type != IndexType::FULL_TEXT) {
+            return {};
+        }
+        config = config_it->second;
+        
+        // EN: The postings come from the mapped file when there is one, from memory otherwise
+        // FR: Les listes viennent du fichier mappé s'il existe, de la mémoire sinon
+        mapped = findSnapshot(mapped_indexes_, table, column);
+        if (!mapped) {
+            in_memory = findSnapshot(fulltext_indexes_, table, column);
+        }
+    }
+    if (!mapped && !in_memory) {
+        return {};
+    }
     
-    const auto& data = table_data_.at(table_name);
-    for (const auto& row : data) {
-        memory += sizeof(size_t); // EN: Row index / FR: Index de ligne
-        for (const auto& field : row) {
-            memory += field.size();
+    const std::vector<std::string> terms = tokenizeText(text, config.tokenizer, config.case_sensitive);
+    std::vector<std::string_view> postings;
+    if (mapped) {
+        for (const auto& term : terms) {
+            postings.push_back(mapped->findEncoded(term));
         }
+        return matchPostings(postings, mode);
     }
     
-    return memory;
+    // EN: A row's match only depends on its own postings, so each segment is matched alone and the results,
+    //     in row order, are concatenated
+    // FR: La correspondance d'une ligne ne dépend que de ses propres listes, chaque segment est donc apparié seul
+    //     et les résultats, dans l'ordre des lignes, sont concaténés
+    std::vector<size_t> rows;
+    for (const auto& segment : in_memory->segments) {
+        postings.clear();
+        for (const auto& term : terms) {
+            postings.push_back(segment->postings->find(term));
+        }
+        std::vector<size_t> matches = matchPostings(postings, mode);
+        rows.insert(rows.end(), matches.begin(), matches.end());
+    }
+    return rows;
 }
 
 // EN: QueryEngine implementation
 // FR: Implémentation de QueryEngine
 
-QueryEngine::QueryEngine(const Config& config) : config_(config) {
+QueryEngine::QueryEngine(const Config& config)
+    : config_(config),
+      query_cache_(std::make_unique<ResultCache>(config.query_cache_bytes, config.query_cache_size)) {
     // EN: Initialize statistics
     // FR: Initialiser les statistiques
     statistics_ = EngineStatistics{};
 }
 
+QueryEngine::~QueryEngine() = default;
+
 QueryError QueryEngine::loadTable(const std::string& table_name, const std::string& csv_file) {
-    std::vector<std::string> headers;
-    std::vector<std::vector<std::string>> data;
+    std::shared_ptr<ColumnarTable> table;
     
-    QueryError error = QueryUtils::loadCsvFile(csv_file, headers, data);
+    // EN: Fingerprinted before the read, so a file changed while loading never validates the indexes built from it
+    // FR: Empreinte relevée avant la lecture, un fichier modifié pendant le chargement ne valide donc jamais les
+    //     index construits à partir de lui
+    IndexSource source;
+    const bool persist = config_.persist_indexes && readIndexSource(csv_file, source);
+    
+    QueryError error = QueryUtils::loadCsvTable(csv_file, table, config_.dictionary_limit);
     if (error != QueryError::SUCCESS) {
         return error;
     }
     
-    return registerTable(table_name, headers, data);
+    error = registerTable(table_name, std::move(table), persist ? &source : nullptr);
+    if (error == QueryError::SUCCESS) {
+        std::lock_guard<std::mutex> lock(table_mutex_);
+        table_files_[table_name] = csv_file;
+    }
+    return error;
 }
 
 QueryError QueryEngine::registerTable(const std::string& table_name, const std::vector<std::string>& headers,
                                      const std::vector<std::vector<std::string>>& data) {
+    return registerTable(table_name, ColumnarTable::fromRows(headers, data, config_.dictionary_limit));
+}
+
+QueryError QueryEngine::registerTable(const std::string& table_name, std::shared_ptr<const ColumnarTable> table) {
+    return registerTable(table_name, std::move(table), nullptr);
+}
+
+QueryError QueryEngine::registerTable(const std::string& table_name, std::shared_ptr<const ColumnarTable> table,
+                                     const IndexSource* source) {
+    if (!table) {
+        return QueryError::EXECUTION_ERROR;
+    }
+    
+    // EN: Planner statistics are gathered before taking the lock, one column per scan pool task
+    // FR: Les statistiques du planificateur sont collectées avant de prendre le verrou, une colonne par tâche du
+    //     pool de parcours
+    std::shared_ptr<const TableStatistics> statistics;
+    if (config_.collect_statistics) {
+        statistics = TableStatistics::collect(*table, scanPool(), workerThreadCount() - 1);
+    }
+    
     std::lock_guard<std::mutex> lock(table_mutex_);
     
-    table_headers_[table_name] = headers;
-    table_data_[table_name] = data;
+    tables_[table_name] = table;
+    table_registrations_[table_name] = ++registration_counter_;
+    attached_tables_.erase(table_name);
+    table_files_.erase(table_name);
+    {
+        std::lock_guard<std::mutex> zone_lock(zone_map_mutex_);
+        zone_maps_.erase(table_name);
+    }
+    invalidateCachedResults(table_name);
+    if (statistics) {
+        table_statistics_[table_name] = std::move(statistics);
+    } else {
+        table_statistics_.erase(table_name);
+    }
     
-    // EN: Load data into index manager
-    // FR: Charger les données dans le gestionnaire d'index
-    index_manager_.loadTableData(table_name, headers, data);
+    // EN: The index manager references the same table rather than a copy
+    // FR: Le gestionnaire d'index référence la même table plutôt qu'une copie
+    if (source) {
+        index_manager_.loadTableData(table_name, table, *source);
+    } else {
+        index_manager_.loadTableData(table_name, table);
+    }
     
     // EN: Auto-create indexes if enabled
     // FR: Créer automatiquement des index si activé
-    if (config_.auto_index && !headers.empty()) {
+    if (config_.auto_index && table->getColumnCount() > 0) {
         IndexConfig index_config;
-        index_config.column = headers[0]; // EN: Index first column by default / FR: Indexer la première colonne par défaut
+        index_config.column = table->getHeaders()[0]; // EN: Index first column by default / FR: Indexer la première colonne par défaut
         index_config.type = IndexType::HASH;
         createIndex(table_name, index_config);
     }
@@ -1587,48 +2053,174 @@ std::vector<std::string> QueryEngine::getTableNames() const {
     std::lock_guard<std::mutex> lock(table_mutex_);
     
     std::vector<std::string> names;
-    for (const auto& pair : table_headers_) {
+    for (const auto& pair : tables_) {
+        names.push_back(pair.first);
+    }
+    for (const auto& pair : attached_tables_) {
         names.push_back(pair.first);
     }
     
     return names;
 }
 
-QueryResult QueryEngine::execute(const std::string& sql) {
-    auto start = std::chrono::high_resolution_clock::now();
+std::shared_ptr<const ColumnarTable> QueryEngine::getTable(const std::string& table_name) const {
+    std::lock_guard<std::mutex> lock(table_mutex_);
     
-    // EN: Check query cache first
-    // FR: Vérifier d'abord le cache de requêtes
-    if (config_.enable_query_cache) {
-        std::lock_guard<std::mutex> cache_lock(cache_mutex_);
-        auto it = query_cache_.find(sql);
-        if (it != query_cache_.end()) {
-            auto end = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-            
-            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
-            statistics_.cache_hits++;
-            statistics_.total_queries_executed++;
-            statistics_.total_execution_time += duration;
-            
-            QueryResult result = it->second;
-            QueryStatistics stats;
-            stats.execution_time = duration;
-            stats.query_cached = true;
-            result.setStatistics(stats);
-            
-            return result;
-        }
+    auto it = tables_.find(table_name);
+    return it != tables_.end() ? it->second : nullptr;
+}
+
+void QueryEngine::unloadTable(const std::string& table_name) {
+    std::lock_guard<std::mutex> lock(table_mutex_);
+    
+    // EN: The table is freed once neither the engine nor the index manager references it
+    // FR: La table est libérée quand ni le moteur ni le gestionnaire d'index ne la référencent plus
+    tables_.erase(table_name);
+    table_registrations_.erase(table_name);
+    attached_tables_.erase(table_name);
+    table_files_.erase(table_name);
+    {
+        std::lock_guard<std::mutex> zone_lock(zone_map_mutex_);
+        zone_maps_.erase(table_name);
+    }
+    table_statistics_.erase(table_name);
+    index_manager_.clearTableData(table_name);
+    invalidateCachedResults(table_name);
+}
+
+QueryError QueryEngine::attachTable(const std::string& table_name, const std::string& csv_file) {
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(csv_file, ec)) {
+        return QueryError::FILE_NOT_FOUND;
     }
     
-    // EN: Parse SQL query
-    // FR: Analyser la requête SQL
-    SqlQuery query;
-    QueryError parse_error = parser_.parse(sql, query);
+    std::lock_guard<std::mutex> lock(table_mutex_);
     
-    if (parse_error != QueryError::SUCCESS) {
-        QueryResult error_result;
-        QueryStatistics stats;
+    tables_.erase(table_name);
+    table_registrations_.erase(table_name);
+    table_files_.erase(table_name);
+    {
+        std::lock_guard<std::mutex> zone_lock(zone_map_mutex_);
+        zone_maps_.erase(table_name);
+    }
+    table_statistics_.erase(table_name);
+    index_manager_.clearTableData(table_name);
+    attached_tables_[table_name] = csv_file;
+    invalidateCachedResults(table_name);
+    return QueryError::SUCCESS;
+}
+
+QueryError QueryEngine::appendRows(const std::string& table_name, const std::vector<std::vector<std::string>>& rows) {
+    std::shared_ptr<const TableStatistics> statistics;
+    {
+        std::lock_guard<std::mutex> lock(table_mutex_);
+        if (tables_.count(table_name) == 0) {
+            return QueryError::FILE_NOT_FOUND;
+        }
+        auto it = table_statistics_.find(table_name);
+        if (it != table_statistics_.end()) {
+            statistics = it->second;
+        }
+    }
+    
+    // EN: The index manager extends the table it shares with the engine, and its indexes, without the table lock
+    // FR: Le gestionnaire d'index étend la table qu'il partage avec le moteur, et ses index, sans le verrou des tables
+    QueryError error = index_manager_.appendRows(table_name, rows);
+    if (error != QueryError::SUCCESS || rows.empty()) {
+        return error;
+    }
+    
+    std::shared_ptr<const TableStatistics> collected;
+    std::shared_ptr<const ColumnarTable> extended = index_manager_.getTableData(table_name);
+    if (config_.collect_statistics && extended &&
+        (!statistics || extended->getRowCount() > statistics->getRowCount() + statistics->getRowCount() / 4)) {
+        collected = TableStatistics::collect(*extended, scanPool(), workerThreadCount() - 1);
+    }
+    
+    std::lock_guard<std::mutex> lock(table_mutex_);
+    
+    // EN: Read again under the lock: a concurrent append may have published a longer table since
+    // FR: Relue sous le verrou : un ajout concurrent peut avoir publié une table plus longue depuis
+    extended = index_manager_.getTableData(table_name);
+    auto table_it = tables_.find(table_name);
+    if (!extended || table_it == tables_.end()) {
+        return QueryError::FILE_NOT_FOUND;
+    }
+    table_it->second = std::move(extended);
+    invalidateCachedResults(table_name);
+    if (collected) {
+        table_statistics_[table_name] = std::move(collected);
+    }
+    return QueryError::SUCCESS;
+}
+
+QueryResult QueryEngine::execute(const std::string& sql) {
+    // EN: "EXPLAIN [ANALYZE] <query>" answers with the plan, one line per row
+    // FR: « EXPLAIN [ANALYZE] <requête> » répond avec le plan, une ligne par rangée
+    std::istringstream words(sql);
+    std::string keyword;
+    auto nextKeyword = [&words, &keyword]() {
+        keyword.clear();
+        words >> keyword;
+        std::transform(keyword.begin(), keyword.end(), keyword.begin(), ::toupper);
+        return keyword;
+    };
+    if (nextKeyword() == "EXPLAIN") {
+        std::streampos rest = words.tellg();
+        const bool analyze = nextKeyword() == "ANALYZE";
+        if (analyze) {
+            rest = words.tellg();
+        }
+        const std::string inner = rest == std::streampos(-1) ? std::string() : sql.substr(static_cast<size_t>(rest));
+        std::istringstream lines(analyze ? explainAnalyze(inner) : explainQuery(inner));
+        QueryResult plan({"plan"});
+        for (std::string line; std::getline(lines, line);) {
+            plan.addRow({line});
+        }
+        return plan;
+    }
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    
+    // EN: Check query cache first; a hit shares the cached rows instead of copying them
+    // FR: Vérifier d'abord le cache de requêtes ; un succès partage les lignes en cache au lieu de les copier
+    uint64_t generation = 0;
+    if (config_.enable_query_cache) {
+        std::shared_ptr<const QueryResult> cached;
+        {
+            std::lock_guard<std::mutex> cache_lock(cache_mutex_);
+            cached = query_cache_->find(sql);
+            generation = cache_generation_;
+        }
+        if (cached) {
+            auto end = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+            
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            statistics_.cache_hits++;
+            statistics_.total_queries_executed++;
+            statistics_.total_execution_time += duration;
+            
+            QueryResult result = *cached;
+            QueryStatistics stats;
+            stats.execution_time = duration;
+            stats.query_cached = true;
+            result.setStatistics(stats);
+            
+            return result;
+        }
+    }
+    
+    // EN: Parse SQL query
+    // FR: Analyser la requête SQL
+    SqlQuery query;
+    QueryError parse_error = parser_.parse(sql, query);
+    
+    // EN: "?" placeholders only take values through prepare() and execute(statement, ...)
+    // FR: Les paramètres « ? » ne reçoivent de valeurs que via prepare() et execute(instruction, ...)
+    if (parse_error != QueryError::SUCCESS || !query.parameters.empty()) {
+        QueryResult error_result;
+        QueryStatistics stats;
         stats.execution_time = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::high_resolution_clock::now() - start);
         error_result.setStatistics(stats);
@@ -1637,6 +2229,10 @@ QueryResult QueryEngine::execute(const std::string& sql) {
     
     // EN: Execute the parsed query
     // FR: Exécuter la requête analysée
+    std::vector<SourceSignature> sources;
+    if (config_.enable_query_cache) {
+        sources = readSources(query);
+    }
     QueryResult result = executeInternal(query);
     
     auto end = std::chrono::high_resolution_clock::now();
@@ -1650,31 +2246,198 @@ QueryResult QueryEngine::execute(const std::string& sql) {
     // FR: Mettre en cache le résultat si la mise en cache est activée
     if (config_.enable_query_cache && result.getRowCount() > 0) {
         std::lock_guard<std::mutex> cache_lock(cache_mutex_);
-        query_cache_[sql] = result;
-        cache_timestamps_[sql] = std::chrono::system_clock::now();
-        
-        // EN: Clean up cache if too large
-        // FR: Nettoyer le cache s'il est trop gros
-        if (query_cache_.size() > config_.query_cache_size) {
-            cleanupCache();
+        if (generation == cache_generation_) {
+            query_cache_->insert(sql, std::make_shared<const QueryResult>(result), std::move(sources));
         }
     }
     
     return result;
 }
 
-QueryResult QueryEngine::executeInternal(const SqlQuery& query) {
-    std::lock_guard<std::mutex> lock(table_mutex_);
+QueryResult QueryEngine::searchText(const std::string& table_name, const std::string& column, const std::string& text,
+                                    TextMatch mode) {
+    auto start = std::chrono::high_resolution_clock::now();
     
-    // EN: Check if table exists
-    // FR: Vérifier si la table existe
-    auto table_it = table_data_.find(query.table);
-    if (table_it == table_data_.end()) {
+    auto table = getTable(table_name);
+    if (!table) {
         return QueryResult{}; // EN: Empty result / FR: Résultat vide
     }
     
-    const auto& headers = table_headers_[query.table];
-    const auto& data = table_data_[query.table];
+    std::vector<size_t> rows = index_manager_.findRowsByText(table_name, column, text, mode);
+    std::erase_if(rows, [&table](size_t row) { return row >= table->getRowCount(); });
+    QueryResult result(table->getHeaders());
+    std::vector<std::string> row(table->getColumnCount());
+    for (size_t row_idx : rows) {
+        for (size_t col = 0; col < row.size(); ++col) {
+            row[col] = std::string(table->getValue(row_idx, col));
+        }
+        result.addRow(row);
+    }
+    
+    static const char* const kModeNames[] = {"all terms", "any term", "phrase"};
+    QueryStatistics stats;
+    stats.execution_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    stats.rows_examined = rows.size();
+    stats.rows_returned = rows.size();
+    stats.indexes_used = 1;
+    stats.index_hits.push_back(column);
+    stats.execution_plan = "Full-text search: " + std::string(kModeNames[static_cast<int>(mode)]) + " on " + column +
+                           ", " + std::to_string(rows.size()) + " rows\n";
+    result.setStatistics(stats);
+    updateStatistics(result, stats.execution_time);
+    return result;
+}
+
+namespace {
+
+void bindParameter(SqlQuery& query, const QueryParameter& parameter, const QueryValue& value) {
+    WhereCondition& condition = query.where[parameter.condition];
+    switch (parameter.slot) {
+        case QueryParameter::Slot::VALUE:       condition.value = value; break;
+        case QueryParameter::Slot::RANGE_START: condition.range_start = value; break;
+        case QueryParameter::Slot::RANGE_END:   condition.range_end = value; break;
+        case QueryParameter::Slot::IN_VALUE:    condition.in_values[parameter.in_index] = value; break;
+        case QueryParameter::Slot::PATTERN:     condition.pattern = QueryUtils::queryValueToString(value); break;
+    }
+}
+
+std::string zoneMapDetail(size_t blocks_skipped, size_t block_count, size_t block_rows) {
+    return "Zone maps: " + std::to_string(blocks_skipped) + " of " + std::to_string(block_count) + " blocks of " +
+           std::to_string(block_rows) + " rows skipped";
+}
+
+} // anonymous namespace
+
+PreparedHandle QueryEngine::prepare(const std::string& sql) {
+    auto statement = std::make_shared<PreparedStatement>();
+    SqlQuery& query = statement->query_;
+    if (parser_.parse(sql, query) != QueryError::SUCCESS) {
+        return nullptr;
+    }
+    
+    // EN: Placeholders are planned as a typical text value: an equality keeps 1 / NDV of the rows, a range the
+    //     default fraction
+    // FR: Les paramètres sont planifiés comme une valeur textuelle typique : une égalité garde 1 / NDV des
+    //     lignes, une plage la fraction par défaut
+    for (const auto& parameter : query.parameters) {
+        bindParameter(query, parameter, std::string("?"));
+    }
+    
+    QuerySources sources;
+    {
+        std::lock_guard<std::mutex> lock(table_mutex_);
+        sources = takeSources(query);
+        if (!sources.table) {
+            return attached_tables_.count(query.table) > 0 && query.joins.empty() ? statement : nullptr;
+        }
+    }
+    if (std::find(sources.joined.begin(), sources.joined.end(), nullptr) != sources.joined.end()) {
+        return nullptr;
+    }
+    if (query.joins.empty()) {
+        const ColumnarTable& table = *sources.table;
+        auto known = [&table](const std::string& column) { return column == "*" || table.getColumnIndex(column) >= 0; };
+        const bool resolved =
+            std::all_of(query.columns.begin(), query.columns.end(), [&](const SelectColumn& col) { return known(col.column); }) &&
+            std::all_of(query.where.begin(), query.where.end(), [&](const WhereCondition& cond) { return known(cond.column); }) &&
+            std::all_of(query.group_by.begin(), query.group_by.end(), known);
+        if (!resolved) {
+            return nullptr;
+        }
+    }
+    statement->plan_ = std::make_shared<const QueryPlan>(planQuery(query, sources));
+    statement->planned_for_ = sources.table;
+    return statement;
+}
+
+QueryResult QueryEngine::execute(const PreparedHandle& statement, const std::vector<QueryValue>& parameters) {
+    auto start = std::chrono::high_resolution_clock::now();
+    if (!statement || parameters.size() != statement->getParameterCount()) {
+        return QueryResult{};
+    }
+    
+    SqlQuery query = statement->query_;
+    for (size_t i = 0; i < parameters.size(); ++i) {
+        bindParameter(query, query.parameters[i], parameters[i]);
+    }
+    query.parameters.clear();
+    QueryResult result = executeInternal(query, statement.get());
+    
+    updateStatistics(result, std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - start));
+    return result;
+}
+
+QueryResult QueryEngine::executeInternal(const SqlQuery& query, const PreparedStatement* prepared) {
+    // EN: The table lock is only held to take the snapshots the query reads; planning and execution run without
+    //     it, so queries run side by side and an append never waits for them
+    // FR: Le verrou des tables n'est tenu que pour prendre les instantanés lus par la requête ; planification et
+    //     exécution se font sans lui, les requêtes s'exécutent donc côte à côte et un ajout ne les attend jamais
+    QuerySources sources;
+    {
+        std::unique_lock<std::mutex> lock(table_mutex_);
+        sources = takeSources(query);
+        if (!sources.table) {
+            // EN: Attached tables are streamed from their file, without holding the table lock meanwhile
+            // FR: Les tables attachées sont lues en flux depuis leur fichier, sans garder le verrou des tables pendant ce temps
+            auto attached_it = attached_tables_.find(query.table);
+            if (attached_it == attached_tables_.end() || !query.joins.empty()) {
+                return QueryResult{}; // EN: Empty result / FR: Résultat vide
+            }
+            std::string csv_file = attached_it->second;
+            lock.unlock();
+            return executeStreaming(query, csv_file);
+        }
+    }
+    
+    // EN: JOIN clauses produce one joined table that the rest of the query reads like any other
+    // FR: Les clauses JOIN produisent une table jointe que le reste de la requête lit comme n'importe quelle autre
+    std::shared_ptr<const ColumnarTable> source = sources.table;
+    
+    // EN: A prepared plan is reused while its table is the one it was chosen for; only the zone maps, which
+    //     depend on the bound values, are read again
+    // FR: Un plan préparé est réutilisé tant que sa table est celle pour laquelle il a été choisi ; seules les
+    //     zone maps, qui dépendent des valeurs liées, sont relues
+    QueryPlan plan;
+    if (prepared && prepared->plan_ && prepared->planned_for_ == source) {
+        plan = *prepared->plan_;
+        PlanNode* scan = plan.find(PlanNode::Kind::SCAN);
+        if (plan.prunable && plan.index_condition < 0 && scan) {
+            plan.scan_ranges = pruneScanBlocks(query.table, sources.registration, *source, query.where,
+                                               plan.block_count, plan.blocks_skipped);
+            if (plan.block_count > 0) {
+                scan->details.push_back(zoneMapDetail(plan.blocks_skipped, plan.block_count, config_.zone_map_block_rows));
+            }
+        }
+    } else {
+        plan = planQuery(query, sources);
+    }
+    auto lap = std::chrono::steady_clock::now();
+    auto record = [&plan, &lap](PlanNode::Kind kind, size_t rows) {
+        const auto now = std::chrono::steady_clock::now();
+        if (PlanNode* node = plan.find(kind)) {
+            node->executed = true;
+            node->actual_rows = rows;
+            node->actual_ms = std::chrono::duration<double, std::milli>(now - lap).count();
+        }
+        lap = now;
+    };
+    
+    std::string join_plan;
+    if (!query.joins.empty()) {
+        if (executeJoins(query, sources, source, join_plan, plan) != QueryError::SUCCESS) {
+            return QueryResult{};
+        }
+        if (PlanNode* base = plan.find(PlanNode::Kind::SCAN)) {
+            base->executed = true;
+            base->actual_rows = sources.table->getRowCount();
+        }
+        lap = std::chrono::steady_clock::now();
+    }
+    
+    const ColumnarTable& table = *source;
+    const auto& headers = table.getHeaders();
     
     // EN: Build result headers
     // FR: Construire les en-têtes de résultat
@@ -1692,70 +2455,194 @@ QueryResult QueryEngine::executeInternal(const SqlQuery& query) {
     // EN: Apply WHERE conditions
     // FR: Appliquer les conditions WHERE
     std::vector<size_t> matching_rows;
+    std::string scan_plan;
+    size_t rows_examined = table.getRowCount();
+    size_t blocks_skipped = 0;
+    size_t indexes_used = 0;
+    std::vector<std::string> index_hits;
     if (query.where.empty()) {
         // EN: No WHERE clause - include all rows
         // FR: Pas de clause WHERE - inclure toutes les lignes
-        matching_rows.resize(data.size());
+        matching_rows.resize(table.getRowCount());
         std::iota(matching_rows.begin(), matching_rows.end(), 0);
     } else {
-        matching_rows = optimizedRowSelection(query.table, query.where);
+        // EN: Conditions are compiled once for this query, then evaluated per row
+        // FR: Les conditions sont compilées une fois pour cette requête, puis évaluées par ligne
+        CompiledFilter filter(query.where, table);
         
-        // EN: If no index optimization was possible, scan all rows
-        // FR: Si aucune optimisation d'index n'était possible, parcourir toutes les lignes
-        if (matching_rows.empty()) {
-            for (size_t i = 0; i < data.size(); ++i) {
-                if (evaluateWhere(data[i], headers, query.where)) {
-                    matching_rows.push_back(i);
-                }
-            }
+        // EN: When the planner picked an index, it narrows the candidates of the AND-only clause; they are
+        //     still checked against every condition
+        // FR: Quand le planificateur a choisi un index, il réduit les candidats de la clause faite de AND ; ils
+        //     sont tout de même vérifiés contre chaque condition
+        std::vector<size_t> candidates;
+        if (plan.index_condition >= 0) {
+            const WhereCondition& condition = query.where[static_cast<size_t>(plan.index_condition)];
+            candidates = index_manager_.findRowsByIndex(query.table, condition.column, condition.value);
+            
+            // EN: The indexes are published before the table, so they may already hold rows appended after this
+            //     query took its table
+            // FR: Les index sont publiés avant la table, ils peuvent donc déjà contenir des lignes ajoutées après
+            //     que cette requête a pris sa table
+            std::erase_if(candidates, [&table](size_t row) { return row >= table.getRowCount(); });
         }
-    }
-    
-    // EN: Project columns and add rows to result
-    // FR: Projeter les colonnes et ajouter les lignes au résultat
-    for (size_t row_idx : matching_rows) {
-        if (row_idx >= data.size()) continue;
-        
-        const auto& row = data[row_idx];
-        std::vector<std::string> result_row;
         
-        if (query.columns.size() == 1 && query.columns[0].column == "*") {
-            result_row = row;
+        if (!candidates.empty()) {
+            const WhereCondition& condition = query.where[static_cast<size_t>(plan.index_condition)];
+            rows_examined = candidates.size();
+            indexes_used = 1;
+            index_hits.push_back(condition.column);
+            for (size_t row : candidates) {
+                if (filter.matches(row)) {
+                    matching_rows.push_back(row);
+                }
+            }
         } else {
-            for (const auto& col : query.columns) {
-                // EN: Find column index
-                // FR: Trouver l'index de colonne
-                int col_idx = -1;
-                for (size_t i = 0; i < headers.size(); ++i) {
-                    if (headers[i] == col.column) {
-                        col_idx = static_cast<int>(i);
-                        break;
-                    }
+            // EN: If no index optimization was possible, scan the blocks the zone maps keep in vectorized
+            //     batches, one morsel per task; each morsel keeps its own matches and they are concatenated in
+            //     table order
+            // FR: Si aucune optimisation d'index n'était possible, parcourir les blocs gardés par les zone maps
+            //     par lots vectorisés, un morceau par tâche ; chaque morceau garde ses correspondances et elles
+            //     sont concaténées dans l'ordre de la table
+            const size_t block_count = plan.block_count;
+            std::vector<std::pair<size_t, size_t>> ranges = plan.scan_ranges;
+            blocks_skipped = plan.blocks_skipped;
+            if (block_count == 0) {
+                ranges.assign(1, std::make_pair(size_t{0}, table.getRowCount()));
+            } else {
+                rows_examined = 0;
+                for (const auto& range : ranges) {
+                    rows_examined += range.second - range.first;
                 }
-                
-                if (col_idx >= 0 && static_cast<size_t>(col_idx) < row.size()) {
-                    result_row.push_back(row[col_idx]);
-                } else {
-                    result_row.push_back(""); // EN: Missing column / FR: Colonne manquante
+                scan_plan += "Zone maps: skipped " + std::to_string(blocks_skipped) + " of " +
+                             std::to_string(block_count) + " blocks of " + std::to_string(config_.zone_map_block_rows) +
+                             " rows\n";
+            }
+            
+            std::vector<std::pair<size_t, size_t>> morsels;
+            for (const auto& range : ranges) {
+                for (size_t begin = range.first; begin < range.second; begin += kScanMorselRows) {
+                    morsels.emplace_back(begin, std::min(range.second, begin + kScanMorselRows));
+                }
+            }
+            ThreadPool* pool = morsels.size() > 1 ? scanPool() : nullptr;
+            if (pool) {
+                std::vector<std::vector<size_t>> selected(morsels.size());
+                const size_t threads = forEachMorsel(pool, workerThreadCount() - 1, morsels.size(), 1,
+                                                     [&](size_t morsel, size_t, size_t) {
+                    filter.selectRows(morsels[morsel].first, morsels[morsel].second, selected[morsel]);
+                });
+                size_t total = 0;
+                for (const auto& rows : selected) {
+                    total += rows.size();
+                }
+                matching_rows.reserve(total);
+                for (const auto& rows : selected) {
+                    matching_rows.insert(matching_rows.end(), rows.begin(), rows.end());
+                }
+                scan_plan += "Parallel scan: " + std::to_string(selected.size()) + " morsels of " +
+                             std::to_string(kScanMorselRows) + " rows on " + std::to_string(threads) + " threads\n";
+            } else {
+                for (const auto& range : ranges) {
+                    filter.selectRows(range.first, range.second, matching_rows);
                 }
             }
         }
-        
-        result.addRow(std::move(result_row));
+    }
+    if (!query.joins.empty()) {
+        if (!query.where.empty()) {
+            record(PlanNode::Kind::FILTER, matching_rows.size());
+        }
+    } else {
+        record(plan.index_condition >= 0 ? PlanNode::Kind::INDEX_LOOKUP : PlanNode::Kind::SCAN, matching_rows.size());
+    }
+    
+    // EN: Aggregates read the matching rows straight from the table, without projecting them first
+    // FR: Les agrégats lisent les lignes correspondantes directement dans la table, sans les projeter d'abord
+    const bool has_aggregates = !query.group_by.empty() ||
+        std::any_of(query.columns.begin(), query.columns.end(),
+                    [](const SelectColumn& col) { return col.aggregate != AggregateFunction::NONE; });
+    std::string aggregate_plan;
+    if (has_aggregates) {
+        result = applyAggregation(table, matching_rows, query, aggregate_plan);
+        matching_rows.clear();
+        record(PlanNode::Kind::AGGREGATE, result.getRowCount());
+    }
+    
+    // EN: Resolve projected columns once; unknown columns yield empty values
+    // FR: Résoudre les colonnes projetées une fois ; les colonnes inconnues donnent des valeurs vides
+    const bool select_all = query.columns.size() == 1 && query.columns[0].column == "*";
+    std::vector<size_t> projection;
+    if (!select_all) {
+        for (const auto& col : query.columns) {
+            int col_idx = table.getColumnIndex(col.column);
+            projection.push_back(col_idx >= 0 ? static_cast<size_t>(col_idx) : table.getColumnCount());
+        }
     }
     
-    // EN: Apply aggregation if needed
-    // FR: Appliquer l'agrégation si nécessaire
-    bool has_aggregates = false;
-    for (const auto& col : query.columns) {
-        if (col.aggregate != AggregateFunction::NONE) {
-            has_aggregates = true;
-            break;
+    // EN: ORDER BY ... LIMIT on plain rows: pick the top rows from the table before projecting anything
+    // FR: ORDER BY ... LIMIT sur des lignes simples : choisir les premières lignes dans la table avant toute projection
+    std::string top_k_plan;
+    bool ordered_and_limited = false;
+    if (!has_aggregates && !query.distinct_query && !query.order_by.empty() && query.limit > 0) {
+        RowOrder order(result_headers, query.order_by);
+        if (order.valid()) {
+            std::vector<size_t> sort_columns;
+            for (size_t i = 0; i < order.getKeyCount(); ++i) {
+                sort_columns.push_back(select_all ? order.getColumn(i) : projection[order.getColumn(i)]);
+            }
+            const size_t candidates = matching_rows.size();
+            matching_rows = selectTopRows(table, matching_rows, order, sort_columns, query.offset + query.limit);
+            matching_rows.erase(matching_rows.begin(),
+                                matching_rows.begin() + static_cast<std::ptrdiff_t>(std::min(query.offset, matching_rows.size())));
+            ordered_and_limited = true;
+            top_k_plan = "Top-K: " + std::to_string(query.offset + query.limit) + " of " + std::to_string(candidates) +
+                         " rows\n";
+            record(PlanNode::Kind::TOP_K, matching_rows.size());
         }
     }
     
-    if (has_aggregates || !query.group_by.empty()) {
-        result = applyAggregation(result, query);
+    // EN: Project columns and add rows to result; large selections are materialized morsel by morsel on the
+    //     scan pool into their final slots, then appended in order
+    // FR: Projeter les colonnes et ajouter les lignes au résultat ; les grandes sélections sont matérialisées
+    //     morceau par morceau sur le pool de parcours dans leurs cases finales, puis ajoutées dans l'ordre
+    auto projectRow = [&](size_t row_idx) {
+        if (select_all) {
+            return table.getRow(row_idx);
+        }
+        std::vector<std::string> result_row;
+        result_row.reserve(projection.size());
+        for (size_t col_idx : projection) {
+            result_row.emplace_back(table.getValue(row_idx, col_idx));
+        }
+        return result_row;
+    };
+    ThreadPool* pool = morselCount(matching_rows.size(), kScanMorselRows) > 1 ? scanPool() : nullptr;
+    if (pool) {
+        std::vector<std::vector<std::string>> projected(matching_rows.size());
+        const size_t threads = forEachMorsel(pool, workerThreadCount() - 1, matching_rows.size(), kScanMorselRows,
+                                             [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (matching_rows[i] < table.getRowCount()) {
+                    projected[i] = projectRow(matching_rows[i]);
+                }
+            }
+        });
+        for (size_t i = 0; i < projected.size(); ++i) {
+            if (matching_rows[i] < table.getRowCount()) {
+                result.addRow(std::move(projected[i]));
+            }
+        }
+        scan_plan += "Parallel projection: " + std::to_string(morselCount(matching_rows.size(), kScanMorselRows)) +
+                     " morsels on " + std::to_string(threads) + " threads\n";
+    } else {
+        for (size_t row_idx : matching_rows) {
+            if (row_idx < table.getRowCount()) {
+                result.addRow(projectRow(row_idx));
+            }
+        }
+    }
+    if (!has_aggregates) {
+        record(PlanNode::Kind::PROJECT, result.getRowCount());
     }
     
     // EN: Apply DISTINCT if needed
@@ -1775,220 +2662,788 @@ QueryResult QueryEngine::executeInternal(const SqlQuery& query) {
         for (const auto& row : unique_rows) {
             result.addRow(row);
         }
+        record(PlanNode::Kind::DISTINCT, result.getRowCount());
     }
     
-    // EN: Apply ORDER BY
-    // FR: Appliquer ORDER BY
-    if (!query.order_by.empty()) {
-        applySorting(result, query.order_by);
+    // EN: Apply ORDER BY and LIMIT / OFFSET; with both, a Top-K heap replaces the full sort
+    // FR: Appliquer ORDER BY et LIMIT / OFFSET ; avec les deux, un tas Top-K remplace le tri complet
+    if (!ordered_and_limited && !query.order_by.empty() && query.limit > 0) {
+        top_k_plan = "Top-K: " + std::to_string(query.offset + query.limit) + " of " +
+                     std::to_string(result.getRowCount()) + " rows\n";
+        applyTopK(result, query.order_by, query.limit, query.offset);
+        record(PlanNode::Kind::TOP_K, result.getRowCount());
+    } else if (!ordered_and_limited) {
+        if (!query.order_by.empty()) {
+            applySorting(result, query.order_by);
+            record(PlanNode::Kind::SORT, result.getRowCount());
+        }
+        if (query.limit > 0) {
+            result = applyLimitOffset(result, query.limit, query.offset);
+            record(PlanNode::Kind::LIMIT, result.getRowCount());
+        }
     }
     
-    // EN: Apply LIMIT and OFFSET
-    // FR: Appliquer LIMIT et OFFSET
-    if (query.limit > 0) {
-        result = applyLimitOffset(result, query.limit, query.offset);
-    }
+    QueryStatistics stats = result.getStatistics();
+    stats.rows_examined = rows_examined;
+    stats.blocks_skipped = blocks_skipped;
+    stats.indexes_used = indexes_used;
+    stats.index_hits = std::move(index_hits);
+    stats.execution_plan = join_plan + scan_plan + aggregate_plan + top_k_plan;
+    stats.plan_tree = std::make_shared<PlanNode>(plan.tree());
+    result.setStatistics(stats);
     
     return result;
 }
 
-bool QueryEngine::evaluateWhere(const std::vector<std::string>& row, const std::vector<std::string>& headers,
-                                const std::vector<WhereCondition>& conditions) const {
-    if (conditions.empty()) return true;
+namespace {
+
+const char* joinTypeName(JoinClause::Type type) {
+    switch (type) {
+        case JoinClause::LEFT:  return "LEFT";
+        case JoinClause::RIGHT: return "RIGHT";
+        case JoinClause::FULL:  return "FULL";
+        default:                return "INNER";
+    }
+}
+
+// EN: Column names of the tables joined so far, qualified ("table.column") and bare ("column")
+// FR: Noms des colonnes des tables jointes jusqu'ici, qualifiés ("table.colonne") et simples ("colonne")
+struct JoinColumns {
+    std::vector<std::string> qualified;
+    std::vector<std::string> bare;
     
-    bool result = true;
-    bool first = true;
+    void add(const std::string& table, const std::vector<std::string>& headers) {
+        for (const auto& header : headers) {
+            qualified.push_back(table + "." + header);
+            bare.push_back(header);
+        }
+    }
     
-    for (const auto& condition : conditions) {
-        // EN: Find column index
-        // FR: Trouver l'index de colonne
-        int col_idx = -1;
-        for (size_t i = 0; i < headers.size(); ++i) {
-            if (headers[i] == condition.column) {
-                col_idx = static_cast<int>(i);
-                break;
-            }
+    // EN: Qualified name, or a bare name held by exactly one column; -1 otherwise
+    // FR: Nom qualifié, ou nom simple porté par exactement une colonne ; -1 sinon
+    int resolve(const std::string& name) const {
+        auto it = std::find(qualified.begin(), qualified.end(), name);
+        if (it != qualified.end()) {
+            return static_cast<int>(it - qualified.begin());
+        }
+        if (std::count(bare.begin(), bare.end(), name) != 1) {
+            return -1;
+        }
+        return static_cast<int>(std::find(bare.begin(), bare.end(), name) - bare.begin());
+    }
+    
+    // EN: Output headers: bare when unambiguous, qualified otherwise
+    // FR: En-têtes de sortie : simples si non ambigus, qualifiés sinon
+    std::vector<std::string> displayNames() const {
+        std::vector<std::string> names;
+        for (size_t i = 0; i < bare.size(); ++i) {
+            names.push_back(std::count(bare.begin(), bare.end(), bare[i]) == 1 ? bare[i] : qualified[i]);
+        }
+        return names;
+    }
+};
+
+// EN: Resolve the ON columns, whichever order they were written in
+// FR: Résout les colonnes ON, quel que soit l'ordre dans lequel elles sont écrites
+bool resolveJoinKeys(const JoinClause& join, const JoinColumns& left, const JoinColumns& right,
+                     int& left_column, int& right_column) {
+    left_column = left.resolve(join.on_left);
+    right_column = right.resolve(join.on_right);
+    if (left_column < 0 || right_column < 0) {
+        left_column = left.resolve(join.on_right);
+        right_column = right.resolve(join.on_left);
+    }
+    return left_column >= 0 && right_column >= 0;
+}
+
+} // anonymous namespace
+
+QueryError QueryEngine::executeJoins(const SqlQuery& query, const QuerySources& sources,
+                                     std::shared_ptr<const ColumnarTable>& source,
+                                     std::string& plan, QueryPlan& operators) const {
+    std::ostringstream oss;
+    std::vector<PlanNode*> join_nodes;
+    for (auto& stage : operators.stages) {
+        if (stage.kind == PlanNode::Kind::HASH_JOIN) {
+            join_nodes.push_back(&stage);
         }
+    }
+    auto lap = std::chrono::steady_clock::now();
+    JoinColumns columns;
+    columns.add(query.table, source->getHeaders());
+    std::shared_ptr<const ColumnarTable> current = source;
+    
+    for (size_t j = 0; j < query.joins.size(); ++j) {
+        const JoinClause& join = query.joins[j];
+        if (!sources.joined[j]) {
+            return QueryError::EXECUTION_ERROR;
+        }
+        const ColumnarTable& right = *sources.joined[j];
         
-        if (col_idx < 0 || static_cast<size_t>(col_idx) >= row.size()) {
-            continue; // EN: Column not found / FR: Colonne non trouvée
+        JoinColumns right_columns;
+        right_columns.add(join.table, right.getHeaders());
+        int left_key = -1;
+        int right_key = -1;
+        if (!resolveJoinKeys(join, columns, right_columns, left_key, right_key)) {
+            return QueryError::COLUMN_NOT_FOUND;
         }
         
-        const std::string& value = row[col_idx];
-        bool condition_result = evaluateCondition(value, condition);
+        if (j < join_nodes.size() && !join_nodes[j]->inputs.empty()) {
+            join_nodes[j]->inputs.front().executed = true;
+            join_nodes[j]->inputs.front().actual_rows = right.getRowCount();
+        }
+        
+        HashJoin hash_join(join.type, config_.max_memory_mb * 1024 * 1024);
+        HashJoin::Pairs pairs;
+        QueryError error = hash_join.execute(*current, static_cast<size_t>(left_key),
+                                             right, static_cast<size_t>(right_key), pairs);
+        if (error != QueryError::SUCCESS) {
+            return error;
+        }
         
-        if (first) {
-            result = condition_result;
-            first = false;
+        oss << "Join: " << joinTypeName(join.type) << " " << join.table << " ON "
+            << columns.qualified[left_key] << " = " << right_columns.qualified[right_key]
+            << " (hash, build " << (hash_join.builtLeft() ? "left" : "right") << ", ";
+        if (hash_join.getPartitionCount() > 0) {
+            oss << "spilled " << QueryUtils::formatMemorySize(hash_join.getSpilledBytes()) << " in "
+                << hash_join.getPartitionCount() << " partitions";
         } else {
-            switch (condition.logical_op) {
-                case LogicalOperator::AND:
-                    result = result && condition_result;
-                    break;
-                case LogicalOperator::OR:
-                    result = result || condition_result;
-                    break;
-                case LogicalOperator::NOT:
-                    result = result && !condition_result;
-                    break;
+            oss << "in memory";
+        }
+        oss << ", " << pairs.left.size() << " rows)\n";
+        
+        // EN: Intermediate tables keep qualified headers; the last one gets the output names, qualified ones as aliases
+        // FR: Les tables intermédiaires gardent des en-têtes qualifiés ; la dernière reçoit les noms de sortie, les qualifiés en alias
+        columns.add(join.table, right.getHeaders());
+        const bool last = j + 1 == query.joins.size();
+        auto joined = materializeJoin(*current, right, pairs, last ? columns.displayNames() : columns.qualified,
+                                      config_.dictionary_limit);
+        if (last) {
+            for (size_t i = 0; i < columns.qualified.size(); ++i) {
+                joined->addColumnAlias(columns.qualified[i], i);
             }
         }
+        current = std::move(joined);
+        
+        if (j < join_nodes.size()) {
+            const auto now = std::chrono::steady_clock::now();
+            join_nodes[j]->executed = true;
+            join_nodes[j]->actual_rows = current->getRowCount();
+            join_nodes[j]->actual_ms = std::chrono::duration<double, std::milli>(now - lap).count();
+            lap = now;
+        }
     }
     
-    return result;
+    source = std::move(current);
+    plan = oss.str();
+    return QueryError::SUCCESS;
 }
 
-bool QueryEngine::evaluateCondition(const std::string& value, const WhereCondition& condition) const {
-    QueryValue query_value = QueryUtils::stringToQueryValue(value);
+QueryEngine::QuerySources QueryEngine::takeSources(const SqlQuery& query) const {
+    QuerySources sources;
+    auto table_it = tables_.find(query.table);
+    if (table_it == tables_.end()) {
+        return sources;
+    }
+    sources.table = table_it->second;
+    sources.registration = table_registrations_.at(query.table);
     
-    switch (condition.operator_) {
-        case SqlOperator::IN: {
-            for (const auto& in_value : condition.in_values) {
-                if (QueryUtils::compareValues(query_value, in_value, SqlOperator::EQUALS)) {
-                    return true;
+    std::vector<std::string> names{query.table};
+    for (const auto& join : query.joins) {
+        auto it = tables_.find(join.table);
+        sources.joined.push_back(it != tables_.end() ? it->second : nullptr);
+        names.push_back(join.table);
+    }
+    for (const auto& name : names) {
+        auto it = table_statistics_.find(name);
+        sources.statistics.push_back(it != table_statistics_.end() ? it->second : nullptr);
+    }
+    return sources;
+}
+
+QueryPlan QueryEngine::planQuery(const SqlQuery& query, const QuerySources& sources) {
+    using Kind = PlanNode::Kind;
+    QueryPlan plan;
+    if (!sources.table) {
+        return plan;
+    }
+    const ColumnarTable& table = *sources.table;
+    
+    // EN: Statistics of a column named "table.column", or by its bare name in the first queried table having it
+    // FR: Statistiques d'une colonne nommée "table.colonne", ou par son nom simple dans la première table
+    //     interrogée qui l'a
+    std::vector<const TableStatistics*> queried;
+    std::vector<std::string> queried_names{query.table};
+    for (const auto& join : query.joins) {
+        queried_names.push_back(join.table);
+    }
+    for (const auto& statistics : sources.statistics) {
+        queried.push_back(statistics.get());
+    }
+    auto lookup = [&](const std::string& column) -> const ColumnStatistics* {
+        const size_t dot = column.find('.');
+        for (size_t i = 0; dot != std::string::npos && i < queried.size(); ++i) {
+            if (queried[i] && column.compare(0, dot, queried_names[i]) == 0 && dot == queried_names[i].size()) {
+                if (const ColumnStatistics* stats = queried[i]->find(column.substr(dot + 1))) {
+                    return stats;
                 }
             }
-            return false;
         }
-        case SqlOperator::NOT_IN: {
-            for (const auto& in_value : condition.in_values) {
-                if (QueryUtils::compareValues(query_value, in_value, SqlOperator::EQUALS)) {
-                    return false;
-                }
+        for (const TableStatistics* stats : queried) {
+            if (const ColumnStatistics* found = stats ? stats->find(column) : nullptr) {
+                return found;
             }
-            return true;
         }
-        case SqlOperator::BETWEEN: {
-            return QueryUtils::compareValues(query_value, condition.range_start, SqlOperator::GREATER_EQUAL) &&
-                   QueryUtils::compareValues(query_value, condition.range_end, SqlOperator::LESS_EQUAL);
+        return nullptr;
+    };
+    
+    double rows = static_cast<double>(table.getRowCount());
+    if (query.joins.empty()) {
+        // EN: Access path: the scan reads the blocks the zone maps keep; an indexed equality of an AND-only
+        //     clause fetches its rows instead when the probe and re-check cost less
+        // FR: Chemin d'accès : le parcours lit les blocs gardés par les zone maps ; une égalité indexée d'une
+        //     clause faite de AND lit plutôt ses lignes quand la recherche et la revérification coûtent moins
+        const std::string scan_label = "Seq Scan on " + query.table;
+        if (query.where.empty()) {
+            plan.add(Kind::SCAN, scan_label, rows, rows * PlanCost::kScanRow);
+        } else {
+            const bool conjunctive = CompiledFilter(query.where, table).isConjunctive();
+            double scanned = rows;
+            plan.prunable = conjunctive;
+            if (conjunctive && query.parameters.empty()) {
+                plan.scan_ranges = pruneScanBlocks(query.table, sources.registration, table, query.where,
+                                                   plan.block_count, plan.blocks_skipped);
+                if (plan.block_count > 0) {
+                    scanned = 0.0;
+                    for (const auto& range : plan.scan_ranges) {
+                        scanned += static_cast<double>(range.second - range.first);
+                    }
+                }
+            }
+            double cost = scanned * PlanCost::kScanRow;
+            for (size_t i = 0; conjunctive && i < query.where.size(); ++i) {
+                const WhereCondition& condition = query.where[i];
+                if (condition.operator_ != SqlOperator::EQUALS ||
+                    !index_manager_.hasIndex(query.table, condition.column)) {
+                    continue;
+                }
+                const ColumnStatistics* column = lookup(condition.column);
+                const double fetched = rows * (column ? column->selectivity(condition)
+                                                      : ColumnStatistics::defaultSelectivity(condition));
+                const double index_cost = PlanCost::kIndexProbe + fetched * PlanCost::kIndexRow;
+                if (index_cost < cost) {
+                    cost = index_cost;
+                    plan.index_condition = static_cast<int>(i);
+                }
+            }
+            
+            const double matches = rows * clauseSelectivity(query.where, lookup);
+            if (plan.index_condition >= 0) {
+                const WhereCondition& condition = query.where[static_cast<size_t>(plan.index_condition)];
+                PlanNode& node = plan.add(Kind::INDEX_LOOKUP, "Index Lookup on " + query.table + " using " +
+                                          condition.column, matches, cost);
+                node.details.push_back("Index Cond: " + describeCondition(condition));
+                if (query.where.size() > 1) {
+                    node.details.push_back("Filter: " + describeWhere(query.where, plan.index_condition));
+                }
+            } else {
+                PlanNode& node = plan.add(Kind::SCAN, scan_label, matches, cost);
+                node.details.push_back("Filter: " + describeWhere(query.where));
+                if (plan.block_count > 0) {
+                    node.details.push_back(zoneMapDetail(plan.blocks_skipped, plan.block_count,
+                                                         config_.zone_map_block_rows));
+                }
+            }
+            rows = matches;
         }
-        default:
-            return QueryUtils::compareValues(query_value, condition.value, condition.operator_);
+    } else {
+        // EN: Joins run in the order written, which fixes the output columns; each one is estimated as
+        //     left x right / the larger key NDV, outer sides keeping at least all their rows
+        // FR: Les jointures s'exécutent dans l'ordre écrit, qui fixe les colonnes de sortie ; chacune est estimée
+        //     à gauche x droite / le plus grand NDV des clés, les côtés externes gardant au moins toutes leurs lignes
+        plan.add(Kind::SCAN, "Seq Scan on " + query.table, rows, rows * PlanCost::kScanRow);
+        JoinColumns columns;
+        columns.add(query.table, table.getHeaders());
+        for (size_t j = 0; j < query.joins.size(); ++j) {
+            const JoinClause& join = query.joins[j];
+            if (!sources.joined[j]) {
+                break;
+            }
+            const ColumnarTable& right_table = *sources.joined[j];
+            const double right_rows = static_cast<double>(right_table.getRowCount());
+            JoinColumns right_columns;
+            right_columns.add(join.table, right_table.getHeaders());
+            double distinct = 1.0;
+            int left_key = -1;
+            int right_key = -1;
+            if (resolveJoinKeys(join, columns, right_columns, left_key, right_key)) {
+                const ColumnStatistics* left_stats = lookup(columns.qualified[static_cast<size_t>(left_key)]);
+                const ColumnStatistics* right_stats = lookup(right_columns.qualified[static_cast<size_t>(right_key)]);
+                distinct = std::max({distinct, left_stats ? static_cast<double>(left_stats->getDistinctCount()) : 1.0,
+                                     right_stats ? static_cast<double>(right_stats->getDistinctCount()) : 1.0});
+            }
+            double joined = rows * right_rows / distinct;
+            if (join.type == JoinClause::LEFT || join.type == JoinClause::FULL) {
+                joined = std::max(joined, rows);
+            }
+            if (join.type == JoinClause::RIGHT || join.type == JoinClause::FULL) {
+                joined = std::max(joined, right_rows);
+            }
+            
+            std::string type = joinTypeName(join.type);
+            std::transform(type.begin(), type.end(), type.begin(), [](unsigned char c) { return std::tolower(c); });
+            PlanNode& node = plan.add(Kind::HASH_JOIN, "Hash Join (" + type + ")", joined,
+                                      right_rows * PlanCost::kScanRow + (rows + right_rows) * PlanCost::kHashRow);
+            node.details.push_back("Hash Cond: " + join.on_left + " = " + join.on_right);
+            PlanNode right;
+            right.label = "Seq Scan on " + join.table;
+            right.estimated_rows = right_rows;
+            right.estimated_cost = right_rows * PlanCost::kScanRow;
+            node.inputs.push_back(std::move(right));
+            
+            columns.add(join.table, right_table.getHeaders());
+            rows = joined;
+        }
+        if (!query.where.empty()) {
+            const double matches = rows * clauseSelectivity(query.where, lookup);
+            PlanNode& node = plan.add(Kind::FILTER, "Filter", matches, rows * PlanCost::kScanRow);
+            node.details.push_back("Filter: " + describeWhere(query.where));
+            rows = matches;
+        }
+    }
+    
+    const bool has_aggregates = !query.group_by.empty() ||
+        std::any_of(query.columns.begin(), query.columns.end(),
+                    [](const SelectColumn& col) { return col.aggregate != AggregateFunction::NONE; });
+    if (has_aggregates) {
+        double groups = 1.0;
+        std::string keys;
+        for (const auto& column : query.group_by) {
+            const ColumnStatistics* stats = lookup(column);
+            groups *= stats ? std::max<double>(1.0, static_cast<double>(stats->getDistinctCount())) : 10.0;
+            keys += (keys.empty() ? "" : ", ") + column;
+        }
+        groups = std::min(groups, std::max(rows, 1.0));
+        PlanNode& node = plan.add(Kind::AGGREGATE, query.group_by.empty() ? "Aggregate" : "Hash Aggregate", groups,
+                                  rows * PlanCost::kHashRow);
+        if (!keys.empty()) {
+            node.details.push_back("Group Key: " + keys);
+        }
+        rows = groups;
+    }
+    
+    std::string sort_keys;
+    for (const auto& key : query.order_by) {
+        sort_keys += (sort_keys.empty() ? "" : ", ") + key.column +
+                     (key.direction == SortDirection::DESC ? " DESC" : "");
+    }
+    auto addTopK = [&]() {
+        const double keep = static_cast<double>(query.offset + query.limit);
+        const double kept = std::min(rows, static_cast<double>(query.limit));
+        PlanNode& node = plan.add(Kind::TOP_K, "Top-K", kept, rows * std::log2(std::max(2.0, keep)) * PlanCost::kScanRow);
+        node.details.push_back("Sort Key: " + sort_keys + ", keep " + std::to_string(query.offset + query.limit));
+        rows = kept;
+    };
+    const bool top_k_first = !has_aggregates && !query.distinct_query && !query.order_by.empty() && query.limit > 0;
+    if (top_k_first) {
+        addTopK();
+    }
+    if (!has_aggregates) {
+        const bool select_all = query.columns.size() == 1 && query.columns[0].column == "*";
+        const double cells = static_cast<double>(select_all ? table.getColumnCount() : query.columns.size());
+        plan.add(Kind::PROJECT, "Project", rows, rows * cells * PlanCost::kProjectCell);
     }
-}
-
-QueryResult QueryEngine::applyAggregation(const QueryResult& intermediate_result, const SqlQuery& query) {
-    // EN: Simple aggregation implementation
-    // FR: Implémentation d'agrégation simple
-    std::vector<std::string> agg_headers;
-    std::vector<std::string> agg_row;
-    
-    for (const auto& col : query.columns) {
-        agg_headers.push_back(col.alias.empty() ? col.column : col.alias);
-        
-        if (col.aggregate != AggregateFunction::NONE) {
-            auto column_data = intermediate_result.getColumn(col.column);
-            std::string agg_result = calculateAggregate(column_data, col.aggregate);
-            agg_row.push_back(agg_result);
+    if (query.distinct_query) {
+        plan.add(Kind::DISTINCT, "Distinct", rows, rows * PlanCost::kHashRow);
+    }
+    if (!top_k_first && !query.order_by.empty()) {
+        if (query.limit > 0) {
+            addTopK();
         } else {
-            // EN: Non-aggregate column - take first value
-            // FR: Colonne non-agrégée - prendre la première valeur
-            auto column_data = intermediate_result.getColumn(col.column);
-            agg_row.push_back(column_data.empty() ? "" : column_data[0]);
+            PlanNode& node = plan.add(Kind::SORT, "Sort", rows, rows * std::log2(std::max(2.0, rows)) * PlanCost::kScanRow);
+            node.details.push_back("Sort Key: " + sort_keys);
+        }
+    } else if (query.order_by.empty() && query.limit > 0) {
+        PlanNode& node = plan.add(Kind::LIMIT, "Limit", std::min(rows, static_cast<double>(query.limit)), 0.0);
+        if (query.offset > 0) {
+            node.details.push_back("Offset: " + std::to_string(query.offset));
+        }
+    }
+    return plan;
+}
+
+QueryResult QueryEngine::executeStreaming(const SqlQuery& query, const std::string& csv_file) const {
+    const bool select_all = query.columns.size() == 1 && query.columns[0].column == "*";
+    const bool aggregate = !query.group_by.empty() ||
+        std::any_of(query.columns.begin(), query.columns.end(),
+                    [](const SelectColumn& col) { return col.aggregate != AggregateFunction::NONE; });
+    
+    // EN: Only the columns the query references are materialized by the parser
+    // FR: Seules les colonnes référencées par la requête sont matérialisées par le parser
+    CSV::ParserConfig parser_config;
+    parser_config.use_memory_mapping = true;
+    parser_config.trim_whitespace = false;
+    parser_config.batch_size = 16384;
+    if (!select_all) {
+        std::vector<std::string> referenced;
+        auto reference = [&referenced](const std::string& column) {
+            if (column != "*" && !column.empty() &&
+                std::find(referenced.begin(), referenced.end(), column) == referenced.end()) {
+                referenced.push_back(column);
+            }
+        };
+        for (const auto& col : query.columns) reference(col.column);
+        for (const auto& condition : query.where) reference(condition.column);
+        for (const auto& column : query.group_by) reference(column);
+        for (const auto& order : query.order_by) {
+            // EN: ORDER BY may name a select alias rather than a file column
+            // FR: ORDER BY peut nommer un alias de sélection plutôt qu'une colonne du fichier
+            if (std::none_of(query.columns.begin(), query.columns.end(),
+                             [&order](const SelectColumn& col) { return col.alias == order.column; })) {
+                reference(order.column);
+            }
+        }
+        parser_config.projected_columns = referenced;
+        if (referenced.empty()) {
+            parser_config.projected_column_indices = {0};   // EN: COUNT(*) alone still needs rows / FR: COUNT(*) seul a tout de même besoin des lignes
         }
     }
+    CSV::StreamingParser parser(parser_config);
     
-    QueryResult result(agg_headers);
-    result.addRow(agg_row);
-    
-    return result;
-}
-
-std::string QueryEngine::calculateAggregate(const std::vector<std::string>& values, AggregateFunction func) const {
-    if (values.empty()) return "";
-    
-    switch (func) {
-        case AggregateFunction::COUNT:
-            return std::to_string(values.size());
-            
-        case AggregateFunction::SUM: {
-            double sum = 0.0;
-            for (const auto& value : values) {
-                if (QueryUtils::isNumeric(value)) {
-                    sum += std::stod(value);
-                }
+    const size_t memory_budget = config_.max_memory_mb * 1024 * 1024;
+    const size_t wanted = query.limit > 0 ? query.offset + query.limit : 0;
+    std::vector<std::string> result_headers;
+    std::vector<size_t> projection;
+    std::unique_ptr<HashAggregation> aggregation;
+    if (aggregate) {
+        aggregation = std::make_unique<HashAggregation>(query.columns, query.group_by, memory_budget);
+    }
+    std::unique_ptr<ExternalSorter> sorter;
+    std::unique_ptr<RowTopK> top;
+    std::set<std::vector<std::string>> seen;
+    std::vector<std::vector<std::string>> collected;
+    std::vector<size_t> selected;
+    std::vector<std::string_view> fields;
+    size_t rows_examined = 0;
+    bool prepared = false;
+    bool failed = false;
+    
+    parser.setBatchCallback([&](const CSV::RowBatch& batch, CSV::ParserError /*error*/) {
+        // EN: Each batch becomes a small columnar chunk, so WHERE runs through the same compiled batch filter
+        //     as loaded tables
+        // FR: Chaque lot devient un petit bloc colonnaire, WHERE passe donc par le même filtre compilé par lots
+        //     que les tables chargées
+        ColumnarTable chunk(batch.getHeaders(), 0);
+        chunk.reserve(batch.getRowCount());
+        for (size_t row = 0; row < batch.getRowCount(); ++row) {
+            fields.clear();
+            for (size_t column = 0; column < batch.getFieldCount(row); ++column) {
+                fields.push_back(batch.getField(row, column));
             }
-            return std::to_string(sum);
+            chunk.appendRow(fields);
         }
+        rows_examined += chunk.getRowCount();
         
-        case AggregateFunction::AVG: {
-            double sum = 0.0;
-            size_t count = 0;
-            for (const auto& value : values) {
-                if (QueryUtils::isNumeric(value)) {
-                    sum += std::stod(value);
-                    count++;
+        if (!prepared) {
+            prepared = true;
+            if (select_all) {
+                result_headers = chunk.getHeaders();
+                for (size_t i = 0; i < chunk.getColumnCount(); ++i) {
+                    projection.push_back(i);
                 }
-            }
-            return count > 0 ? std::to_string(sum / count) : "0";
-        }
-        
-        case AggregateFunction::MIN: {
-            std::string min_val = values[0];
-            for (const auto& value : values) {
-                if (QueryUtils::isNumeric(value) && QueryUtils::isNumeric(min_val)) {
-                    if (std::stod(value) < std::stod(min_val)) min_val = value;
-                } else {
-                    if (value < min_val) min_val = value;
+            } else {
+                for (const auto& col : query.columns) {
+                    result_headers.push_back(col.alias.empty() ? col.column : col.alias);
+                    int col_idx = chunk.getColumnIndex(col.column);
+                    projection.push_back(col_idx >= 0 ? static_cast<size_t>(col_idx) : chunk.getColumnCount());
                 }
             }
-            return min_val;
-        }
-        
-        case AggregateFunction::MAX: {
-            std::string max_val = values[0];
-            for (const auto& value : values) {
-                if (QueryUtils::isNumeric(value) && QueryUtils::isNumeric(max_val)) {
-                    if (std::stod(value) > std::stod(max_val)) max_val = value;
+            if (!aggregate && !query.order_by.empty()) {
+                RowOrder order(result_headers, query.order_by);
+                if (!order.valid()) {
+                    failed = true;
+                    return false;
+                }
+                // EN: With a LIMIT only the first offset + limit rows are ever kept, no run is spilled
+                // FR: Avec un LIMIT seules les offset + limit premières lignes sont gardées, aucune séquence n'est débordée
+                if (wanted > 0) {
+                    top = std::make_unique<RowTopK>(std::move(order), wanted);
                 } else {
-                    if (value > max_val) max_val = value;
+                    sorter = std::make_unique<ExternalSorter>(std::move(order), memory_budget);
                 }
             }
-            return max_val;
         }
         
-        case AggregateFunction::DISTINCT: {
-            std::set<std::string> unique_values(values.begin(), values.end());
-            return std::to_string(unique_values.size());
+        selected.clear();
+        if (query.where.empty()) {
+            selected.resize(chunk.getRowCount());
+            std::iota(selected.begin(), selected.end(), 0);
+        } else {
+            CompiledFilter(query.where, chunk).selectRows(0, chunk.getRowCount(), selected);
         }
         
-        case AggregateFunction::GROUP_CONCAT: {
-            std::ostringstream oss;
-            for (size_t i = 0; i < values.size(); ++i) {
-                if (i > 0) oss << ",";
-                oss << values[i];
+        if (aggregation) {
+            if (aggregation->add(chunk, selected) != QueryError::SUCCESS) {
+                failed = true;
+                return false;
             }
-            return oss.str();
+            return true;
         }
         
-        default:
-            return "";
+        for (size_t row : selected) {
+            std::vector<std::string> out;
+            out.reserve(projection.size());
+            for (size_t col_idx : projection) {
+                out.emplace_back(chunk.getValue(row, col_idx));
+            }
+            if (query.distinct_query && !seen.insert(out).second) {
+                continue;
+            }
+            if (top) {
+                top->add(std::move(out));
+                continue;
+            }
+            if (sorter) {
+                if (sorter->add(std::move(out)) != QueryError::SUCCESS) {
+                    failed = true;
+                    return false;
+                }
+                continue;
+            }
+            collected.push_back(std::move(out));
+            if (wanted > 0 && collected.size() >= wanted) {
+                return false;   // EN: LIMIT reached, stop reading the file / FR: LIMIT atteint, arrêter la lecture du fichier
+            }
+        }
+        return true;
+    });
+    
+    CSV::ParserError parse_error = parser.parseFile(csv_file);
+    if (failed || (parse_error != CSV::ParserError::SUCCESS && parse_error != CSV::ParserError::CALLBACK_ERROR)) {
+        return QueryResult{};
+    }
+    if (!prepared && select_all) {
+        result_headers = parser.getHeaders();
+    } else if (!prepared) {
+        for (const auto& col : query.columns) {
+            result_headers.push_back(col.alias.empty() ? col.column : col.alias);
+        }
+    }
+    
+    QueryResult result(result_headers);
+    std::ostringstream plan;
+    plan << "Streaming scan: " << csv_file << " (" << rows_examined << " rows read)\n";
+    if (aggregation) {
+        std::vector<std::vector<std::string>> groups;
+        if (aggregation->finish(groups) != QueryError::SUCCESS) {
+            return QueryResult{};
+        }
+        for (auto& group : groups) {
+            result.addRow(std::move(group));
+        }
+        plan << "Hash aggregate: " << aggregation->getGroupCount() << " groups";
+        if (aggregation->getPartitionCount() > 0) {
+            plan << ", spilled " << QueryUtils::formatMemorySize(aggregation->getSpilledBytes()) << " over "
+                 << aggregation->getPartitionCount() << " partitions";
+        }
+        plan << "\n";
+        if (!query.order_by.empty()) {
+            applySorting(result, query.order_by);
+        }
+        if (query.limit > 0) {
+            result = applyLimitOffset(result, query.limit, query.offset);
+        }
+    } else if (top) {
+        plan << "Top-K: " << wanted << " of " << top->getRowCount() << " rows\n";
+        auto rows = top->take();
+        for (size_t i = query.offset; i < rows.size(); ++i) {
+            result.addRow(std::move(rows[i]));
+        }
+    } else if (sorter) {
+        // EN: Merged output is already in order: skip OFFSET rows, stop after LIMIT
+        // FR: La sortie fusionnée est déjà ordonnée : sauter OFFSET lignes, s'arrêter après LIMIT
+        size_t position = 0;
+        QueryError error = sorter->finish([&](std::vector<std::string>&& row) {
+            if (position++ >= query.offset) {
+                result.addRow(std::move(row));
+            }
+            return wanted == 0 || position < wanted;
+        });
+        if (error != QueryError::SUCCESS) {
+            return QueryResult{};
+        }
+        plan << "External sort: " << sorter->getRunCount() << " spilled runs ("
+             << QueryUtils::formatMemorySize(sorter->getSpilledBytes()) << ")\n";
+    } else {
+        for (size_t i = query.limit > 0 ? query.offset : 0; i < collected.size(); ++i) {
+            result.addRow(std::move(collected[i]));
+        }
+    }
+    
+    QueryStatistics stats;
+    stats.rows_examined = rows_examined;
+    stats.execution_plan = plan.str();
+    result.setStatistics(stats);
+    return result;
+}
+
+QueryResult QueryEngine::applyAggregation(const ColumnarTable& table, const std::vector<size_t>& rows,
+                                          const SqlQuery& query, std::string& plan) const {
+    std::vector<std::string> agg_headers;
+    for (const auto& col : query.columns) {
+        agg_headers.push_back(col.alias.empty() ? col.column : col.alias);
     }
+    
+    HashAggregation aggregation(query.columns, query.group_by, config_.max_memory_mb * 1024 * 1024, scanPool(),
+                                workerThreadCount() - 1);
+    std::vector<std::vector<std::string>> groups;
+    if (aggregation.add(table, rows) != QueryError::SUCCESS || aggregation.finish(groups) != QueryError::SUCCESS) {
+        return QueryResult{};
+    }
+    
+    QueryResult result(agg_headers);
+    for (auto& group : groups) {
+        result.addRow(std::move(group));
+    }
+    std::ostringstream oss;
+    oss << "Hash aggregate: " << aggregation.getGroupCount() << " groups, " << aggregation.getThreadCount()
+        << (aggregation.getThreadCount() == 1 ? " thread" : " threads");
+    if (aggregation.getPartitionCount() > 0) {
+        oss << ", spilled " << QueryUtils::formatMemorySize(aggregation.getSpilledBytes()) << " over "
+            << aggregation.getPartitionCount() << " partitions";
+    }
+    oss << "\n";
+    plan = oss.str();
+    return result;
+}
+
+std::vector<std::pair<size_t, size_t>> QueryEngine::pruneScanBlocks(const std::string& table_name,
+                                                                    uint64_t registration,
+                                                                    const ColumnarTable& table,
+                                                                    const std::vector<WhereCondition>& where,
+                                                                    size_t& block_count, size_t& blocks_skipped) {
+    block_count = 0;
+    blocks_skipped = 0;
+    const size_t block_rows = config_.zone_map_block_rows;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    if (block_rows == 0 || table.getRowCount() <= block_rows) {
+        ranges.emplace_back(0, table.getRowCount());
+        return ranges;
+    }
+    
+    // EN: Zone maps of the filtered columns, built once per table and column, then extended over appended rows.
+    //     A query still reading an older snapshot of the table uses maps that already cover later rows: their
+    //     bounds only widen, so pruning stays correct. Those of a replaced table are not reused.
+    // FR: Zone maps des colonnes filtrées, construites une fois par table et colonne, puis étendues aux lignes
+    //     ajoutées. Une requête lisant encore un instantané plus ancien de la table utilise des cartes qui couvrent
+    //     déjà des lignes suivantes : leurs bornes ne font que s'élargir, l'élagage reste donc correct. Celles
+    //     d'une table remplacée ne sont pas réutilisées.
+    std::lock_guard<std::mutex> lock(zone_map_mutex_);
+    auto& table_maps = zone_maps_[table_name];
+    if (table_maps.registration > registration) {
+        ranges.emplace_back(0, table.getRowCount());
+        return ranges;
+    }
+    if (table_maps.registration < registration) {
+        table_maps.registration = registration;
+        table_maps.columns.clear();
+    }
+    std::vector<std::pair<const ZoneMap*, const WhereCondition*>> bounds;
+    for (const auto& condition : where) {
+        const int column = table.getColumnIndex(condition.column);
+        if (column < 0 || !ZoneMap::canPrune(condition)) {
+            continue;
+        }
+        auto& zone_map = table_maps.columns[condition.column];
+        if (!zone_map || zone_map->getBlockRows() != block_rows) {
+            zone_map = std::make_unique<ZoneMap>(table, static_cast<size_t>(column), block_rows);
+        } else if (zone_map->getRowCount() < table.getRowCount()) {
+            zone_map->extend(table, static_cast<size_t>(column));
+        }
+        bounds.emplace_back(zone_map.get(), &condition);
+    }
+    if (bounds.empty()) {
+        ranges.emplace_back(0, table.getRowCount());
+        return ranges;
+    }
+    
+    block_count = (table.getRowCount() + block_rows - 1) / block_rows;
+    for (size_t block = 0; block < block_count; ++block) {
+        const bool keep = std::all_of(bounds.begin(), bounds.end(), [block](const auto& bound) {
+            return bound.first->mayMatch(block, *bound.second);
+        });
+        if (!keep) {
+            ++blocks_skipped;
+            continue;
+        }
+        const size_t begin = block * block_rows;
+        const size_t end = std::min(table.getRowCount(), begin + block_rows);
+        if (!ranges.empty() && ranges.back().second == begin) {
+            ranges.back().second = end;
+        } else {
+            ranges.emplace_back(begin, end);
+        }
+    }
+    return ranges;
+}
+
+size_t QueryEngine::workerThreadCount() const {
+    if (config_.worker_threads > 0) {
+        return config_.worker_threads;
+    }
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+ThreadPool* QueryEngine::scanPool() const {
+    const size_t helpers = workerThreadCount() - 1;
+    if (helpers == 0) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    if (!scan_pool_) {
+        ThreadPoolConfig pool_config;
+        pool_config.initial_threads = helpers;
+        pool_config.min_threads = helpers;
+        pool_config.max_threads = helpers;
+        pool_config.max_queue_size = 0;
+        pool_config.enable_auto_scaling = false;
+        scan_pool_ = std::make_unique<ThreadPool>(pool_config);
+    }
+    return scan_pool_.get();
+}
+
+std::string QueryEngine::calculateAggregate(const std::vector<std::string>& values, AggregateFunction func) const {
+    AggregateAccumulator accumulator(func);
+    for (const auto& value : values) {
+        accumulator.add(value);
+    }
+    return accumulator.result();
 }
 
 void QueryEngine::applySorting(QueryResult& result, const std::vector<OrderByColumn>& order_by) const {
     result.sortBy(order_by);
 }
 
-QueryResult QueryEngine::applyLimitOffset(const QueryResult& result, size_t limit, size_t offset) const {
-    return result.slice(offset, limit);
+void QueryEngine::applyTopK(QueryResult& result, const std::vector<OrderByColumn>& order_by,
+                            size_t limit, size_t offset) const {
+    RowOrder order(result.getHeaders(), order_by);
+    if (!order.valid()) {
+        applySorting(result, order_by);   // EN: Reports the unknown column / FR: Signale la colonne inconnue
+        return;
+    }
+    RowTopK top(std::move(order), offset + limit);
+    for (const auto& row : result.getRows()) {
+        top.add(row);
+    }
+    auto rows = top.take();
+    result.clear();
+    for (size_t i = offset; i < rows.size(); ++i) {
+        result.addRow(std::move(rows[i]));
+    }
 }
 
-std::vector<size_t> QueryEngine::optimizedRowSelection(const std::string& table, const std::vector<WhereCondition>& conditions) {
-    std::vector<size_t> result;
-    
-    // EN: Try to use indexes for optimization
-    // FR: Essayer d'utiliser les index pour l'optimisation
-    for (const auto& condition : conditions) {
-        if (index_manager_.hasIndex(table, condition.column)) {
-            if (condition.operator_ == SqlOperator::EQUALS) {
-                result = index_manager_.findRowsByIndex(table, condition.column, condition.value);
-                break; // EN: Use first indexed condition / FR: Utiliser la première condition indexée
-            }
-        }
-    }
-    
-    return result;
+QueryResult QueryEngine::applyLimitOffset(const QueryResult& result, size_t limit, size_t offset) const {
+    return result.slice(offset, limit);
 }
 
 void QueryEngine::updateStatistics(const QueryResult& result, std::chrono::milliseconds execution_time) const {
@@ -2003,28 +3458,61 @@ void QueryEngine::updateStatistics(const QueryResult& result, std::chrono::milli
     }
 }
 
-void QueryEngine::cleanupCache() {
-    // EN: Remove oldest entries from cache
-    // FR: Supprimer les entrées les plus anciennes du cache
-    auto oldest_time = std::chrono::system_clock::now();
-    std::string oldest_key;
+void QueryEngine::invalidateCachedResults(const std::string& table) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    ++cache_generation_;
+    query_cache_->invalidateTable(table);
+}
+
+std::vector<SourceSignature> QueryEngine::readSources(const SqlQuery& query) const {
+    std::lock_guard<std::mutex> lock(table_mutex_);
     
-    for (const auto& pair : cache_timestamps_) {
-        if (pair.second < oldest_time) {
-            oldest_time = pair.second;
-            oldest_key = pair.first;
-        }
+    std::vector<std::string> names{query.table};
+    for (const auto& join : query.joins) {
+        names.push_back(join.table);
     }
-    
-    if (!oldest_key.empty()) {
-        query_cache_.erase(oldest_key);
-        cache_timestamps_.erase(oldest_key);
+    std::vector<SourceSignature> sources;
+    for (const auto& name : names) {
+        auto attached_it = attached_tables_.find(name);
+        auto file_it = table_files_.find(name);
+        const std::string csv_file = attached_it != attached_tables_.end() ? attached_it->second
+                                   : file_it != table_files_.end()         ? file_it->second
+                                                                           : std::string();
+        sources.push_back(SourceSignature::read(name, csv_file));
     }
+    return sources;
+}
+
+void QueryEngine::clearQueryCache() {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    ++cache_generation_;
+    query_cache_->clear();
+}
+
+size_t QueryEngine::getQueryCacheSize() const {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return query_cache_->size();
 }
 
 QueryEngine::EngineStatistics QueryEngine::getStatistics() const {
+    size_t memory_usage = estimateMemoryUsage();
+    
     std::lock_guard<std::mutex> lock(stats_mutex_);
-    return statistics_;
+    EngineStatistics stats = statistics_;
+    stats.memory_usage_bytes = memory_usage;
+    return stats;
+}
+
+size_t QueryEngine::estimateMemoryUsage() const {
+    // EN: Table storage is counted once, the index manager shares it
+    // FR: Le stockage des tables est compté une fois, le gestionnaire d'index le partage
+    std::lock_guard<std::mutex> lock(table_mutex_);
+    
+    size_t bytes = 0;
+    for (const auto& pair : tables_) {
+        bytes += pair.second->getMemoryUsage();
+    }
+    return bytes;
 }
 
 std::string QueryEngine::explainQuery(const std::string& sql) {
@@ -2044,6 +3532,69 @@ std::string QueryEngine::explainQuery(const SqlQuery& query) {
     oss << "Query Execution Plan:\n";
     oss << "====================\n";
     oss << "Table: " << query.table << "\n";
+    {
+        std::lock_guard<std::mutex> lock(table_mutex_);
+        auto attached_it = attached_tables_.find(query.table);
+        if (attached_it != attached_tables_.end()) {
+            oss << "Scan: streaming " << attached_it->second << " (filter, projection and aggregation in the scan)\n";
+        }
+    }
+    
+    // EN: Joins: build side and spill decision from the input sizes; a joined input is estimated at the size of
+    //     its larger side
+    // FR: Jointures : côté construit et décision de débordement selon la taille des entrées ; une entrée jointe est
+    //     estimée à la taille de son plus grand côté
+    if (!query.joins.empty()) {
+        std::lock_guard<std::mutex> lock(table_mutex_);
+        auto base = tables_.find(query.table);
+        size_t left_rows = base != tables_.end() ? base->second->getRowCount() : 0;
+        JoinColumns columns;
+        if (base != tables_.end()) {
+            columns.add(query.table, base->second->getHeaders());
+        }
+        for (size_t j = 0; j < query.joins.size(); ++j) {
+            const JoinClause& join = query.joins[j];
+            oss << "JOIN: " << joinTypeName(join.type) << " " << join.table << " ON " << join.on_left << " = "
+                << join.on_right << "\n";
+            
+            auto it = tables_.find(join.table);
+            JoinColumns right_columns;
+            int left_key = -1;
+            int right_key = -1;
+            if (base == tables_.end() || it == tables_.end()) {
+                oss << "  - table not loaded\n";
+                break;
+            }
+            right_columns.add(join.table, it->second->getHeaders());
+            if (!resolveJoinKeys(join, columns, right_columns, left_key, right_key)) {
+                oss << "  - join column not found\n";
+                break;
+            }
+            
+            const size_t right_rows = it->second->getRowCount();
+            const bool build_left = HashJoin::buildOnLeft(left_rows, right_rows);
+            size_t build_bytes = 0;
+            if (!build_left) {
+                build_bytes = HashJoin::estimateBuildBytes(*it->second, static_cast<size_t>(right_key));
+            } else if (j == 0) {
+                build_bytes = HashJoin::estimateBuildBytes(*base->second, static_cast<size_t>(left_key));
+            } else {
+                build_bytes = left_rows * HashJoin::kEntryOverheadBytes;
+            }
+            const size_t partitions = HashJoin::partitionCount(build_bytes, config_.max_memory_mb * 1024 * 1024);
+            oss << "  - hash join, build " << (build_left ? "left" : "right") << " ("
+                << (build_left ? left_rows : right_rows) << " rows, ~" << QueryUtils::formatMemorySize(build_bytes)
+                << "), ";
+            if (partitions > 0) {
+                oss << "Grace spill over " << partitions << " partitions\n";
+            } else {
+                oss << "in memory\n";
+            }
+            
+            columns.add(join.table, it->second->getHeaders());
+            left_rows = std::max(left_rows, right_rows);
+        }
+    }
     oss << "Columns: ";
     for (size_t i = 0; i < query.columns.size(); ++i) {
         if (i > 0) oss << ", ";
@@ -2055,7 +3606,9 @@ std::string QueryEngine::explainQuery(const SqlQuery& query) {
         oss << "WHERE conditions: " << query.where.size() << "\n";
         for (const auto& condition : query.where) {
             oss << "  - " << condition.column << " (";
-            if (index_manager_.hasIndex(query.table, condition.column)) {
+            if (index_manager_.isIndexMapped(query.table, condition.column)) {
+                oss << "INDEXED, mapped from disk";
+            } else if (index_manager_.hasIndex(query.table, condition.column)) {
                 oss << "INDEXED";
             } else {
                 oss << "SCAN";
@@ -2064,8 +3617,26 @@ std::string QueryEngine::explainQuery(const SqlQuery& query) {
         }
     }
     
+    const bool has_aggregates = !query.group_by.empty() ||
+        std::any_of(query.columns.begin(), query.columns.end(),
+                    [](const SelectColumn& col) { return col.aggregate != AggregateFunction::NONE; });
+    if (has_aggregates) {
+        oss << "Aggregate: hash";
+        if (!query.group_by.empty()) {
+            oss << ", GROUP BY ";
+            for (size_t i = 0; i < query.group_by.size(); ++i) {
+                oss << (i > 0 ? ", " : "") << query.group_by[i];
+            }
+        }
+        oss << " (up to " << workerThreadCount() << " threads, spill past " << config_.max_memory_mb << " MB)\n";
+    }
+    
     if (!query.order_by.empty()) {
-        oss << "ORDER BY: " << query.order_by.size() << " column(s)\n";
+        oss << "ORDER BY: " << query.order_by.size() << " column(s)";
+        if (query.limit > 0) {
+            oss << ", Top-K heap of " << (query.offset + query.limit) << " rows";
+        }
+        oss << "\n";
     }
     
     if (query.limit > 0) {
@@ -2076,6 +3647,35 @@ std::string QueryEngine::explainQuery(const SqlQuery& query) {
         oss << "\n";
     }
     
+    // EN: Operator tree chosen by the cost-based planner, which also builds the zone maps a scan will need
+    // FR: Arbre d'opérateurs choisi par le planificateur par coût, qui construit aussi les zone maps dont un
+    //     parcours aura besoin
+    QuerySources sources;
+    {
+        std::lock_guard<std::mutex> lock(table_mutex_);
+        sources = takeSources(query);
+    }
+    if (sources.table) {
+        oss << "Plan:\n" << planQuery(query, sources).tree().render(false);
+    }
+    
+    return oss.str();
+}
+
+std::string QueryEngine::explainAnalyze(const std::string& sql) {
+    SqlQuery query;
+    if (parser_.parse(sql, query) != QueryError::SUCCESS) {
+        return "Parse Error: " + parser_.getLastError();
+    }
+    
+    const auto start = std::chrono::steady_clock::now();
+    const QueryResult result = executeInternal(query);
+    const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    const auto& stats = result.getStatistics();
+    std::ostringstream oss;
+    oss << (stats.plan_tree ? stats.plan_tree->render(true) : stats.execution_plan);
+    oss << "Execution time: " << std::fixed << std::setprecision(3) << elapsed << " ms\n";
     return oss.str();
 }
 
@@ -0,0 +1,414 @@
+// EN: Cost-based planning implementation: column statistics, selectivity estimates and plan rendering
+// FR: Implémentation de la planification par coût : statistiques de colonnes, estimations de sélectivité et
+//     rendu des plans
+
+#include "csv/query_planner.hpp"
+#include "csv/morsel_scan.hpp"
+#include "csv/query_predicate.hpp"
+#include "csv/zone_map.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+// EN: Fallback selectivities for what the statistics cannot bound
+// FR: Sélectivités par défaut pour ce que les statistiques ne savent pas borner
+constexpr double kPatternSelectivity = 0.1;     // EN: LIKE, REGEX / FR: LIKE, REGEX
+constexpr double kTextRangeSelectivity = 1.0 / 3.0;
+
+bool isNullCell(std::string_view cell) {
+    return cell == "NULL" || cell == "null";
+}
+
+bool numericConstant(const QueryValue& value, double& number) {
+    if (std::holds_alternative<int64_t>(value)) {
+        number = static_cast<double>(std::get<int64_t>(value));
+        return true;
+    }
+    if (std::holds_alternative<double>(value)) {
+        number = std::get<double>(value);
+        return true;
+    }
+    return std::holds_alternative<std::string>(value) && parseNumericCell(std::get<std::string>(value), number);
+}
+
+const char* operatorText(SqlOperator op) {
+    switch (op) {
+        case SqlOperator::EQUALS:        return "=";
+        case SqlOperator::NOT_EQUALS:    return "!=";
+        case SqlOperator::LESS_THAN:     return "<";
+        case SqlOperator::LESS_EQUAL:    return "<=";
+        case SqlOperator::GREATER_THAN:  return ">";
+        case SqlOperator::GREATER_EQUAL: return ">=";
+        case SqlOperator::LIKE:          return "LIKE";
+        case SqlOperator::NOT_LIKE:      return "NOT LIKE";
+        case SqlOperator::IN:            return "IN";
+        case SqlOperator::NOT_IN:        return "NOT IN";
+        case SqlOperator::IS_NULL:       return "IS NULL";
+        case SqlOperator::IS_NOT_NULL:   return "IS NOT NULL";
+        case SqlOperator::REGEX:         return "REGEX";
+        case SqlOperator::BETWEEN:       return "BETWEEN";
+    }
+    return "?";
+}
+
+std::string valueText(const QueryValue& value) {
+    if (std::holds_alternative<std::string>(value)) {
+        return "'" + std::get<std::string>(value) + "'";
+    }
+    if (std::holds_alternative<std::nullptr_t>(value)) {
+        return "NULL";
+    }
+    return QueryUtils::queryValueToString(value);
+}
+
+void renderNode(const PlanNode& node, bool analyze, size_t depth, std::ostringstream& out) {
+    const std::string indent(depth * 4, ' ');
+    out << indent << (depth > 0 ? "-> " : "") << node.label << "  (est. rows=" << std::llround(node.estimated_rows)
+        << " cost=" << std::llround(node.estimated_cost) << ")";
+    if (analyze) {
+        if (node.executed) {
+            out << " (actual rows=" << node.actual_rows << " time=" << std::fixed << std::setprecision(3)
+                << node.actual_ms << " ms)";
+            out.unsetf(std::ios::floatfield);
+        } else {
+            out << " (never executed)";
+        }
+    }
+    out << "\n";
+    for (const auto& detail : node.details) {
+        out << indent << (depth > 0 ? "     " : "  ") << detail << "\n";
+    }
+    for (const auto& input : node.inputs) {
+        renderNode(input, analyze, depth + 1, out);
+    }
+}
+
+} // anonymous namespace
+
+// EN: ColumnStatistics implementation
+// FR: Implémentation de ColumnStatistics
+
+ColumnStatistics ColumnStatistics::collect(const ColumnarTable& table, size_t column) {
+    ColumnStatistics stats;
+    stats.row_count_ = table.getRowCount();
+    const size_t stride = std::max<size_t>(1, stats.row_count_ / kHistogramSample);
+    std::vector<double> sample;
+    std::array<uint8_t, size_t{1} << kSketchBits> registers{};
+    double min = 0.0;
+    double max = 0.0;
+
+    for (size_t row = 0; row < stats.row_count_; ++row) {
+        std::string_view cell = table.getValue(row, column);
+        if (isNullCell(cell)) {
+            ++stats.null_count_;
+            continue;
+        }
+        double number = 0.0;
+        if (parseNumericCell(cell, number)) {
+            min = stats.numeric_count_ ? std::min(min, number) : number;
+            max = stats.numeric_count_ ? std::max(max, number) : number;
+            ++stats.numeric_count_;
+            if (row % stride == 0) {
+                sample.push_back(number);
+            }
+        }
+        if (!table.isDictionaryEncoded(column)) {
+            // EN: HyperLogLog: the top bits pick a register, which keeps the longest run of leading zeros seen
+            // FR: HyperLogLog : les bits de poids fort choisissent un registre, qui garde la plus longue suite de
+            //     zéros de tête vue
+            const uint64_t hash = BloomFilter::hash(cell);
+            const size_t index = hash >> (64 - kSketchBits);
+            const uint8_t rank = static_cast<uint8_t>(std::countl_zero((hash << kSketchBits) | 1) + 1);
+            registers[index] = std::max(registers[index], rank);
+        }
+    }
+
+    if (table.isDictionaryEncoded(column)) {
+        const auto& dictionary = table.getDictionary(column);
+        stats.distinct_count_ = static_cast<size_t>(std::count_if(dictionary.begin(), dictionary.end(),
+                                                                  [](std::string_view value) { return !isNullCell(value); }));
+    } else {
+        const double m = static_cast<double>(registers.size());
+        double sum = 0.0;
+        size_t zeros = 0;
+        for (uint8_t rank : registers) {
+            sum += std::ldexp(1.0, -rank);
+            zeros += rank == 0;
+        }
+        double estimate = 0.7213 / (1.0 + 1.079 / m) * m * m / sum;
+        if (estimate <= 2.5 * m && zeros > 0) {
+            estimate = m * std::log(m / static_cast<double>(zeros));
+        }
+        stats.distinct_count_ = std::min(stats.row_count_ - stats.null_count_,
+                                         static_cast<size_t>(std::llround(estimate)));
+    }
+    if (stats.row_count_ > stats.null_count_) {
+        stats.distinct_count_ = std::max<size_t>(1, stats.distinct_count_);
+    }
+
+    if (!sample.empty()) {
+        std::sort(sample.begin(), sample.end());
+        stats.bounds_.resize(kHistogramBuckets + 1);
+        for (size_t i = 0; i <= kHistogramBuckets; ++i) {
+            stats.bounds_[i] = sample[std::min(sample.size() - 1, i * sample.size() / kHistogramBuckets)];
+        }
+        stats.bounds_.front() = min;
+        stats.bounds_.back() = max;
+    }
+    return stats;
+}
+
+double ColumnStatistics::numericFractionBelow(double x, bool inclusive) const {
+    if (bounds_.empty()) {
+        return 0.0;
+    }
+    const size_t below = static_cast<size_t>(
+        (inclusive ? std::upper_bound(bounds_.begin(), bounds_.end(), x)
+                   : std::lower_bound(bounds_.begin(), bounds_.end(), x)) - bounds_.begin());
+    if (below == 0) {
+        return 0.0;
+    }
+    if (below == bounds_.size()) {
+        return 1.0;
+    }
+    const double low = bounds_[below - 1];
+    const double high = bounds_[below];
+    const double within = high > low ? (x - low) / (high - low) : 1.0;
+    return (static_cast<double>(below - 1) + within) / static_cast<double>(kHistogramBuckets);
+}
+
+double ColumnStatistics::equalsFraction(const QueryValue& value) const {
+    if (row_count_ == 0 || std::holds_alternative<std::nullptr_t>(value)) {
+        return 0.0;
+    }
+    const double non_null = static_cast<double>(row_count_ - null_count_) / static_cast<double>(row_count_);
+    if (std::holds_alternative<bool>(value)) {
+        return non_null / 2.0;
+    }
+    double number = 0.0;
+    if (numericConstant(value, number) && !bounds_.empty() && (number < bounds_.front() || number > bounds_.back()) &&
+        numeric_count_ == row_count_ - null_count_) {
+        return 0.0;
+    }
+    return distinct_count_ > 0 ? non_null / static_cast<double>(distinct_count_) : 0.0;
+}
+
+double ColumnStatistics::compareFraction(const QueryValue& value, SqlOperator op) const {
+    if (row_count_ == 0) {
+        return 0.0;
+    }
+    const double rows = static_cast<double>(row_count_);
+    const double text = static_cast<double>(row_count_ - null_count_ - numeric_count_);
+    double number = 0.0;
+    if (!numericConstant(value, number)) {
+        return static_cast<double>(row_count_ - null_count_) / rows * kTextRangeSelectivity;
+    }
+    double numeric = 0.0;
+    switch (op) {
+        case SqlOperator::LESS_THAN:     numeric = numericFractionBelow(number, false); break;
+        case SqlOperator::LESS_EQUAL:    numeric = numericFractionBelow(number, true); break;
+        case SqlOperator::GREATER_THAN:  numeric = 1.0 - numericFractionBelow(number, true); break;
+        default:                         numeric = 1.0 - numericFractionBelow(number, false); break;
+    }
+    return (static_cast<double>(numeric_count_) * numeric + text * kTextRangeSelectivity) / rows;
+}
+
+double ColumnStatistics::selectivity(const WhereCondition& condition) const {
+    if (row_count_ == 0) {
+        return 0.0;
+    }
+    const double null_fraction = static_cast<double>(null_count_) / static_cast<double>(row_count_);
+    double fraction = 1.0;
+    switch (condition.operator_) {
+        case SqlOperator::EQUALS:
+            fraction = equalsFraction(condition.value);
+            break;
+        case SqlOperator::NOT_EQUALS:
+            fraction = 1.0 - null_fraction - equalsFraction(condition.value);
+            break;
+        case SqlOperator::IN:
+        case SqlOperator::NOT_IN: {
+            double in = 0.0;
+            for (const auto& value : condition.in_values) {
+                in += equalsFraction(value);
+            }
+            in = std::min(in, 1.0 - null_fraction);
+            fraction = condition.operator_ == SqlOperator::IN ? in : 1.0 - null_fraction - in;
+            break;
+        }
+        case SqlOperator::LESS_THAN:
+        case SqlOperator::LESS_EQUAL:
+        case SqlOperator::GREATER_THAN:
+        case SqlOperator::GREATER_EQUAL:
+            fraction = compareFraction(condition.value, condition.operator_);
+            break;
+        case SqlOperator::BETWEEN: {
+            // EN: P(x >= low and x <= high) = P(x >= low) + P(x <= high) - P(non-null)
+            // FR: P(x >= bas et x <= haut) = P(x >= bas) + P(x <= haut) - P(non nul)
+            fraction = compareFraction(condition.range_start, SqlOperator::GREATER_EQUAL) +
+                       compareFraction(condition.range_end, SqlOperator::LESS_EQUAL) - (1.0 - null_fraction);
+            break;
+        }
+        case SqlOperator::IS_NULL:
+            fraction = null_fraction;
+            break;
+        case SqlOperator::IS_NOT_NULL:
+            fraction = 1.0 - null_fraction;
+            break;
+        case SqlOperator::LIKE:
+        case SqlOperator::REGEX:
+            fraction = (1.0 - null_fraction) * kPatternSelectivity;
+            break;
+        case SqlOperator::NOT_LIKE:
+            fraction = (1.0 - null_fraction) * (1.0 - kPatternSelectivity);
+            break;
+    }
+    return std::clamp(fraction, 0.0, 1.0);
+}
+
+double ColumnStatistics::defaultSelectivity(const WhereCondition& condition) {
+    switch (condition.operator_) {
+        case SqlOperator::EQUALS:      return 0.005;
+        case SqlOperator::IN:          return std::min(1.0, 0.005 * static_cast<double>(condition.in_values.size()));
+        case SqlOperator::IS_NULL:     return 0.01;
+        case SqlOperator::LIKE:
+        case SqlOperator::REGEX:       return kPatternSelectivity;
+        default:                       return kTextRangeSelectivity;
+    }
+}
+
+// EN: TableStatistics implementation
+// FR: Implémentation de TableStatistics
+
+std::shared_ptr<const TableStatistics> TableStatistics::collect(const ColumnarTable& table, ThreadPool* pool,
+                                                                size_t helpers) {
+    auto stats = std::make_shared<TableStatistics>();
+    stats->row_count_ = table.getRowCount();
+    stats->headers_ = table.getHeaders();
+    stats->columns_.resize(table.getColumnCount());
+    forEachMorsel(pool, helpers, table.getColumnCount(), 1, [&](size_t column, size_t, size_t) {
+        stats->columns_[column] = ColumnStatistics::collect(table, column);
+    });
+    return stats;
+}
+
+const ColumnStatistics* TableStatistics::find(const std::string& column) const {
+    auto it = std::find(headers_.begin(), headers_.end(), column);
+    return it != headers_.end() ? &columns_[static_cast<size_t>(it - headers_.begin())] : nullptr;
+}
+
+double TableStatistics::selectivity(const std::vector<WhereCondition>& where) const {
+    return clauseSelectivity(where, [this](const std::string& column) { return find(column); });
+}
+
+double clauseSelectivity(const std::vector<WhereCondition>& where,
+                         const std::function<const ColumnStatistics*(const std::string&)>& lookup) {
+    double fraction = 1.0;
+    for (size_t i = 0; i < where.size(); ++i) {
+        const ColumnStatistics* column = lookup(where[i].column);
+        const double condition = column ? column->selectivity(where[i]) : ColumnStatistics::defaultSelectivity(where[i]);
+        // EN: The parser stores each connector on the condition written before it
+        // FR: L'analyseur stocke chaque connecteur sur la condition écrite avant lui
+        if (i == 0) {
+            fraction = condition;
+        } else if (where[i - 1].logical_op == LogicalOperator::OR) {
+            fraction = fraction + condition - fraction * condition;
+        } else {
+            fraction *= condition;
+        }
+    }
+    return fraction;
+}
+
+// EN: PlanNode and QueryPlan implementation
+// FR: Implémentation de PlanNode et QueryPlan
+
+std::string PlanNode::render(bool analyze) const {
+    std::ostringstream out;
+    renderNode(*this, analyze, 0, out);
+    return out.str();
+}
+
+PlanNode* QueryPlan::find(PlanNode::Kind kind) {
+    for (auto& stage : stages) {
+        if (stage.kind == kind) {
+            return &stage;
+        }
+    }
+    return nullptr;
+}
+
+PlanNode& QueryPlan::add(PlanNode::Kind kind, std::string label, double rows, double cost) {
+    PlanNode node;
+    node.kind = kind;
+    node.label = std::move(label);
+    node.estimated_rows = rows;
+    node.estimated_cost = (stages.empty() ? 0.0 : stages.back().estimated_cost) + cost;
+    stages.push_back(std::move(node));
+    return stages.back();
+}
+
+PlanNode QueryPlan::tree() const {
+    PlanNode root;
+    for (size_t i = 0; i < stages.size(); ++i) {
+        PlanNode node = stages[i];
+        if (i > 0) {
+            node.inputs.insert(node.inputs.begin(), std::move(root));
+        }
+        root = std::move(node);
+    }
+    return root;
+}
+
+std::string describeCondition(const WhereCondition& condition) {
+    std::string text = condition.column + " " + operatorText(condition.operator_);
+    switch (condition.operator_) {
+        case SqlOperator::IS_NULL:
+        case SqlOperator::IS_NOT_NULL:
+            break;
+        case SqlOperator::BETWEEN:
+            text += " " + valueText(condition.range_start) + " AND " + valueText(condition.range_end);
+            break;
+        case SqlOperator::IN:
+        case SqlOperator::NOT_IN:
+            text += " (";
+            for (size_t i = 0; i < condition.in_values.size(); ++i) {
+                text += (i > 0 ? ", " : "") + valueText(condition.in_values[i]);
+            }
+            text += ")";
+            break;
+        case SqlOperator::LIKE:
+        case SqlOperator::NOT_LIKE:
+        case SqlOperator::REGEX:
+            text += " '" + condition.pattern + "'";
+            break;
+        default:
+            text += " " + valueText(condition.value);
+            break;
+    }
+    return text;
+}
+
+std::string describeWhere(const std::vector<WhereCondition>& where, int skip) {
+    std::string text;
+    for (size_t i = 0; i < where.size(); ++i) {
+        if (static_cast<int>(i) == skip) {
+            continue;
+        }
+        if (!text.empty()) {
+            text += where[i - 1].logical_op == LogicalOperator::OR ? " OR " : " AND ";
+        }
+        text += describeCondition(where[i]);
+    }
+    return text;
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,462 @@
+// EN: Compiled WHERE predicates implementation
+// FR: Implémentation des prédicats WHERE compilés
+
+#include "csv/query_predicate.hpp"
+#include "csv/field_conversion.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <regex>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+// EN: Comparison constant parsed once at compile time
+// FR: Constante de comparaison analysée une fois à la compilation
+struct Constant {
+    bool is_null{false};
+    std::string text;
+    bool has_number{false};
+    double number{0.0};
+    std::optional<bool> boolean;
+};
+
+Constant makeConstant(const QueryValue& value) {
+    Constant constant;
+    if (std::holds_alternative<std::nullptr_t>(value)) {
+        constant.is_null = true;
+        return constant;
+    }
+    constant.text = QueryUtils::queryValueToString(value);
+    if (std::holds_alternative<int64_t>(value)) {
+        constant.has_number = true;
+        constant.number = static_cast<double>(std::get<int64_t>(value));
+    } else if (std::holds_alternative<double>(value)) {
+        constant.has_number = true;
+        constant.number = std::get<double>(value);
+    } else if (std::holds_alternative<bool>(value)) {
+        constant.boolean = std::get<bool>(value);
+    } else {
+        constant.has_number = parseNumericCell(constant.text, constant.number);
+    }
+    return constant;
+}
+
+bool isNullCell(std::string_view cell) {
+    return cell == "NULL" || cell == "null";
+}
+
+// EN: Compare a non-null cell with a constant; numeric when both sides are numbers
+// FR: Compare une cellule non nulle à une constante ; numériquement quand les deux côtés sont des nombres
+bool compareCell(std::string_view cell, const Constant& constant, SqlOperator op) {
+    if (constant.is_null) {
+        return false;
+    }
+    if (constant.boolean) {
+        bool flag = false;
+        const bool equal = parseField(cell, flag) && flag == *constant.boolean;
+        return op == SqlOperator::EQUALS ? equal : (op == SqlOperator::NOT_EQUALS && !equal);
+    }
+
+    int order = 0;
+    double number = 0.0;
+    if (constant.has_number && parseNumericCell(cell, number)) {
+        order = number < constant.number ? -1 : (number > constant.number ? 1 : 0);
+    } else {
+        int compared = cell.compare(constant.text);
+        order = compared < 0 ? -1 : (compared > 0 ? 1 : 0);
+    }
+
+    switch (op) {
+        case SqlOperator::EQUALS:        return order == 0;
+        case SqlOperator::NOT_EQUALS:    return order != 0;
+        case SqlOperator::LESS_THAN:     return order < 0;
+        case SqlOperator::LESS_EQUAL:    return order <= 0;
+        case SqlOperator::GREATER_THAN:  return order > 0;
+        case SqlOperator::GREATER_EQUAL: return order >= 0;
+        default:                         return false;
+    }
+}
+
+bool isComparison(SqlOperator op) {
+    return op == SqlOperator::EQUALS || op == SqlOperator::NOT_EQUALS || op == SqlOperator::LESS_THAN ||
+           op == SqlOperator::LESS_EQUAL || op == SqlOperator::GREATER_THAN || op == SqlOperator::GREATER_EQUAL;
+}
+
+// EN: Tight compare loop over a contiguous buffer, left for the compiler to vectorize
+// FR: Boucle de comparaison serrée sur un buffer contigu, laissée au compilateur pour la vectorisation
+template<typename Compare>
+void compareBuffer(const double* values, size_t count, uint8_t* hits, Compare compare) {
+    for (size_t i = 0; i < count; ++i) {
+        hits[i] = compare(values[i]) ? 1 : 0;
+    }
+}
+
+void packMask(const uint8_t* hits, size_t count, CompiledPredicate::BatchMask& mask) {
+    mask.fill(0);
+    for (size_t i = 0; i < count; ++i) {
+        mask[i >> 6] |= static_cast<uint64_t>(hits[i]) << (i & 63);
+    }
+}
+
+} // anonymous namespace
+
+// EN: LikeMatcher implementation
+// FR: Implémentation de LikeMatcher
+
+LikeMatcher::LikeMatcher(std::string_view pattern) : shape_(Shape::WILDCARD), literal_(pattern) {
+    if (pattern.find('_') != std::string_view::npos) {
+        return;
+    }
+    size_t begin = pattern.find_first_not_of('%');
+    if (begin == std::string_view::npos) {
+        shape_ = pattern.empty() ? Shape::EXACT : Shape::ANY;
+        return;
+    }
+    size_t end = pattern.find_last_not_of('%') + 1;
+    std::string_view literal = pattern.substr(begin, end - begin);
+    if (literal.find('%') != std::string_view::npos) {
+        return;
+    }
+    const bool leading = begin > 0;
+    const bool trailing = end < pattern.size();
+    shape_ = leading ? (trailing ? Shape::CONTAINS : Shape::SUFFIX) : (trailing ? Shape::PREFIX : Shape::EXACT);
+    literal_ = std::string(literal);
+}
+
+bool LikeMatcher::matches(std::string_view text) const {
+    switch (shape_) {
+        case Shape::EXACT:
+            return text == literal_;
+        case Shape::PREFIX:
+            return text.size() >= literal_.size() && text.compare(0, literal_.size(), literal_) == 0;
+        case Shape::SUFFIX:
+            return text.size() >= literal_.size() &&
+                   text.compare(text.size() - literal_.size(), literal_.size(), literal_) == 0;
+        case Shape::CONTAINS:
+            return text.find(literal_) != std::string_view::npos;
+        case Shape::ANY:
+            return true;
+        case Shape::WILDCARD:
+            break;
+    }
+
+    // EN: Greedy match remembering the last '%': on a mismatch, let that '%' absorb one more character
+    // FR: Correspondance gloutonne retenant le dernier '%' : en cas d'échec, ce '%' absorbe un caractère de plus
+    const std::string& pattern = literal_;
+    size_t t = 0;
+    size_t p = 0;
+    size_t star = std::string::npos;
+    size_t mark = 0;
+    while (t < text.size()) {
+        if (p < pattern.size() && pattern[p] == '%') {
+            star = p++;
+            mark = t;
+        } else if (p < pattern.size() && (pattern[p] == '_' || pattern[p] == text[t])) {
+            ++p;
+            ++t;
+        } else if (star != std::string::npos) {
+            p = star + 1;
+            t = ++mark;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '%') {
+        ++p;
+    }
+    return p == pattern.size();
+}
+
+bool parseNumericCell(std::string_view text, double& value) noexcept {
+    size_t pos = (!text.empty() && text[0] == '-') ? 1 : 0;
+    bool has_dot = false;
+    bool has_digit = false;
+    for (size_t i = pos; i < text.size(); ++i) {
+        if (text[i] == '.' && !has_dot) {
+            has_dot = true;
+        } else if (text[i] >= '0' && text[i] <= '9') {
+            has_digit = true;
+        } else {
+            return false;
+        }
+    }
+    if (!has_digit) {
+        return false;
+    }
+    return parseFloatingPoint(text, value);
+}
+
+// EN: CompiledPredicate implementation
+// FR: Implémentation de CompiledPredicate
+
+CompiledPredicate::ValueTest CompiledPredicate::compileValueTest(const WhereCondition& condition) {
+    const SqlOperator op = condition.operator_;
+    switch (op) {
+        case SqlOperator::IS_NULL:
+            return [](std::string_view cell) { return isNullCell(cell); };
+        case SqlOperator::IS_NOT_NULL:
+            return [](std::string_view cell) { return !isNullCell(cell); };
+
+        case SqlOperator::IN:
+        case SqlOperator::NOT_IN: {
+            std::vector<Constant> constants;
+            for (const auto& value : condition.in_values) {
+                constants.push_back(makeConstant(value));
+            }
+            const bool negate = op == SqlOperator::NOT_IN;
+            return [constants = std::move(constants), negate](std::string_view cell) {
+                if (isNullCell(cell)) {
+                    return false;
+                }
+                for (const auto& constant : constants) {
+                    if (compareCell(cell, constant, SqlOperator::EQUALS)) {
+                        return !negate;
+                    }
+                }
+                return negate;
+            };
+        }
+
+        case SqlOperator::BETWEEN:
+            return [low = makeConstant(condition.range_start), high = makeConstant(condition.range_end)](std::string_view cell) {
+                return !isNullCell(cell) && compareCell(cell, low, SqlOperator::GREATER_EQUAL) &&
+                       compareCell(cell, high, SqlOperator::LESS_EQUAL);
+            };
+
+        case SqlOperator::LIKE:
+        case SqlOperator::NOT_LIKE: {
+            const bool negate = op == SqlOperator::NOT_LIKE;
+            return [matcher = LikeMatcher(condition.pattern), negate](std::string_view cell) {
+                return !isNullCell(cell) && matcher.matches(cell) != negate;
+            };
+        }
+
+        case SqlOperator::REGEX: {
+            // EN: Built once per query; an invalid expression matches nothing
+            // FR: Construite une fois par requête ; une expression invalide ne correspond à rien
+            std::shared_ptr<const std::regex> regex;
+            try {
+                regex = std::make_shared<const std::regex>(condition.pattern, std::regex::ECMAScript | std::regex::optimize);
+            } catch (const std::regex_error&) {
+                return [](std::string_view) { return false; };
+            }
+            return [regex](std::string_view cell) {
+                return !isNullCell(cell) && std::regex_search(cell.begin(), cell.end(), *regex);
+            };
+        }
+
+        default:
+            return [constant = makeConstant(condition.value), op](std::string_view cell) {
+                return !isNullCell(cell) && compareCell(cell, constant, op);
+            };
+    }
+}
+
+std::optional<CompiledPredicate> CompiledPredicate::compile(const WhereCondition& condition, const ColumnarTable& table) {
+    int column = table.getColumnIndex(condition.column);
+    if (column < 0) {
+        return std::nullopt;
+    }
+
+    CompiledPredicate predicate;
+    predicate.column_ = static_cast<size_t>(column);
+    predicate.test_ = compileValueTest(condition);
+
+    if (table.isDictionaryEncoded(predicate.column_)) {
+        // EN: One evaluation per distinct value instead of one per row
+        // FR: Une évaluation par valeur distincte au lieu d'une par ligne
+        const auto& dictionary = table.getDictionary(predicate.column_);
+        predicate.dictionary_matches_.reserve(dictionary.size());
+        for (std::string_view value : dictionary) {
+            predicate.dictionary_matches_.push_back(predicate.test_(value) ? 1 : 0);
+        }
+        predicate.codes_ = &table.getCodes(predicate.column_);
+        predicate.kernel_ = Kernel::DICTIONARY;
+    } else if (isComparison(condition.operator_)) {
+        Constant constant = makeConstant(condition.value);
+        if (!constant.is_null && !constant.boolean) {
+            if (constant.has_number) {
+                predicate.kernel_ = Kernel::NUMERIC;
+                predicate.op_ = condition.operator_;
+                predicate.low_ = constant.number;
+            } else if ((condition.operator_ == SqlOperator::EQUALS || condition.operator_ == SqlOperator::NOT_EQUALS) &&
+                       !isNullCell(constant.text)) {
+                predicate.kernel_ = condition.operator_ == SqlOperator::EQUALS ? Kernel::TEXT_EQUALS : Kernel::TEXT_NOT_EQUALS;
+                predicate.text_ = constant.text;
+            }
+        }
+    } else if (condition.operator_ == SqlOperator::BETWEEN) {
+        Constant low = makeConstant(condition.range_start);
+        Constant high = makeConstant(condition.range_end);
+        if (low.has_number && high.has_number) {
+            predicate.kernel_ = Kernel::NUMERIC_RANGE;
+            predicate.low_ = low.number;
+            predicate.high_ = high.number;
+        }
+    }
+    return predicate;
+}
+
+void CompiledPredicate::evaluateBatch(const ColumnarTable& table, size_t begin, size_t count, BatchMask& mask) const {
+    uint8_t hits[kBatchSize];
+
+    if (kernel_ == Kernel::DICTIONARY) {
+        // EN: Gather the precomputed answer of each row's dictionary code
+        // FR: Récupère la réponse précalculée du code de dictionnaire de chaque ligne
+        const ColumnarTable::DictionaryCode* codes = codes_->data() + begin;
+        const uint8_t* answers = dictionary_matches_.data();
+        for (size_t i = 0; i < count; ++i) {
+            hits[i] = answers[codes[i]];
+        }
+        packMask(hits, count, mask);
+        return;
+    }
+
+    const std::string_view* cells = table.getValues(column_).data() + begin;
+    switch (kernel_) {
+        case Kernel::NUMERIC:
+        case Kernel::NUMERIC_RANGE: {
+            // EN: Pull the batch into a contiguous double buffer, compare it in one pass, then settle the
+            //     non-numeric cells (text order or NULL) with the generic test
+            // FR: Charge le lot dans un buffer contigu de doubles, le compare en une passe, puis règle les
+            //     cellules non numériques (ordre textuel ou NULL) avec le test générique
+            double values[kBatchSize];
+            uint8_t numeric[kBatchSize];
+            for (size_t i = 0; i < count; ++i) {
+                values[i] = 0.0;
+                numeric[i] = parseNumericCell(cells[i], values[i]) ? 1 : 0;
+            }
+            const double low = low_;
+            const double high = high_;
+            if (kernel_ == Kernel::NUMERIC_RANGE) {
+                compareBuffer(values, count, hits, [low, high](double v) { return (v >= low) & (v <= high); });
+            } else {
+                switch (op_) {
+                    case SqlOperator::EQUALS:        compareBuffer(values, count, hits, [low](double v) { return v == low; }); break;
+                    case SqlOperator::NOT_EQUALS:    compareBuffer(values, count, hits, [low](double v) { return v != low; }); break;
+                    case SqlOperator::LESS_THAN:     compareBuffer(values, count, hits, [low](double v) { return v < low; }); break;
+                    case SqlOperator::LESS_EQUAL:    compareBuffer(values, count, hits, [low](double v) { return v <= low; }); break;
+                    case SqlOperator::GREATER_THAN:  compareBuffer(values, count, hits, [low](double v) { return v > low; }); break;
+                    default:                         compareBuffer(values, count, hits, [low](double v) { return v >= low; }); break;
+                }
+            }
+            for (size_t i = 0; i < count; ++i) {
+                if (!numeric[i]) {
+                    hits[i] = test_(cells[i]) ? 1 : 0;
+                }
+            }
+            break;
+        }
+        case Kernel::TEXT_EQUALS:
+        case Kernel::TEXT_NOT_EQUALS: {
+            // EN: Length check first, memcmp only on candidates of the right size
+            // FR: Test de longueur d'abord, memcmp seulement sur les candidats de la bonne taille
+            const bool negate = kernel_ == Kernel::TEXT_NOT_EQUALS;
+            const size_t size = text_.size();
+            for (size_t i = 0; i < count; ++i) {
+                const std::string_view cell = cells[i];
+                const bool equal = cell.size() == size && (size == 0 || std::memcmp(cell.data(), text_.data(), size) == 0);
+                hits[i] = (negate ? !equal && !isNullCell(cell) : equal) ? 1 : 0;
+            }
+            break;
+        }
+        default:
+            for (size_t i = 0; i < count; ++i) {
+                hits[i] = test_(cells[i]) ? 1 : 0;
+            }
+            break;
+    }
+    packMask(hits, count, mask);
+}
+
+// EN: CompiledFilter implementation
+// FR: Implémentation de CompiledFilter
+
+CompiledFilter::CompiledFilter(const std::vector<WhereCondition>& conditions, const ColumnarTable& table)
+    : table_(table) {
+    for (size_t i = 0; i < conditions.size(); ++i) {
+        auto predicate = CompiledPredicate::compile(conditions[i], table);
+        if (!predicate) {
+            continue;
+        }
+        // EN: The parser stores each connector on the condition written before it
+        // FR: L'analyseur stocke chaque connecteur sur la condition écrite avant lui
+        LogicalOperator connector = i > 0 ? conditions[i - 1].logical_op : LogicalOperator::AND;
+        if (!predicates_.empty() && connector != LogicalOperator::AND) {
+            conjunctive_ = false;
+        }
+        predicates_.push_back(std::move(*predicate));
+        connectors_.push_back(connector);
+    }
+}
+
+void CompiledFilter::selectRows(size_t begin, size_t end, std::vector<size_t>& rows) const {
+    if (predicates_.empty()) {
+        for (size_t row = begin; row < end; ++row) {
+            rows.push_back(row);
+        }
+        return;
+    }
+
+    CompiledPredicate::BatchMask selected;
+    CompiledPredicate::BatchMask mask;
+    for (size_t batch = begin; batch < end; batch += CompiledPredicate::kBatchSize) {
+        const size_t count = std::min(CompiledPredicate::kBatchSize, end - batch);
+        predicates_[0].evaluateBatch(table_, batch, count, selected);
+
+        for (size_t i = 1; i < predicates_.size(); ++i) {
+            const LogicalOperator connector = connectors_[i];
+            if (connector != LogicalOperator::OR &&
+                std::all_of(selected.begin(), selected.end(), [](uint64_t word) { return word == 0; })) {
+                continue;
+            }
+            predicates_[i].evaluateBatch(table_, batch, count, mask);
+            for (size_t w = 0; w < selected.size(); ++w) {
+                switch (connector) {
+                    case LogicalOperator::AND: selected[w] &= mask[w]; break;
+                    case LogicalOperator::OR:  selected[w] |= mask[w]; break;
+                    case LogicalOperator::NOT: selected[w] &= ~mask[w]; break;
+                }
+            }
+        }
+
+        // EN: Set bits become the selection vector
+        // FR: Les bits à un forment le vecteur de sélection
+        for (size_t w = 0; w < selected.size(); ++w) {
+            uint64_t bits = selected[w];
+            while (bits != 0) {
+                rows.push_back(batch + w * 64 + static_cast<size_t>(std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+}
+
+bool CompiledFilter::matches(size_t row) const {
+    if (predicates_.empty()) {
+        return true;
+    }
+
+    bool result = predicates_[0].matches(table_, row);
+    for (size_t i = 1; i < predicates_.size(); ++i) {
+        switch (connectors_[i]) {
+            case LogicalOperator::AND:
+                result = result && predicates_[i].matches(table_, row);
+                break;
+            case LogicalOperator::OR:
+                result = result || predicates_[i].matches(table_, row);
+                break;
+            case LogicalOperator::NOT:
+                result = result && !predicates_[i].matches(table_, row);
+                break;
+        }
+    }
+    return result;
+}
+
+} // namespace CSV
+} // namespace BBP
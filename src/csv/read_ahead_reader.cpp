@@ -0,0 +1,169 @@
+// EN: Asynchronous read-ahead implementation (POSIX pread on a background thread, ring of buffers)
+// FR: Implémentation de la lecture anticipée asynchrone (pread POSIX sur un thread d'arrière-plan, anneau de buffers)
+
+#include "csv/read_ahead_reader.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace BBP {
+namespace CSV {
+
+ReadAheadReader::ReadAheadReader(size_t buffer_count, size_t buffer_size)
+    : buffer_size_(std::max(buffer_size, kMinBufferSize))
+    , buffers_(std::max(buffer_count, kMinBufferCount)) {
+}
+
+ReadAheadReader::~ReadAheadReader() {
+    close();
+}
+
+bool ReadAheadReader::open(const std::string& file_path) {
+    close();
+
+    int fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        last_error_ = "open failed: " + std::string(std::strerror(errno));
+        return false;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    // EN: Let the kernel read ahead aggressively too; failure is harmless
+    // FR: Laisse aussi le noyau lire en avance agressivement ; un échec est sans conséquence
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    for (auto& buffer : buffers_) {
+        if (!buffer.data) {
+            buffer.data = std::make_unique<char[]>(buffer_size_);
+        }
+        buffer.size = 0;
+    }
+    produced_ = 0;
+    consumed_ = 0;
+    holding_ = false;
+    finished_ = false;
+    stop_requested_ = false;
+    last_error_.clear();
+    bytes_read_ = 0;
+    stall_count_ = 0;
+
+    reader_thread_ = std::thread(&ReadAheadReader::readWorker, this, fd);
+    is_open_ = true;
+    return true;
+}
+
+void ReadAheadReader::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_ = true;
+    }
+    buffer_free_.notify_all();
+    if (reader_thread_.joinable()) {
+        reader_thread_.join();
+    }
+    is_open_ = false;
+}
+
+bool ReadAheadReader::next(const char*& data, size_t& size) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (holding_) {
+        // EN: Hand the previous buffer back to the reader
+        // FR: Rend le buffer précédent au lecteur
+        ++consumed_;
+        holding_ = false;
+        buffer_free_.notify_one();
+    }
+
+    if (produced_ == consumed_ && !finished_) {
+        stall_count_.fetch_add(1, std::memory_order_relaxed);
+        buffer_ready_.wait(lock, [this] { return produced_ > consumed_ || finished_; });
+    }
+    if (produced_ == consumed_) {
+        return false;
+    }
+
+    const Buffer& buffer = buffers_[consumed_ % buffers_.size()];
+    data = buffer.data.get();
+    size = buffer.size;
+    holding_ = true;
+    return true;
+}
+
+bool ReadAheadReader::hasError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !last_error_.empty();
+}
+
+std::string ReadAheadReader::getLastError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return last_error_;
+}
+
+void ReadAheadReader::readWorker(int fd) {
+    // EN: Fill every buffer the consumer does not hold, in file order, until end of file
+    // FR: Remplit chaque buffer que le consommateur ne détient pas, dans l'ordre du fichier, jusqu'à la fin
+    std::string error;
+    off_t offset = 0;
+    while (true) {
+        Buffer* buffer = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            buffer_free_.wait(lock, [this] { return stop_requested_ || produced_ - consumed_ < buffers_.size(); });
+            if (stop_requested_) {
+                break;
+            }
+            buffer = &buffers_[produced_ % buffers_.size()];
+        }
+
+        // EN: Fill the whole buffer unless the file ends; short reads are retried
+        // FR: Remplit tout le buffer sauf en fin de fichier ; les lectures partielles sont relancées
+        size_t filled = 0;
+        while (filled < buffer_size_) {
+            ssize_t count = ::pread(fd, buffer->data.get() + filled, buffer_size_ - filled, offset);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                error = "read failed: " + std::string(std::strerror(errno));
+                break;
+            }
+            if (count == 0) {
+                break;
+            }
+            filled += static_cast<size_t>(count);
+            offset += count;
+        }
+
+        if (filled > 0) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                buffer->size = filled;
+                ++produced_;
+            }
+            bytes_read_.fetch_add(filled, std::memory_order_relaxed);
+            buffer_ready_.notify_one();
+        }
+        if (!error.empty() || filled < buffer_size_) {
+            break;
+        }
+    }
+
+    ::close(fd);
+    finish(error);
+}
+
+void ReadAheadReader::finish(const std::string& error) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+        if (!error.empty()) {
+            last_error_ = error;
+        }
+    }
+    buffer_ready_.notify_all();
+}
+
+} // namespace CSV
+} // namespace BBP
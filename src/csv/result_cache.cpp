@@ -0,0 +1,128 @@
+// EN: Query result cache implementation
+// FR: Implémentation du cache de résultats de requêtes
+
+#include "csv/result_cache.hpp"
+#include <algorithm>
+#include <filesystem>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+// EN: Characters a std::string holds without allocating (short string optimization of libstdc++)
+// FR: Caractères qu'un std::string tient sans allouer (optimisation des chaînes courtes de libstdc++)
+constexpr size_t kInlineChars = 15;
+
+} // anonymous namespace
+
+// EN: SourceSignature implementation
+// FR: Implémentation de SourceSignature
+
+SourceSignature SourceSignature::read(const std::string& table, const std::string& csv_file) {
+    SourceSignature signature;
+    signature.table = table;
+    signature.csv_file = csv_file;
+    if (csv_file.empty()) {
+        return signature;
+    }
+    std::error_code error;
+    const uint64_t size = std::filesystem::file_size(csv_file, error);
+    if (error) {
+        return signature;
+    }
+    const auto write_time = std::filesystem::last_write_time(csv_file, error);
+    if (error) {
+        return signature;
+    }
+    signature.size = size;
+    signature.mtime = static_cast<int64_t>(write_time.time_since_epoch().count());
+    return signature;
+}
+
+bool SourceSignature::isCurrent() const {
+    if (csv_file.empty()) {
+        return true;
+    }
+    const SourceSignature now = read(table, csv_file);
+    return now.size == size && now.mtime == mtime;
+}
+
+// EN: ResultCache implementation
+// FR: Implémentation de ResultCache
+
+ResultCache::ResultCache(size_t max_bytes, size_t max_entries) : max_bytes_(max_bytes), max_entries_(max_entries) {}
+
+std::shared_ptr<const QueryResult> ResultCache::find(const std::string& key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return nullptr;
+    }
+    const auto& sources = it->second->sources;
+    if (!std::all_of(sources.begin(), sources.end(), [](const SourceSignature& source) { return source.isCurrent(); })) {
+        erase(it->second);
+        return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return entries_.front().result;
+}
+
+void ResultCache::insert(const std::string& key, std::shared_ptr<const QueryResult> result,
+                         std::vector<SourceSignature> sources) {
+    auto existing = index_.find(key);
+    if (existing != index_.end()) {
+        erase(existing->second);
+    }
+    const size_t bytes = estimateBytes(*result) + key.size() + sizeof(Entry);
+    if (bytes > max_bytes_ || max_entries_ == 0) {
+        return;
+    }
+    while (!entries_.empty() && (bytes_ + bytes > max_bytes_ || entries_.size() >= max_entries_)) {
+        erase(std::prev(entries_.end()));
+    }
+    entries_.push_front(Entry{key, std::move(result), std::move(sources), bytes});
+    index_[key] = entries_.begin();
+    bytes_ += bytes;
+}
+
+void ResultCache::invalidateTable(const std::string& table) {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        auto next = std::next(it);
+        if (std::any_of(it->sources.begin(), it->sources.end(),
+                        [&table](const SourceSignature& source) { return source.table == table; })) {
+            erase(it);
+        }
+        it = next;
+    }
+}
+
+void ResultCache::clear() {
+    entries_.clear();
+    index_.clear();
+    bytes_ = 0;
+}
+
+size_t ResultCache::estimateBytes(const QueryResult& result) {
+    size_t bytes = sizeof(QueryResult);
+    for (const auto& header : result.getHeaders()) {
+        bytes += sizeof(std::string) + header.capacity();
+    }
+    for (const auto& row : result.getRows()) {
+        bytes += sizeof(row) + row.capacity() * sizeof(std::string);
+        for (const auto& cell : row) {
+            if (cell.capacity() > kInlineChars) {
+                bytes += cell.capacity() + 1;
+            }
+        }
+    }
+    return bytes;
+}
+
+void ResultCache::erase(std::list<Entry>::iterator it) {
+    bytes_ -= it->bytes;
+    index_.erase(it->key);
+    entries_.erase(it);
+}
+
+} // namespace CSV
+} // namespace BBP
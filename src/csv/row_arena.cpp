@@ -0,0 +1,56 @@
+// EN: Row arena and counting memory resource implementation
+// FR: Implémentation de l'arène de lignes et de la ressource mémoire comptée
+
+#include "csv/row_arena.hpp"
+
+namespace BBP {
+namespace CSV {
+
+// EN: CountingMemoryResource implementation
+// FR: Implémentation de CountingMemoryResource
+
+void CountingMemoryResource::resetCounters() {
+    allocation_count_.store(0, std::memory_order_relaxed);
+    bytes_allocated_.store(0, std::memory_order_relaxed);
+}
+
+void* CountingMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+    void* pointer = upstream_->allocate(bytes, alignment);
+    allocation_count_.fetch_add(1, std::memory_order_relaxed);
+    bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+    return pointer;
+}
+
+void CountingMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+    upstream_->deallocate(pointer, bytes, alignment);
+}
+
+// EN: RowArena implementation
+// FR: Implémentation de RowArena
+
+RowArena::RowArena(size_t arena_size) : block_size_(arena_size) {
+    if (block_size_ > 0) {
+        // EN: The initial block goes through the counted heap too, so the statistics show its single allocation
+        // FR: Le bloc initial passe aussi par le tas compté, les statistiques montrent donc son allocation unique
+        block_ = heap_.allocate(block_size_, alignof(std::max_align_t));
+        arena_.emplace(block_, block_size_, &heap_);
+    }
+}
+
+RowArena::~RowArena() {
+    arena_.reset();
+    if (block_ != nullptr) {
+        heap_.deallocate(block_, block_size_, alignof(std::max_align_t));
+    }
+}
+
+void RowArena::rewind() {
+    // EN: release() frees the overflow blocks, if any, and restarts from the initial block
+    // FR: release() libère les blocs de débordement éventuels et repart du bloc initial
+    if (arena_) {
+        arena_->release();
+    }
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,217 @@
+// EN: Sparse byte-offset row index implementation (varint delta encoding, size/mtime validation)
+// FR: Implémentation de l'index creux des offsets de lignes (encodage delta varint, validation taille/mtime)
+
+#include "csv/row_index.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+constexpr char kMagic[8] = {'B', 'B', 'P', 'R', 'I', 'D', 'X', '1'};
+
+// EN: LEB128 varint: 7 bits per byte, high bit set on every byte but the last
+// FR: Varint LEB128 : 7 bits par octet, bit de poids fort positionné sur chaque octet sauf le dernier
+void putVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+bool getVarint(const std::string& in, size_t& pos, uint64_t& value) {
+    value = 0;
+    for (unsigned shift = 0; shift < 64 && pos < in.size(); shift += 7) {
+        const auto byte = static_cast<unsigned char>(in[pos++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+RowIndex::RowIndex(size_t stride) : stride_(std::max<size_t>(1, stride)) {
+}
+
+void RowIndex::reset(size_t stride) {
+    stride_ = std::max<size_t>(1, stride);
+    row_count_ = 0;
+    file_size_ = 0;
+    file_mtime_ = 0;
+    checkpoints_.clear();
+}
+
+void RowIndex::finish(uint64_t file_size, int64_t file_mtime) {
+    file_size_ = file_size;
+    file_mtime_ = file_mtime;
+}
+
+bool RowIndex::finish(const std::string& csv_path) {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    if (!fileFingerprint(csv_path, size, mtime)) {
+        last_error_ = "cannot stat " + csv_path;
+        return false;
+    }
+    finish(size, mtime);
+    return true;
+}
+
+RowRange RowIndex::locate(uint64_t row) const {
+    RowRange range;
+    range.end_offset = file_size_;
+    if (checkpoints_.empty()) {
+        return range;
+    }
+    const size_t checkpoint = static_cast<size_t>(std::min<uint64_t>(row / stride_, checkpoints_.size() - 1));
+    range.first_row = static_cast<uint64_t>(checkpoint) * stride_;
+    range.row_count = row_count_ - range.first_row;
+    range.begin_offset = checkpoints_[checkpoint];
+    return range;
+}
+
+RowRange RowIndex::rangeForBytes(uint64_t begin, uint64_t end) const {
+    // EN: Both ends snap forward to the next checkpoint, so a row belongs to the range holding its checkpoint
+    // FR: Les deux bornes avancent au point de reprise suivant, une ligne appartient donc à la plage de son point
+    auto first = std::lower_bound(checkpoints_.begin(), checkpoints_.end(), begin);
+    auto last = std::lower_bound(first, checkpoints_.end(), end);
+    const auto first_checkpoint = static_cast<uint64_t>(std::distance(checkpoints_.begin(), first));
+    const auto last_checkpoint = static_cast<uint64_t>(std::distance(checkpoints_.begin(), last));
+
+    RowRange range;
+    range.first_row = std::min(first_checkpoint * stride_, row_count_);
+    range.row_count = std::min(last_checkpoint * stride_, row_count_) - range.first_row;
+    range.begin_offset = first != checkpoints_.end() ? *first : file_size_;
+    range.end_offset = last != checkpoints_.end() ? *last : file_size_;
+    return range;
+}
+
+std::vector<RowRange> RowIndex::split(size_t parts) const {
+    std::vector<RowRange> ranges;
+    if (checkpoints_.empty() || parts == 0) {
+        return ranges;
+    }
+
+    // EN: Byte-balanced cut points, the first one pulled back to the first data row
+    // FR: Points de coupe équilibrés en octets, le premier ramené à la première ligne de données
+    const uint64_t data_begin = checkpoints_.front();
+    const uint64_t data_size = file_size_ > data_begin ? file_size_ - data_begin : 0;
+    uint64_t begin = data_begin;
+    for (size_t part = 1; part <= parts; ++part) {
+        uint64_t end = part == parts ? UINT64_MAX : data_begin + data_size * part / parts;
+        RowRange range = rangeForBytes(begin, end);
+        if (range.row_count > 0) {
+            ranges.push_back(range);
+        }
+        begin = end;
+    }
+    return ranges;
+}
+
+bool RowIndex::save(const std::string& index_path) const {
+    std::string out(kMagic, sizeof(kMagic));
+    putVarint(out, stride_);
+    putVarint(out, row_count_);
+    putVarint(out, file_size_);
+    putVarint(out, static_cast<uint64_t>(file_mtime_));
+    putVarint(out, checkpoints_.size());
+    uint64_t previous = 0;
+    for (uint64_t offset : checkpoints_) {
+        putVarint(out, offset - previous);
+        previous = offset;
+    }
+
+    const std::string temp_path = index_path + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file.write(out.data(), static_cast<std::streamsize>(out.size()))) {
+            last_error_ = "cannot write " + temp_path;
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_path, index_path, error);
+    if (error) {
+        last_error_ = "cannot rename " + temp_path + ": " + error.message();
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+    return true;
+}
+
+bool RowIndex::load(const std::string& index_path) {
+    std::ifstream file(index_path, std::ios::binary);
+    if (!file) {
+        last_error_ = "cannot open " + index_path;
+        return false;
+    }
+    std::string in((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (in.size() < sizeof(kMagic) || !std::equal(kMagic, kMagic + sizeof(kMagic), in.begin())) {
+        last_error_ = "not a row index: " + index_path;
+        return false;
+    }
+
+    size_t pos = sizeof(kMagic);
+    uint64_t stride = 0, row_count = 0, file_size = 0, mtime = 0, count = 0;
+    if (!getVarint(in, pos, stride) || !getVarint(in, pos, row_count) || !getVarint(in, pos, file_size) ||
+        !getVarint(in, pos, mtime) || !getVarint(in, pos, count) || stride == 0 ||
+        count != (row_count + stride - 1) / stride) {
+        last_error_ = "corrupt row index header: " + index_path;
+        return false;
+    }
+
+    std::vector<uint64_t> checkpoints;
+    checkpoints.reserve(static_cast<size_t>(count));
+    uint64_t offset = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        uint64_t delta = 0;
+        if (!getVarint(in, pos, delta)) {
+            last_error_ = "truncated row index: " + index_path;
+            return false;
+        }
+        offset += delta;
+        checkpoints.push_back(offset);
+    }
+
+    stride_ = static_cast<size_t>(stride);
+    row_count_ = row_count;
+    file_size_ = file_size;
+    file_mtime_ = static_cast<int64_t>(mtime);
+    checkpoints_ = std::move(checkpoints);
+    return true;
+}
+
+bool RowIndex::matches(const std::string& csv_path) const {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    return fileFingerprint(csv_path, size, mtime) && size == file_size_ && mtime == file_mtime_;
+}
+
+std::string RowIndex::sidecarPath(const std::string& csv_path) {
+    return csv_path + ".idx";
+}
+
+bool RowIndex::fileFingerprint(const std::string& csv_path, uint64_t& size, int64_t& mtime) {
+    std::error_code error;
+    size = std::filesystem::file_size(csv_path, error);
+    if (error) {
+        return false;
+    }
+    auto write_time = std::filesystem::last_write_time(csv_path, error);
+    if (error) {
+        return false;
+    }
+    mtime = static_cast<int64_t>(write_time.time_since_epoch().count());
+    return true;
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,34 @@
+// EN: Spill directory implementation
+// FR: Implémentation du répertoire de débordement
+
+#include "csv/spill_directory.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <system_error>
+
+namespace BBP {
+namespace CSV {
+
+SpillDirectory::SpillDirectory(const std::filesystem::path& parent, const std::string& prefix) {
+    static std::atomic<uint64_t> sequence{0};
+    const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+    for (int attempt = 0; attempt < 16 && path_.empty(); ++attempt) {
+        std::filesystem::path candidate = parent / (prefix + std::to_string(stamp) + "_" +
+                                                    std::to_string(sequence.fetch_add(1)));
+        std::error_code ec;
+        if (std::filesystem::create_directory(candidate, ec) && !ec) {
+            path_ = candidate;
+        }
+    }
+}
+
+SpillDirectory::~SpillDirectory() {
+    if (!path_.empty()) {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+}
+
+} // namespace CSV
+} // namespace BBP
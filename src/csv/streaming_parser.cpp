@@ -2,64 +2,153 @@
 // FR: Implémentation du parser CSV streaming haute performance - traite de gros fichiers avec usage mémoire constant
 
 #include "csv/streaming_parser.hpp"
+#include "csv/compressed_input.hpp"
+#include "csv/mapped_file.hpp"
+#include "csv/read_ahead_reader.hpp"
 #include "infrastructure/logging/logger.hpp"
+#include "infrastructure/threading/thread_pool.hpp"
 #include <algorithm>
+#include <deque>
+#include <future>
 #include <sstream>
 #include <fstream>
 #include <codecvt>
 #include <locale>
 #include <regex>
 #include <cstring>
+#include <stdexcept>
+#include <sys/resource.h>
 
 namespace BBP {
 namespace CSV {
 
+namespace {
+
+std::string_view trimField(std::string_view value, const ParserConfig& config) {
+    static constexpr std::string_view whitespace = " \t\r\n";
+    if (!config.trim_whitespace) {
+        return value;
+    }
+    size_t start = value.find_first_not_of(whitespace);
+    if (start == std::string_view::npos) {
+        return std::string_view();
+    }
+    size_t last = value.find_last_not_of(whitespace);
+    return value.substr(start, last - start + 1);
+}
+
+// EN: Field of a parallel chunk: a slice of the input, or of the chunk scratch when it had to be unescaped
+// FR: Champ d'un chunk parallèle : une tranche de l'entrée, ou du buffer du chunk s'il a fallu le déséchapper
+struct ChunkField {
+    size_t offset;
+    size_t length;
+    bool in_scratch;
+};
+
+// EN: Rows tokenized by one worker, kept as offsets so the result can be moved across threads
+// FR: Lignes découpées par un worker, gardées en offsets pour que le résultat puisse changer de thread
+struct ParsedChunk {
+    std::vector<ChunkField> fields;     // EN: Fields of all rows / FR: Champs de toutes les lignes
+    std::vector<size_t> row_ends;       // EN: End index in `fields` per row / FR: Index de fin dans `fields` par ligne
+    std::vector<size_t> row_offsets;    // EN: Byte offset after each row / FR: Offset en octets après chaque ligne
+    std::string scratch;                // EN: Unescaped field bytes / FR: Octets de champs déséchappés
+    bool unterminated_quote{false};     // EN: Chunk ended inside quotes / FR: Le chunk s'est terminé dans des quotes
+    size_t fields_skipped{0};           // EN: Fields dropped by the projection / FR: Champs écartés par la projection
+};
+
+} // anonymous namespace
+
+// EN: HeaderIndex implementation
+// FR: Implémentation de HeaderIndex
+
+HeaderIndex::HeaderIndex(std::vector<std::string> header_names)
+    : names(std::move(header_names)) {
+    positions.reserve(names.size());
+    for (size_t i = 0; i < names.size(); ++i) {
+        positions.emplace(names[i], i);
+    }
+}
+
+std::optional<size_t> HeaderIndex::find(const std::string& header) const {
+    auto it = positions.find(header);
+    if (it == positions.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
 // EN: ParsedRow implementation
 // FR: Implémentation de ParsedRow
 
-ParsedRow::ParsedRow(size_t row_number, std::vector<std::string> fields, std::vector<std::string> headers)
-    : row_number_(row_number), fields_(std::move(fields)), headers_(std::move(headers)) {
-    initializeHeaderMap();
+ParsedRow::ParsedRow(size_t row_number, const std::vector<std::string>& fields, std::vector<std::string> headers)
+    : row_number_(row_number), fields_(fields.begin(), fields.end()) {
+    if (!headers.empty()) {
+        headers_ = std::make_shared<const HeaderIndex>(std::move(headers));
+    }
+}
+
+ParsedRow::ParsedRow(size_t row_number, const std::vector<std::string>& fields, std::shared_ptr<const HeaderIndex> headers)
+    : row_number_(row_number), fields_(fields.begin(), fields.end()), headers_(std::move(headers)) {
+}
+
+ParsedRow::ParsedRow(size_t row_number, const std::vector<std::string_view>& fields, std::shared_ptr<const HeaderIndex> headers,
+                     std::pmr::memory_resource* resource)
+    : row_number_(row_number), fields_(fields.begin(), fields.end(), FieldList::allocator_type(resource)), headers_(std::move(headers)) {
 }
 
-const std::string& ParsedRow::operator[](size_t index) const {
+std::string ParsedRow::operator[](size_t index) const {
     return getField(index);
 }
 
-const std::string& ParsedRow::getField(size_t index) const {
-    static const std::string empty_string;
-    if (index >= fields_.size()) {
-        return empty_string;
-    }
-    return fields_[index];
+std::string ParsedRow::getField(size_t index) const {
+    return std::string(getFieldView(index));
 }
 
 std::optional<std::string> ParsedRow::getFieldSafe(size_t index) const {
     if (index >= fields_.size()) {
         return std::nullopt;
     }
-    return fields_[index];
+    return std::string(fields_[index]);
 }
 
-const std::string& ParsedRow::operator[](const std::string& header) const {
+std::string ParsedRow::operator[](const std::string& header) const {
     return getField(header);
 }
 
-const std::string& ParsedRow::getField(const std::string& header) const {
-    static const std::string empty_string;
-    auto it = header_map_.find(header);
-    if (it == header_map_.end()) {
-        return empty_string;
-    }
-    return getField(it->second);
+std::string ParsedRow::getField(const std::string& header) const {
+    return std::string(getFieldView(header));
 }
 
 std::optional<std::string> ParsedRow::getFieldSafe(const std::string& header) const {
-    auto it = header_map_.find(header);
-    if (it == header_map_.end()) {
+    auto index = findHeader(header);
+    if (!index.has_value()) {
         return std::nullopt;
     }
-    return getFieldSafe(it->second);
+    return getFieldSafe(index.value());
+}
+
+std::string_view ParsedRow::getFieldView(size_t index) const {
+    if (index >= fields_.size()) {
+        return std::string_view();
+    }
+    return fields_[index];
+}
+
+std::string_view ParsedRow::getFieldView(const std::string& header) const {
+    auto index = findHeader(header);
+    if (!index.has_value()) {
+        return std::string_view();
+    }
+    return getFieldView(index.value());
+}
+
+std::vector<std::string> ParsedRow::getFields() const {
+    return std::vector<std::string>(fields_.begin(), fields_.end());
+}
+
+const std::vector<std::string>& ParsedRow::getHeaders() const {
+    static const std::vector<std::string> no_headers;
+    return headers_ != nullptr ? headers_->names : no_headers;
 }
 
 std::string ParsedRow::toString() const {
@@ -73,13 +162,141 @@ std::string ParsedRow::toString() const {
     return oss.str();
 }
 
-void ParsedRow::initializeHeaderMap() {
-    // EN: Create header name to index mapping for efficient field access
-    // FR: Crée le mappage nom d'en-tête vers index pour accès efficace aux champs
-    header_map_.clear();
-    for (size_t i = 0; i < headers_.size(); ++i) {
-        header_map_[headers_[i]] = i;
+std::optional<size_t> ParsedRow::findHeader(const std::string& header) const {
+    if (headers_ == nullptr) {
+        return std::nullopt;
     }
+    return headers_->find(header);
+}
+
+// EN: RowView implementation
+// FR: Implémentation de RowView
+
+std::string_view RowView::getField(size_t index) const {
+    if (index >= fields_->size()) {
+        return std::string_view();
+    }
+    return (*fields_)[index];
+}
+
+std::string_view RowView::getField(const std::string& header) const {
+    auto index = getFieldIndex(header);
+    if (!index.has_value()) {
+        return std::string_view();
+    }
+    return getField(index.value());
+}
+
+std::optional<size_t> RowView::getFieldIndex(const std::string& header) const {
+    if (headers_ == nullptr) {
+        return std::nullopt;
+    }
+    return headers_->find(header);
+}
+
+ParsedRow RowView::toParsedRow() const {
+    // EN: Materialize the slices so the row can outlive the callback; the header index is shared, not copied
+    // FR: Matérialise les tranches pour que la ligne survive au callback ; l'index d'en-têtes est partagé, pas copié
+    if (headers_ == nullptr) {
+        return ParsedRow(row_number_, *fields_, nullptr);
+    }
+    if (auto shared = headers_->weak_from_this().lock()) {
+        return ParsedRow(row_number_, *fields_, std::move(shared));
+    }
+    return ParsedRow(row_number_, *fields_, std::make_shared<const HeaderIndex>(headers_->names));
+}
+
+// EN: RowBatch implementation
+// FR: Implémentation de RowBatch
+
+void RowBatch::appendRow(size_t row_number, const std::vector<std::string_view>& fields) {
+    appendFields(row_number, fields);
+}
+
+void RowBatch::appendRow(size_t row_number, const std::vector<std::string>& fields) {
+    appendFields(row_number, fields);
+}
+
+template<typename Field>
+void RowBatch::appendFields(size_t row_number, const std::vector<Field>& fields) {
+    size_t row_bytes = 0;
+    for (const auto& field : fields) {
+        row_bytes += field.size();
+    }
+    if (buffer_.size() + row_bytes > kMaxBufferSize) {
+        throw std::length_error("RowBatch buffer exceeds 32-bit offsets");
+    }
+    
+    // EN: A wider row opens new columns, earlier rows read as empty there
+    // FR: Une ligne plus large ouvre de nouvelles colonnes, les lignes précédentes y lisent des champs vides
+    if (fields.size() > column_count_) {
+        if (columns_.size() < fields.size()) {
+            columns_.resize(fields.size());
+        }
+        for (size_t column = column_count_; column < fields.size(); ++column) {
+            columns_[column].assign(row_numbers_.size(), FieldSpan{});
+        }
+        column_count_ = fields.size();
+    }
+    
+    for (size_t column = 0; column < column_count_; ++column) {
+        if (column < fields.size() && !fields[column].empty()) {
+            columns_[column].push_back(FieldSpan{static_cast<uint32_t>(buffer_.size()), static_cast<uint32_t>(fields[column].size())});
+            buffer_.append(fields[column].data(), fields[column].size());
+        } else {
+            columns_[column].push_back(FieldSpan{});
+        }
+    }
+    row_numbers_.push_back(row_number);
+    field_counts_.push_back(static_cast<uint32_t>(fields.size()));
+}
+
+void RowBatch::clear() {
+    // EN: Keep every capacity so the next batch fills without allocating
+    // FR: Conserve toutes les capacités pour que le lot suivant se remplisse sans allouer
+    buffer_.clear();
+    for (size_t column = 0; column < column_count_; ++column) {
+        columns_[column].clear();
+    }
+    column_count_ = 0;
+    row_numbers_.clear();
+    field_counts_.clear();
+}
+
+std::string_view RowBatch::getField(size_t row, size_t column) const {
+    if (row >= row_numbers_.size() || column >= column_count_) {
+        return std::string_view();
+    }
+    return view(columns_[column][row]);
+}
+
+std::string_view RowBatch::getField(size_t row, const std::string& header) const {
+    auto column = getColumnIndex(header);
+    if (!column.has_value()) {
+        return std::string_view();
+    }
+    return getField(row, column.value());
+}
+
+std::optional<size_t> RowBatch::getColumnIndex(const std::string& header) const {
+    if (headers_ == nullptr) {
+        return std::nullopt;
+    }
+    return headers_->find(header);
+}
+
+const std::vector<std::string>& RowBatch::getHeaders() const {
+    static const std::vector<std::string> no_headers;
+    return headers_ != nullptr ? headers_->names : no_headers;
+}
+
+ParsedRow RowBatch::toParsedRow(size_t row) const {
+    std::vector<std::string_view> fields;
+    fields.reserve(field_counts_[row]);
+    for (size_t column = 0; column < field_counts_[row]; ++column) {
+        fields.push_back(getField(row, column));
+    }
+    return ParsedRow(row_numbers_[row], fields, headers_);
 }
 
 // EN: ParserStatistics implementation
@@ -96,10 +313,13 @@ void ParserStatistics::reset() {
     rows_skipped_ = 0;
     rows_with_errors_ = 0;
     bytes_read_ = 0;
+    fields_skipped_ = 0;
     parsing_duration_ = std::chrono::duration<double>(0);
     total_field_count_ = 0;
     min_field_count_ = SIZE_MAX;
     max_field_count_ = 0;
+    heap_allocations_ = 0;
+    peak_rss_bytes_ = 0;
 }
 
 void ParserStatistics::startTiming() {
@@ -113,6 +333,17 @@ void ParserStatistics::stopTiming() {
     // FR: Arrête de mesurer le temps de parsing et met à jour la durée
     auto end_time = std::chrono::high_resolution_clock::now();
     parsing_duration_ = end_time - start_time_;
+    
+    // EN: ru_maxrss is in kilobytes on Linux and in bytes on macOS
+    // FR: ru_maxrss est en kilo-octets sous Linux et en octets sous macOS
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        peak_rss_bytes_ = static_cast<size_t>(usage.ru_maxrss);
+#else
+        peak_rss_bytes_ = static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+    }
 }
 
 void ParserStatistics::recordFieldCount(size_t count) {
@@ -184,20 +415,155 @@ std::string ParserStatistics::generateReport() const {
         report << "  - Min fields per row: " << min_field_count_ << "\n";
     }
     report << "  - Max fields per row: " << max_field_count_ << "\n";
+    if (fields_skipped_ > 0) {
+        report << "  - Skipped by projection: " << fields_skipped_ << "\n";
+    }
+    
+    report << "Memory:\n";
+    report << "  - Row heap allocations: " << heap_allocations_ << "\n";
+    report << "  - Peak RSS: " << (static_cast<double>(peak_rss_bytes_) / 1024.0 / 1024.0) << " MB\n";
     
     return report.str();
 }
 
+// EN: RowTokenizer implementation
+// FR: Implémentation de RowTokenizer
+
+RowTokenizer::RowTokenizer(const ParserConfig& config)
+    : config_(config), scanner_(config_.delimiter, config_.quote_char, config_.scanner_backend) {
+}
+
+void RowTokenizer::setProjection(const std::vector<size_t>& columns) {
+    // EN: Map each source column to its output slot; duplicates keep their first slot
+    // FR: Associe chaque colonne source à son emplacement de sortie ; les doublons gardent leur premier emplacement
+    projection_slots_.clear();
+    projected_count_ = 0;
+    for (size_t column : columns) {
+        if (column >= projection_slots_.size()) {
+            projection_slots_.resize(column + 1, kSkippedColumn);
+        }
+        if (projection_slots_[column] == kSkippedColumn) {
+            projection_slots_[column] = projected_count_++;
+        }
+    }
+    resetRow();
+}
+
+size_t RowTokenizer::findNextRowStart(const char* data, size_t pos, size_t end, bool in_quotes) {
+    // EN: Scan small windows until the first unquoted line terminator; rows are short compared to a chunk
+    // FR: Scanne de petites fenêtres jusqu'à la première fin de ligne hors quotes ; les lignes sont courtes
+    //     comparées à un chunk
+    static constexpr size_t kProbeWindowSize = 4096;
+    const char delimiter = config_.delimiter;
+    for (size_t window = pos; window < end; window += kProbeWindowSize) {
+        size_t window_size = std::min(kProbeWindowSize, end - window);
+        structurals_.clear();
+        scanner_.scan(data + window, window_size, in_quotes, structurals_);
+        for (const auto& structural : structurals_) {
+            if (data[window + structural.offset] != delimiter) {
+                return window + structural.offset + 1;
+            }
+        }
+    }
+    return end;
+}
+
+std::string_view RowTokenizer::decodeField(std::string_view raw, size_t quote_count, const ParserConfig& config, std::string& scratch) {
+    // EN: The result is a slice of `raw` unless unescaping is needed, in which case the bytes are appended to
+    //     `scratch` and the result points there
+    // FR: Le résultat est une tranche de `raw` sauf si un déséchappement est nécessaire ; les octets sont alors
+    //     ajoutés à `scratch` et le résultat pointe dedans
+
+    if (quote_count == 0) {
+        return trimField(raw, config);
+    }
+    
+    // EN: Plain quoted field ("value"): the content is a contiguous slice between the quotes
+    // FR: Champ quoté simple ("valeur") : le contenu est une tranche contiguë entre les quotes
+    const char quote = config.quote_char;
+    std::string_view candidate = trimField(raw, config);
+    if (quote_count == 2 && candidate.size() >= 2 && candidate.front() == quote && candidate.back() == quote) {
+        return trimField(candidate.substr(1, candidate.size() - 2), config);
+    }
+    
+    // EN: Escaped quotes (or quotes mid-field): unescape into the scratch buffer
+    // FR: Quotes échappées (ou quotes en milieu de champ) : déséchappe dans le buffer temporaire
+    size_t offset = scratch.size();
+    bool in_quotes = false;
+    for (size_t i = 0; i < raw.size(); ++i) {
+        char c = raw[i];
+        if (c == quote) {
+            if (in_quotes && i + 1 < raw.size() && raw[i + 1] == quote) {
+                scratch += quote;
+                ++i;
+            } else {
+                in_quotes = !in_quotes;
+            }
+        } else {
+            scratch += c;
+        }
+    }
+    return trimField(std::string_view(scratch).substr(offset), config);
+}
+
+void RowTokenizer::appendField(const char* begin, const char* end, size_t quote_count) {
+    // EN: Turn a raw field span into a view, copying only when unescaping is unavoidable. Columns outside the
+    //     projection are only counted.
+    // FR: Transforme une plage brute de champ en vue, en ne copiant que si le déséchappement est inévitable.
+    //     Les colonnes hors projection sont seulement comptées.
+    size_t column = column_++;
+    size_t slot = field_views_.size();
+    if (!projection_slots_.empty()) {
+        slot = column < projection_slots_.size() ? projection_slots_[column] : kSkippedColumn;
+        if (slot == kSkippedColumn) {
+            ++fields_skipped_;
+            return;
+        }
+    } else {
+        field_views_.emplace_back();
+    }
+    
+    size_t scratch_offset = row_scratch_.size();
+    std::string_view value = decodeField(std::string_view(begin, static_cast<size_t>(end - begin)), quote_count, config_, row_scratch_);
+    
+    if (value.empty()) {
+        field_views_[slot] = std::string_view();
+    } else if (row_scratch_.size() != scratch_offset) {
+        // EN: Scratch may still reallocate, remember the position and resolve it once the row is complete
+        // FR: Le buffer temporaire peut encore réallouer, mémorise la position et la résout une fois la ligne complète
+        scratch_fields_.push_back({slot, {static_cast<size_t>(value.data() - row_scratch_.data()), value.size()}});
+    } else {
+        field_views_[slot] = value;
+    }
+}
+
+void RowTokenizer::resolveScratchFields() {
+    for (const auto& [index, span] : scratch_fields_) {
+        field_views_[index] = std::string_view(row_scratch_.data() + span.first, span.second);
+    }
+}
+
+void RowTokenizer::resetRow() {
+    // EN: Projected rows have a fixed width, missing trailing columns read as empty
+    // FR: Les lignes projetées ont une largeur fixe, les colonnes finales manquantes se lisent vides
+    field_views_.assign(projected_count_, std::string_view());
+    row_scratch_.clear();
+    scratch_fields_.clear();
+    column_ = 0;
+}
+
 // EN: StreamingParser implementation
 // FR: Implémentation de StreamingParser
 
-StreamingParser::StreamingParser() : config_() {
+StreamingParser::StreamingParser()
+    : config_(), tokenizer_(config_) {
     // EN: Initialize with default configuration
     // FR: Initialise avec configuration par défaut
     initializeBuffer();
 }
 
-StreamingParser::StreamingParser(const ParserConfig& config) : config_(config) {
+StreamingParser::StreamingParser(const ParserConfig& config)
+    : config_(config), tokenizer_(config_) {
     // EN: Initialize with custom configuration
     // FR: Initialise avec configuration personnalisée
     initializeBuffer();
@@ -217,6 +583,8 @@ StreamingParser::~StreamingParser() {
 StreamingParser::StreamingParser(StreamingParser&& other) noexcept
     : config_(std::move(other.config_))
     , row_callback_(std::move(other.row_callback_))
+    , row_view_callback_(std::move(other.row_view_callback_))
+    , batch_callback_(std::move(other.batch_callback_))
     , progress_callback_(std::move(other.progress_callback_))
     , error_callback_(std::move(other.error_callback_))
     , parsing_thread_(std::move(other.parsing_thread_))
@@ -225,6 +593,9 @@ StreamingParser::StreamingParser(StreamingParser&& other) noexcept
     , buffer_size_(other.buffer_size_)
     , current_row_(std::move(other.current_row_))
     , headers_(std::move(other.headers_))
+    , batch_(std::move(other.batch_))
+    , tokenizer_(config_)
+    , row_arena_(std::move(other.row_arena_))
     , current_row_number_(other.current_row_number_)
     , total_file_size_(other.total_file_size_)
     , detected_encoding_(other.detected_encoding_) {
@@ -261,6 +632,8 @@ StreamingParser& StreamingParser::operator=(StreamingParser&& other) noexcept {
         // FR: Déplace tous les membres
         config_ = std::move(other.config_);
         row_callback_ = std::move(other.row_callback_);
+        row_view_callback_ = std::move(other.row_view_callback_);
+        batch_callback_ = std::move(other.batch_callback_);
         progress_callback_ = std::move(other.progress_callback_);
         error_callback_ = std::move(other.error_callback_);
         // EN: Reset stats instead of moving (atomic members cannot be moved)
@@ -272,6 +645,9 @@ StreamingParser& StreamingParser::operator=(StreamingParser&& other) noexcept {
         buffer_size_ = other.buffer_size_;
         current_row_ = std::move(other.current_row_);
         headers_ = std::move(other.headers_);
+        batch_ = std::move(other.batch_);
+        tokenizer_ = RowTokenizer(config_);
+        row_arena_ = std::move(other.row_arena_);
         current_row_number_ = other.current_row_number_;
         total_file_size_ = other.total_file_size_;
         detected_encoding_ = other.detected_encoding_;
@@ -304,6 +680,8 @@ void StreamingParser::setConfig(const ParserConfig& config) {
     }
     
     config_ = config;
+    tokenizer_ = RowTokenizer(config_);
+    row_arena_.reset();
     initializeBuffer();
 }
 
@@ -314,6 +692,18 @@ ParserError StreamingParser::parseFile(const std::string& file_path) {
         return ParserError::THREAD_ERROR;
     }
     
+    if (config_.decompress_input && DecompressingReader::isCompressed(file_path)) {
+        return parseCompressedFile(file_path);
+    }
+    
+    if (config_.use_memory_mapping || config_.enable_parallel_processing || config_.row_index_stride > 0) {
+        return parseFileMapped(file_path);
+    }
+    
+    if (config_.read_ahead_buffers > 0) {
+        return parseFileReadAhead(file_path);
+    }
+    
     std::ifstream file(file_path, std::ios::binary);
     if (!file.is_open()) {
         reportError(ParserError::FILE_NOT_FOUND, "Cannot open file: " + file_path, 0);
@@ -354,6 +744,79 @@ ParserError StreamingParser::parseString(const std::string& csv_content) {
     return parseStream(stream);
 }
 
+ParserError StreamingParser::parseFileMapped(const std::string& file_path) {
+    // EN: Synchronous zero-copy parsing over a read-only mapping of the file
+    // FR: Parsing zero-copy synchrone sur un mapping en lecture seule du fichier
+    if (is_parsing_) {
+        return ParserError::THREAD_ERROR;
+    }
+    
+    // EN: A compressed file cannot be sliced in place, it goes through the inflate pipeline instead
+    // FR: Un fichier compressé ne peut pas être découpé sur place, il passe par le pipeline d'inflate
+    if (config_.decompress_input && DecompressingReader::isCompressed(file_path)) {
+        return parseCompressedFile(file_path);
+    }
+    
+    MappedFile mapping;
+    if (!mapping.open(file_path, MappingAdvice::SEQUENTIAL)) {
+        reportError(ParserError::FILE_NOT_FOUND, "Cannot map file: " + file_path + " (" + mapping.getLastError() + ")", 0);
+        return ParserError::FILE_NOT_FOUND;
+    }
+    
+    total_file_size_ = mapping.size();
+    
+    auto& logger = Logger::getInstance();
+    logger.info("streaming_parser", "Starting to parse mapped file: " + file_path + 
+                " (size: " + std::to_string(total_file_size_) + " bytes)");
+    
+    // EN: Row offsets are collected while parsing; the file is fingerprinted first so a concurrent rewrite makes
+    //     the sidecar stale rather than wrong
+    // FR: Les offsets de lignes sont collectés pendant le parsing ; l'empreinte du fichier est prise avant pour
+    //     qu'une réécriture concurrente rende l'annexe périmée plutôt que fausse
+    row_index_.reset(config_.row_index_stride > 0 ? config_.row_index_stride : RowIndex::kDefaultStride);
+    bool build_index = config_.row_index_stride > 0 && row_index_.finish(file_path);
+    if (build_index) {
+        index_data_ = mapping.data();
+        index_size_ = mapping.size();
+    }
+    
+    setParsingState(true, false);
+    
+    auto result = parseMappedRange(mapping.data(), mapping.size());
+    
+    index_data_ = nullptr;
+    if (build_index && result == ParserError::SUCCESS && !checkShouldStop()) {
+        if (!row_index_.save(RowIndex::sidecarPath(file_path))) {
+            logger.error("streaming_parser", "Cannot write row index: " + row_index_.getLastError());
+        }
+    }
+    
+    setParsingState(false, false);
+    return result;
+}
+
+ParserError StreamingParser::parseFileRange(const std::string& file_path, const RowRange& range) {
+    // EN: Parse one row range, e.g. from RowIndex::split(); rows keep their file-wide numbers
+    // FR: Parse une plage de lignes, par ex. issue de RowIndex::split() ; les lignes gardent leur numéro dans le fichier
+    return parseMappedSlice(file_path, range, 0, range.row_count);
+}
+
+ParserError StreamingParser::parseFileFromRow(const std::string& file_path, size_t first_row, size_t row_count) {
+    // EN: Jump to the checkpoint at or before first_row through the sidecar, then skip the few rows in between.
+    //     Without a valid sidecar the skip starts at the first data row.
+    // FR: Saute au point de reprise au plus tard à first_row via l'annexe, puis saute les quelques lignes
+    //     intermédiaires. Sans annexe valide, le saut part de la première ligne de données.
+    RowRange range;
+    RowIndex index;
+    if (index.load(RowIndex::sidecarPath(file_path)) && index.matches(file_path)) {
+        range = index.locate(first_row);
+    } else {
+        Logger::getInstance().info("streaming_parser", "No valid row index for " + file_path + ", seeking linearly");
+    }
+    size_t skip_rows = first_row - static_cast<size_t>(range.first_row);
+    return parseMappedSlice(file_path, range, skip_rows, row_count);
+}
+
 ParserError StreamingParser::parseFileAsync(const std::string& file_path) {
     // EN: Asynchronous file parsing
     // FR: Parsing asynchrone de fichier
@@ -366,14 +829,19 @@ ParserError StreamingParser::parseFileAsync(const std::string& file_path) {
     // EN: Start parsing in background thread
     // FR: Démarre le parsing dans un thread en arrière-plan
     parsing_thread_ = std::make_unique<std::thread>([this, file_path]() {
-        std::ifstream file(file_path, std::ios::binary);
-        if (!file.is_open()) {
+        std::unique_ptr<std::istream> file;
+        if (config_.decompress_input) {
+            file = openCsvInput(file_path);
+        } else {
+            file = std::make_unique<std::ifstream>(file_path, std::ios::binary);
+        }
+        if (!*file) {
             reportError(ParserError::FILE_NOT_FOUND, "Cannot open file: " + file_path, 0);
             setParsingState(false, false);
             return;
         }
         
-        asyncParsingWorker(file);
+        asyncParsingWorker(*file);
     });
     
     return ParserError::SUCCESS;
@@ -434,6 +902,11 @@ ParserError StreamingParser::waitForCompletion() {
     return ParserError::SUCCESS;
 }
 
+const std::vector<std::string>& StreamingParser::getHeaders() const {
+    static const std::vector<std::string> no_headers;
+    return headers_ != nullptr ? headers_->names : no_headers;
+}
+
 // EN: Static utility methods
 // FR: Méthodes utilitaires statiques
 
@@ -484,69 +957,41 @@ EncodingType StreamingParser::detectEncoding(std::istream& stream) {
 }
 
 std::vector<std::string> StreamingParser::parseRow(const std::string& row, const ParserConfig& config) {
-    // EN: Static method to parse a single CSV row
-    // FR: Méthode statique pour parser une seule ligne CSV
+    // EN: Static method to parse a single CSV row. Field boundaries come from the structural scanner bitmasks;
+    //     line terminators inside a row are ordinary characters here.
+    // FR: Méthode statique pour parser une seule ligne CSV. Les limites de champs viennent des masques du
+    //     scanner structurel ; les fins de ligne dans une ligne sont ici des caractères ordinaires.
     std::vector<std::string> fields;
     if (row.empty()) {
         return fields;
     }
     
-    size_t pos = 0;
-    bool in_quotes = false;
-    std::string current_field;
+    StructuralScanner scanner(config.delimiter, config.quote_char, config.scanner_backend);
+    thread_local std::vector<StructuralIndex> structurals;
+    thread_local std::string scratch;
+    structurals.clear();
     
-    while (pos < row.length()) {
-        char c = row[pos];
-        
-        if (c == config.quote_char) {
-            if (in_quotes && pos + 1 < row.length() && row[pos + 1] == config.quote_char) {
-                // EN: Escaped quote within quoted field
-                // FR: Quote échappée dans un champ quoté
-                current_field += config.quote_char;
-                pos += 2;
-            } else {
-                // EN: Toggle quote state
-                // FR: Bascule l'état de quote
-                in_quotes = !in_quotes;
-                pos++;
-            }
-        } else if (c == config.delimiter && !in_quotes) {
-            // EN: Field delimiter outside quotes
-            // FR: Délimiteur de champ en dehors des quotes
-            if (config.trim_whitespace) {
-                // EN: Trim leading and trailing whitespace
-                // FR: Supprime les espaces en début et fin
-                size_t start = current_field.find_first_not_of(" \t\r\n");
-                if (start != std::string::npos) {
-                    size_t end = current_field.find_last_not_of(" \t\r\n");
-                    current_field = current_field.substr(start, end - start + 1);
-                } else {
-                    current_field.clear();
-                }
-            }
-            fields.push_back(current_field);
-            current_field.clear();
-            pos++;
-        } else {
-            // EN: Regular character
-            // FR: Caractère normal
-            current_field += c;
-            pos++;
+    bool in_quotes = false;
+    size_t trailing_quotes = scanner.scan(row.data(), row.size(), in_quotes, structurals);
+    
+    std::string_view data(row);
+    size_t field_start = 0;
+    size_t quote_count = 0;
+    for (const auto& structural : structurals) {
+        quote_count += structural.quote_count;
+        if (data[structural.offset] != config.delimiter) {
+            continue;
         }
+        scratch.clear();
+        fields.emplace_back(RowTokenizer::decodeField(data.substr(field_start, structural.offset - field_start), quote_count, config, scratch));
+        field_start = structural.offset + 1;
+        quote_count = 0;
     }
     
     // EN: Add the last field
     // FR: Ajoute le dernier champ
-    if (config.trim_whitespace) {
-        size_t start = current_field.find_first_not_of(" \t\r\n");
-        if (start != std::string::npos) {
-            size_t end = current_field.find_last_not_of(" \t\r\n");
-            current_field = current_field.substr(start, end - start + 1);
-        } else {
-            current_field.clear();
-        }
-    }
-    fields.push_back(current_field);
+    scratch.clear();
+    fields.emplace_back(RowTokenizer::decodeField(data.substr(field_start), quote_count + trailing_quotes, config, scratch));
     
     return fields;
 }
@@ -615,7 +1060,20 @@ ParserError StreamingParser::parseInternal(std::istream& stream) {
     // EN: Initialize parsing state
     // FR: Initialise l'état de parsing
     current_row_number_ = 0;
-    headers_.clear();
+    headers_.reset();
+    batch_.clear();
+    batch_.setHeaders(nullptr);
+    
+    // EN: Without a header row the projection can only use indices and is resolved up front
+    // FR: Sans ligne d'en-tête la projection ne peut utiliser que des index et est résolue dès le départ
+    tokenizer_.setProjection({});
+    if (!config_.has_header) {
+        ParserError projection_result = applyProjection();
+        if (projection_result != ParserError::SUCCESS) {
+            stats_.stopTiming();
+            return projection_result;
+        }
+    }
     
     // EN: Process file in chunks
     // FR: Traite le fichier par chunks
@@ -624,17 +1082,19 @@ ParserError StreamingParser::parseInternal(std::istream& stream) {
         while (!checkShouldStop() && stream.good()) {
             // EN: Handle pause state
             // FR: Gère l'état de pause
-            {
-                std::unique_lock<std::mutex> lock(parsing_mutex_);
-                parsing_cv_.wait(lock, [this] { return !is_paused_ || should_stop_; });
-                if (should_stop_) break;
-            }
+            if (!waitWhilePaused()) break;
             
             result = processBuffer(stream);
             if (result != ParserError::SUCCESS && config_.strict_mode) {
                 break;
             }
         }
+        
+        // EN: Deliver the last partial batch unless parsing was stopped
+        // FR: Transmet le dernier lot partiel sauf si le parsing a été arrêté
+        if (!checkShouldStop()) {
+            flushBatch();
+        }
     } catch (const std::exception& e) {
         logger.error("streaming_parser", "Exception during parsing: " + std::string(e.what()));
         result = ParserError::CALLBACK_ERROR;
@@ -657,7 +1117,7 @@ ParserError StreamingParser::processBuffer(std::istream& stream) {
     
     // EN: Extract and process complete rows from buffer
     // FR: Extrait et traite les lignes complètes du buffer
-    while (buffer_pos_ < buffer_size_) {
+    while (buffer_pos_ < buffer_size_ && !checkShouldStop()) {
         std::string row = extractNextRow();
         if (row.empty()) {
             break; // EN: No complete row available / FR: Aucune ligne complète disponible
@@ -673,7 +1133,7 @@ ParserError StreamingParser::processBuffer(std::istream& stream) {
         }
         
         ParserError row_result = processRow(row, current_row_number_);
-        if (row_result != ParserError::SUCCESS && config_.strict_mode) {
+        if (row_result != ParserError::SUCCESS && (config_.strict_mode || checkShouldStop())) {
             return row_result;
         }
         
@@ -696,29 +1156,50 @@ ParserError StreamingParser::processRow(const std::string& row_data, size_t row_
     }
     
     try {
-        std::vector<std::string> fields = parseRowFields(row_data);
-        
-        // EN: Handle header row
-        // FR: Gère la ligne d'en-tête
+        // EN: Handle header row, then resolve the projection against it
+        // FR: Gère la ligne d'en-tête, puis résout la projection avec elle
         if (config_.has_header && row_number == 1) {
-            headers_ = fields;
+            setHeaders(parseRowFields(row_data));
             stats_.incrementRowsSkipped(); // EN: Header is not counted as data row / FR: En-tête n'est pas comptée comme ligne de données
-            return ParserError::SUCCESS;
+            
+            // EN: A projection that cannot be resolved ends the parse in any mode
+            // FR: Une projection impossible à résoudre termine le parsing dans tous les modes
+            ParserError projection_result = applyProjection();
+            if (projection_result != ParserError::SUCCESS) {
+                should_stop_ = true;
+            }
+            return projection_result;
         }
         
-        // EN: Create parsed row object
-        // FR: Crée l'objet ligne analysée
-        ParsedRow parsed_row(row_number, std::move(fields), headers_);
-        stats_.incrementRowsParsed();
-        stats_.recordFieldCount(parsed_row.getFieldCount());
-        
-        // EN: Call user callback if provided
-        // FR: Appelle le callback utilisateur si fourni
-        if (row_callback_) {
-            bool continue_parsing = row_callback_(parsed_row, ParserError::SUCCESS);
-            if (!continue_parsing) {
-                return ParserError::SUCCESS; // EN: User requested stop / FR: Utilisateur demande l'arrêt
+        // EN: Fields are cut as views over the row (only projected columns are decoded) and copied once, into the
+        //     batch and/or the row storage; the row holds no unquoted line terminator here
+        // FR: Les champs sont découpés en vues sur la ligne (seules les colonnes projetées sont décodées) et copiés
+        //     une seule fois, dans le lot et/ou le stockage de ligne ; la ligne ne contient ici aucune fin de ligne
+        //     hors quotes
+        auto deliver = [this, row_number](const std::vector<std::string_view>& fields) {
+            stats_.incrementRowsParsed();
+            stats_.recordFieldCount(fields.size());
+            
+            // EN: A batch stop request ends the parse; a row callback returning false only skips the rest of the row
+            // FR: Une demande d'arrêt du lot termine le parsing ; un callback de ligne retournant false ne fait
+            //     qu'abandonner la suite de la ligne
+            if (batch_callback_ && !appendToBatch(row_number, fields)) {
+                should_stop_ = true;
+                return false;
+            }
+            if (row_callback_) {
+                deliverParsedRow(row_number, fields);
             }
+            return true;
+        };
+        
+        if (row_data.empty()) {
+            deliver(std::vector<std::string_view>());
+        } else {
+            auto outcome = tokenizer_.tokenize(row_data.data(), 0, row_data.size(), [&deliver](const std::vector<std::string_view>& fields, size_t /*row_end*/) {
+                return deliver(fields);
+            });
+            stats_.addFieldsSkipped(outcome.fields_skipped);
         }
         
         return ParserError::SUCCESS;
@@ -863,6 +1344,688 @@ std::string StreamingParser::extractNextRow() {
     return line;
 }
 
+ParserError StreamingParser::parseMappedRange(const char* data, size_t size) {
+    // EN: Zero-copy parsing: rows are cut in place as slices of [data, data + size), either by one tokenizer on
+    //     this thread or chunk by chunk on a thread pool when parallel processing is enabled
+    // FR: Parsing zero-copy : les lignes sont découpées sur place en tranches de [data, data + size), soit par
+    //     un tokenizer sur ce thread, soit chunk par chunk sur un pool de threads si le parallélisme est activé
+    auto& logger = Logger::getInstance();
+    stats_.startTiming();
+    
+    ParserError result = ParserError::SUCCESS;
+    size_t thread_count = resolveThreadCount();
+    
+    try {
+        size_t pos = parseMappedPrologue(data, size, result);
+        
+        if (thread_count > 1 && config_.parallel_chunk_size > 0 && size - pos > config_.parallel_chunk_size) {
+            ParserError chunk_result = parseMappedRangeParallel(data, pos, size, thread_count);
+            if (chunk_result != ParserError::SUCCESS) {
+                result = chunk_result;
+            }
+        } else if (pos < size && !checkShouldStop()) {
+            auto outcome = tokenizer_.tokenize(data, pos, size, [this](const std::vector<std::string_view>& fields, size_t row_end) {
+                return deliverRowView(fields, row_end);
+            });
+            stats_.addFieldsSkipped(outcome.fields_skipped);
+            if (outcome.unterminated_quote) {
+                reportUnterminatedQuote(result);
+            }
+        }
+        
+        // EN: Deliver the last partial batch unless a callback or stopParsing() ended the parse
+        // FR: Transmet le dernier lot partiel sauf si un callback ou stopParsing() a terminé le parsing
+        if (!checkShouldStop()) {
+            flushBatch();
+        }
+    } catch (const std::exception& e) {
+        logger.error("streaming_parser", "Exception during parsing: " + std::string(e.what()));
+        result = ParserError::CALLBACK_ERROR;
+    }
+    
+    stats_.addBytesRead(size);
+    stats_.stopTiming();
+    logger.info("streaming_parser", "Parsing completed. " + 
+                std::to_string(stats_.getRowsParsed()) + " rows processed");
+    
+    return result;
+}
+
+size_t StreamingParser::parseMappedPrologue(const char* data, size_t size, ParserError& result) {
+    // EN: Reset per-parse state, skip the BOM, deliver the header and resolve the projection; returns where
+    //     data rows start (size if the projection cannot be resolved)
+    // FR: Réinitialise l'état du parsing, ignore le BOM, transmet l'en-tête et résout la projection ; retourne
+    //     le début des lignes de données (size si la projection ne peut être résolue)
+    current_row_number_ = 0;
+    headers_.reset();
+    batch_.clear();
+    batch_.setHeaders(nullptr);
+    
+    // EN: Skip UTF-8 BOM so it does not end up in the first header name
+    // FR: Ignore le BOM UTF-8 pour qu'il ne finisse pas dans le premier nom d'en-tête
+    size_t pos = 0;
+    if (size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+        pos = 3;
+    }
+    index_next_row_start_ = pos;
+    
+    // EN: The header row is cut first so the projection can be resolved before data rows are tokenized
+    // FR: La ligne d'en-tête est découpée d'abord pour résoudre la projection avant de découper les données
+    tokenizer_.setProjection({});
+    if (config_.has_header) {
+        pos = parseMappedHeader(data, pos, size, result);
+    }
+    ParserError projection_result = applyProjection();
+    if (projection_result != ParserError::SUCCESS) {
+        result = projection_result;
+        return size;
+    }
+    return pos;
+}
+
+ParserError StreamingParser::parseMappedSlice(const std::string& file_path, const RowRange& range, size_t skip_rows, size_t max_rows) {
+    // EN: The header is still read from the top of the file (names and projection), then tokenizing starts at
+    //     the range offset; row offsets from a RowIndex are row boundaries, so no quote state is needed
+    // FR: L'en-tête est toujours lu en haut du fichier (noms et projection), puis le découpage commence à
+    //     l'offset de la plage ; les offsets d'un RowIndex sont des limites de ligne, aucun état de quote requis
+    if (is_parsing_) {
+        return ParserError::THREAD_ERROR;
+    }
+    
+    if (config_.decompress_input && DecompressingReader::isCompressed(file_path)) {
+        reportError(ParserError::FILE_READ_ERROR, "Row seeking needs an uncompressed file: " + file_path, 0);
+        return ParserError::FILE_READ_ERROR;
+    }
+    
+    MappedFile mapping;
+    if (!mapping.open(file_path, MappingAdvice::RANDOM)) {
+        reportError(ParserError::FILE_NOT_FOUND, "Cannot map file: " + file_path + " (" + mapping.getLastError() + ")", 0);
+        return ParserError::FILE_NOT_FOUND;
+    }
+    
+    const char* data = mapping.data();
+    const size_t size = mapping.size();
+    total_file_size_ = size;
+    auto& logger = Logger::getInstance();
+    
+    setParsingState(true, false);
+    stats_.startTiming();
+    
+    ParserError result = ParserError::SUCCESS;
+    size_t begin = 0;
+    size_t end = 0;
+    try {
+        size_t data_start = parseMappedPrologue(data, size, result);
+        begin = std::clamp<size_t>(static_cast<size_t>(std::min<uint64_t>(range.begin_offset, size)), data_start, size);
+        end = std::max(begin, static_cast<size_t>(std::min<uint64_t>(range.end_offset, size)));
+        mapping.advise(MappingAdvice::SEQUENTIAL, begin, end - begin);
+        
+        // EN: Row numbers continue from the range start as if every earlier row had been delivered
+        // FR: Les numéros de ligne reprennent au début de la plage comme si toutes les lignes précédentes avaient été transmises
+        current_row_number_ = (config_.has_header ? 1 : 0) + static_cast<size_t>(range.first_row);
+        
+        size_t remaining = max_rows;
+        if (begin < end && !checkShouldStop()) {
+            auto outcome = tokenizer_.tokenize(data, begin, end, [&](const std::vector<std::string_view>& fields, size_t row_end) {
+                if (skip_rows > 0) {
+                    --skip_rows;
+                    ++current_row_number_;
+                    return true;
+                }
+                bool keep_going = deliverRowView(fields, row_end);
+                return keep_going && (max_rows == 0 || --remaining > 0);
+            });
+            stats_.addFieldsSkipped(outcome.fields_skipped);
+            if (outcome.unterminated_quote) {
+                reportUnterminatedQuote(result);
+            }
+        }
+        
+        if (!checkShouldStop()) {
+            flushBatch();
+        }
+    } catch (const std::exception& e) {
+        logger.error("streaming_parser", "Exception during parsing: " + std::string(e.what()));
+        result = ParserError::CALLBACK_ERROR;
+    }
+    
+    stats_.addBytesRead(end - begin);
+    stats_.stopTiming();
+    setParsingState(false, false);
+    return result;
+}
+
+ParserError StreamingParser::parseCompressedFile(const std::string& file_path) {
+    // EN: Blocks are inflated on the reader's thread while this one tokenizes the previous block
+    // FR: Les blocs sont inflatés sur le thread du lecteur pendant que celui-ci découpe le bloc précédent
+    DecompressingReader reader;
+    if (!reader.open(file_path)) {
+        reportError(ParserError::FILE_NOT_FOUND, "Cannot open file: " + file_path + " (" + reader.getLastError() + ")", 0);
+        return ParserError::FILE_NOT_FOUND;
+    }
+    
+    total_file_size_ = getFileSize(file_path);
+    
+    Logger::getInstance().info("streaming_parser", "Starting to parse compressed file: " + file_path + 
+                               " (size: " + std::to_string(total_file_size_) + " bytes)");
+    
+    return parseBlocks(file_path, reader, "Cannot decompress file: ");
+}
+
+ParserError StreamingParser::parseFileReadAhead(const std::string& file_path) {
+    // EN: The reader thread keeps read_ahead_buffers buffers filled while this one tokenizes
+    // FR: Le thread de lecture garde read_ahead_buffers buffers remplis pendant que celui-ci découpe
+    ReadAheadReader reader(config_.read_ahead_buffers, config_.read_ahead_buffer_size);
+    if (!reader.open(file_path)) {
+        reportError(ParserError::FILE_NOT_FOUND, "Cannot open file: " + file_path + " (" + reader.getLastError() + ")", 0);
+        return ParserError::FILE_NOT_FOUND;
+    }
+    
+    total_file_size_ = getFileSize(file_path);
+    
+    Logger::getInstance().info("streaming_parser", "Starting to parse file with read-ahead: " + file_path + 
+                               " (size: " + std::to_string(total_file_size_) + " bytes, " +
+                               std::to_string(reader.getBufferCount()) + " x " + std::to_string(reader.getBufferSize()) + " bytes buffers)");
+    
+    return parseBlocks(file_path, reader, "Cannot read file: ");
+}
+
+namespace {
+
+// EN: File bytes consumed so far by a block reader, for progress reporting
+// FR: Octets du fichier consommés jusqu'ici par un lecteur de blocs, pour le suivi de progression
+size_t sourceBytesRead(const DecompressingReader& reader) { return reader.getCompressedBytesRead(); }
+size_t sourceBytesRead(const ReadAheadReader& reader) { return reader.getBytesRead(); }
+
+} // anonymous namespace
+
+template<typename BlockReader>
+ParserError StreamingParser::parseBlocks(const std::string& file_path, BlockReader& reader, const std::string& failure_message) {
+    // EN: Rows are cut in place in each block handed over by the reader; only the row straddling two blocks is
+    //     copied, into `carry`, and completed with the head of the next block
+    // FR: Les lignes sont découpées sur place dans chaque bloc remis par le lecteur ; seule la ligne à cheval sur
+    //     deux blocs est copiée, dans `carry`, et complétée avec le début du bloc suivant
+    auto& logger = Logger::getInstance();
+    setParsingState(true, false);
+    stats_.startTiming();
+    
+    current_row_number_ = 0;
+    headers_.reset();
+    batch_.clear();
+    batch_.setHeaders(nullptr);
+    tokenizer_.setProjection({});
+    
+    ParserError result = ParserError::SUCCESS;
+    bool header_pending = config_.has_header;
+    bool done = false;
+    
+    // EN: The header row is delivered on its own so the projection is in place before data rows are cut
+    // FR: La ligne d'en-tête est transmise seule pour que la projection soit en place avant les données
+    auto sink = [this, &reader, &header_pending](const std::vector<std::string_view>& fields, size_t) {
+        bool keep_going = deliverRowView(fields, sourceBytesRead(reader));
+        if (header_pending) {
+            header_pending = false;
+            return false;
+        }
+        return keep_going;
+    };
+    
+    auto consume = [&](const char* data, size_t size, bool end_of_input) -> size_t {
+        size_t pos = 0;
+        while (!done && pos < size) {
+            bool was_header = header_pending;
+            auto outcome = tokenizer_.tokenize(data, pos, size, sink, end_of_input);
+            stats_.addFieldsSkipped(outcome.fields_skipped);
+            if (outcome.unterminated_quote) {
+                reportUnterminatedQuote(result);
+            }
+            pos = outcome.bytes_consumed;
+            if (!outcome.stopped) {
+                break;
+            }
+            if (!was_header || checkShouldStop()) {
+                done = true;
+            } else {
+                ParserError projection_result = applyProjection();
+                if (projection_result != ParserError::SUCCESS) {
+                    result = projection_result;
+                    done = true;
+                }
+            }
+        }
+        return pos;
+    };
+    
+    try {
+        if (!header_pending) {
+            ParserError projection_result = applyProjection();
+            if (projection_result != ParserError::SUCCESS) {
+                result = projection_result;
+                done = true;
+            }
+        }
+        
+        std::string carry;
+        bool first_block = true;
+        const char* block = nullptr;
+        size_t block_size = 0;
+        while (!done && !checkShouldStop() && reader.next(block, block_size)) {
+            stats_.addBytesRead(block_size);
+            
+            // EN: Skip UTF-8 BOM so it does not end up in the first header name
+            // FR: Ignore le BOM UTF-8 pour qu'il ne finisse pas dans le premier nom d'en-tête
+            if (first_block && block_size >= 3 && std::memcmp(block, "\xEF\xBB\xBF", 3) == 0) {
+                block += 3;
+                block_size -= 3;
+            }
+            first_block = false;
+            
+            if (carry.empty()) {
+                size_t consumed = consume(block, block_size, false);
+                carry.assign(block + consumed, block_size - consumed);
+            } else {
+                carry.append(block, block_size);
+                size_t consumed = consume(carry.data(), carry.size(), false);
+                carry.erase(0, consumed);
+            }
+            
+            if (carry.size() > config_.max_row_size) {
+                reportError(ParserError::BUFFER_OVERFLOW, "Row exceeds max_row_size", current_row_number_ + 1);
+                result = ParserError::BUFFER_OVERFLOW;
+                done = true;
+            }
+        }
+        
+        if (reader.hasError()) {
+            reportError(ParserError::FILE_READ_ERROR, failure_message + file_path + " (" + reader.getLastError() + ")", 0);
+            result = ParserError::FILE_READ_ERROR;
+        } else if (!carry.empty()) {
+            consume(carry.data(), carry.size(), true);
+        }
+        
+        // EN: Deliver the last partial batch unless a callback or stopParsing() ended the parse
+        // FR: Transmet le dernier lot partiel sauf si un callback ou stopParsing() a terminé le parsing
+        if (!checkShouldStop()) {
+            flushBatch();
+        }
+    } catch (const std::exception& e) {
+        logger.error("streaming_parser", "Exception during parsing: " + std::string(e.what()));
+        result = ParserError::CALLBACK_ERROR;
+    }
+    
+    reader.close();
+    stats_.stopTiming();
+    logger.info("streaming_parser", "Parsing completed. " + 
+                std::to_string(stats_.getRowsParsed()) + " rows processed");
+    
+    setParsingState(false, false);
+    return result;
+}
+
+ParserError StreamingParser::parseMappedRangeParallel(const char* data, size_t begin, size_t size, size_t thread_count) {
+    // EN: Speculative chunked parsing in two passes over fixed-size chunks:
+    //     1. count quotes per chunk in parallel; a prefix parity gives the quote state at every chunk start,
+    //        so a worker never mistakes a newline inside a quoted field for a row boundary;
+    //     2. each worker moves its chunk start to the next real row start and tokenizes up to the next
+    //        chunk's row start. Chunks are consumed in order through a bounded window of futures (the reorder
+    //        buffer) and rows are delivered on this thread with sequential numbering.
+    // FR: Parsing spéculatif par chunks en deux passes sur des chunks de taille fixe :
+    //     1. compte les quotes par chunk en parallèle ; une parité préfixe donne l'état des quotes au début de
+    //        chaque chunk, un worker ne prend donc jamais une fin de ligne dans un champ quoté pour une limite ;
+    //     2. chaque worker avance son début de chunk au prochain vrai début de ligne et découpe jusqu'au début
+    //        de ligne du chunk suivant. Les chunks sont consommés dans l'ordre via une fenêtre bornée de futures
+    //        (le tampon de réordonnancement) et les lignes sont transmises sur ce thread avec une numérotation
+    //        séquentielle.
+    const size_t chunk_size = config_.parallel_chunk_size;
+    const size_t chunk_count = (size - begin + chunk_size - 1) / chunk_size;
+    const size_t window_size = thread_count * 2;
+    auto chunkStart = [=](size_t chunk) { return std::min(begin + chunk * chunk_size, size); };
+    
+    ThreadPoolConfig pool_config;
+    pool_config.initial_threads = thread_count;
+    pool_config.min_threads = thread_count;
+    pool_config.max_threads = thread_count;
+    pool_config.max_queue_size = std::max(window_size, thread_count) + 1;
+    pool_config.enable_auto_scaling = false;
+    ThreadPool pool(pool_config);
+    
+    // EN: Pass 1: quote parity at each chunk start
+    // FR: Passe 1 : parité des quotes au début de chaque chunk
+    std::vector<uint8_t> chunk_parity(chunk_count, 0);
+    {
+        const char quote = config_.quote_char;
+        const size_t per_task = (chunk_count + thread_count - 1) / thread_count;
+        std::vector<std::future<void>> counts;
+        for (size_t first = 0; first < chunk_count; first += per_task) {
+            size_t last = std::min(first + per_task, chunk_count);
+            counts.push_back(pool.submit([&chunk_parity, &chunkStart, data, quote, first, last] {
+                for (size_t chunk = first; chunk < last; ++chunk) {
+                    chunk_parity[chunk] = static_cast<uint8_t>(
+                        std::count(data + chunkStart(chunk), data + chunkStart(chunk + 1), quote) & 1);
+                }
+            }));
+        }
+        for (auto& count : counts) {
+            count.get();
+        }
+    }
+    bool in_quotes = false;
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+        bool chunk_quotes = chunk_parity[chunk] != 0;
+        chunk_parity[chunk] = in_quotes;
+        in_quotes ^= chunk_quotes;
+    }
+    
+    // EN: Pass 2: tokenize row-aligned chunks on the pool
+    // FR: Passe 2 : découpe des chunks alignés sur les lignes dans le pool
+    std::atomic<bool> cancelled{false};
+    const ParserConfig config = config_;
+    const std::vector<size_t> projection = projection_;
+    auto parseChunk = [&chunk_parity, &chunkStart, &cancelled, &config, &projection, data, begin, size, chunk_count](size_t chunk) {
+        ParsedChunk parsed;
+        RowTokenizer tokenizer(config);
+        auto rowStart = [&](size_t index) {
+            if (index == 0) {
+                return begin;
+            }
+            if (index >= chunk_count) {
+                return size;
+            }
+            return tokenizer.findNextRowStart(data, chunkStart(index), size, chunk_parity[index] != 0);
+        };
+        size_t chunk_begin = rowStart(chunk);
+        size_t chunk_end = std::max(chunk_begin, rowStart(chunk + 1));
+        tokenizer.setProjection(projection);
+        
+        std::less<const char*> before;
+        auto outcome = tokenizer.tokenize(data, chunk_begin, chunk_end, [&](const std::vector<std::string_view>& fields, size_t row_end) {
+            for (const auto& field : fields) {
+                if (field.empty()) {
+                    parsed.fields.push_back(ChunkField{0, 0, false});
+                } else if (!before(field.data(), data) && before(field.data(), data + size)) {
+                    parsed.fields.push_back(ChunkField{static_cast<size_t>(field.data() - data), field.size(), false});
+                } else {
+                    parsed.fields.push_back(ChunkField{parsed.scratch.size(), field.size(), true});
+                    parsed.scratch.append(field);
+                }
+            }
+            parsed.row_ends.push_back(parsed.fields.size());
+            parsed.row_offsets.push_back(row_end);
+            return !cancelled.load(std::memory_order_relaxed);
+        });
+        parsed.unterminated_quote = outcome.unterminated_quote;
+        parsed.fields_skipped = outcome.fields_skipped;
+        return parsed;
+    };
+    
+    std::deque<std::future<ParsedChunk>> in_flight;
+    size_t next_chunk = 0;
+    auto fillWindow = [&] {
+        while (next_chunk < chunk_count && in_flight.size() < window_size) {
+            in_flight.push_back(pool.submit(parseChunk, next_chunk++));
+        }
+    };
+    
+    // EN: Cancel and wait for queued chunks: the pool only joins its workers, it does not run leftover tasks
+    // FR: Annule et attend les chunks en file : le pool ne fait que rejoindre ses workers, il n'exécute pas
+    //     les tâches restantes
+    auto drainInFlight = [&] {
+        cancelled = true;
+        for (auto& pending : in_flight) {
+            pending.wait();
+        }
+        in_flight.clear();
+        field_views_.clear();
+    };
+    
+    ParserError result = ParserError::SUCCESS;
+    try {
+        fillWindow();
+        bool stopped = false;
+        while (!in_flight.empty() && !stopped) {
+            ParsedChunk parsed = in_flight.front().get();
+            in_flight.pop_front();
+            fillWindow();
+            stats_.addFieldsSkipped(parsed.fields_skipped);
+            
+            size_t field_begin = 0;
+            for (size_t row = 0; row < parsed.row_ends.size(); ++row) {
+                field_views_.clear();
+                for (size_t i = field_begin; i < parsed.row_ends[row]; ++i) {
+                    const ChunkField& field = parsed.fields[i];
+                    const char* base = field.in_scratch ? parsed.scratch.data() : data;
+                    field_views_.emplace_back(field.length == 0 ? std::string_view() : std::string_view(base + field.offset, field.length));
+                }
+                field_begin = parsed.row_ends[row];
+                if (!deliverRowView(field_views_, parsed.row_offsets[row])) {
+                    stopped = true;
+                    break;
+                }
+            }
+            
+            if (!stopped && parsed.unterminated_quote) {
+                reportUnterminatedQuote(result);
+            }
+        }
+    } catch (...) {
+        drainInFlight();
+        throw;
+    }
+    
+    drainInFlight();
+    return result;
+}
+
+bool StreamingParser::deliverRowView(const std::vector<std::string_view>& fields, size_t bytes_consumed) {
+    // EN: Number and deliver one tokenized row; honor pause/stop periodically
+    // FR: Numérote et transmet une ligne découpée ; respecte pause/arrêt périodiquement
+    current_row_number_++;
+    if (index_data_ != nullptr) {
+        indexRow(bytes_consumed);
+    }
+    bool keep_going = dispatchRowView(current_row_number_, fields);
+    if (!keep_going) {
+        should_stop_ = true;
+    }
+    
+    if (current_row_number_ % 1000 == 0) {
+        reportProgress(bytes_consumed);
+        if (!waitWhilePaused()) {
+            return false;
+        }
+    }
+    
+    // EN: stopParsing() called from a callback ends the parse after this row, as on the buffered path
+    // FR: stopParsing() appelé depuis un callback termine le parsing après cette ligne, comme sur le chemin bufferisé
+    return keep_going && !checkShouldStop();
+}
+
+void StreamingParser::indexRow(size_t row_end) {
+    // EN: The row just cut started where the previous one ended; the LF of a CRLF pair is stepped over so
+    //     checkpoints land on the first byte of the row
+    // FR: La ligne qui vient d'être découpée commence où la précédente s'est terminée ; le LF d'une paire CRLF
+    //     est sauté pour que les points de reprise tombent sur le premier octet de la ligne
+    if (!config_.has_header || current_row_number_ > 1) {
+        row_index_.addRow(index_next_row_start_);
+    }
+    index_next_row_start_ = row_end;
+    if (row_end > 0 && row_end < index_size_ && index_data_[row_end - 1] == '\r' && index_data_[row_end] == '\n') {
+        ++index_next_row_start_;
+    }
+}
+
+bool StreamingParser::dispatchRowView(size_t row_number, const std::vector<std::string_view>& fields) {
+    // EN: Deliver a row to the registered callbacks; returns false when a callback asks to stop
+    // FR: Transmet une ligne aux callbacks enregistrés ; retourne false quand un callback demande l'arrêt
+    if (config_.has_header && row_number == 1) {
+        setHeaders(std::vector<std::string>(fields.begin(), fields.end()));
+        stats_.incrementRowsSkipped(); // EN: Header is not counted as data row / FR: En-tête n'est pas comptée comme ligne de données
+        return true;
+    }
+    
+    stats_.incrementRowsParsed();
+    stats_.recordFieldCount(fields.size());
+    
+    if (batch_callback_ && !appendToBatch(row_number, fields)) {
+        return false;
+    }
+    
+    RowView view(row_number, fields, headers_.get());
+    if (row_view_callback_ && !row_view_callback_(view, ParserError::SUCCESS)) {
+        return false;
+    }
+    
+    // EN: As on the buffered path, a row callback returning false only skips its row
+    // FR: Comme sur le chemin bufferisé, un callback de ligne retournant false n'abandonne que sa ligne
+    if (row_callback_) {
+        deliverParsedRow(row_number, fields);
+    }
+    
+    return true;
+}
+
+void StreamingParser::deliverParsedRow(size_t row_number, const std::vector<std::string_view>& fields) {
+    // EN: Materialize the row in the row storage, count the heap allocations it took, and rewind the arena once
+    //     the callback is done with the row
+    // FR: Matérialise la ligne dans le stockage de lignes, compte les allocations sur le tas qu'elle a coûtées, et
+    //     rembobine l'arène une fois le callback terminé avec la ligne
+    if (!row_arena_) {
+        row_arena_ = std::make_unique<RowArena>(config_.row_arena_size);
+        stats_.addHeapAllocations(row_arena_->getHeapAllocations());
+    }
+    
+    {
+        const size_t heap_before = row_arena_->getHeapAllocations();
+        ParsedRow parsed_row(row_number, fields, headers_, row_arena_->resource());
+        stats_.addHeapAllocations(row_arena_->getHeapAllocations() - heap_before);
+        row_callback_(parsed_row, ParserError::SUCCESS);
+    }
+    row_arena_->rewind();
+}
+
+void StreamingParser::setHeaders(std::vector<std::string> names) {
+    // EN: Build the header index once; rows and batches share it instead of copying header names
+    // FR: Construit l'index d'en-têtes une fois ; lignes et lots le partagent au lieu de copier les noms
+    headers_ = std::make_shared<const HeaderIndex>(std::move(names));
+    batch_.setHeaders(headers_);
+}
+
+template<typename Field>
+bool StreamingParser::appendToBatch(size_t row_number, const std::vector<Field>& fields) {
+    // EN: Queue a row in the columnar batch and deliver the batch once it is full
+    // FR: Ajoute une ligne au lot colonnaire et transmet le lot une fois plein
+    batch_.appendRow(row_number, fields);
+    if (batch_.getRowCount() >= std::max<size_t>(1, config_.batch_size)) {
+        return flushBatch();
+    }
+    return true;
+}
+
+bool StreamingParser::flushBatch() {
+    // EN: Hand the batch to the callback and reuse its storage for the next one
+    // FR: Passe le lot au callback et réutilise son stockage pour le suivant
+    if (!batch_callback_ || batch_.empty()) {
+        return true;
+    }
+    bool keep_going = batch_callback_(batch_, ParserError::SUCCESS);
+    batch_.clear();
+    return keep_going;
+}
+
+size_t StreamingParser::parseMappedHeader(const char* data, size_t begin, size_t size, ParserError& result) {
+    // EN: Tokenize line by line until the header row has been delivered; returns where data rows start
+    // FR: Découpe ligne par ligne jusqu'à la transmission de la ligne d'en-tête ; retourne le début des données
+    size_t pos = begin;
+    while (current_row_number_ == 0 && pos < size) {
+        size_t line_end = tokenizer_.findNextRowStart(data, pos, size, false);
+        auto outcome = tokenizer_.tokenize(data, pos, line_end, [this](const std::vector<std::string_view>& fields, size_t row_end) {
+            return deliverRowView(fields, row_end);
+        });
+        if (outcome.unterminated_quote) {
+            reportUnterminatedQuote(result);
+        }
+        pos = line_end;
+    }
+    return pos;
+}
+
+void StreamingParser::reportUnterminatedQuote(ParserError& result) {
+    stats_.incrementRowsWithErrors();
+    reportError(ParserError::MALFORMED_ROW, "Unterminated quoted field at end of input", current_row_number_ + 1);
+    if (config_.strict_mode) {
+        result = ParserError::MALFORMED_ROW;
+    }
+}
+
+ParserError StreamingParser::applyProjection() {
+    // EN: Resolve projected names against the header and indices as given, then narrow the delivered header
+    //     to the projected columns
+    // FR: Résout les noms projetés avec l'en-tête et les index tels quels, puis réduit l'en-tête transmis
+    //     aux colonnes projetées
+    projection_.clear();
+    if (!hasProjectionConfig()) {
+        tokenizer_.setProjection({});
+        return ParserError::SUCCESS;
+    }
+    
+    for (const auto& name : config_.projected_columns) {
+        auto index = headers_ != nullptr ? headers_->find(name) : std::nullopt;
+        if (!index.has_value()) {
+            reportError(ParserError::MALFORMED_ROW, "Projected column not found in header: " + name, 1);
+            if (config_.strict_mode) {
+                return ParserError::MALFORMED_ROW;
+            }
+            continue;
+        }
+        projection_.push_back(index.value());
+    }
+    projection_.insert(projection_.end(), config_.projected_column_indices.begin(), config_.projected_column_indices.end());
+    
+    // EN: Duplicates keep their first position, as in the tokenizer
+    // FR: Les doublons gardent leur première position, comme dans le tokenizer
+    std::vector<size_t> unique_columns;
+    for (size_t column : projection_) {
+        if (std::find(unique_columns.begin(), unique_columns.end(), column) == unique_columns.end()) {
+            unique_columns.push_back(column);
+        }
+    }
+    projection_ = std::move(unique_columns);
+    
+    // EN: An empty projection would mean all columns, so a projection none of whose names resolved is an error
+    //     even outside strict mode, rather than rows wider than their header
+    // FR: Une projection vide signifierait toutes les colonnes, une projection dont aucun nom n'est résolu est donc
+    //     une erreur même hors mode strict, plutôt que des lignes plus larges que leur en-tête
+    if (projection_.empty()) {
+        if (!config_.strict_mode) {
+            reportError(ParserError::MALFORMED_ROW, "No projected column found in header", 1);
+        }
+        return ParserError::MALFORMED_ROW;
+    }
+    tokenizer_.setProjection(projection_);
+    
+    if (headers_ != nullptr) {
+        std::vector<std::string> projected_names;
+        projected_names.reserve(projection_.size());
+        for (size_t column : projection_) {
+            projected_names.push_back(column < headers_->names.size() ? headers_->names[column] : std::string());
+        }
+        setHeaders(std::move(projected_names));
+    }
+    return ParserError::SUCCESS;
+}
+
+size_t StreamingParser::resolveThreadCount() const {
+    // EN: Worker threads for the mapped path (1 = sequential)
+    // FR: Threads workers pour le chemin mappé (1 = séquentiel)
+    if (!config_.enable_parallel_processing) {
+        return 1;
+    }
+    if (config_.thread_count > 0) {
+        return config_.thread_count;
+    }
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
 ParserError StreamingParser::handleEncoding(std::istream& stream) {
     // EN: Handle file encoding detection and conversion
     // FR: Gère la détection et conversion d'encodage de fichier
@@ -947,5 +2110,13 @@ bool StreamingParser::checkShouldStop() const {
     return should_stop_.load();
 }
 
+bool StreamingParser::waitWhilePaused() {
+    // EN: Block while paused; returns false if a stop was requested
+    // FR: Bloque pendant la pause ; retourne false si un arrêt a été demandé
+    std::unique_lock<std::mutex> lock(parsing_mutex_);
+    parsing_cv_.wait(lock, [this] { return !is_paused_ || should_stop_; });
+    return !should_stop_;
+}
+
 } // namespace CSV
 } // namespace BBP
\ No newline at end of file
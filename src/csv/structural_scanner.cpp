@@ -0,0 +1,257 @@
+// EN: Vectorized CSV structural-character scanner implementation (scalar, SSE4.2 and AVX2 classifiers)
+// FR: Implémentation du scanner vectorisé des caractères structurels CSV (classifieurs scalaire, SSE4.2 et AVX2)
+
+#include "csv/structural_scanner.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__)
+#define BBP_SCANNER_X86 1
+#include <immintrin.h>
+#else
+#define BBP_SCANNER_X86 0
+#endif
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+constexpr size_t kBlockSize = 64;       // EN: Bytes per bitmask / FR: Octets par masque de bits
+constexpr size_t kBatchBlocks = 64;     // EN: Blocks classified per backend call (4 KB) / FR: Blocs classifiés par appel backend (4 Ko)
+
+// EN: Propagate the quote carry: all ones if the block ends inside quotes, zero otherwise
+// FR: Propage la retenue de quote : tous les bits à 1 si le bloc finit dans des quotes, zéro sinon
+inline uint64_t quoteCarry(uint64_t inside_quotes) {
+    return 0 - (inside_quotes >> 63);
+}
+
+// EN: Prefix XOR with shifts: bit i = parity of quote bits 0..i
+// FR: XOR préfixe par décalages : bit i = parité des bits de quote 0..i
+inline uint64_t prefixXorPortable(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+void classifyScalar(const char* data, size_t block_count, char delimiter, char quote_char,
+                    uint64_t& quote_carry, BlockMasks* out) {
+    for (size_t block = 0; block < block_count; ++block) {
+        const char* bytes = data + block * kBlockSize;
+        uint64_t quotes = 0;
+        uint64_t delimiters = 0;
+        uint64_t newlines = 0;
+        for (size_t i = 0; i < kBlockSize; ++i) {
+            const char c = bytes[i];
+            const uint64_t bit = uint64_t{1} << i;
+            quotes |= (c == quote_char) ? bit : 0;
+            delimiters |= (c == delimiter) ? bit : 0;
+            newlines |= (c == '\n' || c == '\r') ? bit : 0;
+        }
+        const uint64_t inside_quotes = prefixXorPortable(quotes) ^ quote_carry;
+        quote_carry = quoteCarry(inside_quotes);
+        out[block] = BlockMasks{quotes, delimiters, newlines, inside_quotes};
+    }
+}
+
+#if BBP_SCANNER_X86
+
+// EN: Prefix XOR as a carry-less multiplication by all ones
+// FR: XOR préfixe comme multiplication sans retenue par tous les bits à 1
+__attribute__((target("pclmul")))
+inline uint64_t prefixXorClmul(uint64_t bits) {
+    const __m128i all_ones = _mm_set1_epi8(static_cast<char>(0xFF));
+    const __m128i product = _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<long long>(bits)), all_ones, 0);
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(product));
+}
+
+__attribute__((target("sse4.2,pclmul")))
+void classifySse42(const char* data, size_t block_count, char delimiter, char quote_char,
+                   uint64_t& quote_carry, BlockMasks* out) {
+    const __m128i quote_vec = _mm_set1_epi8(quote_char);
+    const __m128i delimiter_vec = _mm_set1_epi8(delimiter);
+    const __m128i lf_vec = _mm_set1_epi8('\n');
+    const __m128i cr_vec = _mm_set1_epi8('\r');
+
+    for (size_t block = 0; block < block_count; ++block) {
+        const char* bytes = data + block * kBlockSize;
+        uint64_t quotes = 0;
+        uint64_t delimiters = 0;
+        uint64_t newlines = 0;
+        for (size_t lane = 0; lane < 4; ++lane) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + lane * 16));
+            const unsigned shift = static_cast<unsigned>(lane * 16);
+            quotes |= static_cast<uint64_t>(static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote_vec)))) << shift;
+            delimiters |= static_cast<uint64_t>(static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, delimiter_vec)))) << shift;
+            newlines |= static_cast<uint64_t>(static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, lf_vec), _mm_cmpeq_epi8(chunk, cr_vec))))) << shift;
+        }
+        const uint64_t inside_quotes = prefixXorClmul(quotes) ^ quote_carry;
+        quote_carry = quoteCarry(inside_quotes);
+        out[block] = BlockMasks{quotes, delimiters, newlines, inside_quotes};
+    }
+}
+
+__attribute__((target("avx2")))
+inline uint64_t movemask(__m256i mask) {
+    return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(mask)));
+}
+
+__attribute__((target("avx2,pclmul")))
+void classifyAvx2(const char* data, size_t block_count, char delimiter, char quote_char,
+                  uint64_t& quote_carry, BlockMasks* out) {
+    const __m256i quote_vec = _mm256_set1_epi8(quote_char);
+    const __m256i delimiter_vec = _mm256_set1_epi8(delimiter);
+    const __m256i lf_vec = _mm256_set1_epi8('\n');
+    const __m256i cr_vec = _mm256_set1_epi8('\r');
+
+    for (size_t block = 0; block < block_count; ++block) {
+        const char* bytes = data + block * kBlockSize;
+        const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+        const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + 32));
+
+        const uint64_t quotes = movemask(_mm256_cmpeq_epi8(low, quote_vec)) |
+                                (movemask(_mm256_cmpeq_epi8(high, quote_vec)) << 32);
+        const uint64_t delimiters = movemask(_mm256_cmpeq_epi8(low, delimiter_vec)) |
+                                    (movemask(_mm256_cmpeq_epi8(high, delimiter_vec)) << 32);
+        const uint64_t newlines =
+            movemask(_mm256_or_si256(_mm256_cmpeq_epi8(low, lf_vec), _mm256_cmpeq_epi8(low, cr_vec))) |
+            (movemask(_mm256_or_si256(_mm256_cmpeq_epi8(high, lf_vec), _mm256_cmpeq_epi8(high, cr_vec))) << 32);
+
+        const uint64_t inside_quotes = prefixXorClmul(quotes) ^ quote_carry;
+        quote_carry = quoteCarry(inside_quotes);
+        out[block] = BlockMasks{quotes, delimiters, newlines, inside_quotes};
+    }
+}
+
+#endif // BBP_SCANNER_X86
+
+} // anonymous namespace
+
+StructuralScanner::StructuralScanner(char delimiter, char quote_char, ScannerBackend backend)
+    : delimiter_(delimiter), quote_char_(quote_char) {
+    // EN: Resolve AUTO and fall back to scalar for backends this CPU cannot run
+    // FR: Résout AUTO et se replie sur le scalaire pour les backends que ce CPU ne peut pas exécuter
+    if (backend == ScannerBackend::AUTO) {
+        backend = detectBackend();
+    } else if (!isSupported(backend)) {
+        backend = ScannerBackend::SCALAR;
+    }
+    backend_ = backend;
+
+    switch (backend_) {
+#if BBP_SCANNER_X86
+        case ScannerBackend::AVX2:  classify_ = classifyAvx2; break;
+        case ScannerBackend::SSE42: classify_ = classifySse42; break;
+#endif
+        default:                    classify_ = classifyScalar; break;
+    }
+}
+
+size_t StructuralScanner::scan(const char* data, size_t size, bool& in_quotes, std::vector<StructuralIndex>& out) const {
+    // EN: Stage 1 classifies a batch of blocks into bitmasks, stage 2 walks the set bits of the structural mask
+    // FR: L'étape 1 classifie un lot de blocs en masques, l'étape 2 parcourt les bits à 1 du masque structurel
+    uint64_t quote_carry = in_quotes ? ~uint64_t{0} : 0;
+    uint32_t pending_quotes = 0;
+    BlockMasks masks[kBatchBlocks];
+
+    size_t offset = 0;
+    while (offset < size) {
+        const size_t remaining = size - offset;
+        size_t block_count = std::min(remaining / kBlockSize, kBatchBlocks);
+        size_t valid_bytes = block_count * kBlockSize;
+
+        if (block_count > 0) {
+            classify_(data + offset, block_count, delimiter_, quote_char_, quote_carry, masks);
+        } else {
+            // EN: Zero-padded tail block; padding bytes are masked out below
+            // FR: Bloc final complété par des zéros ; les octets de remplissage sont masqués plus bas
+            alignas(kBlockSize) char tail[kBlockSize] = {};
+            std::memcpy(tail, data + offset, remaining);
+            classify_(tail, 1, delimiter_, quote_char_, quote_carry, masks);
+            block_count = 1;
+            valid_bytes = remaining;
+        }
+
+        for (size_t block = 0; block < block_count; ++block) {
+            const BlockMasks& mask = masks[block];
+            const size_t block_bytes = std::min(kBlockSize, valid_bytes - block * kBlockSize);
+            const uint64_t valid = block_bytes == kBlockSize ? ~uint64_t{0} : ((uint64_t{1} << block_bytes) - 1);
+            const uint32_t base = static_cast<uint32_t>(offset + block * kBlockSize);
+
+            uint64_t quotes = mask.quotes & valid;
+            uint64_t structurals = (mask.delimiters | mask.newlines) & ~mask.inside_quotes & valid;
+            while (structurals != 0) {
+                const unsigned bit = static_cast<unsigned>(std::countr_zero(structurals));
+                const uint64_t quotes_before = quotes & ((uint64_t{1} << bit) - 1);
+                out.push_back(StructuralIndex{base + bit, pending_quotes + static_cast<uint32_t>(std::popcount(quotes_before))});
+                pending_quotes = 0;
+                quotes &= ~quotes_before;
+                structurals &= structurals - 1;
+            }
+            pending_quotes += static_cast<uint32_t>(std::popcount(quotes));
+        }
+
+        offset += valid_bytes;
+    }
+
+    in_quotes = quote_carry != 0;
+    return pending_quotes;
+}
+
+void StructuralScanner::classify(const char* data, size_t block_count, bool& in_quotes, BlockMasks* out) const {
+    uint64_t quote_carry = in_quotes ? ~uint64_t{0} : 0;
+    classify_(data, block_count, delimiter_, quote_char_, quote_carry, out);
+    in_quotes = quote_carry != 0;
+}
+
+ScannerBackend StructuralScanner::detectBackend() {
+    // EN: CPU features do not change while running, detect once
+    // FR: Les fonctionnalités CPU ne changent pas à l'exécution, détection unique
+    static const ScannerBackend detected = [] {
+        if (isSupported(ScannerBackend::AVX2)) {
+            return ScannerBackend::AVX2;
+        }
+        if (isSupported(ScannerBackend::SSE42)) {
+            return ScannerBackend::SSE42;
+        }
+        return ScannerBackend::SCALAR;
+    }();
+    return detected;
+}
+
+bool StructuralScanner::isSupported(ScannerBackend backend) {
+    switch (backend) {
+        case ScannerBackend::AUTO:
+        case ScannerBackend::SCALAR:
+            return true;
+#if BBP_SCANNER_X86
+        case ScannerBackend::SSE42:
+            return __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("pclmul");
+        case ScannerBackend::AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("pclmul");
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* StructuralScanner::backendName(ScannerBackend backend) {
+    switch (backend) {
+        case ScannerBackend::AUTO:   return "auto";
+        case ScannerBackend::SCALAR: return "scalar";
+        case ScannerBackend::SSE42:  return "sse4.2";
+        case ScannerBackend::AVX2:   return "avx2";
+    }
+    return "unknown";
+}
+
+} // namespace CSV
+} // namespace BBP
@@ -0,0 +1,269 @@
+// EN: Zone maps and Bloom filters implementation
+// FR: Implémentation des zone maps et des filtres de Bloom
+
+#include "csv/zone_map.hpp"
+#include "csv/query_predicate.hpp"
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+namespace BBP {
+namespace CSV {
+
+namespace {
+
+bool isNullCell(std::string_view cell) {
+    return cell == "NULL" || cell == "null";
+}
+
+// EN: Constant read the way CompiledPredicate reads it; `bounded` is false for NULL and boolean constants,
+//     which the summaries cannot bound
+// FR: Constante lue comme CompiledPredicate la lit ; `bounded` est faux pour les constantes NULL et booléennes,
+//     que les résumés ne savent pas borner
+struct Constant {
+    bool bounded{false};
+    std::string text;
+    bool has_number{false};
+    double number{0.0};
+};
+
+Constant readConstant(const QueryValue& value) {
+    Constant constant;
+    if (std::holds_alternative<std::nullptr_t>(value) || std::holds_alternative<bool>(value)) {
+        return constant;
+    }
+    constant.bounded = true;
+    constant.text = QueryUtils::queryValueToString(value);
+    if (std::holds_alternative<int64_t>(value)) {
+        constant.has_number = true;
+        constant.number = static_cast<double>(std::get<int64_t>(value));
+    } else if (std::holds_alternative<double>(value)) {
+        constant.has_number = true;
+        constant.number = std::get<double>(value);
+    } else {
+        constant.has_number = parseNumericCell(constant.text, constant.number);
+    }
+    return constant;
+}
+
+// EN: Whether some value of [min, max] satisfies "value op constant"
+// FR: Si une valeur de [min, max] satisfait « valeur op constante »
+template<typename T>
+bool rangeMayCompare(const T& min, const T& max, const T& constant, SqlOperator op) {
+    switch (op) {
+        case SqlOperator::LESS_THAN:     return min < constant;
+        case SqlOperator::LESS_EQUAL:    return min <= constant;
+        case SqlOperator::GREATER_THAN:  return max > constant;
+        case SqlOperator::GREATER_EQUAL: return max >= constant;
+        case SqlOperator::EQUALS:        return min <= constant && constant <= max;
+        default:                         return true;
+    }
+}
+
+uint64_t mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+} // anonymous namespace
+
+// EN: BloomFilter implementation
+// FR: Implémentation de BloomFilter
+
+BloomFilter::BloomFilter(size_t distinct_values)
+    : bits_(distinct_values == 0 ? 0 : std::bit_ceil(std::max<size_t>(64, distinct_values * kBitsPerValue)) / 64, 0) {}
+
+uint64_t BloomFilter::hash(std::string_view value) {
+    return mix(std::hash<std::string_view>{}(value));
+}
+
+void BloomFilter::add(uint64_t hash) {
+    if (bits_.empty()) {
+        return;
+    }
+    const uint64_t mask = bits_.size() * 64 - 1;
+    const uint64_t step = mix(hash) | 1;
+    for (size_t probe = 0; probe < kProbes; ++probe, hash += step) {
+        const uint64_t bit = hash & mask;
+        bits_[bit >> 6] |= uint64_t{1} << (bit & 63);
+    }
+}
+
+bool BloomFilter::mayContain(uint64_t hash) const {
+    if (bits_.empty()) {
+        return false;
+    }
+    const uint64_t mask = bits_.size() * 64 - 1;
+    const uint64_t step = mix(hash) | 1;
+    for (size_t probe = 0; probe < kProbes; ++probe, hash += step) {
+        const uint64_t bit = hash & mask;
+        if (!(bits_[bit >> 6] & (uint64_t{1} << (bit & 63)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// EN: ZoneMap implementation
+// FR: Implémentation de ZoneMap
+
+ZoneMap::ZoneMap(const ColumnarTable& table, size_t column, size_t block_rows) : block_rows_(block_rows) {
+    addBlocks(table, column);
+}
+
+void ZoneMap::extend(const ColumnarTable& table, size_t column) {
+    if (!blocks_.empty() && blocks_.back().row_count < block_rows_) {
+        row_count_ -= blocks_.back().row_count;
+        blocks_.pop_back();
+    }
+    addBlocks(table, column);
+}
+
+void ZoneMap::addBlocks(const ColumnarTable& table, size_t column) {
+    const size_t rows = table.getRowCount();
+    blocks_.reserve((rows + block_rows_ - 1) / block_rows_);
+    std::vector<uint64_t> hashes;
+    for (size_t begin = row_count_; begin < rows; begin += block_rows_) {
+        Block block;
+        block.row_count = std::min(block_rows_, rows - begin);
+        hashes.clear();
+        bool has_text = false;
+        for (size_t row = begin; row < begin + block.row_count; ++row) {
+            std::string_view cell = table.getValue(row, column);
+            if (isNullCell(cell)) {
+                ++block.null_count;
+                continue;
+            }
+            double number = 0.0;
+            if (parseNumericCell(cell, number)) {
+                block.min_number = block.numeric_count ? std::min(block.min_number, number) : number;
+                block.max_number = block.numeric_count ? std::max(block.max_number, number) : number;
+                ++block.numeric_count;
+            }
+            if (!has_text || cell < block.min_text) {
+                block.min_text = cell;
+            }
+            if (!has_text || cell > block.max_text) {
+                block.max_text = cell;
+            }
+            has_text = true;
+            hashes.push_back(BloomFilter::hash(cell));
+        }
+
+        // EN: Sized from the distinct values of the block, so a low-cardinality column keeps a tiny filter
+        // FR: Dimensionné selon les valeurs distinctes du bloc, une colonne de faible cardinalité garde donc un
+        //     filtre minuscule
+        std::sort(hashes.begin(), hashes.end());
+        hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+        block.values = BloomFilter(hashes.size());
+        for (uint64_t hash : hashes) {
+            block.values.add(hash);
+        }
+        blocks_.push_back(std::move(block));
+    }
+    row_count_ = rows;
+}
+
+bool ZoneMap::canPrune(const WhereCondition& condition) {
+    switch (condition.operator_) {
+        case SqlOperator::EQUALS:
+        case SqlOperator::LESS_THAN:
+        case SqlOperator::LESS_EQUAL:
+        case SqlOperator::GREATER_THAN:
+        case SqlOperator::GREATER_EQUAL:
+        case SqlOperator::BETWEEN:
+        case SqlOperator::IN:
+        case SqlOperator::IS_NULL:
+        case SqlOperator::IS_NOT_NULL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ZoneMap::mayMatch(size_t block_index, const WhereCondition& condition) const {
+    const Block& block = blocks_[block_index];
+    switch (condition.operator_) {
+        case SqlOperator::IS_NULL:
+            return block.null_count > 0;
+        case SqlOperator::IS_NOT_NULL:
+            return block.null_count < block.row_count;
+        case SqlOperator::EQUALS:
+            return mayEqual(block, condition.value);
+        case SqlOperator::IN:
+            return std::any_of(condition.in_values.begin(), condition.in_values.end(),
+                               [&block](const QueryValue& value) { return mayEqual(block, value); });
+        case SqlOperator::LESS_THAN:
+        case SqlOperator::LESS_EQUAL:
+        case SqlOperator::GREATER_THAN:
+        case SqlOperator::GREATER_EQUAL:
+            return mayCompare(block, condition.value, condition.operator_);
+        case SqlOperator::BETWEEN:
+            // EN: A matching row satisfies both bounds, so the block must allow each of them
+            // FR: Une ligne correspondante satisfait les deux bornes, le bloc doit donc permettre chacune
+            return mayCompare(block, condition.range_start, SqlOperator::GREATER_EQUAL) &&
+                   mayCompare(block, condition.range_end, SqlOperator::LESS_EQUAL);
+        default:
+            return true;
+    }
+}
+
+bool ZoneMap::mayEqual(const Block& block, const QueryValue& value) {
+    const Constant constant = readConstant(value);
+    if (!constant.bounded) {
+        return true;
+    }
+    const size_t non_null = block.row_count - block.null_count;
+    if (non_null == 0) {
+        return false;
+    }
+    // EN: Numeric cells compare as numbers against a numeric constant; every other cell compares as text, and
+    //     then only its exact spelling matches
+    // FR: Les cellules numériques se comparent comme nombres à une constante numérique ; toute autre cellule se
+    //     compare comme texte, et seule son écriture exacte correspond alors
+    if (constant.has_number && block.numeric_count > 0 &&
+        rangeMayCompare(block.min_number, block.max_number, constant.number, SqlOperator::EQUALS)) {
+        return true;
+    }
+    if (constant.has_number && block.numeric_count == non_null) {
+        return false;
+    }
+    return rangeMayCompare(block.min_text, block.max_text, constant.text, SqlOperator::EQUALS) &&
+           block.values.mayContain(BloomFilter::hash(constant.text));
+}
+
+bool ZoneMap::mayCompare(const Block& block, const QueryValue& value, SqlOperator op) {
+    const Constant constant = readConstant(value);
+    if (!constant.bounded) {
+        return true;
+    }
+    const size_t non_null = block.row_count - block.null_count;
+    if (non_null == 0) {
+        return false;
+    }
+    if (!constant.has_number) {
+        return rangeMayCompare(block.min_text, block.max_text, constant.text, op);
+    }
+    // EN: Cells that are not numbers compare as text against a numeric constant; their range is not kept
+    // FR: Les cellules non numériques se comparent comme texte à une constante numérique ; leur plage n'est pas
+    //     conservée
+    if (block.numeric_count < non_null) {
+        return true;
+    }
+    return rangeMayCompare(block.min_number, block.max_number, constant.number, op);
+}
+
+size_t ZoneMap::getMemoryUsage() const {
+    size_t bytes = sizeof(*this) + blocks_.capacity() * sizeof(Block);
+    for (const auto& block : blocks_) {
+        bytes += block.min_text.capacity() + block.max_text.capacity() + block.values.getMemoryUsage();
+    }
+    return bytes;
+}
+
+} // namespace CSV
+} // namespace BBP
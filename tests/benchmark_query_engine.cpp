@@ -0,0 +1,491 @@
+// EN: Benchmarks for the query engine: WHERE scans with per-cell interpreted evaluation vs compiled predicates,
+//     row at a time vs batch selection; hash joins in memory vs spilled; GROUP BY hash aggregation;
+//     ORDER BY ... LIMIT with a full sort vs a Top-K heap; streaming queries over a CSV file; index creation
+//     built in memory vs mapped from its saved file; full-text search vs LIKE scan; morsel-parallel scans by
+//     thread count; scans with and without zone maps
+// FR: Benchmarks du moteur de requêtes : parcours WHERE avec évaluation interprétée par cellule vs prédicats compilés,
+//     ligne par ligne vs sélection par lots ; jointures par hachage en mémoire vs débordées ; agrégation par hachage
+//     GROUP BY ; ORDER BY ... LIMIT par tri complet vs tas Top-K ; requêtes en flux sur un fichier CSV ; création
+//     d'index construit en mémoire vs mappé depuis son fichier enregistré ; recherche texte intégral vs parcours LIKE ;
+//     parcours parallèles par morceaux selon le nombre de threads ; parcours avec et sans zone maps
+
+#include <benchmark/benchmark.h>
+#include "csv/hash_join.hpp"
+#include "csv/query_engine.hpp"
+#include "csv/query_predicate.hpp"
+#include <filesystem>
+#include <fstream>
+#include <regex>
+
+using namespace BBP::CSV;
+
+namespace {
+
+// EN: 02_probe-like table shared by the scans
+// FR: Table de type 02_probe partagée par les parcours
+const std::shared_ptr<ColumnarTable>& probeTable() {
+    static const std::shared_ptr<ColumnarTable> table = [] {
+        std::vector<std::string> headers = {"host", "url", "scheme", "status_code", "response_time_ms", "cdn_provider",
+                                            "content_length"};
+        std::vector<std::vector<std::string>> rows;
+        rows.reserve(100000);
+        for (size_t i = 0; i < 100000; ++i) {
+            rows.push_back({"api" + std::to_string(i) + ".example.com",
+                            "https://api" + std::to_string(i) + ".example.com/v1/users?id=" + std::to_string(i),
+                            i % 4 ? "https" : "http", std::to_string(200 + (i % 5) * 100), std::to_string(i % 1500),
+                            i % 3 ? "cloudflare" : "akamai", std::to_string((i * 7919) % 100000)});
+        }
+        return ColumnarTable::fromRows(headers, rows);
+    }();
+    return table;
+}
+
+// EN: Scanned clauses: numeric range, LIKE on a plain column, equality on a dictionary column, then numeric
+//     range and text equality on plain columns
+// FR: Clauses parcourues : plage numérique, LIKE sur une colonne simple, égalité sur une colonne à dictionnaire,
+//     puis plage numérique et égalité textuelle sur des colonnes simples
+const char* const kScanQueries[] = {
+    "SELECT * FROM probe WHERE response_time_ms > 1000",
+    "SELECT * FROM probe WHERE url LIKE '%id=42%'",
+    "SELECT * FROM probe WHERE cdn_provider = 'akamai' AND status_code = 404",
+    "SELECT * FROM probe WHERE content_length BETWEEN 1000 AND 5000",
+    "SELECT * FROM probe WHERE host = 'api4242.example.com'",
+};
+constexpr int64_t kLastScanQuery = 4;
+
+std::vector<WhereCondition> scanConditions(int64_t query) {
+    QueryParser parser;
+    SqlQuery parsed;
+    parser.parse(kScanQueries[query], parsed);
+    return parsed.where;
+}
+
+// EN: Reference: what evaluation used to cost, one QueryValue conversion per cell and one regex per LIKE test
+// FR: Référence : le coût de l'évaluation d'avant, une conversion QueryValue par cellule et une regex par test LIKE
+bool interpretedCondition(const std::string& cell, const WhereCondition& condition) {
+    QueryValue value = QueryUtils::stringToQueryValue(cell);
+    if (condition.operator_ == SqlOperator::LIKE) {
+        std::string pattern = condition.pattern;
+        for (size_t pos = 0; (pos = pattern.find('%', pos)) != std::string::npos; pos += 2) {
+            pattern.replace(pos, 1, ".*");
+        }
+        return std::regex_match(QueryUtils::queryValueToString(value), std::regex(pattern));
+    }
+    return QueryUtils::compareValues(value, condition.value, condition.operator_);
+}
+
+} // anonymous namespace
+
+static void BM_ScanInterpreted(benchmark::State& state) {
+    const ColumnarTable& table = *probeTable();
+    const auto conditions = scanConditions(state.range(0));
+    std::vector<int> columns;
+    for (const auto& condition : conditions) {
+        columns.push_back(table.getColumnIndex(condition.column));
+    }
+    for (auto _ : state) {
+        size_t matched = 0;
+        for (size_t row = 0; row < table.getRowCount(); ++row) {
+            bool result = true;
+            for (size_t i = 0; i < conditions.size() && result; ++i) {
+                result = interpretedCondition(std::string(table.getValue(row, columns[i])), conditions[i]);
+            }
+            matched += result;
+        }
+        benchmark::DoNotOptimize(matched);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * table.getRowCount()));
+}
+BENCHMARK(BM_ScanInterpreted)->DenseRange(0, kLastScanQuery)->Unit(benchmark::kMillisecond);
+
+static void BM_ScanCompiled(benchmark::State& state) {
+    const ColumnarTable& table = *probeTable();
+    const auto conditions = scanConditions(state.range(0));
+    for (auto _ : state) {
+        CompiledFilter filter(conditions, table);
+        size_t matched = 0;
+        for (size_t row = 0; row < table.getRowCount(); ++row) {
+            matched += filter.matches(row);
+        }
+        benchmark::DoNotOptimize(matched);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * table.getRowCount()));
+}
+BENCHMARK(BM_ScanCompiled)->DenseRange(0, kLastScanQuery)->Unit(benchmark::kMillisecond);
+
+static void BM_ScanBatched(benchmark::State& state) {
+    const ColumnarTable& table = *probeTable();
+    const auto conditions = scanConditions(state.range(0));
+    std::vector<size_t> rows;
+    for (auto _ : state) {
+        CompiledFilter filter(conditions, table);
+        rows.clear();
+        filter.selectRows(0, table.getRowCount(), rows);
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * table.getRowCount()));
+}
+BENCHMARK(BM_ScanBatched)->DenseRange(0, kLastScanQuery)->Unit(benchmark::kMillisecond);
+
+// EN: Whole query through the engine (no cache, no index), projection included
+// FR: Requête complète via le moteur (sans cache ni index), projection comprise
+static void BM_ExecuteScan(benchmark::State& state) {
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    engine.registerTable("probe", probeTable());
+    for (auto _ : state) {
+        QueryResult result = engine.execute(kScanQueries[state.range(0)]);
+        benchmark::DoNotOptimize(result.getRowCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * probeTable()->getRowCount()));
+}
+BENCHMARK(BM_ExecuteScan)->DenseRange(0, kLastScanQuery)->Unit(benchmark::kMillisecond);
+
+namespace {
+
+// EN: 04_discovery-like table: three paths for every other probed host
+// FR: Table de type 04_discovery : trois chemins pour un hôte sondé sur deux
+const std::shared_ptr<ColumnarTable>& discoveryTable() {
+    static const std::shared_ptr<ColumnarTable> table = [] {
+        std::vector<std::vector<std::string>> rows;
+        rows.reserve(150000);
+        for (size_t i = 0; i < 100000; i += 2) {
+            for (const char* path : {"/admin", "/login", "/api/v1"}) {
+                rows.push_back({"api" + std::to_string(i) + ".example.com", path});
+            }
+        }
+        return ColumnarTable::fromRows({"host", "path"}, rows);
+    }();
+    return table;
+}
+
+} // anonymous namespace
+
+// EN: probe LEFT JOIN discovery on host; 0 = in memory, 1 = Grace partitions under a 1 MB budget
+// FR: probe LEFT JOIN discovery sur host ; 0 = en mémoire, 1 = partitions Grace sous un budget de 1 Mo
+static void BM_HashJoin(benchmark::State& state) {
+    const ColumnarTable& probe = *probeTable();
+    const ColumnarTable& discovery = *discoveryTable();
+    const size_t budget = state.range(0) ? (size_t{1} << 20) : (size_t{1} << 30);
+    HashJoin join(JoinClause::LEFT, budget);
+    HashJoin::Pairs pairs;
+    for (auto _ : state) {
+        join.execute(probe, 0, discovery, 0, pairs);
+        benchmark::DoNotOptimize(pairs.left.data());
+    }
+    state.counters["partitions"] = static_cast<double>(join.getPartitionCount());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (probe.getRowCount() + discovery.getRowCount())));
+}
+BENCHMARK(BM_HashJoin)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+
+namespace {
+
+// EN: The probe table written once as a CSV file, for the streaming scans
+// FR: La table probe écrite une fois dans un fichier CSV, pour les parcours en flux
+const std::string& probeFile() {
+    static const std::string path = [] {
+        const ColumnarTable& table = *probeTable();
+        std::string file = (std::filesystem::temp_directory_path() / "bbp_bench_probe.csv").string();
+        std::ofstream out(file, std::ios::trunc);
+        const auto& headers = table.getHeaders();
+        for (size_t c = 0; c < headers.size(); ++c) {
+            out << (c ? "," : "") << headers[c];
+        }
+        out << '\n';
+        for (size_t row = 0; row < table.getRowCount(); ++row) {
+            for (size_t c = 0; c < headers.size(); ++c) {
+                out << (c ? "," : "") << table.getValue(row, c);
+            }
+            out << '\n';
+        }
+        return file;
+    }();
+    return path;
+}
+
+// EN: Filter with projection, grouped aggregation, then a full ORDER BY
+// FR: Filtre avec projection, agrégation groupée, puis un ORDER BY complet
+const char* const kStreamingQueries[] = {
+    "SELECT host, status_code FROM probe WHERE response_time_ms > 1000",
+    "SELECT COUNT(*), AVG(response_time_ms) FROM probe WHERE cdn_provider = 'akamai'",
+    "SELECT host, content_length FROM probe ORDER BY content_length DESC",
+};
+
+} // anonymous namespace
+
+// EN: GROUP BY through the engine: low-cardinality key, then one group per host; second argument = worker threads,
+//     third = max_memory_mb (1 makes the per-host groups spill)
+// FR: GROUP BY via le moteur : clé de faible cardinalité, puis un groupe par hôte ; deuxième argument = threads,
+//     troisième = max_memory_mb (1 fait déborder les groupes par hôte)
+static void BM_GroupBy(benchmark::State& state) {
+    static const char* const queries[] = {
+        "SELECT cdn_provider, COUNT(host), AVG(response_time_ms), MAX(content_length) FROM probe GROUP BY cdn_provider",
+        "SELECT host, COUNT(url), SUM(response_time_ms) FROM probe GROUP BY host",
+    };
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    config.worker_threads = static_cast<size_t>(state.range(1));
+    config.max_memory_mb = static_cast<size_t>(state.range(2));
+    QueryEngine engine(config);
+    engine.registerTable("probe", probeTable());
+    for (auto _ : state) {
+        QueryResult result = engine.execute(queries[state.range(0)]);
+        benchmark::DoNotOptimize(result.getRowCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * probeTable()->getRowCount()));
+}
+BENCHMARK(BM_GroupBy)->ArgsProduct({{0, 1}, {1, 4}, {512}})->Args({1, 4, 1})->Unit(benchmark::kMillisecond);
+
+// EN: "Top 100 by score": 0 = full sort of the result then slice (the previous plan), 1 = Top-K heap on the table
+// FR: « Top 100 par score » : 0 = tri complet du résultat puis découpe (le plan précédent), 1 = tas Top-K sur la table
+static void BM_OrderByLimit(benchmark::State& state) {
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    engine.registerTable("probe", probeTable());
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            QueryResult result = engine.execute("SELECT host, content_length FROM probe");
+            result.sortBy({{"content_length", SortDirection::DESC}});
+            benchmark::DoNotOptimize(result.slice(0, 100).getRowCount());
+        } else {
+            QueryResult result = engine.execute("SELECT host, content_length FROM probe ORDER BY content_length DESC LIMIT 100");
+            benchmark::DoNotOptimize(result.getRowCount());
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * probeTable()->getRowCount()));
+}
+BENCHMARK(BM_OrderByLimit)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+
+// EN: Query over the attached file; the second argument sets max_memory_mb (1 forces the sort to spill)
+// FR: Requête sur le fichier attaché ; le second argument fixe max_memory_mb (1 force le tri à déborder)
+static void BM_StreamingQuery(benchmark::State& state) {
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    config.max_memory_mb = static_cast<size_t>(state.range(1));
+    QueryEngine engine(config);
+    engine.attachTable("probe", probeFile());
+    for (auto _ : state) {
+        QueryResult result = engine.execute(kStreamingQueries[state.range(0)]);
+        benchmark::DoNotOptimize(result.getRowCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * probeTable()->getRowCount()));
+}
+BENCHMARK(BM_StreamingQuery)->ArgsProduct({{0, 1, 2}, {1, 512}})->Unit(benchmark::kMillisecond);
+
+// EN: Index on the 100k distinct hosts of the loaded file: 0 = built in memory, 1 = mapped from the .bbpidx saved
+//     by the warm-up call
+// FR: Index sur les 100k hôtes distincts du fichier chargé : 0 = construit en mémoire, 1 = mappé depuis le .bbpidx
+//     enregistré par l'appel de préchauffage
+static void BM_IndexCreation(benchmark::State& state) {
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    config.persist_indexes = state.range(0) == 1;
+    QueryEngine engine(config);
+    engine.loadTable("probe", probeFile());
+    IndexConfig index;
+    index.column = "host";
+    index.type = IndexType::HASH;
+    engine.createIndex("probe", index);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(engine.createIndex("probe", index));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * probeTable()->getRowCount()));
+}
+BENCHMARK(BM_IndexCreation)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+
+// EN: One URL among 100k: 0 = LIKE scan, 1 = full-text AND of a frequent and a rare term, 2 = the same as a phrase
+// FR: Une URL parmi 100k : 0 = parcours LIKE, 1 = ET texte intégral d'un terme fréquent et d'un rare, 2 = la même
+//     chose en phrase
+static void BM_FullTextSearch(benchmark::State& state) {
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    engine.registerTable("probe", probeTable());
+    IndexConfig index;
+    index.column = "url";
+    index.type = IndexType::FULL_TEXT;
+    engine.createIndex("probe", index);
+    for (auto _ : state) {
+        QueryResult result = state.range(0) == 0
+            ? engine.execute("SELECT * FROM probe WHERE url LIKE '%?id=4242'")
+            : engine.searchText("probe", "url", "id 4242", state.range(0) == 1 ? TextMatch::ALL_TERMS : TextMatch::PHRASE);
+        benchmark::DoNotOptimize(result.getRowCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * probeTable()->getRowCount()));
+}
+BENCHMARK(BM_FullTextSearch)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+
+// EN: Selective filter (LIKE) then full projection of every row, on 1 to 8 worker threads
+// FR: Filtre sélectif (LIKE) puis projection complète de toutes les lignes, sur 1 à 8 threads
+static void BM_ParallelScan(benchmark::State& state) {
+    static const char* const queries[] = {
+        "SELECT host, status_code FROM probe WHERE url LIKE '%id=42%'",
+        "SELECT * FROM probe",
+    };
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    config.worker_threads = static_cast<size_t>(state.range(1));
+    QueryEngine engine(config);
+    engine.registerTable("probe", probeTable());
+    for (auto _ : state) {
+        QueryResult result = engine.execute(queries[state.range(0)]);
+        benchmark::DoNotOptimize(result.getRowCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * probeTable()->getRowCount()));
+}
+BENCHMARK(BM_ParallelScan)->ArgsProduct({{0, 1}, {1, 2, 4, 8}})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// EN: Time window and absent host over a time-ordered 1M-row table; second argument = zone_map_block_rows (0 = off)
+// FR: Fenêtre de temps et hôte absent sur une table d'un million de lignes ordonnée dans le temps ; second argument
+//     = zone_map_block_rows (0 = désactivé)
+static void BM_ZoneMapScan(benchmark::State& state) {
+    static const std::shared_ptr<ColumnarTable> changes = [] {
+        std::vector<std::vector<std::string>> rows;
+        rows.reserve(1000000);
+        for (size_t i = 0; i < 1000000; ++i) {
+            rows.push_back({std::to_string(1700000000 + i), "api" + std::to_string(i % 20000) + ".example.com"});
+        }
+        return ColumnarTable::fromRows({"detected_at", "host"}, rows);
+    }();
+    static const char* const queries[] = {
+        "SELECT * FROM changes WHERE detected_at BETWEEN 1700500000 AND 1700500999",
+        "SELECT * FROM changes WHERE host = 'api20001.example.com'",
+    };
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    config.worker_threads = 1;
+    config.zone_map_block_rows = static_cast<size_t>(state.range(1));
+    QueryEngine engine(config);
+    engine.registerTable("changes", changes);
+    engine.execute(queries[state.range(0)]);
+    for (auto _ : state) {
+        QueryResult result = engine.execute(queries[state.range(0)]);
+        benchmark::DoNotOptimize(result.getRowCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * changes->getRowCount()));
+}
+BENCHMARK(BM_ZoneMapScan)->ArgsProduct({{0, 1}, {0, 65536}})->Unit(benchmark::kMillisecond);
+
+// EN: Selective host equality next to a broad status equality, both indexed; argument = which one is written first
+// FR: Égalité host sélective à côté d'une égalité status large, toutes deux indexées ; argument = celle écrite en
+//     premier
+static void BM_PlannerIndexChoice(benchmark::State& state) {
+    static const char* const queries[] = {
+        "SELECT * FROM probe WHERE status_code = 400 AND host = 'api77.example.com'",
+        "SELECT * FROM probe WHERE host = 'api77.example.com' AND status_code = 400",
+    };
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    engine.registerTable("probe", probeTable());
+    for (const char* column : {"status_code", "host"}) {
+        IndexConfig index;
+        index.column = column;
+        index.type = IndexType::HASH;
+        engine.createIndex("probe", index);
+    }
+    for (auto _ : state) {
+        QueryResult result = engine.execute(queries[state.range(0)]);
+        benchmark::DoNotOptimize(result.getRowCount());
+    }
+}
+BENCHMARK(BM_PlannerIndexChoice)->DenseRange(0, 1)->Unit(benchmark::kMicrosecond);
+
+// EN: Repeated 20k-row query; argument = enable_query_cache (hits share the cached rows)
+// FR: Requête de 20k lignes répétée ; argument = enable_query_cache (les succès partagent les lignes en cache)
+static void BM_ResultCacheHit(benchmark::State& state) {
+    QueryEngine::Config config;
+    config.enable_query_cache = state.range(0) != 0;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    engine.registerTable("probe", probeTable());
+    for (auto _ : state) {
+        QueryResult result = engine.execute("SELECT host, status_code FROM probe WHERE status_code = 200");
+        benchmark::DoNotOptimize(result.getRowCount());
+    }
+}
+BENCHMARK(BM_ResultCacheHit)->DenseRange(0, 1)->Unit(benchmark::kMicrosecond);
+
+// EN: Same query shape with a different host each time; argument = 0 for SQL text, 1 for a prepared statement
+// FR: Même forme de requête avec un hôte différent à chaque fois ; argument = 0 pour du texte SQL, 1 pour une
+//     instruction préparée
+static void BM_PreparedStatement(benchmark::State& state) {
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    engine.registerTable("probe", probeTable());
+    IndexConfig index;
+    index.column = "host";
+    index.type = IndexType::HASH;
+    engine.createIndex("probe", index);
+    PreparedHandle statement =
+        engine.prepare("SELECT host, status_code, response_time_ms FROM probe WHERE host = ? AND status_code >= ?");
+    size_t i = 0;
+    for (auto _ : state) {
+        const std::string host = "api" + std::to_string(i++ % 100000) + ".example.com";
+        QueryResult result = state.range(0)
+            ? engine.execute(statement, host, 300)
+            : engine.execute("SELECT host, status_code, response_time_ms FROM probe WHERE host = '" + host +
+                             "' AND status_code >= 300");
+        benchmark::DoNotOptimize(result.getRowCount());
+    }
+}
+BENCHMARK(BM_PreparedStatement)->DenseRange(0, 1)->Unit(benchmark::kMicrosecond);
+
+// EN: 1000 rows added to the 100k-row table with HASH and FULL_TEXT indexes; argument = 0 to register the whole
+//     table again and rebuild its indexes, 1 for appendRows()
+// FR: 1000 lignes ajoutées à la table de 100k lignes avec index HASH et FULL_TEXT ; argument = 0 pour
+//     réenregistrer toute la table et reconstruire ses index, 1 pour appendRows()
+static void BM_AppendRows(benchmark::State& state) {
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    auto indexAll = [&engine] {
+        IndexConfig index;
+        index.column = "host";
+        index.type = IndexType::HASH;
+        engine.createIndex("probe", index);
+        index.column = "url";
+        index.type = IndexType::FULL_TEXT;
+        engine.createIndex("probe", index);
+    };
+    engine.registerTable("probe", probeTable());
+    indexAll();
+    
+    const ColumnarTable& base = *probeTable();
+    std::vector<std::vector<std::string>> rows;
+    if (state.range(0) == 0) {
+        for (size_t row = 0; row < base.getRowCount(); ++row) {
+            rows.push_back(base.getRow(row));
+        }
+    }
+    std::vector<std::vector<std::string>> batch;
+    for (size_t i = 0; i < 1000; ++i) {
+        batch.push_back(base.getRow(i));
+    }
+    for (auto _ : state) {
+        if (state.range(0)) {
+            engine.appendRows("probe", batch);
+        } else {
+            rows.insert(rows.end(), batch.begin(), batch.end());
+            engine.registerTable("probe", base.getHeaders(), rows);
+            indexAll();
+            rows.resize(base.getRowCount());
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch.size()));
+}
+BENCHMARK(BM_AppendRows)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,404 @@
+// EN: Benchmarks for the streaming CSV parser: structural scanner backends, buffered vs memory-mapped parsing,
+//     row vs batch delivery, projection pushdown, chunk-parallel scaling, gzip inputs, asynchronous read-ahead
+//     and typed field conversion
+// FR: Benchmarks du parser CSV streaming : backends du scanner structurel, parsing bufferisé vs mappé en mémoire,
+//     transmission par ligne vs par lot, projection de colonnes, montée en charge du parsing parallèle par chunks,
+//     entrées gzip, lecture anticipée asynchrone et conversion typée des champs
+
+#include <benchmark/benchmark.h>
+#include "csv/streaming_parser.hpp"
+#include "csv/compressed_input.hpp"
+#include "csv/read_ahead_reader.hpp"
+#include "infrastructure/logging/logger.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <zlib.h>
+
+using namespace BBP::CSV;
+
+namespace {
+
+// EN: Generate 02_probe-shaped rows (28 columns, some quoted fields with commas and escaped quotes)
+// FR: Génère des lignes au format 02_probe (28 colonnes, certains champs quotés avec virgules et quotes échappées)
+std::string makeProbeCsv(size_t rows) {
+    std::ostringstream oss;
+    oss << "schema_ver,program,host,url,scheme,port,status_code,content_type,content_length,response_time_ms,"
+           "title,server_header,x_powered_by,location_header,set_cookie_headers,security_headers,cdn_provider,"
+           "waf_detected,waf_type,robots_txt_length,favicon_hash,favicon_url,screenshot_path,technologies_detected,"
+           "error_message,redirect_chain,final_url,timestamp\n";
+    for (size_t i = 0; i < rows; ++i) {
+        oss << "1,acme,api" << i << ".example.com,https://api" << i << ".example.com/v1/users?id=" << i
+            << ",https,443," << (200 + (i % 5) * 100) << ",application/json," << (1000 + i % 9000) << ","
+            << (i % 1500) << ",\"Acme API, v" << (i % 7) << "\",nginx/1.25.3,,,"
+            << "\"session=\"\"abc" << i << "\"\"; HttpOnly\",\"HSTS,CSP\",cloudflare,true,cloudflare,"
+            << (i % 400) << ",-12345" << i << ",https://api" << i << ".example.com/favicon.ico,"
+            << "/shots/" << i << ".png,\"nginx,react,graphql\",,,https://api" << i << ".example.com/v1/,"
+            << "2025-01-01T00:00:00Z\n";
+    }
+    return oss.str();
+}
+
+// EN: Shared input written once to a temporary file
+// FR: Entrée partagée écrite une seule fois dans un fichier temporaire
+const std::string& probeCsv() {
+    static const std::string content = makeProbeCsv(100000);
+    return content;
+}
+
+const std::string& probeCsvPath() {
+    static const std::string path = [] {
+        auto file = std::filesystem::temp_directory_path() / "bbp_benchmark_probe.csv";
+        std::ofstream out(file, std::ios::binary);
+        out << probeCsv();
+        return file.string();
+    }();
+    return path;
+}
+
+const std::string& probeCsvGzipPath() {
+    static const std::string path = [] {
+        auto file = std::filesystem::temp_directory_path() / "bbp_benchmark_probe.csv.gz";
+        gzFile gz = gzopen(file.string().c_str(), "wb6");
+        gzwrite(gz, probeCsv().data(), static_cast<unsigned>(probeCsv().size()));
+        gzclose(gz);
+        return file.string();
+    }();
+    return path;
+}
+
+void quietLogger() {
+    BBP::Logger::getInstance().setLogLevel(BBP::LogLevel::ERROR);
+}
+
+} // anonymous namespace
+
+// EN: Raw structural scanning throughput per backend
+// FR: Débit brut de scan structurel par backend
+static void BM_StructuralScan(benchmark::State& state) {
+    auto backend = static_cast<ScannerBackend>(state.range(0));
+    if (!StructuralScanner::isSupported(backend)) {
+        state.SkipWithError("backend not supported on this CPU");
+        return;
+    }
+    const std::string& input = probeCsv();
+    StructuralScanner scanner(',', '"', backend);
+    std::vector<StructuralIndex> out;
+    out.reserve(input.size() / 4);
+    for (auto _ : state) {
+        out.clear();
+        bool in_quotes = false;
+        scanner.scan(input.data(), input.size(), in_quotes, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * input.size()));
+    state.SetLabel(StructuralScanner::backendName(backend));
+}
+BENCHMARK(BM_StructuralScan)
+    ->Arg(static_cast<int>(ScannerBackend::SCALAR))
+    ->Arg(static_cast<int>(ScannerBackend::SSE42))
+    ->Arg(static_cast<int>(ScannerBackend::AVX2));
+
+// EN: Current buffered path: ifstream + byte-by-byte row extraction + ParsedRow per row
+// FR: Chemin bufferisé actuel : ifstream + extraction de ligne octet par octet + ParsedRow par ligne
+static void BM_ParseFileBuffered(benchmark::State& state) {
+    quietLogger();
+    const std::string& path = probeCsvPath();
+    for (auto _ : state) {
+        StreamingParser parser;
+        size_t rows = 0;
+        parser.setRowCallback([&rows](const ParsedRow& row, ParserError) {
+            rows += row.getFieldCount() > 0;
+            return true;
+        });
+        parser.parseFile(path);
+        benchmark::DoNotOptimize(rows);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+}
+BENCHMARK(BM_ParseFileBuffered)->Unit(benchmark::kMillisecond);
+
+// EN: Memory-mapped zero-copy path with RowView callback, per scanner backend
+// FR: Chemin zero-copy mappé en mémoire avec callback RowView, par backend de scanner
+static void BM_ParseFileMapped(benchmark::State& state) {
+    quietLogger();
+    auto backend = static_cast<ScannerBackend>(state.range(0));
+    if (!StructuralScanner::isSupported(backend)) {
+        state.SkipWithError("backend not supported on this CPU");
+        return;
+    }
+    const std::string& path = probeCsvPath();
+    ParserConfig config;
+    config.scanner_backend = backend;
+    for (auto _ : state) {
+        StreamingParser parser(config);
+        size_t rows = 0;
+        parser.setRowViewCallback([&rows](const RowView& row, ParserError) {
+            rows += row.getFieldCount() > 0;
+            return true;
+        });
+        parser.parseFileMapped(path);
+        benchmark::DoNotOptimize(rows);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+    state.SetLabel(StructuralScanner::backendName(backend));
+}
+BENCHMARK(BM_ParseFileMapped)
+    ->Arg(static_cast<int>(ScannerBackend::SCALAR))
+    ->Arg(static_cast<int>(ScannerBackend::SSE42))
+    ->Arg(static_cast<int>(ScannerBackend::AVX2))
+    ->Unit(benchmark::kMillisecond);
+
+// EN: Materializing consumers: one ParsedRow per row (general heap vs row arena) vs columnar RowBatch delivery
+// FR: Consommateurs qui matérialisent : un ParsedRow par ligne (tas général vs arène de lignes) vs transmission
+//     en RowBatch colonnaires
+static void BM_ParseFileMappedRows(benchmark::State& state) {
+    quietLogger();
+    const std::string& path = probeCsvPath();
+    ParserConfig config;
+    config.use_memory_mapping = true;
+    config.row_arena_size = static_cast<size_t>(state.range(0));
+    size_t heap_allocations = 0;
+    for (auto _ : state) {
+        StreamingParser parser(config);
+        size_t bytes = 0;
+        parser.setRowCallback([&bytes](const ParsedRow& row, ParserError) {
+            bytes += row.getField(3).size();
+            return true;
+        });
+        parser.parseFile(path);
+        benchmark::DoNotOptimize(bytes);
+        heap_allocations = parser.getStatistics().getHeapAllocations();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+    state.counters["heap_allocations"] = static_cast<double>(heap_allocations);
+}
+BENCHMARK(BM_ParseFileMappedRows)->Arg(0)->Arg(64 * 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_ParseFileMappedBatches(benchmark::State& state) {
+    quietLogger();
+    const std::string& path = probeCsvPath();
+    ParserConfig config;
+    config.use_memory_mapping = true;
+    for (auto _ : state) {
+        StreamingParser parser(config);
+        size_t bytes = 0;
+        parser.setBatchCallback([&bytes](const RowBatch& batch, ParserError) {
+            for (const auto& span : batch.getColumn(3)) {
+                bytes += span.length;
+            }
+            return true;
+        });
+        parser.parseFile(path);
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+}
+BENCHMARK(BM_ParseFileMappedBatches)->Unit(benchmark::kMillisecond);
+
+// EN: Projection pushdown on the wide probe schema: all 28 columns vs 4 of them (arg 0 = no projection)
+// FR: Projection sur le schéma probe large : les 28 colonnes vs 4 d'entre elles (arg 0 = pas de projection)
+static void BM_ParseFileProjected(benchmark::State& state) {
+    quietLogger();
+    const std::string& path = probeCsvPath();
+    ParserConfig config;
+    config.use_memory_mapping = state.range(0) != 0;
+    if (state.range(1) != 0) {
+        config.projected_columns = {"host", "status_code", "title", "technologies_detected"};
+    }
+    for (auto _ : state) {
+        StreamingParser parser(config);
+        size_t bytes = 0;
+        parser.setRowCallback([&bytes](const ParsedRow& row, ParserError) {
+            bytes += row.getField("host").size();
+            return true;
+        });
+        parser.parseFile(path);
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+    state.SetLabel(std::string(config.use_memory_mapping ? "mapped" : "buffered") +
+                   (config.projected_columns.empty() ? ", all columns" : ", 4 columns"));
+}
+BENCHMARK(BM_ParseFileProjected)
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({1, 0})
+    ->Args({1, 1})
+    ->Unit(benchmark::kMillisecond);
+
+// EN: Chunk-parallel mapped path, per worker thread count
+// FR: Chemin mappé parallèle par chunks, par nombre de threads workers
+static void BM_ParseFileParallel(benchmark::State& state) {
+    quietLogger();
+    const std::string& path = probeCsvPath();
+    ParserConfig config;
+    config.enable_parallel_processing = true;
+    config.thread_count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        StreamingParser parser(config);
+        size_t rows = 0;
+        parser.setRowViewCallback([&rows](const RowView& row, ParserError) {
+            rows += row.getFieldCount() > 0;
+            return true;
+        });
+        parser.parseFileMapped(path);
+        benchmark::DoNotOptimize(rows);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+}
+BENCHMARK(BM_ParseFileParallel)->RangeMultiplier(2)->Range(1, 8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// EN: gzip input: raw inflate throughput vs full parse with inflate overlapped on the background thread
+//     (bytes are decompressed bytes)
+// FR: Entrée gzip : débit brut d'inflate vs parsing complet avec inflate superposé sur le thread d'arrière-plan
+//     (octets décompressés)
+static void BM_InflateGzip(benchmark::State& state) {
+    const std::string& path = probeCsvGzipPath();
+    for (auto _ : state) {
+        DecompressingReader reader;
+        reader.open(path);
+        const char* data = nullptr;
+        size_t size = 0;
+        size_t total = 0;
+        while (reader.next(data, size)) {
+            total += size;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+}
+BENCHMARK(BM_InflateGzip)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ParseFileGzip(benchmark::State& state) {
+    quietLogger();
+    const std::string& path = probeCsvGzipPath();
+    for (auto _ : state) {
+        StreamingParser parser;
+        size_t rows = 0;
+        parser.setRowViewCallback([&rows](const RowView& row, ParserError) {
+            rows += row.getFieldCount() > 0;
+            return true;
+        });
+        parser.parseFile(path);
+        benchmark::DoNotOptimize(rows);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+}
+BENCHMARK(BM_ParseFileGzip)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// EN: Read-ahead of plain files: raw reader throughput and full parse with N buffers in flight (0 = legacy
+//     buffered read for reference). Stalls count the blocks the parser had to wait for.
+// FR: Lecture anticipée de fichiers bruts : débit brut du lecteur et parsing complet avec N buffers en vol
+//     (0 = lecture bufferisée historique pour référence). Les attentes comptent les blocs que le parser a attendus.
+static void BM_ReadAhead(benchmark::State& state) {
+    const std::string& path = probeCsvPath();
+    size_t stalls = 0;
+    for (auto _ : state) {
+        ReadAheadReader reader(static_cast<size_t>(state.range(0)), 1 << 20);
+        reader.open(path);
+        const char* data = nullptr;
+        size_t size = 0;
+        size_t total = 0;
+        while (reader.next(data, size)) {
+            total += size;
+        }
+        stalls += reader.getStallCount();
+        benchmark::DoNotOptimize(total);
+    }
+    state.counters["stalls"] = benchmark::Counter(static_cast<double>(stalls), benchmark::Counter::kAvgIterations);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+}
+BENCHMARK(BM_ReadAhead)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ParseFileReadAhead(benchmark::State& state) {
+    quietLogger();
+    const std::string& path = probeCsvPath();
+    for (auto _ : state) {
+        ParserConfig config;
+        config.read_ahead_buffers = static_cast<size_t>(state.range(0));
+        config.read_ahead_buffer_size = 1 << 20;
+        StreamingParser parser(config);
+        size_t rows = 0;
+        parser.setRowViewCallback([&rows](const RowView& row, ParserError) {
+            rows += row.getFieldCount() > 0;
+            return true;
+        });
+        parser.parseFile(path);
+        benchmark::DoNotOptimize(rows);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * probeCsv().size()));
+}
+BENCHMARK(BM_ParseFileReadAhead)->Arg(0)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// EN: Typed conversion of status_code, content_length and response_time_ms: copy + stoll/stod baseline,
+//     per-field from_chars on row views, and whole-column extraction from batches
+// FR: Conversion typée de status_code, content_length et response_time_ms : référence copie + stoll/stod,
+//     from_chars par champ sur les vues de ligne, et extraction de colonnes entières depuis les lots
+static void BM_ConvertFields(benchmark::State& state) {
+    quietLogger();
+    // EN: Parse once into a single batch so only the conversion is measured
+    // FR: Analyse une seule fois dans un lot unique pour ne mesurer que la conversion
+    static const RowBatch probe_batch = [] {
+        ParserConfig config;
+        config.use_memory_mapping = true;
+        config.batch_size = 100000;
+        StreamingParser parser(config);
+        RowBatch copy;
+        parser.setBatchCallback([&copy](const RowBatch& batch, ParserError) {
+            copy = batch;
+            return true;
+        });
+        parser.parseFile(probeCsvPath());
+        return copy;
+    }();
+    const int mode = static_cast<int>(state.range(0));
+    const size_t rows = probe_batch.getRowCount();
+    std::vector<int64_t> status;
+    std::vector<int64_t> length;
+    std::vector<double> time;
+    for (auto _ : state) {
+        double checksum = 0;
+        if (mode == 0) {
+            for (size_t row = 0; row < rows; ++row) {
+                checksum += static_cast<double>(std::stoll(std::string(probe_batch.getField(row, 6))) +
+                                                std::stoll(std::string(probe_batch.getField(row, 8)))) +
+                            std::stod(std::string(probe_batch.getField(row, 9)));
+            }
+        } else if (mode == 1) {
+            for (size_t row = 0; row < rows; ++row) {
+                checksum += static_cast<double>(probe_batch.getFieldAs<int64_t>(row, 6).value_or(0) +
+                                                probe_batch.getFieldAs<int64_t>(row, 8).value_or(0)) +
+                            probe_batch.getFieldAs<double>(row, 9).value_or(0.0);
+            }
+        } else {
+            probe_batch.extractColumn(6, status);
+            probe_batch.extractColumn(8, length);
+            probe_batch.extractColumn(9, time);
+            for (size_t row = 0; row < rows; ++row) {
+                checksum += static_cast<double>(status[row] + length[row]) + time[row];
+            }
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows * 3));
+}
+BENCHMARK(BM_ConvertFields)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+
+// EN: Single-row static helper
+// FR: Assistant statique sur une seule ligne
+static void BM_ParseRow(benchmark::State& state) {
+    ParserConfig config;
+    config.scanner_backend = static_cast<ScannerBackend>(state.range(0));
+    const std::string& input = probeCsv();
+    size_t first = input.find('\n') + 1;
+    std::string row = input.substr(first, input.find('\n', first) - first);
+    for (auto _ : state) {
+        auto fields = StreamingParser::parseRow(row, config);
+        benchmark::DoNotOptimize(fields.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * row.size()));
+}
+BENCHMARK(BM_ParseRow)
+    ->Arg(static_cast<int>(ScannerBackend::SCALAR))
+    ->Arg(static_cast<int>(ScannerBackend::AVX2));
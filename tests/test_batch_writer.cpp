@@ -28,6 +28,7 @@ protected:
         std::vector<std::string> files_to_remove = {
             test_filename_,
             test_filename_compressed_,
+            test_filename_ + ".idx",
             test_filename_ + ".bak",
             test_filename_compressed_ + ".bak",
             test_filename_ + ".tmp"
@@ -670,6 +671,75 @@ TEST_F(BatchWriterTest, RealFileIntegration) {
     EXPECT_GT(stats.getBytesWritten(), 0);
 }
 
+TEST_F(BatchWriterTest, RowIndexSidecar) {
+    // EN: Checkpoints must point at row starts even with a BOM, CRLF and quoted line breaks
+    // FR: Les points de reprise doivent pointer sur les débuts de ligne même avec BOM, CRLF et retours quotés
+    WriterConfig config;
+    config.row_index_stride = 10;
+    config.write_bom = true;
+    config.line_ending = "\r\n";
+    config.enable_background_flush = false;
+    BatchWriter writer(config);
+    
+    ASSERT_EQ(writer.openFile(test_filename_), WriterError::SUCCESS);
+    ASSERT_EQ(writer.writeHeader(std::vector<std::string>{"id", "note"}), WriterError::SUCCESS);
+    for (int i = 0; i < 95; ++i) {
+        EXPECT_EQ(writer.writeRow(std::vector<std::string>{std::to_string(i), i % 3 == 0 ? "multi\nline" : "plain"}), WriterError::SUCCESS);
+        if (i % 17 == 0) {
+            writer.flush();
+        }
+    }
+    ASSERT_EQ(writer.closeFile(), WriterError::SUCCESS);
+    
+    std::string sidecar = RowIndex::sidecarPath(test_filename_);
+    RowIndex index;
+    ASSERT_TRUE(index.load(sidecar)) << index.getLastError();
+    std::filesystem::remove(sidecar);
+    EXPECT_TRUE(index.matches(test_filename_));
+    EXPECT_EQ(index.getRowCount(), 95);
+    ASSERT_EQ(index.getCheckpointCount(), 10);
+    
+    std::ifstream file(test_filename_, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    for (size_t i = 0; i < index.getCheckpointCount(); ++i) {
+        std::string expected = std::to_string(i * 10) + ",";
+        EXPECT_EQ(content.compare(index.getCheckpointOffset(i), expected.size(), expected), 0) << "checkpoint " << i;
+    }
+    
+    // EN: Compressed outputs are not indexed
+    // FR: Les sorties compressées ne sont pas indexées
+    config.compression = CompressionType::GZIP;
+    BatchWriter compressed_writer(config);
+    ASSERT_EQ(compressed_writer.openFile(test_filename_compressed_), WriterError::SUCCESS);
+    compressed_writer.writeRow(std::vector<std::string>{"1", "a"});
+    ASSERT_EQ(compressed_writer.closeFile(), WriterError::SUCCESS);
+    EXPECT_FALSE(std::filesystem::exists(RowIndex::sidecarPath(test_filename_compressed_)));
+    
+    // EN: AUTO resolves from the file name: a plain .csv is written as is and indexed, a .gz is not
+    // FR: AUTO se résout depuis le nom de fichier : un .csv simple est écrit tel quel et indexé, un .gz ne l'est pas
+    config.compression = CompressionType::AUTO;
+    config.write_bom = false;
+    for (const std::string& name : {test_filename_, test_filename_compressed_}) {
+        BatchWriter auto_writer(config);
+        ASSERT_EQ(auto_writer.openFile(name), WriterError::SUCCESS);
+        for (int i = 0; i < 25; ++i) {
+            auto_writer.writeRow(std::vector<std::string>{std::to_string(i), "plain"});
+        }
+        ASSERT_EQ(auto_writer.closeFile(), WriterError::SUCCESS);
+        
+        const bool plain = name == test_filename_;
+        const std::string auto_sidecar = RowIndex::sidecarPath(name);
+        EXPECT_EQ(std::filesystem::exists(auto_sidecar), plain) << name;
+        if (plain) {
+            RowIndex auto_index;
+            ASSERT_TRUE(auto_index.load(auto_sidecar)) << auto_index.getLastError();
+            EXPECT_TRUE(auto_index.matches(name));
+            EXPECT_EQ(auto_index.getRowCount(), 25);
+        }
+        std::filesystem::remove(auto_sidecar);
+    }
+}
+
 // EN: Edge cases and boundary conditions
 // FR: Cas limites et conditions aux limites
 
@@ -7,6 +7,7 @@
 #include <vector>
 #include <chrono>
 #include "csv/delta_compression.hpp"
+#include <zlib.h>
 
 using namespace BBP::CSV;
 using namespace testing;
@@ -1052,6 +1053,42 @@ TEST_F(DeltaUtilsTest, HashUtilities) {
     EXPECT_NE(hash1, hash3); // Different content should produce different hash
 }
 
+TEST_F(DeltaUtilsTest, CompressedCsvInputs) {
+    // EN: Historical outputs kept as .csv.gz load and diff like their plain counterparts
+    // FR: Les sorties historiques gardées en .csv.gz se chargent et se comparent comme leurs équivalents bruts
+    auto writeGzip = [this](const std::string& filename, const std::string& content) {
+        std::string path = test_dir / filename;
+        gzFile gz = gzopen(path.c_str(), "wb");
+        gzwrite(gz, content.data(), static_cast<unsigned>(content.size()));
+        gzclose(gz);
+        return path;
+    };
+    createCSVFile("old.csv", {"id,name", "1,Alice", "2,Bob"});
+    std::string old_gz = writeGzip("old.csv.gz", readFile("old.csv"));
+    std::string new_gz = writeGzip("new.csv.gz", "id,name\n1,Alice\n2,Robert\n3,Carol\n");
+    
+    EXPECT_EQ(DeltaUtils::loadCsvFile(old_gz), DeltaUtils::loadCsvFile(test_dir / "old.csv"));
+    
+    DeltaConfig config;
+    config.detection_mode = ChangeDetectionMode::KEY_BASED;
+    config.key_columns = {"id"};
+    ChangeDetector detector(config);
+    std::vector<DeltaRecord> changes;
+    ASSERT_EQ(detector.detectChangesFromFiles(old_gz, new_gz, changes), DeltaError::SUCCESS);
+    EXPECT_FALSE(changes.empty());
+    
+    // EN: A truncated archive is an error, not a shorter file
+    // FR: Une archive tronquée est une erreur, pas un fichier plus court
+    std::string truncated = test_dir / "truncated.csv.gz";
+    {
+        std::ifstream in(new_gz, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out(truncated, std::ios::binary);
+        out << bytes.substr(0, bytes.size() - 12);
+    }
+    EXPECT_THROW(DeltaUtils::loadCsvFile(truncated), std::runtime_error);
+}
+
 TEST_F(DeltaUtilsTest, CompressionUtilities) {
     // EN: Test compression ratio calculation
     // FR: Tester calcul ratio de compression
@@ -1,12 +1,26 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <sstream>
 #include <fstream>
 #include <filesystem>
 #include <thread>
 #include <vector>
 #include <chrono>
+#include "csv/aggregation.hpp"
+#include "csv/external_sort.hpp"
+#include "csv/hash_join.hpp"
+#include "csv/inverted_index.hpp"
+#include "csv/morsel_scan.hpp"
+#include "csv/persistent_index.hpp"
 #include "csv/query_engine.hpp"
+#include "csv/query_planner.hpp"
+#include "csv/query_predicate.hpp"
+#include "csv/result_cache.hpp"
+#include "csv/top_k.hpp"
+#include "csv/zone_map.hpp"
 
 using namespace BBP::CSV;
 using namespace testing;
@@ -268,6 +282,32 @@ TEST_F(QueryParserTest, WhereClauseParsing) {
     EXPECT_EQ(query.where[0].logical_op, LogicalOperator::AND);
 }
 
+TEST_F(QueryParserTest, JoinParsing) {
+    // EN: Join types, optional OUTER, qualified columns
+    // FR: Types de jointure, OUTER optionnel, colonnes qualifiées
+    std::string sql = "SELECT probe.host, path FROM probe JOIN discovery ON probe.host = discovery.host "
+                      "LEFT OUTER JOIN jsintel ON url = jsintel.url FULL JOIN dns ON host = dns.name WHERE status_code = 200";
+    ASSERT_EQ(parser.parse(sql, query), QueryError::SUCCESS);
+    
+    EXPECT_EQ(query.table, "probe");
+    EXPECT_EQ(query.columns[0].column, "probe.host");
+    ASSERT_EQ(query.joins.size(), 3u);
+    EXPECT_EQ(query.joins[0].type, JoinClause::INNER);
+    EXPECT_EQ(query.joins[0].table, "discovery");
+    EXPECT_EQ(query.joins[0].on_left, "probe.host");
+    EXPECT_EQ(query.joins[0].on_right, "discovery.host");
+    EXPECT_EQ(query.joins[1].type, JoinClause::LEFT);
+    EXPECT_EQ(query.joins[1].on_left, "url");
+    EXPECT_EQ(query.joins[2].type, JoinClause::FULL);
+    EXPECT_EQ(query.joins[2].on_right, "dns.name");
+    ASSERT_EQ(query.where.size(), 1u);
+    EXPECT_EQ(query.where[0].column, "status_code");
+    
+    SqlQuery broken;
+    EXPECT_EQ(parser.parse("SELECT * FROM a LEFT b ON x = y", broken), QueryError::SYNTAX_ERROR);
+    EXPECT_EQ(parser.parse("SELECT * FROM a JOIN b x = y", broken), QueryError::SYNTAX_ERROR);
+}
+
 TEST_F(QueryParserTest, OrderByParsing) {
     // EN: Test ORDER BY parsing
     // FR: Tester analyse ORDER BY
@@ -733,6 +773,1456 @@ TEST_F(QueryIntegrationTest, QueryPlanAnalysis) {
     EXPECT_THAT(plan, HasSubstr("INDEXED"));
 }
 
+// EN: Tests for the columnar table storage shared by the engine and the index manager
+// FR: Tests du stockage colonnaire partagé par le moteur et le gestionnaire d'index
+TEST(ColumnarTableTest, DictionaryEncodingAndFallback) {
+    std::vector<std::string> headers = {"host", "scheme", "status_code", "cdn_provider"};
+    std::vector<std::vector<std::string>> rows;
+    for (int i = 0; i < 1000; ++i) {
+        rows.push_back({"api" + std::to_string(i) + ".example.com", i % 3 ? "https" : "http",
+                        std::to_string(200 + (i % 4) * 100), i % 2 ? "cloudflare" : ""});
+    }
+    rows.push_back({"short.example.com"});  // EN: Ragged row / FR: Ligne incomplète
+    
+    auto table = ColumnarTable::fromRows(headers, rows, 64);
+    ASSERT_EQ(table->getRowCount(), 1001u);
+    ASSERT_EQ(table->getColumnCount(), 4u);
+    
+    // EN: Low-cardinality columns keep their dictionary, host exceeds the limit and is stored plain
+    // FR: Les colonnes à faible cardinalité gardent leur dictionnaire, host dépasse la limite et est stocké tel quel
+    EXPECT_FALSE(table->isDictionaryEncoded(0));
+    EXPECT_TRUE(table->isDictionaryEncoded(1));
+    EXPECT_TRUE(table->isDictionaryEncoded(2));
+    EXPECT_TRUE(table->isDictionaryEncoded(3));
+    EXPECT_EQ(table->getDictionary(1).size(), 3u);  // EN: http, https and the padded empty value / FR: http, https et la valeur vide de complétion
+    EXPECT_EQ(table->getDictionary(2).size(), 5u);
+    EXPECT_EQ(table->getCodes(2).size(), 1001u);
+    
+    for (size_t row = 0; row < rows.size(); ++row) {
+        for (size_t column = 0; column < headers.size(); ++column) {
+            std::string expected = column < rows[row].size() ? rows[row][column] : "";
+            ASSERT_EQ(table->getValue(row, column), expected) << "row " << row << " column " << column;
+        }
+    }
+    EXPECT_EQ(table->getRow(1000), (std::vector<std::string>{"short.example.com", "", "", ""}));
+    EXPECT_EQ(table->getValue(5000, 0), "");
+    EXPECT_EQ(table->getColumnIndex("status_code"), 2);
+    EXPECT_EQ(table->getColumnIndex("missing"), -1);
+    
+    // EN: Far smaller than the row-major copy it replaces
+    // FR: Bien plus petit que la copie en lignes qu'il remplace
+    size_t row_major = 0;
+    for (const auto& row : rows) {
+        row_major += sizeof(row) + row.capacity() * sizeof(std::string);
+    }
+    EXPECT_LT(table->getMemoryUsage(), row_major / 2);
+    
+    // EN: A zero limit disables dictionary encoding
+    // FR: Une limite nulle désactive l'encodage par dictionnaire
+    auto plain = ColumnarTable::fromRows(headers, rows, 0);
+    EXPECT_FALSE(plain->isDictionaryEncoded(1));
+    EXPECT_EQ(plain->getValue(3, 1), "http");
+}
+
+TEST_F(QueryEngineTest, ColumnarStorageSharedWithIndexes) {
+    std::string csv_file = test_dir / "test_data.csv";
+    ASSERT_EQ(engine->loadTable("test_table", csv_file), QueryError::SUCCESS);
+    
+    auto table = engine->getTable("test_table");
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table->getRowCount(), 4u);
+    EXPECT_TRUE(table->isDictionaryEncoded(table->getColumnIndex("category")));
+    EXPECT_EQ(table->getValue(2, 1), "Item C");
+    
+    // EN: Engine, index manager and this test hold the same single copy
+    // FR: Le moteur, le gestionnaire d'index et ce test détiennent la même copie unique
+    EXPECT_EQ(table.use_count(), 3);
+    EXPECT_GE(engine->getStatistics().memory_usage_bytes, table->getMemoryUsage());
+    
+    IndexConfig config;
+    config.column = "category";
+    config.type = IndexType::HASH;
+    EXPECT_EQ(engine->createIndex("test_table", config), QueryError::SUCCESS);
+    EXPECT_EQ(engine->execute("SELECT name FROM test_table WHERE category = 'Cat1'").getRowCount(), 2u);
+    
+    // EN: Unloading drops both references
+    // FR: Le déchargement supprime les deux références
+    engine->unloadTable("test_table");
+    EXPECT_EQ(table.use_count(), 1);
+    EXPECT_EQ(engine->getTable("test_table"), nullptr);
+    EXPECT_TRUE(engine->execute("SELECT * FROM test_table").isEmpty());
+}
+
+// EN: Tests for compiled WHERE predicates
+// FR: Tests des prédicats WHERE compilés
+TEST(CompiledPredicateTest, LikeMatcherShapes) {
+    EXPECT_TRUE(LikeMatcher("api").matches("api"));
+    EXPECT_FALSE(LikeMatcher("api").matches("api2"));
+    EXPECT_TRUE(LikeMatcher("api%").matches("api.example.com"));
+    EXPECT_FALSE(LikeMatcher("api%").matches("www.api.com"));
+    EXPECT_TRUE(LikeMatcher("%.com").matches("api.example.com"));
+    EXPECT_TRUE(LikeMatcher("%example%").matches("api.example.com"));
+    EXPECT_TRUE(LikeMatcher("%%").matches(""));
+    EXPECT_TRUE(LikeMatcher("a_i%.c_m").matches("api.example.com"));
+    EXPECT_FALSE(LikeMatcher("a_i%.c_m").matches("api.example.org"));
+    EXPECT_TRUE(LikeMatcher("%a%b%c").matches("xxaxxbxxbxc"));
+    EXPECT_FALSE(LikeMatcher("%a%b%c").matches("xxaxxcxxb"));
+    // EN: Regex metacharacters are plain characters in LIKE
+    // FR: Les métacaractères regex sont des caractères ordinaires dans LIKE
+    EXPECT_FALSE(LikeMatcher("a.c").matches("abc"));
+    EXPECT_TRUE(LikeMatcher("(v1)%").matches("(v1) api"));
+    EXPECT_TRUE(QueryUtils::compareValues(std::string("Laptop"), std::string("Lap%"), SqlOperator::LIKE));
+}
+
+TEST(CompiledPredicateTest, TypedComparisons) {
+    auto table = ColumnarTable::fromRows({"host", "status_code", "response_time_ms", "waf"}, {
+        {"a.example.com", "200", "12.5", "true"},
+        {"b.example.com", "404", "7", "false"},
+        {"c.test.org", "200", "150", "NULL"},
+        {"d.example.com", "0301", "abc", "TRUE"},
+    });
+    
+    auto select = [&table](const std::string& sql) {
+        QueryParser parser;
+        SqlQuery query;
+        EXPECT_EQ(parser.parse(sql, query), QueryError::SUCCESS) << sql;
+        CompiledFilter filter(query.where, *table);
+        std::vector<size_t> rows;
+        for (size_t row = 0; row < table->getRowCount(); ++row) {
+            if (filter.matches(row)) {
+                rows.push_back(row);
+            }
+        }
+        return rows;
+    };
+    using Rows = std::vector<size_t>;
+    
+    // EN: Numbers compare numerically whether the constant is quoted or not, other cells as text ("abc" > "10")
+    // FR: Les nombres se comparent numériquement que la constante soit quotée ou non, les autres cellules comme du texte ("abc" > "10")
+    EXPECT_EQ(select("SELECT * FROM t WHERE response_time_ms > 10"), (Rows{0, 2, 3}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE response_time_ms > '10'"), (Rows{0, 2, 3}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE response_time_ms = 12.5"), (Rows{0}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE status_code = 301"), (Rows{3}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE status_code IN (200, 404)"), (Rows{0, 1, 2}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE status_code NOT IN ('200')"), (Rows{1, 3}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE response_time_ms BETWEEN 7 AND 13"), (Rows{0, 1}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE host >= 'c'"), (Rows{2, 3}));
+    
+    // EN: NULL cells only match IS NULL; booleans accept any spelling parseField() knows
+    // FR: Les cellules NULL ne correspondent qu'à IS NULL ; les booléens acceptent toute écriture connue de parseField()
+    EXPECT_EQ(select("SELECT * FROM t WHERE waf IS NULL"), (Rows{2}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE waf IS NOT NULL"), (Rows{0, 1, 3}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE waf != 'x'"), (Rows{0, 1, 3}));
+    
+    // EN: LIKE uses the pattern, REGEX searches with an expression built once
+    // FR: LIKE utilise le motif, REGEX cherche avec une expression construite une fois
+    EXPECT_EQ(select("SELECT * FROM t WHERE host LIKE '%.example.com'"), (Rows{0, 1, 3}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE host NOT LIKE '%.example.com'"), (Rows{2}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE host REGEX '^[bc]\\.'"), (Rows{1, 2}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE host REGEX '('"), (Rows{}));
+    
+    // EN: Connectors apply to the condition that follows them; unknown columns are ignored
+    // FR: Les connecteurs s'appliquent à la condition qui les suit ; les colonnes inconnues sont ignorées
+    EXPECT_EQ(select("SELECT * FROM t WHERE status_code = 404 OR host LIKE 'c%'"), (Rows{1, 2}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE status_code = 200 AND response_time_ms < 100"), (Rows{0}));
+    EXPECT_EQ(select("SELECT * FROM t WHERE missing = 1 AND status_code = 404"), (Rows{1}));
+}
+
+TEST(CompiledPredicateTest, BatchSelectionMatchesRowByRow) {
+    // EN: 2500 rows = two full batches and a partial one; latency mixes numbers, NULL and text
+    // FR: 2500 lignes = deux lots complets et un partiel ; latency mélange nombres, NULL et texte
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 2500; ++i) {
+        std::string latency = i % 97 == 0 ? "NULL" : (i % 89 == 0 ? "n/a" : std::to_string(i % 700) + (i % 3 ? "" : ".5"));
+        rows.push_back({"h" + std::to_string(i) + ".example.com", std::to_string(200 + (i % 4) * 100), latency,
+                        i % 5 ? "nginx" : ""});
+    }
+    const std::vector<std::string> headers = {"host", "status_code", "latency", "server"};
+    const char* const queries[] = {
+        "SELECT * FROM t WHERE latency > 350",
+        "SELECT * FROM t WHERE latency <= '12'",
+        "SELECT * FROM t WHERE latency != 100",
+        "SELECT * FROM t WHERE latency BETWEEN 10 AND 20.5",
+        "SELECT * FROM t WHERE latency = 'n/a'",
+        "SELECT * FROM t WHERE latency != 'n/a'",
+        "SELECT * FROM t WHERE latency IS NULL",
+        "SELECT * FROM t WHERE host = 'h1234.example.com'",
+        "SELECT * FROM t WHERE host LIKE 'h1%' AND status_code = 300",
+        "SELECT * FROM t WHERE server = '' OR latency < 5",
+        "SELECT * FROM t WHERE status_code = 999 AND latency > 0 OR host = 'h7.example.com'",
+        "SELECT * FROM t WHERE missing = 1",
+    };
+    
+    // EN: Same answers on dictionary-encoded and plain columns
+    // FR: Mêmes réponses sur colonnes à dictionnaire et colonnes simples
+    for (size_t limit : {ColumnarTable::kDefaultDictionaryLimit, size_t{0}}) {
+        auto table = ColumnarTable::fromRows(headers, rows, limit);
+        for (const char* sql : queries) {
+            QueryParser parser;
+            SqlQuery query;
+            ASSERT_EQ(parser.parse(sql, query), QueryError::SUCCESS) << sql;
+            CompiledFilter filter(query.where, *table);
+            
+            std::vector<size_t> expected;
+            for (size_t row = 0; row < table->getRowCount(); ++row) {
+                if (filter.matches(row)) {
+                    expected.push_back(row);
+                }
+            }
+            std::vector<size_t> selected;
+            filter.selectRows(0, table->getRowCount(), selected);
+            EXPECT_EQ(selected, expected) << sql << " (dictionary limit " << limit << ")";
+            
+            // EN: Ranges not aligned on a batch give the matching slice
+            // FR: Des plages non alignées sur un lot donnent la tranche correspondante
+            std::vector<size_t> slice;
+            filter.selectRows(1000, 2100, slice);
+            std::vector<size_t> expected_slice;
+            std::copy_if(expected.begin(), expected.end(), std::back_inserter(expected_slice),
+                         [](size_t row) { return row >= 1000 && row < 2100; });
+            EXPECT_EQ(slice, expected_slice) << sql << " (dictionary limit " << limit << ")";
+        }
+    }
+}
+
+// EN: Tests for the hash join operator
+// FR: Tests de l'opérateur de jointure par hachage
+
+TEST(HashJoinTest, JoinTypesWithEitherBuildSideAndSpill) {
+    auto probe = ColumnarTable::fromRows({"host", "status_code"}, {
+        {"a.example.com", "200"},
+        {"b.example.com", "404"},
+        {"a.example.com", "301"},
+        {"NULL", "500"},
+        {"c.example.com", "200"},
+    });
+    auto discovery = ColumnarTable::fromRows({"host", "path"}, {
+        {"a.example.com", "/admin"},
+        {"c.example.com", "/login"},
+        {"c.example.com", "/api"},
+        {"d.example.com", "/"},
+        {"", "/orphan"},
+    }, 0);
+    // EN: Same content with one more row, so that the other side gets built
+    // FR: Même contenu avec une ligne de plus, pour que l'autre côté soit construit
+    auto discovery_large = ColumnarTable::fromRows({"host", "path"}, {
+        {"a.example.com", "/admin"},
+        {"c.example.com", "/login"},
+        {"c.example.com", "/api"},
+        {"d.example.com", "/"},
+        {"", "/orphan"},
+        {"e.example.com", "/extra"},
+    }, 0);
+    
+    using Pair = std::pair<size_t, size_t>;
+    constexpr size_t none = HashJoin::kNoRow;
+    auto run = [](JoinClause::Type type, size_t budget, const ColumnarTable& left, const ColumnarTable& right,
+                  bool& built_left, size_t& partitions) {
+        HashJoin join(type, budget);
+        HashJoin::Pairs pairs;
+        EXPECT_EQ(join.execute(left, 0, right, 0, pairs), QueryError::SUCCESS);
+        built_left = join.builtLeft();
+        partitions = join.getPartitionCount();
+        std::vector<Pair> sorted;
+        for (size_t i = 0; i < pairs.left.size(); ++i) {
+            sorted.emplace_back(pairs.left[i], pairs.right[i]);
+        }
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    };
+    
+    const std::vector<Pair> inner = {{0, 0}, {2, 0}, {4, 1}, {4, 2}};
+    std::vector<Pair> left_outer = inner;
+    left_outer.insert(left_outer.end(), {{1, none}, {3, none}});
+    std::vector<Pair> right_outer = inner;
+    right_outer.insert(right_outer.end(), {{none, 3}, {none, 4}});
+    std::vector<Pair> full_outer = left_outer;
+    full_outer.insert(full_outer.end(), {{none, 3}, {none, 4}});
+    std::vector<Pair> full_large = full_outer;
+    full_large.push_back({none, 5});
+    for (auto* expected : {&left_outer, &right_outer, &full_outer, &full_large}) {
+        std::sort(expected->begin(), expected->end());
+    }
+    
+    bool built_left = false;
+    size_t partitions = 0;
+    for (size_t budget : {size_t{1} << 20, size_t{1}}) {
+        // EN: Equal sizes build the right side, a smaller left side gets built instead
+        // FR: À tailles égales le côté droit est construit, un côté gauche plus petit l'est à la place
+        EXPECT_EQ(run(JoinClause::INNER, budget, *probe, *discovery, built_left, partitions), inner);
+        EXPECT_FALSE(built_left);
+        EXPECT_EQ(partitions > 0, budget == 1);
+        EXPECT_EQ(run(JoinClause::LEFT, budget, *probe, *discovery, built_left, partitions), left_outer);
+        EXPECT_EQ(run(JoinClause::RIGHT, budget, *probe, *discovery, built_left, partitions), right_outer);
+        EXPECT_EQ(run(JoinClause::FULL, budget, *probe, *discovery, built_left, partitions), full_outer);
+        
+        EXPECT_EQ(run(JoinClause::INNER, budget, *probe, *discovery_large, built_left, partitions), inner);
+        EXPECT_TRUE(built_left);
+        EXPECT_EQ(run(JoinClause::LEFT, budget, *probe, *discovery_large, built_left, partitions), left_outer);
+        EXPECT_EQ(run(JoinClause::FULL, budget, *probe, *discovery_large, built_left, partitions), full_large);
+    }
+}
+
+TEST(HashJoinTest, SpilledJoinMatchesInMemory) {
+    std::vector<std::vector<std::string>> left_rows;
+    std::vector<std::vector<std::string>> right_rows;
+    for (size_t i = 0; i < 20000; ++i) {
+        left_rows.push_back({"host" + std::to_string(i % 7000) + ".example.com", std::to_string(i)});
+    }
+    for (size_t i = 0; i < 9000; ++i) {
+        right_rows.push_back({"host" + std::to_string(i * 3) + ".example.com", std::to_string(i)});
+    }
+    auto left = ColumnarTable::fromRows({"host", "id"}, left_rows);
+    auto right = ColumnarTable::fromRows({"host", "id"}, right_rows);
+    
+    auto join = [&](size_t budget, size_t& partitions, size_t& spilled) {
+        HashJoin hash_join(JoinClause::FULL, budget);
+        HashJoin::Pairs pairs;
+        EXPECT_EQ(hash_join.execute(*left, 0, *right, 0, pairs), QueryError::SUCCESS);
+        partitions = hash_join.getPartitionCount();
+        spilled = hash_join.getSpilledBytes();
+        std::vector<std::pair<size_t, size_t>> sorted;
+        for (size_t i = 0; i < pairs.left.size(); ++i) {
+            sorted.emplace_back(pairs.left[i], pairs.right[i]);
+        }
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    };
+    size_t partitions = 0;
+    size_t spilled = 0;
+    auto in_memory = join(64u << 20, partitions, spilled);
+    EXPECT_EQ(partitions, 0u);
+    EXPECT_EQ(spilled, 0u);
+    auto partitioned = join(256u << 10, partitions, spilled);
+    EXPECT_GE(partitions, 2u);
+    EXPECT_GT(spilled, 0u);
+    EXPECT_EQ(partitioned, in_memory);
+}
+
+TEST_F(QueryEngineTest, JoinQueries) {
+    engine->registerTable("probe", {"host", "status_code"}, {
+        {"a.example.com", "200"},
+        {"b.example.com", "404"},
+        {"c.example.com", "200"},
+    });
+    engine->registerTable("discovery", {"host", "path"}, {
+        {"a.example.com", "/admin"},
+        {"c.example.com", "/login"},
+        {"c.example.com", "/api"},
+        {"d.example.com", "/"},
+    });
+    
+    // EN: Shared columns are qualified, the others keep their name; WHERE and ORDER BY read the joined table
+    // FR: Les colonnes communes sont qualifiées, les autres gardent leur nom ; WHERE et ORDER BY lisent la table jointe
+    auto result = engine->execute("SELECT * FROM probe JOIN discovery ON probe.host = discovery.host ORDER BY path");
+    EXPECT_EQ(result.getHeaders(), (std::vector<std::string>{"probe.host", "status_code", "discovery.host", "path"}));
+    ASSERT_EQ(result.getRowCount(), 3u);
+    EXPECT_EQ(result.getCell(0, "path"), "/admin");
+    EXPECT_EQ(result.getCell(1, "path"), "/api");
+    EXPECT_EQ(result.getCell(1, "probe.host"), "c.example.com");
+    EXPECT_THAT(result.getStatistics().execution_plan, HasSubstr("Join: INNER discovery"));
+    
+    result = engine->execute("SELECT probe.host, path FROM probe LEFT JOIN discovery ON host = host "
+                             "WHERE path IS NULL");
+    ASSERT_EQ(result.getRowCount(), 1u);
+    EXPECT_EQ(result.getCell(0, 0), "b.example.com");
+    
+    result = engine->execute("SELECT discovery.host FROM probe RIGHT JOIN discovery ON discovery.host = probe.host "
+                             "WHERE status_code IS NULL");
+    ASSERT_EQ(result.getRowCount(), 1u);
+    EXPECT_EQ(result.getCell(0, 0), "d.example.com");
+    
+    result = engine->execute("SELECT COUNT(path) FROM probe FULL JOIN discovery ON probe.host = discovery.host");
+    ASSERT_EQ(result.getRowCount(), 1u);
+    EXPECT_EQ(result.getCell(0, 0), "5");
+    
+    // EN: Unknown join table or column gives an empty result
+    // FR: Une table ou colonne de jointure inconnue donne un résultat vide
+    EXPECT_EQ(engine->execute("SELECT * FROM probe JOIN missing ON host = host").getRowCount(), 0u);
+    EXPECT_EQ(engine->execute("SELECT * FROM probe JOIN discovery ON host = missing").getRowCount(), 0u);
+    
+    std::string plan = engine->explainQuery("SELECT * FROM probe JOIN discovery ON probe.host = discovery.host");
+    EXPECT_THAT(plan, HasSubstr("JOIN: INNER discovery"));
+    EXPECT_THAT(plan, HasSubstr("build left"));
+    EXPECT_THAT(plan, HasSubstr("in memory"));
+}
+
+// EN: Tests for out-of-core execution
+// FR: Tests de l'exécution hors mémoire
+
+TEST(ExternalSortTest, SpilledRunsMergeStably) {
+    // EN: Mixed numeric and text keys, many duplicates; the second column records the input order
+    // FR: Clés numériques et textuelles mêlées, beaucoup de doublons ; la deuxième colonne retient l'ordre d'entrée
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 5000; ++i) {
+        std::string key = i % 11 == 0 ? "n/a" : std::to_string((i * 7919) % 300) + (i % 4 ? "" : ".5");
+        rows.push_back({key, std::to_string(i)});
+    }
+    const std::vector<std::string> headers = {"score", "seq"};
+    const std::vector<OrderByColumn> order_by = {{"score", SortDirection::DESC}};
+    
+    RowOrder order(headers, order_by);
+    ASSERT_TRUE(order.valid());
+    EXPECT_FALSE(RowOrder(headers, {{"missing", SortDirection::ASC}}).valid());
+    auto expected = rows;
+    std::stable_sort(expected.begin(), expected.end(), [&order](const auto& a, const auto& b) {
+        return order.less(a, order.makeKey(a), b, order.makeKey(b));
+    });
+    
+    for (size_t budget : {size_t{0}, size_t{16} << 10}) {
+        ExternalSorter sorter(RowOrder(headers, order_by), budget);
+        for (const auto& row : rows) {
+            ASSERT_EQ(sorter.add(row), QueryError::SUCCESS);
+        }
+        std::vector<std::vector<std::string>> sorted;
+        ASSERT_EQ(sorter.finish([&sorted](std::vector<std::string>&& row) {
+            sorted.push_back(std::move(row));
+            return true;
+        }), QueryError::SUCCESS);
+        EXPECT_EQ(sorted, expected) << "budget " << budget;
+        EXPECT_EQ(sorter.getRunCount() > 1, budget > 0);
+    }
+    
+    // EN: The sink can stop the merge early
+    // FR: Le récepteur peut arrêter la fusion tôt
+    ExternalSorter sorter(RowOrder(headers, order_by), size_t{16} << 10);
+    for (const auto& row : rows) {
+        ASSERT_EQ(sorter.add(row), QueryError::SUCCESS);
+    }
+    std::vector<std::vector<std::string>> top;
+    ASSERT_EQ(sorter.finish([&top](std::vector<std::string>&& row) {
+        top.push_back(std::move(row));
+        return top.size() < 10;
+    }), QueryError::SUCCESS);
+    EXPECT_EQ(top, std::vector<std::vector<std::string>>(expected.begin(), expected.begin() + 10));
+}
+
+TEST(HashAggregationTest, ParallelAndSpilledGroupsMatchSequential) {
+    // EN: Four morsels; "sub" is unique per row pair (high cardinality), "cdn" is dictionary-encoded
+    // FR: Quatre morceaux ; "sub" est unique par paire de lignes (forte cardinalité), "cdn" est encodé par dictionnaire
+    const size_t row_count = HashAggregation::kMorselRows * 3 + 1234;
+    std::vector<std::vector<std::string>> data;
+    for (size_t i = 0; i < row_count; ++i) {
+        data.push_back({"s" + std::to_string((i * 7919) % (row_count / 2)) + ".example.com",
+                        i % 3 ? "cloudflare" : "akamai", std::to_string((i * 31) % 977),
+                        i % 5 ? std::to_string(i % 13) : "n/a"});
+    }
+    auto table = ColumnarTable::fromRows({"sub", "cdn", "ms", "port"}, data);
+    ASSERT_TRUE(table->isDictionaryEncoded(1));
+    std::vector<size_t> rows;
+    for (size_t i = 0; i < row_count; ++i) {
+        if (i % 7 != 0) {
+            rows.push_back(i);
+        }
+    }
+    
+    auto select = [](const std::string& column, AggregateFunction aggregate) {
+        SelectColumn col;
+        col.column = column;
+        col.aggregate = aggregate;
+        return col;
+    };
+    auto reference = [&](const std::vector<SelectColumn>& columns, size_t key) {
+        std::vector<std::string> order;
+        std::unordered_map<std::string, std::vector<AggregateAccumulator>> groups;
+        for (size_t row : rows) {
+            auto [it, inserted] = groups.try_emplace(data[row][key]);
+            if (inserted) {
+                order.push_back(data[row][key]);
+                for (const auto& col : columns) {
+                    it->second.emplace_back(col.aggregate);
+                }
+            }
+            for (size_t c = 0; c < columns.size(); ++c) {
+                it->second[c].add(data[row][table->getColumnIndex(columns[c].column)]);
+            }
+        }
+        std::vector<std::vector<std::string>> expected;
+        for (const auto& name : order) {
+            std::vector<std::string> out;
+            for (const auto& accumulator : groups[name]) {
+                out.push_back(accumulator.result());
+            }
+            expected.push_back(out);
+        }
+        return expected;
+    };
+    
+    const std::vector<SelectColumn> by_cdn = {
+        select("cdn", AggregateFunction::NONE), select("sub", AggregateFunction::COUNT),
+        select("ms", AggregateFunction::SUM), select("ms", AggregateFunction::AVG),
+        select("port", AggregateFunction::MIN), select("port", AggregateFunction::MAX),
+        select("port", AggregateFunction::DISTINCT)};
+    const std::vector<SelectColumn> by_sub = {
+        select("sub", AggregateFunction::NONE), select("ms", AggregateFunction::GROUP_CONCAT),
+        select("port", AggregateFunction::MAX), select("ms", AggregateFunction::DISTINCT)};
+    const auto expected_cdn = reference(by_cdn, 1);
+    const auto expected_sub = reference(by_sub, 0);
+    
+    BBP::ThreadPoolConfig pool_config;
+    pool_config.initial_threads = 3;
+    pool_config.min_threads = 3;
+    pool_config.max_threads = 3;
+    pool_config.enable_auto_scaling = false;
+    BBP::ThreadPool pool(pool_config);
+    for (size_t threads : {size_t{1}, size_t{4}}) {
+        for (size_t budget : {size_t{0}, size_t{256} << 10}) {
+            for (const auto& [columns, key, expected] :
+                 {std::tuple{by_cdn, "cdn", expected_cdn}, std::tuple{by_sub, "sub", expected_sub}}) {
+                HashAggregation aggregation(columns, {key}, budget, threads > 1 ? &pool : nullptr, threads - 1);
+                ASSERT_EQ(aggregation.add(*table, rows), QueryError::SUCCESS);
+                std::vector<std::vector<std::string>> output;
+                ASSERT_EQ(aggregation.finish(output), QueryError::SUCCESS);
+                EXPECT_EQ(output, expected) << key << " threads " << threads << " budget " << budget;
+                EXPECT_EQ(aggregation.getGroupCount(), expected.size());
+                EXPECT_GE(aggregation.getThreadCount(), 1u);
+                EXPECT_LE(aggregation.getThreadCount(),
+                          std::min(threads, (rows.size() + HashAggregation::kMorselRows - 1) / HashAggregation::kMorselRows));
+                if (std::string(key) == "sub") {
+                    EXPECT_EQ(aggregation.getPartitionCount() > 0, budget > 0);
+                }
+            }
+        }
+    }
+    
+    // EN: Without GROUP BY there is always one row, even over no rows
+    // FR: Sans GROUP BY il y a toujours une ligne, même sans ligne
+    HashAggregation empty({select("ms", AggregateFunction::SUM)}, {}, 0);
+    ASSERT_EQ(empty.add(*table, {}), QueryError::SUCCESS);
+    std::vector<std::vector<std::string>> output;
+    ASSERT_EQ(empty.finish(output), QueryError::SUCCESS);
+    EXPECT_EQ(output, std::vector<std::vector<std::string>>{{""}});
+}
+
+TEST_F(QueryEngineTest, GroupByQueries) {
+    auto result = engine->execute("SELECT department, COUNT(id), MAX(salary) FROM employees GROUP BY department");
+    ASSERT_GT(result.getRowCount(), 1u);
+    EXPECT_EQ(result.getHeaders()[0], "department");
+    size_t total = 0;
+    for (const auto& row : result.getRows()) {
+        total += std::stoul(row[1]);
+    }
+    EXPECT_EQ(total, engine->execute("SELECT * FROM employees").getRowCount());
+    EXPECT_THAT(result.getStatistics().execution_plan, HasSubstr("Hash aggregate"));
+    EXPECT_THAT(engine->explainQuery("SELECT department, COUNT(id) FROM employees GROUP BY department"),
+                HasSubstr("Aggregate: hash, GROUP BY department"));
+    
+    result = engine->execute("SELECT department, COUNT(id) AS n FROM employees WHERE department = 'Engineering' GROUP BY department");
+    ASSERT_EQ(result.getRowCount(), 1u);
+    EXPECT_EQ(result.getCell(0, 0), "Engineering");
+}
+
+TEST(TopKTest, KeepsSmallestInOrder) {
+    TopK<int, std::less<int>> top(4);
+    for (int value : {9, 3, 7, 1, 8, 3, 2, 6}) {
+        top.push(value);
+    }
+    EXPECT_FALSE(top.admits(5));
+    EXPECT_TRUE(top.admits(2));
+    EXPECT_EQ(top.take(), (std::vector<int>{1, 2, 3, 3}));
+    EXPECT_EQ(top.size(), 0u);
+    
+    TopK<int, std::less<int>> none(0);
+    none.push(1);
+    EXPECT_TRUE(none.take().empty());
+}
+
+TEST(TopKTest, SelectedRowsMatchStableSort) {
+    // EN: Dictionary-encoded and plain sort columns, numbers mixed with text, many ties
+    // FR: Colonnes de tri encodées par dictionnaire et simples, nombres mêlés à du texte, beaucoup d'égalités
+    std::vector<std::vector<std::string>> data;
+    for (size_t i = 0; i < 3000; ++i) {
+        data.push_back({"h" + std::to_string(i), std::to_string(i % 17 * 5),
+                        i % 13 == 0 ? "n/a" : std::to_string((i * 7919) % 211) + (i % 3 ? "" : ".5")});
+    }
+    const std::vector<std::string> headers = {"host", "risk", "score"};
+    auto table = ColumnarTable::fromRows(headers, data, 100);
+    ASSERT_TRUE(table->isDictionaryEncoded(1));
+    ASSERT_FALSE(table->isDictionaryEncoded(2));
+    std::vector<size_t> rows;
+    for (size_t i = 0; i < data.size(); i += 2) {
+        rows.push_back(i);
+    }
+    
+    for (const auto& order_by : {std::vector<OrderByColumn>{{"risk", SortDirection::DESC}},
+                                 std::vector<OrderByColumn>{{"score", SortDirection::ASC}, {"host", SortDirection::DESC}},
+                                 std::vector<OrderByColumn>{{"risk", SortDirection::ASC}, {"score", SortDirection::DESC}}}) {
+        RowOrder order(headers, order_by);
+        ASSERT_TRUE(order.valid());
+        std::vector<size_t> expected = rows;
+        std::stable_sort(expected.begin(), expected.end(), [&](size_t a, size_t b) {
+            return order.less(data[a], order.makeKey(data[a]), data[b], order.makeKey(data[b]));
+        });
+        std::vector<size_t> columns;
+        for (size_t i = 0; i < order.getKeyCount(); ++i) {
+            columns.push_back(order.getColumn(i));
+        }
+        for (size_t k : {size_t{1}, size_t{10}, size_t{250}, rows.size() + 5}) {
+            auto selected = selectTopRows(*table, rows, order, columns, k);
+            ASSERT_EQ(selected.size(), std::min(k, rows.size()));
+            EXPECT_TRUE(std::equal(selected.begin(), selected.end(), expected.begin())) << "k " << k;
+            
+            RowTopK top(RowOrder(headers, order_by), k);
+            for (size_t row : rows) {
+                top.add(data[row]);
+            }
+            auto top_rows = top.take();
+            ASSERT_EQ(top_rows.size(), selected.size());
+            for (size_t i = 0; i < top_rows.size(); ++i) {
+                EXPECT_EQ(top_rows[i], data[selected[i]]);
+            }
+        }
+    }
+}
+
+TEST_F(QueryEngineTest, OrderByLimitUsesTopK) {
+    QueryResult full = engine->execute("SELECT name, salary FROM employees ORDER BY salary DESC");
+    QueryResult top = engine->execute("SELECT name, salary FROM employees ORDER BY salary DESC LIMIT 2 OFFSET 1");
+    ASSERT_EQ(top.getRowCount(), 2u);
+    EXPECT_EQ(top.getRows()[0], full.getRows()[1]);
+    EXPECT_EQ(top.getRows()[1], full.getRows()[2]);
+    EXPECT_THAT(top.getStatistics().execution_plan, HasSubstr("Top-K: 3 of"));
+    
+    // EN: Ordering by a select alias and after an aggregation goes through the result-row heap
+    // FR: Trier par un alias de sélection et après une agrégation passe par le tas de lignes de résultat
+    top = engine->execute("SELECT name AS who FROM employees ORDER BY who LIMIT 1");
+    ASSERT_EQ(top.getRowCount(), 1u);
+    EXPECT_EQ(top.getCell(0, 0), engine->execute("SELECT name FROM employees ORDER BY name").getCell(0, 0));
+    top = engine->execute("SELECT department, COUNT(id) AS n FROM employees GROUP BY department ORDER BY n DESC LIMIT 1");
+    ASSERT_EQ(top.getRowCount(), 1u);
+    EXPECT_EQ(top.getCell(0, 0), "Engineering");
+    EXPECT_THAT(engine->explainQuery("SELECT * FROM employees ORDER BY age LIMIT 3"), HasSubstr("Top-K heap of 3 rows"));
+}
+
+TEST_F(QueryEngineTest, StreamingMatchesLoadedTable) {
+    std::vector<std::string> lines = {"host,status_code,response_time_ms,cdn"};
+    for (size_t i = 0; i < 20000; ++i) {
+        lines.push_back("h" + std::to_string(i) + ".example.com," + std::to_string(200 + (i % 4) * 100) + "," +
+                        std::to_string((i * 7919) % 5000) + "," + (i % 3 ? "cloudflare" : "akamai"));
+    }
+    createCSVFile("probe.csv", lines);
+    const std::string csv_file = test_dir / "probe.csv";
+    
+    // EN: A 1 MB budget makes the ORDER BY queries spill sorted runs
+    // FR: Un budget de 1 Mo fait déborder les requêtes ORDER BY en séquences triées
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.max_memory_mb = 1;
+    QueryEngine streaming(config);
+    ASSERT_EQ(streaming.attachTable("probe", csv_file), QueryError::SUCCESS);
+    EXPECT_EQ(streaming.attachTable("missing", (test_dir / "missing.csv").string()), QueryError::FILE_NOT_FOUND);
+    EXPECT_EQ(streaming.getTableNames(), std::vector<std::string>{"probe"});
+    EXPECT_EQ(streaming.getTable("probe"), nullptr);
+    
+    QueryEngine loaded(config);
+    ASSERT_EQ(loaded.loadTable("probe", csv_file), QueryError::SUCCESS);
+    
+    const char* const queries[] = {
+        "SELECT * FROM probe",
+        "SELECT host, response_time_ms FROM probe WHERE status_code = 400 AND cdn = 'akamai'",
+        "SELECT COUNT(host), SUM(response_time_ms), AVG(response_time_ms), MIN(host), MAX(response_time_ms) FROM probe WHERE status_code >= 300",
+        "SELECT DISTINCT cdn, status_code FROM probe",
+        "SELECT host, response_time_ms FROM probe ORDER BY response_time_ms DESC, host LIMIT 25 OFFSET 5",
+        "SELECT host AS target FROM probe WHERE response_time_ms < 100 ORDER BY target",
+        "SELECT host FROM probe WHERE cdn = 'akamai' LIMIT 10 OFFSET 3",
+        "SELECT cdn, status_code, COUNT(host), MAX(response_time_ms) FROM probe GROUP BY cdn, status_code ORDER BY status_code",
+    };
+    for (const char* sql : queries) {
+        QueryResult expected = loaded.execute(sql);
+        QueryResult actual = streaming.execute(sql);
+        EXPECT_GT(expected.getRowCount(), 0u) << sql;
+        EXPECT_EQ(actual.getHeaders(), expected.getHeaders()) << sql;
+        EXPECT_EQ(actual.getRows(), expected.getRows()) << sql;
+    }
+    
+    QueryResult sorted = streaming.execute("SELECT * FROM probe ORDER BY host");
+    EXPECT_EQ(sorted.getRowCount(), 20000u);
+    EXPECT_EQ(sorted.getStatistics().rows_examined, 20000u);
+    EXPECT_THAT(sorted.getStatistics().execution_plan, HasSubstr("Streaming scan"));
+    EXPECT_THAT(sorted.getStatistics().execution_plan, Not(HasSubstr("External sort: 0 ")));
+    EXPECT_THAT(streaming.explainQuery("SELECT * FROM probe"), HasSubstr("Scan: streaming"));
+    
+    // EN: LIMIT without ORDER BY stops reading early
+    // FR: LIMIT sans ORDER BY arrête la lecture tôt
+    QueryResult limited = streaming.execute("SELECT host FROM probe LIMIT 5");
+    EXPECT_EQ(limited.getRowCount(), 5u);
+    EXPECT_LT(limited.getStatistics().rows_examined, 20000u);
+}
+
+TEST_F(QueryEngineTest, IndexCandidatesAreFiltered) {
+    // EN: The auto index on id narrows the candidates, the other conditions still apply
+    // FR: L'index automatique sur id réduit les candidats, les autres conditions s'appliquent toujours
+    auto result = engine->execute("SELECT name FROM employees WHERE id = '3' AND department = 'Marketing'");
+    EXPECT_EQ(result.getRowCount(), 0u);
+    result = engine->execute("SELECT name FROM employees WHERE id = '2' AND department = 'Marketing'");
+    ASSERT_EQ(result.getRowCount(), 1u);
+    EXPECT_EQ(result.getCell(0, 0), "Bob Smith");
+    
+    // EN: OR clauses are never narrowed by an index
+    // FR: Les clauses OR ne sont jamais réduites par un index
+    result = engine->execute("SELECT name FROM employees WHERE id = '1' OR department = 'HR'");
+    EXPECT_EQ(result.getRowCount(), 2u);
+}
+
+TEST_F(QueryEngineTest, PersistentIndexesReloadUntilSourceChanges) {
+    const std::string csv_file = test_dir / "test_data.csv";
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.persist_indexes = true;
+    IndexConfig by_category;
+    by_category.column = "category";
+    by_category.type = IndexType::BTREE;
+    const std::string sql = "SELECT name FROM items WHERE id = '3' AND category = 'Cat1'";
+    const std::string explain = "SELECT name FROM items WHERE id = '3'";
+    
+    // EN: First session: indexes are built, then saved next to the CSV
+    // FR: Première session : les index sont construits, puis enregistrés à côté du CSV
+    {
+        QueryEngine first(config);
+        ASSERT_EQ(first.loadTable("items", csv_file), QueryError::SUCCESS);
+        ASSERT_EQ(first.createIndex("items", by_category), QueryError::SUCCESS);
+        EXPECT_THAT(first.explainQuery(explain), Not(HasSubstr("mapped")));
+        EXPECT_EQ(first.execute(sql).getRows(), std::vector<std::vector<std::string>>{{"Item C"}});
+    }
+    EXPECT_TRUE(std::filesystem::exists(PersistentIndex::pathFor(csv_file, "id", IndexType::HASH)));
+    EXPECT_TRUE(std::filesystem::exists(PersistentIndex::pathFor(csv_file, "category", IndexType::BTREE)));
+    
+    // EN: Next session: both indexes are mapped and answer the same
+    // FR: Session suivante : les deux index sont mappés et répondent pareil
+    {
+        QueryEngine second(config);
+        ASSERT_EQ(second.loadTable("items", csv_file), QueryError::SUCCESS);
+        ASSERT_EQ(second.createIndex("items", by_category), QueryError::SUCCESS);
+        EXPECT_THAT(second.explainQuery(explain), HasSubstr("INDEXED, mapped from disk"));
+        EXPECT_EQ(second.execute(sql).getRows(), std::vector<std::vector<std::string>>{{"Item C"}});
+        EXPECT_EQ(second.execute("SELECT id FROM items WHERE category = 'Cat1'").getRowCount(), 2u);
+        EXPECT_TRUE(second.execute("SELECT id FROM items WHERE category = 'Cat9'").isEmpty());
+    }
+    
+    // EN: Same size and mtime but another content: the hash rejects the files and they are rebuilt
+    // FR: Même taille et mtime mais un autre contenu : l'empreinte rejette les fichiers et ils sont reconstruits
+    const auto mtime = std::filesystem::last_write_time(csv_file);
+    createCSVFile("test_data.csv", {
+        "id,name,category,value",
+        "1,Item A,Cat1,100",
+        "2,Item B,Cat2,200",
+        "3,Item C,Cat2,150",
+        "4,Item D,Cat3,300"
+    });
+    std::filesystem::last_write_time(csv_file, mtime);
+    {
+        QueryEngine third(config);
+        ASSERT_EQ(third.loadTable("items", csv_file), QueryError::SUCCESS);
+        EXPECT_THAT(third.explainQuery(explain), Not(HasSubstr("mapped")));
+        ASSERT_EQ(third.createIndex("items", by_category), QueryError::SUCCESS);
+        EXPECT_TRUE(third.execute(sql).isEmpty());
+        EXPECT_EQ(third.execute("SELECT id FROM items WHERE category = 'Cat2'").getRowCount(), 2u);
+    }
+    
+    // EN: A file built with other options is not reused, a truncated one is rejected
+    // FR: Un fichier construit avec d'autres options n'est pas réutilisé, un fichier tronqué est rejeté
+    IndexSource source;
+    ASSERT_TRUE(readIndexSource(csv_file, source));
+    const std::string index_file = PersistentIndex::pathFor(csv_file, "category", IndexType::BTREE);
+    PersistentIndex index;
+    ASSERT_TRUE(index.open(index_file, source, by_category, 4));
+    EXPECT_EQ(index.getKeyCount(), 3u);
+    EXPECT_EQ(index.getKey(0), "Cat1");
+    EXPECT_EQ(index.find("Cat2"), (std::vector<size_t>{1, 2}));
+    EXPECT_FALSE(index.open(index_file, source, by_category, 5));
+    IndexConfig by_name = by_category;
+    by_name.column = "name";
+    EXPECT_FALSE(index.open(index_file, source, by_name, 4));
+    std::filesystem::resize_file(index_file, std::filesystem::file_size(index_file) - 1);
+    EXPECT_FALSE(index.open(index_file, source, by_category, 4));
+    EXPECT_TRUE(index.find("Cat2").empty());
+}
+
+TEST(InvertedIndexTest, CompressedPostingsMatchBruteForce) {
+    // EN: Skewed vocabulary: "t0" in every row, "t7" in one row in seven, "t97" rarely, so the rare lists drive
+    //     the intersections and the long ones gallop over several skip blocks
+    // FR: Vocabulaire déséquilibré : "t0" dans chaque ligne, "t7" dans une ligne sur sept, "t97" rarement, les
+    //     listes rares mènent donc les intersections et les longues galopent sur plusieurs blocs de saut
+    const size_t row_count = 5000;
+    std::vector<std::vector<std::string>> documents(row_count);
+    InvertedIndex index;
+    for (size_t row = 0; row < row_count; ++row) {
+        documents[row].push_back("t0");
+        for (size_t modulus : {2, 7, 97}) {
+            if (row % modulus == 0) {
+                documents[row].push_back("t" + std::to_string(modulus));
+            }
+        }
+        documents[row].push_back("w" + std::to_string(row % 13));
+        documents[row].push_back("t0");
+        if (row % 3 == 0) {
+            std::reverse(documents[row].begin(), documents[row].end());
+        }
+        index.add(row, documents[row]);
+    }
+    index.finish();
+    EXPECT_EQ(index.getTermCount(), 17u);
+    EXPECT_TRUE(index.find("absent").empty());
+    
+    // EN: Positions included, under half of the 8 bytes per row a vector of size_t took without them
+    // FR: Positions comprises, moins de la moitié des 8 octets par ligne d'un vecteur de size_t qui n'en avait pas
+    size_t encoded_bytes = 0;
+    for (size_t i = 0; i < index.getTermCount(); ++i) {
+        encoded_bytes += index.getPostings(i).size();
+    }
+    EXPECT_LT(encoded_bytes, 4 * index.getPostingCount());
+    
+    auto brute = [&](const std::vector<std::string>& terms, TextMatch mode) {
+        std::vector<size_t> rows;
+        for (size_t row = 0; row < row_count; ++row) {
+            const auto& tokens = documents[row];
+            auto has = [&tokens](const std::string& term) {
+                return std::find(tokens.begin(), tokens.end(), term) != tokens.end();
+            };
+            bool match = false;
+            if (mode == TextMatch::ALL_TERMS) {
+                match = std::all_of(terms.begin(), terms.end(), has);
+            } else if (mode == TextMatch::ANY_TERM) {
+                match = std::any_of(terms.begin(), terms.end(), has);
+            } else {
+                for (size_t start = 0; start + terms.size() <= tokens.size() && !match; ++start) {
+                    match = std::equal(terms.begin(), terms.end(), tokens.begin() + start);
+                }
+            }
+            if (match) {
+                rows.push_back(row);
+            }
+        }
+        return rows;
+    };
+    const std::vector<std::vector<std::string>> queries = {
+        {"t0"}, {"t2", "t7"}, {"t97", "t0", "t2"}, {"t7", "w3"}, {"t97", "absent"}, {"t0", "t2"}, {"t2", "t0"},
+        {"w5", "t0"}, {"t0", "t7", "t97"}, {"t0", "t0"},
+    };
+    for (const auto& terms : queries) {
+        std::vector<std::string_view> postings;
+        for (const auto& term : terms) {
+            postings.push_back(index.find(term));
+        }
+        for (TextMatch mode : {TextMatch::ALL_TERMS, TextMatch::ANY_TERM, TextMatch::PHRASE}) {
+            EXPECT_EQ(matchPostings(postings, mode), brute(terms, mode))
+                << terms.front() << " x" << terms.size() << " mode " << static_cast<int>(mode);
+        }
+    }
+    
+    // EN: seek() never moves backwards and lands on the first row at or after the target
+    // FR: seek() ne recule jamais et s'arrête sur la première ligne au moins égale à la cible
+    PostingCursor cursor(index.find("t7"));
+    EXPECT_EQ(cursor.getRowCount(), (row_count + 6) / 7);
+    cursor.seek(3000);
+    EXPECT_EQ(cursor.row(), 3003u);
+    cursor.seek(10);
+    EXPECT_EQ(cursor.row(), 3003u);
+    cursor.seek(row_count);
+    EXPECT_TRUE(cursor.atEnd());
+}
+
+TEST_F(QueryEngineTest, FullTextSearch) {
+    createCSVFile("findings.csv", {
+        "id,comment_text",
+        "1,SQL injection in the login form",
+        "2,Reflected XSS in search; no SQL injection found",
+        "3,Injection of SQL comments in the search box",
+        "4,Open redirect on logout",
+    });
+    const std::string csv_file = test_dir / "findings.csv";
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.persist_indexes = true;
+    IndexConfig fulltext;
+    fulltext.column = "comment_text";
+    fulltext.type = IndexType::FULL_TEXT;
+    fulltext.case_sensitive = false;
+    
+    auto ids = [](const QueryResult& result) {
+        std::vector<std::string> values;
+        for (const auto& row : result.getRows()) {
+            values.push_back(row[0]);
+        }
+        return values;
+    };
+    
+    // EN: Built in memory by the first session, mapped from its file by the second
+    // FR: Construit en mémoire par la première session, mappé depuis son fichier par la seconde
+    for (int session = 0; session < 2; ++session) {
+        QueryEngine search(config);
+        ASSERT_EQ(search.loadTable("findings", csv_file), QueryError::SUCCESS);
+        EXPECT_TRUE(search.searchText("findings", "comment_text", "sql").isEmpty()) << "no FULL_TEXT index yet";
+        ASSERT_EQ(search.createIndex("findings", fulltext), QueryError::SUCCESS);
+        
+        EXPECT_EQ(ids(search.searchText("findings", "comment_text", "SQL injection")),
+                  (std::vector<std::string>{"1", "2", "3"}));
+        EXPECT_EQ(ids(search.searchText("findings", "comment_text", "sql injection", TextMatch::PHRASE)),
+                  (std::vector<std::string>{"1", "2"}));
+        EXPECT_EQ(ids(search.searchText("findings", "comment_text", "xss redirect", TextMatch::ANY_TERM)),
+                  (std::vector<std::string>{"2", "4"}));
+        EXPECT_EQ(ids(search.searchText("findings", "comment_text", "in the search", TextMatch::PHRASE)),
+                  (std::vector<std::string>{"3"}));
+        EXPECT_TRUE(search.searchText("findings", "comment_text", "csrf").isEmpty());
+        
+        QueryResult result = search.searchText("findings", "comment_text", "injection");
+        EXPECT_EQ(result.getHeaders(), (std::vector<std::string>{"id", "comment_text"}));
+        EXPECT_EQ(result.getCell(0, 1), "SQL injection in the login form");
+        EXPECT_THAT(result.getStatistics().execution_plan, HasSubstr("Full-text search: all terms"));
+    }
+}
+
+TEST(MorselScanTest, CoversEveryItemOnceAndRethrows) {
+    BBP::ThreadPoolConfig pool_config;
+    pool_config.initial_threads = 3;
+    pool_config.min_threads = 3;
+    pool_config.max_threads = 3;
+    pool_config.enable_auto_scaling = false;
+    BBP::ThreadPool pool(pool_config);
+    
+    std::vector<int> visits(10007, 0);
+    std::vector<size_t> morsel_begins(morselCount(visits.size(), 100), visits.size());
+    const size_t threads = forEachMorsel(&pool, 3, visits.size(), 100, [&](size_t morsel, size_t begin, size_t end) {
+        morsel_begins[morsel] = begin;
+        for (size_t i = begin; i < end; ++i) {
+            ++visits[i];
+        }
+    });
+    EXPECT_GE(threads, 1u);
+    EXPECT_LE(threads, 4u);
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+    for (size_t morsel = 0; morsel < morsel_begins.size(); ++morsel) {
+        EXPECT_EQ(morsel_begins[morsel], morsel * 100);
+    }
+    EXPECT_EQ(forEachMorsel(nullptr, 3, 0, 100, [](size_t, size_t, size_t) { FAIL(); }), 1u);
+    EXPECT_THROW(forEachMorsel(&pool, 3, visits.size(), 100, [](size_t morsel, size_t, size_t) {
+        if (morsel == 42) {
+            throw std::runtime_error("morsel failed");
+        }
+    }), std::runtime_error);
+}
+
+TEST_F(QueryEngineTest, ParallelScanMatchesSingleThread) {
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 100000; ++i) {
+        rows.push_back({std::to_string(i), i % 7 ? "ok" : "error", std::to_string((i * 7919) % 1000)});
+    }
+    auto run = [&rows](size_t threads, const std::string& sql) {
+        QueryEngine::Config config;
+        config.enable_query_cache = false;
+        config.auto_index = false;
+        config.worker_threads = threads;
+        QueryEngine scan(config);
+        scan.registerTable("events", {"id", "level", "score"}, rows);
+        return scan.execute(sql);
+    };
+    
+    const char* const queries[] = {
+        "SELECT id, score FROM events WHERE level = 'error' AND score > 500",
+        "SELECT * FROM events WHERE score < 10",
+        "SELECT id FROM events",
+    };
+    for (const char* sql : queries) {
+        QueryResult serial = run(1, sql);
+        QueryResult parallel = run(4, sql);
+        ASSERT_FALSE(serial.isEmpty()) << sql;
+        EXPECT_EQ(parallel.getRows(), serial.getRows()) << sql;
+        EXPECT_THAT(serial.getStatistics().execution_plan, Not(HasSubstr("Parallel"))) << sql;
+    }
+    QueryResult parallel = run(4, queries[0]);
+    EXPECT_THAT(parallel.getStatistics().execution_plan, HasSubstr("Parallel scan: 7 morsels"));
+    EXPECT_THAT(run(4, queries[2]).getStatistics().execution_plan, HasSubstr("Parallel projection: 7 morsels"));
+}
+
+TEST(ZoneMapTest, NeverSkipsABlockWithAMatch) {
+    // EN: Mixed cells: ordered numbers, text, NULLs and numbers spelled differently ("07", "7.0")
+    // FR: Cellules mélangées : nombres ordonnés, texte, NULL et nombres écrits autrement (« 07 », « 7.0 »)
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 5000; ++i) {
+        std::string cell = std::to_string(i / 10);
+        if (i % 97 == 0) cell = "NULL";
+        else if (i % 89 == 0) cell = "host" + std::to_string(i);
+        else if (i % 83 == 0) cell = "0" + cell;
+        else if (i % 79 == 0) cell += ".0";
+        rows.push_back({cell});
+    }
+    auto table = ColumnarTable::fromRows({"v"}, rows, 0);
+    ZoneMap zone_map(*table, 0, 256);
+    ASSERT_EQ(zone_map.getBlockCount(), 20u);
+    
+    QueryParser parser;
+    const char* const clauses[] = {
+        "v = 42", "v = '042'", "v = 'host178'", "v = 'host179'", "v = 7", "v < 3", "v >= 490", "v > 'host'",
+        "v BETWEEN 100 AND 105", "v BETWEEN 'a' AND 'i'", "v IN (5, 300, 'host445')", "v IS NULL",
+        "v IS NOT NULL", "v LIKE 'host%'",
+    };
+    size_t skipped = 0;
+    for (const char* clause : clauses) {
+        SqlQuery query;
+        ASSERT_EQ(parser.parse(std::string("SELECT * FROM t WHERE ") + clause, query), QueryError::SUCCESS) << clause;
+        CompiledFilter filter(query.where, *table);
+        for (size_t block = 0; block < zone_map.getBlockCount(); ++block) {
+            std::vector<size_t> matches;
+            filter.selectRows(block * 256, std::min<size_t>(table->getRowCount(), (block + 1) * 256), matches);
+            if (!zone_map.mayMatch(block, query.where[0])) {
+                EXPECT_TRUE(matches.empty()) << clause << " skipped block " << block;
+                ++skipped;
+            }
+        }
+    }
+    EXPECT_GT(skipped, 100u) << "equality and ranges on ordered values should prune blocks";
+}
+
+TEST_F(QueryEngineTest, ZoneMapsSkipBlocksOfOrderedTables) {
+    // EN: 09_changes-like output: appended in time order, so every block covers a narrow time window
+    // FR: Sortie de type 09_changes : ajoutée dans l'ordre du temps, chaque bloc couvre donc une fenêtre étroite
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 300000; ++i) {
+        rows.push_back({std::to_string(1700000000 + i), "host" + std::to_string(i % 5000) + ".example.com",
+                        std::to_string(200 + (i / 1000 % 4) * 100)});
+    }
+    auto run = [&rows](size_t block_rows, const std::string& sql) {
+        QueryEngine::Config config;
+        config.enable_query_cache = false;
+        config.auto_index = false;
+        config.zone_map_block_rows = block_rows;
+        QueryEngine scan(config);
+        scan.registerTable("changes", {"detected_at", "host", "status_code"}, rows);
+        return std::make_pair(scan.execute(sql), scan.explainQuery(sql));
+    };
+    
+    const std::string window = "SELECT * FROM changes WHERE detected_at BETWEEN 1700100000 AND 1700100999";
+    auto [pruned, explain] = run(65536, window);
+    auto [full, no_explain] = run(0, window);
+    ASSERT_EQ(pruned.getRowCount(), 1000u);
+    EXPECT_EQ(pruned.getRows(), full.getRows());
+    EXPECT_EQ(pruned.getStatistics().blocks_skipped, 4u);
+    EXPECT_EQ(pruned.getStatistics().rows_examined, 65536u);
+    EXPECT_THAT(pruned.getStatistics().execution_plan, HasSubstr("Zone maps: skipped 4 of 5 blocks"));
+    EXPECT_THAT(explain, HasSubstr("Zone maps: 4 of 5 blocks"));
+    EXPECT_EQ(full.getStatistics().blocks_skipped, 0u);
+    EXPECT_THAT(no_explain, Not(HasSubstr("Zone maps")));
+    
+    // EN: Bloom filters rule out a value absent from the blocks without bounding it; OR is never pruned
+    // FR: Les filtres de Bloom écartent une valeur absente des blocs sans la borner ; OR n'est jamais élagué
+    EXPECT_EQ(run(65536, "SELECT * FROM changes WHERE host = 'host77.example.org'").first.getStatistics().blocks_skipped, 5u);
+    EXPECT_EQ(run(65536, "SELECT * FROM changes WHERE host = 'host77.example.com' AND status_code >= 500")
+                  .first.getRowCount(),
+              run(0, "SELECT * FROM changes WHERE host = 'host77.example.com' AND status_code >= 500").first.getRowCount());
+    QueryResult either = run(65536, "SELECT * FROM changes WHERE detected_at = 1700000000 OR status_code = 300").first;
+    EXPECT_EQ(either.getStatistics().blocks_skipped, 0u);
+    EXPECT_EQ(either.getRowCount(), 75001u);
+}
+
+TEST(QueryPlannerTest, ColumnStatisticsEstimateDistinctValuesAndRanges) {
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 100000; ++i) {
+        rows.push_back({std::to_string(i), "tech" + std::to_string(i % 50),
+                        i % 10 == 0 ? "NULL" : std::to_string(i * 7919 % 1000)});
+    }
+    auto table = ColumnarTable::fromRows({"id", "technology", "latency_ms"}, rows);
+    auto stats = TableStatistics::collect(*table);
+    const ColumnStatistics* id = stats->find("id");
+    const ColumnStatistics* technology = stats->find("technology");
+    const ColumnStatistics* latency = stats->find("latency_ms");
+    ASSERT_TRUE(id && technology && latency);
+    EXPECT_EQ(stats->find("missing"), nullptr);
+    
+    // EN: HyperLogLog stays within a few percent; a dictionary-encoded column is counted exactly
+    // FR: HyperLogLog reste à quelques pour cent près ; une colonne encodée par dictionnaire est comptée exactement
+    EXPECT_NEAR(static_cast<double>(id->getDistinctCount()), 100000.0, 5000.0);
+    EXPECT_EQ(technology->getDistinctCount(), 50u);
+    EXPECT_EQ(latency->getNullCount(), 10000u);
+    EXPECT_EQ(latency->getNumericCount(), 90000u);
+    EXPECT_EQ(latency->getHistogramBounds().size(), ColumnStatistics::kHistogramBuckets + 1);
+    
+    auto selectivity = [&stats](const std::string& where) {
+        QueryParser parser;
+        SqlQuery query;
+        EXPECT_EQ(parser.parse("SELECT * FROM t WHERE " + where, query), QueryError::SUCCESS) << where;
+        return stats->selectivity(query.where);
+    };
+    EXPECT_NEAR(selectivity("latency_ms < 250"), 0.9 * 0.25, 0.02);
+    EXPECT_NEAR(selectivity("latency_ms BETWEEN 100 AND 299"), 0.9 * 0.2, 0.02);
+    EXPECT_NEAR(selectivity("latency_ms IS NULL"), 0.1, 1e-9);
+    EXPECT_NEAR(selectivity("technology = 'tech7'"), 0.02, 1e-9);
+    EXPECT_NEAR(selectivity("technology = 'tech7' AND latency_ms < 500"), 0.02 * 0.45, 0.002);
+    EXPECT_NEAR(selectivity("technology = 'tech7' OR technology = 'tech8'"), 0.02 + 0.02 - 0.0004, 1e-9);
+    EXPECT_EQ(selectivity("id = 100001"), 0.0);
+}
+
+TEST(QueryPlannerTest, PlannerPicksTheCheapestAccessPath) {
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 50000; ++i) {
+        rows.push_back({"host" + std::to_string(i % 5000) + ".example.com", std::to_string(200 + (i % 4) * 100),
+                        std::to_string(i)});
+    }
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    engine.registerTable("probe", {"host", "status_code", "content_length"}, rows);
+    QueryEngine reference(config);
+    reference.registerTable("probe", {"host", "status_code", "content_length"}, rows);
+    for (const char* column : {"status_code", "host"}) {
+        IndexConfig index;
+        index.column = column;
+        index.type = IndexType::HASH;
+        ASSERT_EQ(engine.createIndex("probe", index), QueryError::SUCCESS);
+    }
+    
+    // EN: The host index fetches 10 rows whichever condition comes first; the status index alone would fetch a
+    //     quarter of the table, which costs more than scanning it
+    // FR: L'index host lit 10 lignes quelle que soit la condition écrite en premier ; l'index status seul lirait
+    //     un quart de la table, ce qui coûte plus que de la parcourir
+    for (const std::string sql : {"SELECT * FROM probe WHERE status_code = 500 AND host = 'host7.example.com'",
+                                  "SELECT * FROM probe WHERE host = 'host7.example.com' AND status_code = 500"}) {
+        QueryResult result = engine.execute(sql);
+        EXPECT_EQ(result.getRows(), reference.execute(sql).getRows()) << sql;
+        EXPECT_EQ(result.getRowCount(), 10u) << sql;
+        EXPECT_EQ(result.getStatistics().index_hits, std::vector<std::string>{"host"}) << sql;
+        EXPECT_EQ(result.getStatistics().rows_examined, 10u) << sql;
+        EXPECT_THAT(engine.explainQuery(sql), HasSubstr("Index Lookup on probe using host")) << sql;
+    }
+    
+    const std::string broad = "SELECT * FROM probe WHERE status_code = 300";
+    QueryResult scanned = engine.execute(broad);
+    EXPECT_EQ(scanned.getRowCount(), 12500u);
+    EXPECT_EQ(scanned.getStatistics().indexes_used, 0u);
+    EXPECT_THAT(engine.explainQuery(broad), HasSubstr("Seq Scan on probe"));
+    EXPECT_THAT(engine.explainQuery(broad), HasSubstr("Filter: status_code = 300"));
+}
+
+TEST(QueryPlannerTest, ExplainAnalyzeReportsActualRowsPerOperator) {
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    std::vector<std::vector<std::string>> probe;
+    std::vector<std::vector<std::string>> discovery;
+    for (size_t i = 0; i < 1000; ++i) {
+        probe.push_back({"host" + std::to_string(i), std::to_string(200 + (i % 2) * 200)});
+        discovery.push_back({"host" + std::to_string(i), i % 4 == 1 ? "crtsh" : "subfinder"});
+    }
+    engine.registerTable("probe", {"host", "status_code"}, probe);
+    engine.registerTable("discovery", {"host", "source"}, discovery);
+    
+    QueryResult plan = engine.execute("explain analyze SELECT source, COUNT(host) FROM probe JOIN discovery ON "
+                                      "probe.host = discovery.host WHERE status_code = 400 GROUP BY source");
+    ASSERT_EQ(plan.getHeaders(), std::vector<std::string>{"plan"});
+    std::string text;
+    for (const auto& row : plan.getRows()) {
+        text += row[0] + "\n";
+    }
+    EXPECT_THAT(text, HasSubstr("Hash Aggregate  (est. rows=2"));
+    EXPECT_THAT(text, HasSubstr("(actual rows=2 "));
+    EXPECT_THAT(text, HasSubstr("Filter  (est. rows=500"));
+    EXPECT_THAT(text, HasSubstr("(actual rows=500 "));
+    EXPECT_THAT(text, HasSubstr("Hash Join (inner)  (est. rows=1000"));
+    EXPECT_THAT(text, HasSubstr("(actual rows=1000 "));
+    EXPECT_THAT(text, HasSubstr("Seq Scan on discovery"));
+    EXPECT_THAT(text, HasSubstr("Execution time: "));
+    EXPECT_THAT(text, Not(HasSubstr("never executed")));
+    
+    // EN: Plain EXPLAIN only estimates; an operator that a query never reached says so
+    // FR: EXPLAIN seul ne fait qu'estimer ; un opérateur qu'une requête n'a jamais atteint le signale
+    EXPECT_THAT(engine.execute("EXPLAIN SELECT * FROM probe LIMIT 5").getRows(),
+                Contains(ElementsAre(HasSubstr("Limit  (est. rows=5"))));
+    EXPECT_THAT(engine.explainAnalyze("SELECT * FROM probe WHERE status_code = 200 LIMIT 5"),
+                HasSubstr("Limit  (est. rows=5 cost="));
+    EXPECT_THAT(engine.explainAnalyze("SELECT FROM"), HasSubstr("Parse Error"));
+}
+
+TEST(ResultCacheTest, EvictsLeastRecentlyUsedWithinBounds) {
+    auto makeResult = [](size_t rows) {
+        auto result = std::make_shared<QueryResult>(std::vector<std::string>{"host"});
+        for (size_t i = 0; i < rows; ++i) {
+            result->addRow({"host" + std::to_string(i) + ".internal.example.com"});
+        }
+        return result;
+    };
+    const size_t entry_bytes = ResultCache::estimateBytes(*makeResult(100));
+    ResultCache cache(entry_bytes * 3, 10);
+    cache.insert("a", makeResult(100), {SourceSignature::read("probe", "")});
+    cache.insert("b", makeResult(100), {SourceSignature::read("discovery", "")});
+    ASSERT_NE(cache.find("a"), nullptr);   // EN: "b" is now the least recently used / FR: "b" est maintenant le moins récemment utilisé
+    cache.insert("c", makeResult(100), {SourceSignature::read("probe", "")});
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.find("b"), nullptr);
+    EXPECT_NE(cache.find("a"), nullptr);
+    EXPECT_LE(cache.getBytes(), entry_bytes * 3);
+    
+    // EN: Larger than the whole budget: not kept, and nothing else is evicted for it
+    // FR: Plus grand que tout le budget : pas gardé, et rien d'autre n'est évincé pour lui
+    cache.insert("huge", makeResult(1000), {});
+    EXPECT_EQ(cache.find("huge"), nullptr);
+    EXPECT_EQ(cache.size(), 2u);
+    
+    cache.invalidateTable("probe");
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.getBytes(), 0u);
+}
+
+TEST_F(QueryEngineTest, CachedResultsAreSharedAndFollowTheirSources) {
+    const std::string sql = "SELECT name FROM employees WHERE department = 'Engineering'";
+    QueryResult first = engine->execute(sql);
+    QueryResult hit = engine->execute(sql);
+    QueryResult again = engine->execute(sql);
+    ASSERT_TRUE(hit.getStatistics().query_cached);
+    EXPECT_EQ(&hit.getRows(), &again.getRows());
+    
+    // EN: A caller writing to its copy gets its own rows; the cached snapshot is untouched
+    // FR: Un appelant qui écrit dans sa copie reçoit ses propres lignes ; l'instantané en cache reste intact
+    hit.addRow({"Mallory"});
+    EXPECT_NE(&hit.getRows(), &again.getRows());
+    EXPECT_EQ(engine->execute(sql).getRowCount(), first.getRowCount());
+    
+    // EN: Re-registering a table drops the results that read it
+    // FR: Réenregistrer une table retire les résultats qui la lisaient
+    engine->registerTable("employees", {"name", "department"}, {{"Zoe", "Engineering"}});
+    QueryResult reloaded = engine->execute(sql);
+    EXPECT_FALSE(reloaded.getStatistics().query_cached);
+    EXPECT_EQ(reloaded.getRows(), (std::vector<std::vector<std::string>>{{"Zoe"}}));
+    
+    // EN: So does rewriting the file of an attached table
+    // FR: Tout comme réécrire le fichier d'une table attachée
+    createCSVFile("targets.csv", {"host,program", "a.example.com,acme", "b.example.com,acme"});
+    ASSERT_EQ(engine->attachTable("targets", (test_dir / "targets.csv").string()), QueryError::SUCCESS);
+    const std::string targets = "SELECT host FROM targets WHERE program = 'acme'";
+    EXPECT_EQ(engine->execute(targets).getRowCount(), 2u);
+    EXPECT_TRUE(engine->execute(targets).getStatistics().query_cached);
+    createCSVFile("targets.csv", {"host,program", "a.example.com,acme", "b.example.com,acme", "c.example.com,acme"});
+    QueryResult rewritten = engine->execute(targets);
+    EXPECT_FALSE(rewritten.getStatistics().query_cached);
+    EXPECT_EQ(rewritten.getRowCount(), 3u);
+    
+    engine->clearQueryCache();
+    EXPECT_EQ(engine->getQueryCacheSize(), 0u);
+}
+
+TEST(PreparedStatementTest, BoundParametersMatchLiteralQueries) {
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 5000; ++i) {
+        rows.push_back({"host" + std::to_string(i % 500) + ".example.com", "program" + std::to_string(i % 7),
+                        std::to_string(200 + (i % 4) * 100), std::to_string(i % 1000)});
+    }
+    const std::vector<std::string> headers = {"host", "program", "status_code", "score"};
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    engine.registerTable("probe", headers, rows);
+    IndexConfig index;
+    index.column = "host";
+    index.type = IndexType::HASH;
+    ASSERT_EQ(engine.createIndex("probe", index), QueryError::SUCCESS);
+    
+    PreparedHandle by_host = engine.prepare("SELECT host, score FROM probe WHERE host = ? AND status_code >= ?");
+    PreparedHandle by_window = engine.prepare(
+        "SELECT program, COUNT(host) FROM probe WHERE score BETWEEN ? AND ? AND program IN (?, 'program1') "
+        "GROUP BY program ORDER BY program");
+    PreparedHandle by_pattern = engine.prepare("SELECT host FROM probe WHERE host LIKE ? ORDER BY host LIMIT 5");
+    ASSERT_TRUE(by_host && by_window && by_pattern);
+    EXPECT_EQ(by_host->getParameterCount(), 2u);
+    EXPECT_EQ(by_window->getParameterCount(), 3u);
+    
+    for (int i = 0; i < 3; ++i) {
+        const std::string host = "host" + std::to_string(1 + i * 37) + ".example.com";
+        QueryResult prepared = engine.execute(by_host, host, 300);
+        QueryResult literal = engine.execute("SELECT host, score FROM probe WHERE host = '" + host + "' AND status_code >= 300");
+        EXPECT_GT(prepared.getRowCount(), 0u);
+        EXPECT_EQ(prepared.getRows(), literal.getRows()) << host;
+        EXPECT_EQ(prepared.getStatistics().index_hits, std::vector<std::string>{"host"});
+    }
+    EXPECT_EQ(engine.execute(by_window, 100, 499, "program3").getRows(),
+              engine.execute("SELECT program, COUNT(host) FROM probe WHERE score BETWEEN 100 AND 499 AND program IN "
+                             "('program3', 'program1') GROUP BY program ORDER BY program").getRows());
+    EXPECT_EQ(engine.execute(by_pattern, std::vector<QueryValue>{std::string("host4%")}).getRows(),
+              engine.execute("SELECT host FROM probe WHERE host LIKE 'host4%' ORDER BY host LIMIT 5").getRows());
+    
+    // EN: Wrong arity, unknown columns and unbound placeholders are refused
+    // FR: Une mauvaise arité, des colonnes inconnues et des paramètres non liés sont refusés
+    EXPECT_TRUE(engine.execute(by_host, "host1.example.com").isEmpty());
+    EXPECT_EQ(engine.prepare("SELECT host FROM probe WHERE missing = ?"), nullptr);
+    EXPECT_EQ(engine.prepare("SELECT host FROM nowhere WHERE host = ?"), nullptr);
+    EXPECT_TRUE(engine.execute("SELECT host FROM probe WHERE host = ?").isEmpty());
+    
+    // EN: A replaced table is planned again and its new rows are read
+    // FR: Une table remplacée est planifiée à nouveau et ses nouvelles lignes sont lues
+    engine.registerTable("probe", headers, {{"host7.example.com", "program0", "500", "1"}});
+    EXPECT_EQ(engine.execute(by_host, "host7.example.com", 300).getRows(),
+              (std::vector<std::vector<std::string>>{{"host7.example.com", "1"}}));
+}
+
+TEST_F(QueryEngineTest, AppendedRowsAreIndexedLikeAFreshTable) {
+    auto makeRow = [](size_t i) {
+        return std::vector<std::string>{"host" + std::to_string(i % 300) + ".example.com", "program" + std::to_string(i % 7),
+                                        std::to_string(i), i % 5 == 0 ? "open redirect on login" : "reflected xss in search"};
+    };
+    const std::vector<std::string> headers = {"host", "program", "score", "note"};
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 2000; ++i) {
+        rows.push_back(makeRow(i));
+    }
+    
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    config.zone_map_block_rows = 256;
+    auto indexAll = [](QueryEngine& target) {
+        IndexConfig index;
+        index.column = "host";
+        index.type = IndexType::HASH;
+        ASSERT_EQ(target.createIndex("probe", index), QueryError::SUCCESS);
+        index.column = "program";
+        index.type = IndexType::BTREE;
+        ASSERT_EQ(target.createIndex("probe", index), QueryError::SUCCESS);
+        index.column = "note";
+        index.type = IndexType::FULL_TEXT;
+        index.case_sensitive = false;
+        ASSERT_EQ(target.createIndex("probe", index), QueryError::SUCCESS);
+    };
+    QueryEngine live(config);
+    live.registerTable("probe", headers, rows);
+    indexAll(live);
+    
+    // EN: Batches of growing size, queried while they are appended: the counts read only ever grow
+    // FR: Lots de taille croissante, interrogés pendant leur ajout : les comptes lus ne font que croître
+    std::atomic<bool> appending{true};
+    std::atomic<bool> went_back{false};
+    std::thread reader([&] {
+        size_t previous = 7;
+        while (appending) {
+            const size_t count = std::stoul(
+                live.execute("SELECT COUNT(*) FROM probe WHERE host = 'host1.example.com'").getCell(0, 0));
+            went_back = went_back || count < previous;
+            previous = count;
+        }
+    });
+    for (size_t batch = 1; batch <= 12; ++batch) {
+        std::vector<std::vector<std::string>> appended;
+        for (size_t i = 0; i < batch * 40; ++i) {
+            appended.push_back(makeRow(rows.size()));
+            rows.push_back(appended.back());
+        }
+        ASSERT_EQ(live.appendRows("probe", appended), QueryError::SUCCESS);
+    }
+    appending = false;
+    reader.join();
+    EXPECT_FALSE(went_back);
+    EXPECT_EQ(live.getTable("probe")->getRowCount(), rows.size());
+    EXPECT_EQ(live.appendRows("nowhere", {makeRow(0)}), QueryError::FILE_NOT_FOUND);
+    
+    QueryEngine fresh(config);
+    fresh.registerTable("probe", headers, rows);
+    indexAll(fresh);
+    for (const std::string sql : {"SELECT score FROM probe WHERE host = 'host17.example.com'",
+                                  "SELECT score FROM probe WHERE program = 'program3' AND score >= 2500",
+                                  "SELECT host, note FROM probe WHERE score BETWEEN 2100 AND 2140",
+                                  "SELECT program, COUNT(*) FROM probe GROUP BY program ORDER BY program"}) {
+        EXPECT_EQ(live.execute(sql).getRows(), fresh.execute(sql).getRows()) << sql;
+    }
+    EXPECT_EQ(live.execute("SELECT score FROM probe WHERE host = 'host17.example.com'").getStatistics().index_hits,
+              std::vector<std::string>{"host"});
+    EXPECT_EQ(live.searchText("probe", "note", "open redirect", TextMatch::PHRASE).getRows(),
+              fresh.searchText("probe", "note", "open redirect", TextMatch::PHRASE).getRows());
+    EXPECT_EQ(live.searchText("probe", "note", "redirect", TextMatch::ALL_TERMS).getRowCount(), rows.size() / 5);
+    
+    // EN: A table whose indexes were mapped from their files keeps answering once it no longer matches them
+    // FR: Une table dont les index étaient mappés depuis leurs fichiers continue de répondre une fois qu'elle ne
+    //     leur correspond plus
+    std::vector<std::string> lines = {"host,score"};
+    for (int i = 0; i < 500; ++i) {
+        lines.push_back("t" + std::to_string(i) + ".example.com," + std::to_string(i));
+    }
+    createCSVFile("targets.csv", lines);
+    QueryEngine::Config persisted = config;
+    persisted.persist_indexes = true;
+    IndexConfig host_index;
+    host_index.column = "host";
+    host_index.type = IndexType::HASH;
+    for (int session = 0; session < 2; ++session) {
+        QueryEngine targets(persisted);
+        ASSERT_EQ(targets.loadTable("targets", test_dir / "targets.csv"), QueryError::SUCCESS);
+        ASSERT_EQ(targets.createIndex("targets", host_index), QueryError::SUCCESS);
+        ASSERT_EQ(targets.appendRows("targets", {{"t42.example.com", "500"}}), QueryError::SUCCESS);
+        QueryResult result = targets.execute("SELECT score FROM targets WHERE host = 't42.example.com'");
+        EXPECT_EQ(result.getRows(), (std::vector<std::vector<std::string>>{{"42"}, {"500"}})) << "session " << session;
+        EXPECT_EQ(result.getStatistics().index_hits, std::vector<std::string>{"host"});
+    }
+}
+
+TEST_F(QueryEngineTest, AppendPublishesWhileAQueryRuns) {
+    // EN: A query reads the snapshot it took: an append started while it runs publishes without waiting for it
+    // FR: Une requête lit l'instantané qu'elle a pris : un ajout lancé pendant son exécution publie sans l'attendre
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 0; i < 400000; ++i) {
+        rows.push_back({"host" + std::to_string(i) + ".example.com", "program" + std::to_string(i % 13)});
+    }
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    QueryEngine engine(config);
+    engine.registerTable("targets", {"host", "program"}, rows);
+    
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point query_start = Clock::now();
+    Clock::time_point query_done;
+    size_t counted = 0;
+    std::thread slow([&] {
+        QueryResult result = engine.execute(
+            "SELECT program, COUNT(*) FROM targets WHERE host REGEX '^host[0-9]*[13579]\\.example\\.(com|org)$' "
+            "GROUP BY program");
+        query_done = Clock::now();
+        for (size_t i = 0; i < result.getRowCount(); ++i) {
+            counted += std::stoul(result.getCell(i, 1));
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const Clock::time_point append_start = Clock::now();
+    ASSERT_EQ(engine.appendRows("targets", {{"host1.example.com", "late"}}), QueryError::SUCCESS);
+    const Clock::time_point append_done = Clock::now();
+    slow.join();
+    
+    // EN: The append did not wait for the rest of the query, which saw the table with or without the new row
+    // FR: L'ajout n'a pas attendu la fin de la requête, qui a vu la table avec ou sans la nouvelle ligne
+    EXPECT_LT(append_done - append_start, (query_done - query_start) / 2);
+    EXPECT_TRUE(counted == rows.size() / 2 || counted == rows.size() / 2 + 1) << counted;
+    EXPECT_EQ(engine.execute("SELECT COUNT(*) FROM targets WHERE program = 'late'").getCell(0, 0), "1");
+}
+
+TEST_F(QueryEngineTest, EmptyPersistedTableIsIndexedAndAppendable) {
+    // EN: A header-only file gets (and saves) empty indexes that later appends extend
+    // FR: Un fichier avec seulement l'en-tête reçoit (et enregistre) des index vides que les ajouts étendent
+    createCSVFile("empty_targets.csv", {"host,note"});
+    QueryEngine::Config config;
+    config.enable_query_cache = false;
+    config.auto_index = false;
+    config.persist_indexes = true;
+    for (int session = 0; session < 2; ++session) {
+        QueryEngine targets(config);
+        ASSERT_EQ(targets.loadTable("targets", test_dir / "empty_targets.csv"), QueryError::SUCCESS);
+        IndexConfig index;
+        index.column = "host";
+        index.type = IndexType::HASH;
+        ASSERT_EQ(targets.createIndex("targets", index), QueryError::SUCCESS);
+        index.column = "note";
+        index.type = IndexType::FULL_TEXT;
+        ASSERT_EQ(targets.createIndex("targets", index), QueryError::SUCCESS);
+        EXPECT_EQ(targets.execute("SELECT note FROM targets WHERE host = 'a.example.com'").getRowCount(), 0u);
+        
+        std::vector<std::vector<std::string>> appended = {{"a.example.com", "open redirect"}};
+        for (int i = 0; i < 500; ++i) {
+            appended.push_back({"t" + std::to_string(i) + ".example.com", "reflected xss"});
+        }
+        ASSERT_EQ(targets.appendRows("targets", appended), QueryError::SUCCESS);
+        QueryResult result = targets.execute("SELECT note FROM targets WHERE host = 'a.example.com'");
+        EXPECT_EQ(result.getRows(), (std::vector<std::vector<std::string>>{{"open redirect"}})) << "session " << session;
+        EXPECT_EQ(result.getStatistics().index_hits, std::vector<std::string>{"host"});
+        EXPECT_EQ(targets.searchText("targets", "note", "redirect", TextMatch::ALL_TERMS).getRowCount(), 1u);
+    }
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
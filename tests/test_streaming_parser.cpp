@@ -3,11 +3,16 @@
 
 #include <gtest/gtest.h>
 #include "csv/streaming_parser.hpp"
+#include "csv/compressed_input.hpp"
+#include "csv/read_ahead_reader.hpp"
 #include "infrastructure/logging/logger.hpp"
 #include <sstream>
 #include <fstream>
 #include <thread>
 #include <chrono>
+#include <filesystem>
+#include <random>
+#include <zlib.h>
 
 using namespace BBP::CSV;
 
@@ -34,6 +39,9 @@ protected:
 
     void TearDown() override {
         parser_.reset();
+        for (const auto& file : temp_files_) {
+            std::filesystem::remove(file);
+        }
     }
 
     // EN: Test data and helpers
@@ -44,6 +52,18 @@ protected:
     std::atomic<size_t> progress_updates_{0};
     std::vector<ParsedRow> parsed_rows_;
     std::vector<std::string> error_messages_;
+    std::vector<std::string> temp_files_;
+    
+    // EN: Write content to a temporary file removed in TearDown
+    // FR: Écrit le contenu dans un fichier temporaire supprimé dans TearDown
+    std::string writeTempFile(const std::string& content) {
+        auto path = std::filesystem::temp_directory_path() /
+                    ("streaming_parser_test_" + std::to_string(temp_files_.size()) + ".csv");
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+        temp_files_.push_back(path.string());
+        return path.string();
+    }
     
     // EN: Create simple CSV test data
     // FR: Crée des données de test CSV simples
@@ -255,6 +275,107 @@ TEST_F(StreamingParserTest, ParsedRowBooleanConversions) {
     EXPECT_FALSE(row.getFieldAs<bool>(8).has_value()); // invalid
 }
 
+// EN: Test from_chars field conversion rules shared by ParsedRow, RowView and RowBatch
+// FR: Test des règles de conversion from_chars partagées par ParsedRow, RowView et RowBatch
+TEST_F(StreamingParserTest, FromCharsFieldConversion) {
+    EXPECT_EQ(parseFieldAs<int64_t>("1234567890123"), 1234567890123);
+    EXPECT_EQ(parseFieldAs<int>(" -42\t"), -42);
+    EXPECT_EQ(parseFieldAs<int>("+7"), 7);
+    EXPECT_DOUBLE_EQ(parseFieldAs<double>("1.5e3").value(), 1500.0);
+    EXPECT_DOUBLE_EQ(parseFieldAs<double>("-0.25").value(), -0.25);
+    EXPECT_EQ(parseFieldAs<std::string_view>(" raw "), " raw ");
+    
+    // EN: Partial, empty, out-of-range and malformed values are rejected
+    // FR: Les valeurs partielles, vides, hors limites et malformées sont rejetées
+    EXPECT_FALSE(parseFieldAs<int>("12abc").has_value());
+    EXPECT_FALSE(parseFieldAs<int>("12.5").has_value());
+    EXPECT_FALSE(parseFieldAs<int>("").has_value());
+    EXPECT_FALSE(parseFieldAs<int>("  ").has_value());
+    EXPECT_FALSE(parseFieldAs<int>("+-5").has_value());
+    EXPECT_FALSE(parseFieldAs<int16_t>("70000").has_value());
+    EXPECT_FALSE(parseFieldAs<uint32_t>("-1").has_value());
+    EXPECT_FALSE(parseFieldAs<double>("1.0.0").has_value());
+    
+    int status = 404;
+    EXPECT_FALSE(parseField("oops", status));
+    EXPECT_EQ(status, 404);
+    EXPECT_TRUE(parseField("200", status));
+    EXPECT_EQ(status, 200);
+    
+    // EN: Every row type converts without copying the field
+    // FR: Chaque type de ligne convertit sans copier le champ
+    auto headers = std::make_shared<const HeaderIndex>(std::vector<std::string>{"status_code", "response_time_ms", "waf_detected"});
+    ParsedRow row(2, std::vector<std::string>{"301", "12.75", "yes"}, headers);
+    EXPECT_EQ(row.getFieldView("response_time_ms"), "12.75");
+    EXPECT_EQ(row.getFieldView(9), "");
+    EXPECT_EQ(row.getFieldAs<int>("status_code"), 301);
+    EXPECT_EQ(row.getFieldAs<bool>("waf_detected"), true);
+    
+    std::vector<std::string_view> views = {"301", "12.75", "yes"};
+    RowView view(2, views, headers.get());
+    EXPECT_EQ(view.getFieldAs<int64_t>(0), 301);
+    EXPECT_DOUBLE_EQ(view.getFieldAs<double>("response_time_ms").value(), 12.75);
+    EXPECT_FALSE(view.getFieldAs<int>(5).has_value());
+    EXPECT_FALSE(view.getFieldAs<int>("missing").has_value());
+}
+
+// EN: Test typed column extraction from a RowBatch
+// FR: Test de l'extraction typée de colonnes depuis un RowBatch
+TEST_F(StreamingParserTest, RowBatchTypedColumnExtraction) {
+    RowBatch batch(std::make_shared<const HeaderIndex>(std::vector<std::string>{"status_code", "content_length", "response_time_ms"}));
+    batch.appendRow(2, std::vector<std::string_view>{"200", "1024", "12.5"});
+    batch.appendRow(3, std::vector<std::string_view>{"404", "", "0.75"});
+    batch.appendRow(4, std::vector<std::string_view>{"500"});
+    batch.appendRow(5, std::vector<std::string_view>{"n/a", "99", "3e2"});
+    
+    EXPECT_EQ(batch.getFieldAs<int>(1, 0), 404);
+    EXPECT_FALSE(batch.getFieldAs<int>(1, 1).has_value());
+    EXPECT_FALSE(batch.getFieldAs<int>(9, 0).has_value());
+    
+    std::vector<int64_t> status;
+    std::vector<uint8_t> valid;
+    EXPECT_EQ(batch.extractColumn("status_code", status, &valid, int64_t{-1}), 3);
+    EXPECT_EQ(status, (std::vector<int64_t>{200, 404, 500, -1}));
+    EXPECT_EQ(valid, (std::vector<uint8_t>{1, 1, 1, 0}));
+    
+    std::vector<int64_t> lengths;
+    EXPECT_EQ(batch.extractColumn(1, lengths), 2);
+    EXPECT_EQ(lengths, (std::vector<int64_t>{1024, 0, 0, 99}));
+    
+    std::vector<double> times;
+    EXPECT_EQ(batch.extractColumn("response_time_ms", times, &valid), 3);
+    EXPECT_DOUBLE_EQ(times[0], 12.5);
+    EXPECT_DOUBLE_EQ(times[1], 0.75);
+    EXPECT_DOUBLE_EQ(times[3], 300.0);
+    EXPECT_EQ(valid, (std::vector<uint8_t>{1, 1, 0, 1}));
+    
+    // EN: Unknown columns yield the fallback for every row
+    // FR: Les colonnes inconnues donnent la valeur de repli pour chaque ligne
+    EXPECT_EQ(batch.extractColumn("missing", times, &valid, -1.0), 0);
+    EXPECT_EQ(times, (std::vector<double>(4, -1.0)));
+    EXPECT_EQ(valid, (std::vector<uint8_t>(4, 0)));
+    
+    // EN: Extraction straight from the parsed batches of a file
+    // FR: Extraction directement depuis les lots analysés d'un fichier
+    std::string path = writeTempFile(createLargeCsv(500));
+    ParserConfig config;
+    config.batch_size = 64;
+    StreamingParser parser(config);
+    int64_t id_sum = 0;
+    size_t id_count = 0;
+    std::vector<int64_t> ids;
+    parser.setBatchCallback([&](const RowBatch& parsed, ParserError) {
+        id_count += parsed.extractColumn(0, ids);
+        for (int64_t id : ids) {
+            id_sum += id;
+        }
+        return true;
+    });
+    ASSERT_EQ(parser.parseFile(path), ParserError::SUCCESS);
+    EXPECT_EQ(id_count, 500);
+    EXPECT_EQ(id_sum, 499 * 500 / 2);
+}
+
 // EN: Test ParsedRow empty and invalid states
 // FR: Test des états vide et invalide de ParsedRow
 TEST_F(StreamingParserTest, ParsedRowEmptyAndInvalid) {
@@ -278,6 +399,79 @@ TEST_F(StreamingParserTest, ParsedRowEmptyAndInvalid) {
     EXPECT_FALSE(valid_row.isEmpty());
 }
 
+// EN: Test that the row arena backs ParsedRow storage without heap allocations and that copies outlive it
+// FR: Test que l'arène de lignes porte le stockage des ParsedRow sans allocation sur le tas et que les copies lui survivent
+TEST_F(StreamingParserTest, RowArenaBacksParsedRows) {
+    std::ostringstream oss;
+    oss << "id,url,title\n";
+    for (size_t i = 0; i < 2000; ++i) {
+        oss << i << ",https://api" << i << ".example.com/v1/users?page=" << i << ",\"Acme API, version " << (i % 7) << "\"\n";
+    }
+    std::string path = writeTempFile(oss.str());
+    
+    for (bool mapped : {false, true}) {
+        std::vector<std::vector<std::string>> rows_by_mode[2];
+        size_t allocations[2] = {0, 0};
+        for (size_t arena_size : {size_t{0}, size_t{16384}}) {
+            ParserConfig config;
+            config.use_memory_mapping = mapped;
+            config.row_arena_size = arena_size;
+            StreamingParser parser(config);
+            std::vector<ParsedRow> copies;
+            parser.setRowCallback([&copies](const ParsedRow& row, ParserError) {
+                copies.push_back(row);
+                return true;
+            });
+            ASSERT_EQ(parser.parseFile(path), ParserError::SUCCESS);
+            
+            const size_t mode = arena_size > 0 ? 1 : 0;
+            for (const auto& row : copies) {
+                rows_by_mode[mode].push_back(row.getFields());
+            }
+            allocations[mode] = parser.getStatistics().getHeapAllocations();
+            EXPECT_GT(parser.getStatistics().getPeakRssBytes(), 0);
+            EXPECT_NE(parser.getStatistics().generateReport().find("Row heap allocations"), std::string::npos);
+        }
+        
+        // EN: The buffered path is compared with itself (it splits rows at buffer boundaries)
+        // FR: Le chemin bufferisé est comparé à lui-même (il coupe les lignes aux limites de buffer)
+        ASSERT_GE(rows_by_mode[0].size(), 2000) << "mapped=" << mapped;
+        EXPECT_EQ(rows_by_mode[0], rows_by_mode[1]) << "mapped=" << mapped;
+        if (mapped) {
+            EXPECT_EQ(rows_by_mode[1][1234][2], "Acme API, version 2");
+        }
+        // EN: Heap rows pay the vector and the long strings, arena rows only the initial block
+        // FR: Les lignes sur le tas paient le vecteur et les chaînes longues, celles de l'arène seulement le bloc initial
+        EXPECT_GE(allocations[0], 2000 * 3) << "mapped=" << mapped;
+        EXPECT_EQ(allocations[1], 1) << "mapped=" << mapped;
+    }
+    
+    // EN: A row larger than the arena spills to the heap and the overflow is released on rewind
+    // FR: Une ligne plus grande que l'arène déborde sur le tas et le débordement est libéré au rembobinage
+    RowArena arena(256);
+    ASSERT_TRUE(arena.isArena());
+    EXPECT_EQ(arena.getHeapAllocations(), 1);
+    std::vector<std::string_view> small_fields = {"a", "b"};
+    {
+        ParsedRow row(1, small_fields, nullptr, arena.resource());
+        EXPECT_EQ(row.getField(1), "b");
+    }
+    arena.rewind();
+    EXPECT_EQ(arena.getHeapAllocations(), 1);
+    std::string big(1000, 'x');
+    std::vector<std::string_view> big_fields = {big};
+    {
+        ParsedRow row(1, big_fields, nullptr, arena.resource());
+        ParsedRow copy = row;
+        arena.rewind();
+        EXPECT_EQ(copy.getField(0), big);
+    }
+    EXPECT_GT(arena.getHeapAllocations(), 1);
+    
+    RowArena heap_only(0);
+    EXPECT_FALSE(heap_only.isArena());
+}
+
 // EN: Test ParsedRow toString method
 // FR: Test de la méthode toString de ParsedRow
 TEST_F(StreamingParserTest, ParsedRowToString) {
@@ -643,6 +837,49 @@ TEST_F(StreamingParserTest, EarlyTerminationByCallback) {
     EXPECT_LE(parsed_rows_.size(), 5); // EN: Early termination should limit rows / FR: Terminaison précoce devrait limiter lignes
 }
 
+// EN: Test a row callback returning false skips its row on the buffered, mapped and parallel paths alike, and
+//     stopParsing() from the callback ends every one of them at that row
+// FR: Test qu'un callback de ligne retournant false ignore sa ligne sur les chemins bufferisé, mappé et parallèle,
+//     et que stopParsing() depuis le callback les termine tous à cette ligne
+TEST_F(StreamingParserTest, RowCallbackFalseSkipsRowOnEveryPath) {
+    std::string content = "id,value\n";
+    for (size_t i = 0; i < 3000; ++i) {
+        content += std::to_string(i) + ",v" + std::to_string(i) + "\n";
+    }
+    const std::string path = writeTempFile(content);
+    
+    for (int mode = 0; mode < 3; ++mode) {
+        ParserConfig config;
+        config.use_memory_mapping = mode > 0;
+        config.enable_parallel_processing = mode == 2;
+        config.thread_count = 3;
+        config.parallel_chunk_size = 512;
+        config.buffer_size = content.size() + 1;
+        
+        StreamingParser skipping(config);
+        size_t seen = 0;
+        skipping.setRowCallback([&seen](const ParsedRow& /*row*/, ParserError /*error*/) {
+            ++seen;
+            return false;
+        });
+        ASSERT_EQ(skipping.parseFile(path), ParserError::SUCCESS) << "mode " << mode;
+        EXPECT_EQ(seen, 3000u) << "mode " << mode;
+        
+        StreamingParser stopping(config);
+        std::vector<std::string> ids;
+        stopping.setRowCallback([&ids, &stopping](const ParsedRow& row, ParserError /*error*/) {
+            ids.push_back(row.getField("id"));
+            if (ids.size() == 10) {
+                stopping.stopParsing();
+            }
+            return true;
+        });
+        ASSERT_EQ(stopping.parseFile(path), ParserError::SUCCESS) << "mode " << mode;
+        ASSERT_EQ(ids.size(), 10u) << "mode " << mode;
+        EXPECT_EQ(ids.back(), "9");
+    }
+}
+
 // EN: Test performance with large dataset
 // FR: Test de performance avec gros dataset
 TEST_F(StreamingParserTest, LargeDatasetPerformance) {
@@ -879,6 +1116,848 @@ TEST_F(StreamingParserTest, VariousLineEndings) {
     EXPECT_EQ(parsed_rows_[1]["name"], "Jane");
 }
 
+// EN: Test memory-mapped parsing gives the same rows as the buffered path
+// FR: Test que le parsing mappé en mémoire donne les mêmes lignes que le chemin bufferisé
+TEST_F(StreamingParserTest, MemoryMappedParsingMatchesBufferedPath) {
+    std::string path = writeTempFile(createComplexCsv() + createLargeCsv(50).substr(24));
+    
+    parser_->setRowCallback([this](const ParsedRow& row, ParserError error) {
+        return testRowCallback(row, error);
+    });
+    ASSERT_EQ(parser_->parseFile(path), ParserError::SUCCESS);
+    std::vector<ParsedRow> buffered_rows = parsed_rows_;
+    parsed_rows_.clear();
+    
+    ParserConfig config;
+    config.use_memory_mapping = true;
+    StreamingParser mapped_parser(config);
+    mapped_parser.setRowCallback([this](const ParsedRow& row, ParserError error) {
+        return testRowCallback(row, error);
+    });
+    ASSERT_EQ(mapped_parser.parseFile(path), ParserError::SUCCESS);
+    
+    ASSERT_EQ(parsed_rows_.size(), buffered_rows.size());
+    for (size_t i = 0; i < parsed_rows_.size(); ++i) {
+        EXPECT_EQ(parsed_rows_[i].getFields(), buffered_rows[i].getFields());
+        EXPECT_EQ(parsed_rows_[i].getRowNumber(), buffered_rows[i].getRowNumber());
+    }
+    EXPECT_EQ(mapped_parser.getStatistics().getRowsParsed(), buffered_rows.size());
+    EXPECT_EQ(mapped_parser.getStatistics().getBytesRead(), StreamingParser::getFileSize(path));
+}
+
+// EN: Test zero-copy views point into the mapping except for fields with escaped quotes
+// FR: Test que les vues zero-copy pointent dans le mapping sauf pour les champs avec quotes échappées
+TEST_F(StreamingParserTest, MemoryMappedRowViews) {
+    std::string path = writeTempFile("\xEF\xBB\xBFname,description,value\n"
+                                     "\"Smith, John\",\"Product \"\"A\"\"\", 100.50 \n"
+                                     "\"Doe, Jane\",\"Line1\nLine2\",200.75\n");
+    
+    std::vector<std::vector<std::string>> rows;
+    std::vector<std::string> headers;
+    parser_->setRowViewCallback([&](const RowView& row, ParserError error) {
+        EXPECT_EQ(error, ParserError::SUCCESS);
+        EXPECT_TRUE(row.hasHeaders());
+        rows.emplace_back(row.getFields().begin(), row.getFields().end());
+        headers.emplace_back(row["name"]);
+        return true;
+    });
+    
+    ASSERT_EQ(parser_->parseFileMapped(path), ParserError::SUCCESS);
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_EQ(rows[0], (std::vector<std::string>{"Smith, John", "Product \"A\"", "100.50"}));
+    EXPECT_EQ(rows[1], (std::vector<std::string>{"Doe, Jane", "Line1\nLine2", "200.75"}));
+    EXPECT_EQ(headers, (std::vector<std::string>{"Smith, John", "Doe, Jane"}));
+}
+
+// EN: Test mapped mode stops when the view callback returns false and handles edge cases
+// FR: Test que le mode mappé s'arrête quand le callback de vue retourne false et gère les cas limites
+TEST_F(StreamingParserTest, MemoryMappedEarlyStopAndEdgeCases) {
+    std::string path = writeTempFile(createLargeCsv(100));
+    
+    size_t seen = 0;
+    parser_->setRowViewCallback([&seen](const RowView& row, ParserError /*error*/) {
+        EXPECT_EQ(row["id"], std::to_string(seen));
+        return ++seen < 10;
+    });
+    EXPECT_EQ(parser_->parseFileMapped(path), ParserError::SUCCESS);
+    EXPECT_EQ(seen, 10);
+    
+    // EN: Empty file maps to an empty view
+    // FR: Un fichier vide donne une vue vide
+    seen = 0;
+    EXPECT_EQ(parser_->parseFileMapped(writeTempFile("")), ParserError::SUCCESS);
+    EXPECT_EQ(seen, 0);
+    
+    // EN: Missing file is reported
+    // FR: Un fichier manquant est signalé
+    EXPECT_EQ(parser_->parseFileMapped("nonexistent_file.csv"), ParserError::FILE_NOT_FOUND);
+    
+    // EN: Unterminated quote at end of input is a malformed row in strict mode
+    // FR: Une quote non terminée en fin d'entrée est une ligne malformée en mode strict
+    ParserConfig config;
+    config.strict_mode = true;
+    StreamingParser strict_parser(config);
+    EXPECT_EQ(strict_parser.parseFileMapped(writeTempFile("a,b\n1,\"open\n")), ParserError::MALFORMED_ROW);
+    EXPECT_EQ(strict_parser.getStatistics().getRowsWithErrors(), 1);
+}
+
+// EN: Test every supported scanner backend finds the same structurals as the scalar one
+// FR: Test que chaque backend de scanner supporté trouve les mêmes structurels que le scalaire
+TEST_F(StreamingParserTest, StructuralScannerBackendsAgree) {
+    // EN: Random mix of field bytes, quotes, delimiters and line ends, long enough to cross many blocks
+    // FR: Mélange aléatoire d'octets, quotes, délimiteurs et fins de ligne, assez long pour traverser plusieurs blocs
+    std::mt19937 rng(42);
+    const std::string alphabet = "abcxyz012 ,,,\"\"\n\r";
+    std::string input;
+    for (int i = 0; i < 10000; ++i) {
+        input += alphabet[rng() % alphabet.size()];
+    }
+    
+    auto run = [&input](ScannerBackend backend, bool& in_quotes) {
+        StructuralScanner scanner(',', '"', backend);
+        std::vector<StructuralIndex> out;
+        in_quotes = false;
+        // EN: Scan in uneven windows to exercise quote state carry and tail blocks
+        // FR: Scan en fenêtres inégales pour tester la retenue d'état de quote et les blocs finaux
+        size_t offset = 0;
+        size_t window = 1;
+        while (offset < input.size()) {
+            size_t len = std::min(window, input.size() - offset);
+            std::vector<StructuralIndex> part;
+            scanner.scan(input.data() + offset, len, in_quotes, part);
+            for (auto index : part) {
+                out.push_back({static_cast<uint32_t>(index.offset + offset), 0});
+            }
+            offset += len;
+            window = window * 3 + 7;
+        }
+        return out;
+    };
+    
+    bool scalar_quotes = false;
+    auto expected = run(ScannerBackend::SCALAR, scalar_quotes);
+    ASSERT_FALSE(expected.empty());
+    
+    for (auto backend : {ScannerBackend::SSE42, ScannerBackend::AVX2, ScannerBackend::AUTO}) {
+        if (!StructuralScanner::isSupported(backend)) {
+            continue;
+        }
+        bool in_quotes = false;
+        auto actual = run(backend, in_quotes);
+        ASSERT_EQ(actual.size(), expected.size()) << StructuralScanner::backendName(backend);
+        for (size_t i = 0; i < actual.size(); ++i) {
+            ASSERT_EQ(actual[i].offset, expected[i].offset) << StructuralScanner::backendName(backend);
+        }
+        EXPECT_EQ(in_quotes, scalar_quotes);
+    }
+}
+
+// EN: Test scanner quote counting and quoted structural characters
+// FR: Test du comptage des quotes et des caractères structurels quotés
+TEST_F(StreamingParserTest, StructuralScannerQuoteHandling) {
+    std::string input = "a,\"b,\"\"c\"\"\n\",d\nlast\"";
+    StructuralScanner scanner;
+    std::vector<StructuralIndex> out;
+    bool in_quotes = false;
+    size_t trailing = scanner.scan(input.data(), input.size(), in_quotes, out);
+    
+    // EN: Commas and newline inside the quoted field are not structural
+    // FR: Les virgules et le retour à la ligne dans le champ quoté ne sont pas structurels
+    ASSERT_EQ(out.size(), 3);
+    EXPECT_EQ(out[0].offset, 1);
+    EXPECT_EQ(out[0].quote_count, 0);
+    EXPECT_EQ(out[1].offset, 12);
+    EXPECT_EQ(out[1].quote_count, 6);
+    EXPECT_EQ(out[2].offset, 14);
+    EXPECT_EQ(trailing, 1);
+    EXPECT_TRUE(in_quotes);
+    
+    // EN: parseRow gives identical results whatever the backend
+    // FR: parseRow donne des résultats identiques quel que soit le backend
+    for (auto backend : {ScannerBackend::SCALAR, ScannerBackend::SSE42, ScannerBackend::AVX2}) {
+        ParserConfig config;
+        config.scanner_backend = backend;
+        auto fields = StreamingParser::parseRow("x, \"Smith, \"\"J\"\"\" ,\" padded \",", config);
+        ASSERT_EQ(fields.size(), 4);
+        EXPECT_EQ(fields[0], "x");
+        EXPECT_EQ(fields[1], "Smith, \"J\"");
+        EXPECT_EQ(fields[2], "padded");
+        EXPECT_EQ(fields[3], "");
+    }
+}
+
+// EN: Test mapped parsing when a quoted field straddles the scanner window boundary
+// FR: Test du parsing mappé quand un champ quoté chevauche la limite de fenêtre du scanner
+TEST_F(StreamingParserTest, MemoryMappedRowAcrossScanWindows) {
+    const size_t window = 1 << 20;
+    std::string content = "id,payload\n";
+    size_t id = 0;
+    while (content.size() < window - 20) {
+        content += std::to_string(id++) + ",row\n";
+    }
+    std::string quoted(64, 'q');
+    content += std::to_string(id) + ",\"" + quoted + "\n" + quoted + ",\"\"x\"\"\"\n" + std::to_string(id + 1) + ",tail";
+    
+    std::string path = writeTempFile(content);
+    std::vector<std::string> payloads;
+    parser_->setRowViewCallback([&payloads](const RowView& row, ParserError /*error*/) {
+        payloads.emplace_back(row["payload"]);
+        return true;
+    });
+    
+    ASSERT_EQ(parser_->parseFileMapped(path), ParserError::SUCCESS);
+    ASSERT_EQ(payloads.size(), id + 2);
+    EXPECT_EQ(payloads[id], quoted + "\n" + quoted + ",\"x\"");
+    EXPECT_EQ(payloads[id + 1], "tail");
+}
+
+// EN: Test chunk-parallel parsing yields the same rows, in order, as the sequential mapped path
+// FR: Test que le parsing parallèle par chunks produit les mêmes lignes, dans l'ordre, que le chemin mappé séquentiel
+TEST_F(StreamingParserTest, ParallelParsingMatchesSequential) {
+    // EN: Small chunks so that boundaries land inside quoted newlines, escaped quotes, CRLF pairs and in a
+    //     field larger than a whole chunk
+    // FR: Petits chunks pour que les limites tombent dans des fins de ligne quotées, des quotes échappées,
+    //     des paires CRLF et dans un champ plus grand qu'un chunk entier
+    std::mt19937 rng(42);
+    std::string content = "id,text,value\r\n";
+    for (size_t i = 0; i < 2000; ++i) {
+        content += std::to_string(i) + ",";
+        switch (rng() % 5) {
+            case 0: content += "\"multi\nline \"\"quoted\"\"\nfield\""; break;
+            case 1: content += "\"a, b\""; break;
+            case 2: content += "\"" + std::string(300, 'x') + "\n\""; break;
+            case 3: content += ""; break;
+            default: content += "plain"; break;
+        }
+        content += "," + std::to_string(rng() % 1000) + (i % 3 == 0 ? "\r\n" : "\n");
+    }
+    std::string path = writeTempFile(content);
+    
+    auto parseWith = [&path](bool parallel, std::vector<std::vector<std::string>>& rows, std::vector<size_t>& numbers) {
+        ParserConfig config;
+        config.use_memory_mapping = true;
+        config.enable_parallel_processing = parallel;
+        config.thread_count = 4;
+        config.parallel_chunk_size = 97;
+        StreamingParser parser(config);
+        parser.setRowViewCallback([&](const RowView& row, ParserError error) {
+            EXPECT_EQ(error, ParserError::SUCCESS);
+            rows.emplace_back(row.getFields().begin(), row.getFields().end());
+            numbers.push_back(row.getRowNumber());
+            return true;
+        });
+        EXPECT_EQ(parser.parseFile(path), ParserError::SUCCESS);
+        EXPECT_EQ(parser.getStatistics().getRowsParsed(), rows.size());
+    };
+    
+    std::vector<std::vector<std::string>> sequential_rows, parallel_rows;
+    std::vector<size_t> sequential_numbers, parallel_numbers;
+    parseWith(false, sequential_rows, sequential_numbers);
+    parseWith(true, parallel_rows, parallel_numbers);
+    
+    ASSERT_EQ(sequential_rows.size(), 2000);
+    EXPECT_EQ(parallel_rows, sequential_rows);
+    EXPECT_EQ(parallel_numbers, sequential_numbers);
+    for (size_t i = 0; i < parallel_rows.size(); ++i) {
+        EXPECT_EQ(parallel_rows[i][0], std::to_string(i));
+    }
+}
+
+// EN: Test early stop and malformed input on the parallel path
+// FR: Test de l'arrêt anticipé et d'une entrée malformée sur le chemin parallèle
+TEST_F(StreamingParserTest, ParallelParsingEarlyStopAndUnterminatedQuote) {
+    std::string content = "id,value\n";
+    for (size_t i = 0; i < 5000; ++i) {
+        content += std::to_string(i) + ",v" + std::to_string(i) + "\n";
+    }
+    
+    ParserConfig config;
+    config.enable_parallel_processing = true;
+    config.thread_count = 3;
+    config.parallel_chunk_size = 512;
+    
+    StreamingParser stopping_parser(config);
+    std::vector<std::string> ids;
+    stopping_parser.setRowViewCallback([&ids](const RowView& row, ParserError /*error*/) {
+        ids.emplace_back(row["id"]);
+        return ids.size() < 1234;
+    });
+    ASSERT_EQ(stopping_parser.parseFile(writeTempFile(content)), ParserError::SUCCESS);
+    ASSERT_EQ(ids.size(), 1234);
+    EXPECT_EQ(ids.back(), "1233");
+    
+    config.strict_mode = true;
+    StreamingParser strict_parser(config);
+    size_t rows = 0;
+    strict_parser.setRowViewCallback([&rows](const RowView& /*row*/, ParserError /*error*/) {
+        ++rows;
+        return true;
+    });
+    EXPECT_EQ(strict_parser.parseFile(writeTempFile(content + "5000,\"open")), ParserError::MALFORMED_ROW);
+    EXPECT_EQ(rows, 5000);
+    EXPECT_EQ(strict_parser.getStatistics().getRowsWithErrors(), 1);
+}
+
+// EN: Test columnar batches match row-by-row parsing on both the buffered and the mapped path
+// FR: Test que les lots colonnaires correspondent au parsing ligne par ligne sur les chemins bufferisé et mappé
+TEST_F(StreamingParserTest, BatchCallbackMatchesRowCallback) {
+    std::string content = createComplexCsv() + createLargeCsv(2500).substr(24);
+    std::string path = writeTempFile(content);
+    
+    for (bool mapped : {false, true}) {
+        ParserConfig config;
+        config.use_memory_mapping = mapped;
+        config.batch_size = 1000;
+        
+        parsed_rows_.clear();
+        StreamingParser row_parser(config);
+        row_parser.setRowCallback([this](const ParsedRow& row, ParserError error) {
+            return testRowCallback(row, error);
+        });
+        ASSERT_EQ(row_parser.parseFile(path), ParserError::SUCCESS);
+        ASSERT_GT(parsed_rows_.size(), 2500);
+        
+        StreamingParser batch_parser(config);
+        std::vector<ParsedRow> batch_rows;
+        std::vector<size_t> batch_sizes;
+        const HeaderIndex* shared_headers = nullptr;
+        batch_parser.setBatchCallback([&](const RowBatch& batch, ParserError error) {
+            EXPECT_EQ(error, ParserError::SUCCESS);
+            EXPECT_TRUE(batch.hasHeaders());
+            // EN: One header index for the whole parse / FR: Un seul index d'en-têtes pour tout le parsing
+            if (shared_headers == nullptr) {
+                shared_headers = batch.getHeaderIndex().get();
+            }
+            EXPECT_EQ(batch.getHeaderIndex().get(), shared_headers);
+            batch_sizes.push_back(batch.getRowCount());
+            for (size_t row = 0; row < batch.getRowCount(); ++row) {
+                batch_rows.push_back(batch.toParsedRow(row));
+            }
+            return true;
+        });
+        ASSERT_EQ(batch_parser.parseFile(path), ParserError::SUCCESS);
+        
+        ASSERT_EQ(batch_rows.size(), parsed_rows_.size()) << "mapped=" << mapped;
+        for (size_t i = 0; i < batch_rows.size(); ++i) {
+            EXPECT_EQ(batch_rows[i].getFields(), parsed_rows_[i].getFields());
+            EXPECT_EQ(batch_rows[i].getRowNumber(), parsed_rows_[i].getRowNumber());
+            EXPECT_EQ(batch_rows[i]["name"], parsed_rows_[i]["name"]);
+        }
+        ASSERT_EQ(batch_sizes.size(), (parsed_rows_.size() + 999) / 1000);
+        EXPECT_EQ(batch_sizes.front(), 1000);
+        EXPECT_EQ(batch_parser.getHeaders(), parsed_rows_.front().getHeaders());
+    }
+}
+
+// EN: Test columnar layout: ragged rows, column spans into one buffer and early stop
+// FR: Test de la disposition colonnaire : lignes irrégulières, plages de colonnes dans un buffer et arrêt anticipé
+TEST_F(StreamingParserTest, BatchColumnarLayout) {
+    RowBatch batch(std::make_shared<const HeaderIndex>(std::vector<std::string>{"a", "b", "c"}));
+    batch.appendRow(2, std::vector<std::string_view>{"x", "yy"});
+    batch.appendRow(3, std::vector<std::string>{"1", "", "333", "extra"});
+    
+    ASSERT_EQ(batch.getRowCount(), 2);
+    EXPECT_EQ(batch.getColumnCount(), 4);
+    EXPECT_EQ(batch.getFieldCount(0), 2);
+    EXPECT_EQ(batch.getField(0, "b"), "yy");
+    EXPECT_EQ(batch.getField(0, 2), "");
+    EXPECT_EQ(batch.getField(0, 3), "");
+    EXPECT_EQ(batch.getField(1, "c"), "333");
+    EXPECT_EQ(batch.getField(1, 3), "extra");
+    EXPECT_EQ(batch.getField(5, 0), "");
+    EXPECT_FALSE(batch.getColumnIndex("missing").has_value());
+    EXPECT_EQ(batch.getBuffer(), "xyy1333extra");
+    
+    const auto& column = batch.getColumn(2);
+    ASSERT_EQ(column.size(), 2);
+    EXPECT_EQ(batch.view(column[1]), "333");
+    
+    ParsedRow row = batch.toParsedRow(1);
+    EXPECT_EQ(row.getRowNumber(), 3);
+    EXPECT_EQ(row["c"], "333");
+    EXPECT_EQ(row.getFieldCount(), 4);
+    
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.getColumnCount(), 0);
+    EXPECT_TRUE(batch.hasHeaders());
+    
+    // EN: A batch callback returning false stops both paths / FR: Un callback de lot retournant false arrête les deux chemins
+    std::string path = writeTempFile(createLargeCsv(100));
+    for (bool mapped : {false, true}) {
+        ParserConfig config;
+        config.use_memory_mapping = mapped;
+        config.batch_size = 10;
+        StreamingParser stopping_parser(config);
+        size_t batches = 0;
+        stopping_parser.setBatchCallback([&batches](const RowBatch& /*batch*/, ParserError /*error*/) {
+            return ++batches < 3;
+        });
+        ASSERT_EQ(stopping_parser.parseFile(path), ParserError::SUCCESS);
+        EXPECT_EQ(batches, 3) << "mapped=" << mapped;
+    }
+}
+
+// EN: Test column projection by name and index on the buffered, mapped and parallel paths
+// FR: Test de la projection de colonnes par nom et par index sur les chemins bufferisé, mappé et parallèle
+TEST_F(StreamingParserTest, ProjectionByNameAndIndex) {
+    std::string content = "id,name,description,value\n";
+    for (size_t i = 0; i < 300; ++i) {
+        content += std::to_string(i) + ",\"User, " + std::to_string(i) + "\",\"said \"\"hi\"\"\"," + std::to_string(i * 2) + "\n";
+    }
+    content += "300,short\n";
+    std::string path = writeTempFile(content);
+    
+    struct Mode { bool mapped; bool parallel; };
+    for (Mode mode : {Mode{false, false}, Mode{true, false}, Mode{true, true}}) {
+        ParserConfig config;
+        config.use_memory_mapping = mode.mapped;
+        config.enable_parallel_processing = mode.parallel;
+        config.thread_count = 2;
+        config.parallel_chunk_size = 256;
+        config.projected_columns = {"value", "name"};
+        config.projected_column_indices = {0, 3};
+        StreamingParser parser(config);
+        
+        parsed_rows_.clear();
+        parser.setRowCallback([this](const ParsedRow& row, ParserError error) {
+            return testRowCallback(row, error);
+        });
+        ASSERT_EQ(parser.parseFile(path), ParserError::SUCCESS);
+        
+        ASSERT_EQ(parsed_rows_.size(), 301) << "mapped=" << mode.mapped << " parallel=" << mode.parallel;
+        EXPECT_EQ(parser.getHeaders(), std::vector<std::string>({"value", "name", "id"}));
+        EXPECT_EQ(parsed_rows_[7].getFields(), std::vector<std::string>({"14", "User, 7", "7"}));
+        EXPECT_EQ(parsed_rows_[7]["name"], "User, 7");
+        EXPECT_EQ(parsed_rows_[7]["description"], "");
+        // EN: Missing projected columns read as empty / FR: Les colonnes projetées manquantes se lisent vides
+        EXPECT_EQ(parsed_rows_[300].getFields(), std::vector<std::string>({"", "short", "300"}));
+        EXPECT_EQ(parser.getStatistics().getFieldsSkipped(), 300);
+        EXPECT_EQ(parser.getStatistics().getMaxFieldCount(), 3);
+    }
+}
+
+// EN: Test index projection without header and unknown projected names
+// FR: Test de projection par index sans en-tête et de noms projetés inconnus
+TEST_F(StreamingParserTest, ProjectionWithoutHeaderAndUnknownColumns) {
+    std::string path = writeTempFile("a,b,c,d\n1,2,3,4\n");
+    
+    ParserConfig config;
+    config.use_memory_mapping = true;
+    config.has_header = false;
+    config.projected_column_indices = {2, 7};
+    StreamingParser parser(config);
+    std::vector<std::vector<std::string>> rows;
+    parser.setRowViewCallback([&rows](const RowView& row, ParserError /*error*/) {
+        rows.emplace_back(row.getFields().begin(), row.getFields().end());
+        return true;
+    });
+    ASSERT_EQ(parser.parseFile(path), ParserError::SUCCESS);
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_EQ(rows[0], std::vector<std::string>({"c", ""}));
+    EXPECT_EQ(rows[1], std::vector<std::string>({"3", ""}));
+    EXPECT_EQ(parser.getStatistics().getFieldsSkipped(), 6);
+    
+    config.has_header = true;
+    config.strict_mode = true;
+    config.projected_column_indices.clear();
+    config.projected_columns = {"b", "missing"};
+    for (bool mapped : {false, true}) {
+        config.use_memory_mapping = mapped;
+        StreamingParser strict_parser(config);
+        std::vector<ParserError> errors;
+        strict_parser.setErrorCallback([&errors](ParserError error, const std::string& /*message*/, size_t /*row*/) {
+            errors.push_back(error);
+        });
+        EXPECT_EQ(strict_parser.parseFile(path), ParserError::MALFORMED_ROW) << "mapped=" << mapped;
+        EXPECT_EQ(errors, std::vector<ParserError>({ParserError::MALFORMED_ROW}));
+        EXPECT_EQ(strict_parser.getStatistics().getRowsParsed(), 0);
+    }
+    
+    // EN: Outside strict mode too, a projection resolving to no column fails instead of delivering every field
+    // FR: Hors mode strict aussi, une projection ne résolvant aucune colonne échoue au lieu de transmettre chaque champ
+    config.strict_mode = false;
+    config.projected_columns = {"missing", "absent"};
+    for (bool mapped : {false, true}) {
+        config.use_memory_mapping = mapped;
+        StreamingParser lenient_parser(config);
+        size_t delivered = 0;
+        lenient_parser.setRowCallback([&delivered](const ParsedRow& /*row*/, ParserError /*error*/) {
+            ++delivered;
+            return true;
+        });
+        EXPECT_EQ(lenient_parser.parseFile(path), ParserError::MALFORMED_ROW) << "mapped=" << mapped;
+        EXPECT_EQ(delivered, 0u) << "mapped=" << mapped;
+    }
+}
+
+// EN: Test that gzip and BatchWriter-style zlib inputs parse exactly like the plain file on every path
+// FR: Test que les entrées gzip et zlib au format BatchWriter se parsent exactement comme le fichier brut sur tous les chemins
+TEST_F(StreamingParserTest, CompressedInputMatchesPlainFile) {
+    // EN: Larger than one decompressed buffer so rows, quoted newlines and CRLF pairs straddle block boundaries
+    // FR: Plus grand qu'un buffer décompressé pour que lignes, fins de ligne quotées et paires CRLF chevauchent les blocs
+    std::mt19937 rng(7);
+    std::vector<std::vector<std::string>> source_rows;
+    for (size_t i = 0; i < 40000; ++i) {
+        std::string text;
+        switch (rng() % 4) {
+            case 0: text = "multi\nline \"quoted\""; break;
+            case 1: text = "a, b"; break;
+            case 2: text = std::string(rng() % 200, 'x'); break;
+            default: text = "plain"; break;
+        }
+        source_rows.push_back({std::to_string(i), text, std::to_string(rng() % 1000)});
+    }
+    
+    std::string plain_content = "id,text,value\r\n";
+    for (const auto& row : source_rows) {
+        plain_content += row[0] + ",";
+        if (row[1].find_first_of(",\"\n") != std::string::npos) {
+            std::string escaped;
+            for (char c : row[1]) {
+                escaped += c == '"' ? std::string("\"\"") : std::string(1, c);
+            }
+            plain_content += "\"" + escaped + "\"";
+        } else {
+            plain_content += row[1];
+        }
+        plain_content += "," + row[2] + "\r\n";
+    }
+    std::string plain_path = writeTempFile(plain_content);
+    
+    // EN: BatchWriter layout: raw BOM, then one compress2() stream per flush
+    // FR: Format de BatchWriter : BOM brut, puis un flux compress2() par flush
+    std::string writer_content = "\xEF\xBB\xBF";
+    for (size_t offset = 0; offset < plain_content.size(); offset += 300000) {
+        std::string part = plain_content.substr(offset, 300000);
+        uLongf part_size = compressBound(part.size());
+        std::string compressed(part_size, '\0');
+        ASSERT_EQ(compress2(reinterpret_cast<Bytef*>(compressed.data()), &part_size,
+                            reinterpret_cast<const Bytef*>(part.data()), part.size(), 6), Z_OK);
+        writer_content.append(compressed.data(), part_size);
+    }
+    std::string writer_path = writeTempFile(writer_content);
+    
+    // EN: A real single-member gzip file, as produced by gzip(1)
+    // FR: Un vrai fichier gzip à membre unique, tel que produit par gzip(1)
+    auto gzip_path = (std::filesystem::temp_directory_path() / "streaming_parser_test.csv.gz").string();
+    temp_files_.push_back(gzip_path);
+    gzFile gz = gzopen(gzip_path.c_str(), "wb");
+    ASSERT_NE(gz, nullptr);
+    gzwrite(gz, plain_content.data(), static_cast<unsigned>(plain_content.size()));
+    gzclose(gz);
+    
+    EXPECT_EQ(DecompressingReader::detect(plain_path), InputCompression::NONE);
+    EXPECT_EQ(DecompressingReader::detect(writer_path), InputCompression::ZLIB);
+    EXPECT_EQ(DecompressingReader::detect(gzip_path), InputCompression::GZIP);
+    
+    auto parseWith = [](const std::string& path, ParserConfig config, bool batches) {
+        StreamingParser parser(config);
+        std::vector<std::vector<std::string>> rows;
+        if (batches) {
+            parser.setBatchCallback([&rows](const RowBatch& batch, ParserError) {
+                for (size_t row = 0; row < batch.getRowCount(); ++row) {
+                    std::vector<std::string> fields;
+                    for (size_t col = 0; col < batch.getFieldCount(row); ++col) {
+                        fields.emplace_back(batch.getField(row, col));
+                    }
+                    rows.push_back(std::move(fields));
+                }
+                return true;
+            });
+        } else {
+            parser.setRowCallback([&rows](const ParsedRow& row, ParserError) {
+                rows.push_back(row.getFields());
+                return true;
+            });
+        }
+        EXPECT_EQ(parser.parseFile(path), ParserError::SUCCESS) << path;
+        EXPECT_EQ(parser.getHeaders(), config.projected_columns.empty()
+                  ? std::vector<std::string>({"id", "text", "value"}) : config.projected_columns);
+        return rows;
+    };
+    
+    for (bool mapped : {false, true}) {
+        for (bool projected : {false, true}) {
+            ParserConfig config;
+            config.use_memory_mapping = true;
+            if (projected) {
+                config.projected_columns = {"value", "id"};
+            }
+            auto expected = parseWith(plain_path, config, false);
+            ASSERT_EQ(expected.size(), source_rows.size());
+            config.use_memory_mapping = mapped;
+            for (const auto& path : {writer_path, gzip_path}) {
+                EXPECT_EQ(parseWith(path, config, false), expected) << path << " mapped=" << mapped;
+                EXPECT_EQ(parseWith(path, config, true), expected) << path << " mapped=" << mapped;
+            }
+        }
+    }
+}
+
+// EN: Test corrupt input, stream access and format detection of plain text
+// FR: Test d'entrée corrompue, de l'accès par flux et de la détection de format sur du texte brut
+TEST_F(StreamingParserTest, CompressedInputErrorsAndStreams) {
+    std::string content;
+    for (size_t i = 0; i < 2000; ++i) {
+        content += std::to_string(i) + ",value" + std::to_string(i * 7) + "\n";
+    }
+    uLongf compressed_size = compressBound(content.size());
+    std::string compressed(compressed_size, '\0');
+    ASSERT_EQ(compress2(reinterpret_cast<Bytef*>(compressed.data()), &compressed_size,
+                        reinterpret_cast<const Bytef*>(content.data()), content.size(), 6), Z_OK);
+    compressed.resize(compressed_size);
+    std::string zlib_path = writeTempFile(compressed);
+    
+    // EN: Line reads through the stream adapter with a tiny buffer, so lines straddle many buffers
+    // FR: Lectures de lignes via l'adaptateur de flux avec un petit buffer, les lignes chevauchent de nombreux buffers
+    DecompressingIStream stream(zlib_path, 7);
+    ASSERT_TRUE(stream.is_open());
+    std::string line, roundtrip;
+    while (std::getline(stream, line)) {
+        roundtrip += line + "\n";
+    }
+    EXPECT_EQ(roundtrip, content);
+    EXPECT_FALSE(stream.bad());
+    EXPECT_EQ(stream.reader().getDecompressedBytes(), content.size());
+    
+    // EN: A truncated stream is reported instead of silently ending early
+    // FR: Un flux tronqué est signalé au lieu de se terminer silencieusement
+    std::string truncated_path = writeTempFile(compressed.substr(0, compressed.size() / 2));
+    for (bool mapped : {false, true}) {
+        ParserConfig config;
+        config.has_header = false;
+        config.use_memory_mapping = mapped;
+        StreamingParser parser(config);
+        std::vector<ParserError> errors;
+        parser.setErrorCallback([&errors](ParserError error, const std::string&, size_t) {
+            errors.push_back(error);
+        });
+        EXPECT_EQ(parser.parseFile(truncated_path), ParserError::FILE_READ_ERROR);
+        EXPECT_EQ(errors, std::vector<ParserError>({ParserError::FILE_READ_ERROR}));
+        EXPECT_GT(parser.getStatistics().getRowsParsed(), 0);
+        EXPECT_LT(parser.getStatistics().getRowsParsed(), 2000);
+    }
+    auto truncated_stream = openCsvInput(truncated_path);
+    while (std::getline(*truncated_stream, line)) {
+    }
+    EXPECT_TRUE(truncated_stream->bad());
+    
+    // EN: Plain text whose first bytes look like a zlib header stays plain
+    // FR: Du texte brut dont les premiers octets ressemblent à un en-tête zlib reste brut
+    std::string lookalike_path = writeTempFile("x^,name\n1,a\n");
+    EXPECT_EQ(DecompressingReader::detect(lookalike_path), InputCompression::NONE);
+    StreamingParser parser;
+    size_t rows = 0;
+    parser.setRowCallback([&rows](const ParsedRow&, ParserError) { ++rows; return true; });
+    EXPECT_EQ(parser.parseFile(lookalike_path), ParserError::SUCCESS);
+    EXPECT_EQ(rows, 1);
+    
+    // EN: Decompression can be turned off
+    // FR: La décompression peut être désactivée
+    ParserConfig raw_config;
+    raw_config.decompress_input = false;
+    raw_config.has_header = false;
+    StreamingParser raw_parser(raw_config);
+    EXPECT_EQ(raw_parser.parseFile(zlib_path), ParserError::SUCCESS);
+}
+
+// EN: Test the read-ahead reader ring and the read-ahead parsing path
+// FR: Test de l'anneau du lecteur à lecture anticipée et du chemin de parsing associé
+TEST_F(StreamingParserTest, ReadAheadMatchesMappedParsing) {
+    // EN: Several minimum-size buffers so rows, quoted newlines and CRLF pairs straddle block boundaries
+    // FR: Plusieurs buffers de taille minimale pour que lignes, fins de ligne quotées et paires CRLF chevauchent les blocs
+    std::mt19937 rng(11);
+    std::string content = "\xEF\xBB\xBFid,text,value\r\n";
+    for (size_t i = 0; i < 20000; ++i) {
+        content += std::to_string(i) + ",";
+        switch (rng() % 3) {
+            case 0: content += "\"multi\nline, \"\"quoted\"\"\""; break;
+            case 1: content += std::string(rng() % 100, 'x'); break;
+            default: content += "plain"; break;
+        }
+        content += "," + std::to_string(rng() % 1000) + "\r\n";
+    }
+    std::string path = writeTempFile(content);
+    
+    ReadAheadReader reader(3, 1);
+    EXPECT_EQ(reader.getBufferCount(), 3);
+    EXPECT_EQ(reader.getBufferSize(), ReadAheadReader::kMinBufferSize);
+    ASSERT_TRUE(reader.open(path));
+    std::string reassembled;
+    const char* block = nullptr;
+    size_t block_size = 0;
+    size_t blocks = 0;
+    while (reader.next(block, block_size)) {
+        reassembled.append(block, block_size);
+        ++blocks;
+    }
+    EXPECT_FALSE(reader.hasError());
+    EXPECT_EQ(reassembled, content);
+    EXPECT_EQ(reader.getBytesRead(), content.size());
+    EXPECT_EQ(blocks, (content.size() + ReadAheadReader::kMinBufferSize - 1) / ReadAheadReader::kMinBufferSize);
+    
+    // EN: Closing while the reader thread waits for a free buffer, and reopening
+    // FR: Fermeture pendant que le thread de lecture attend un buffer libre, puis réouverture
+    ASSERT_TRUE(reader.open(path));
+    ASSERT_TRUE(reader.next(block, block_size));
+    EXPECT_EQ(std::string(block, 3), "\xEF\xBB\xBF");
+    reader.close();
+    EXPECT_FALSE(reader.isOpen());
+    EXPECT_FALSE(reader.open("/nonexistent/file.csv"));
+    EXPECT_FALSE(reader.getLastError().empty());
+    
+    auto parseWith = [&path](ParserConfig config, bool batches) {
+        StreamingParser parser(config);
+        std::vector<std::vector<std::string>> rows;
+        if (batches) {
+            parser.setBatchCallback([&rows](const RowBatch& batch, ParserError) {
+                for (size_t row = 0; row < batch.getRowCount(); ++row) {
+                    ParsedRow parsed = batch.toParsedRow(row);
+                    rows.push_back(parsed.getFields());
+                }
+                return true;
+            });
+        } else {
+            parser.setRowCallback([&rows](const ParsedRow& row, ParserError) {
+                rows.push_back(row.getFields());
+                return true;
+            });
+        }
+        EXPECT_EQ(parser.parseFile(path), ParserError::SUCCESS);
+        EXPECT_EQ(parser.getHeaders(), std::vector<std::string>({"id", "text", "value"}));
+        return rows;
+    };
+    
+    ParserConfig mapped_config;
+    mapped_config.use_memory_mapping = true;
+    auto expected = parseWith(mapped_config, false);
+    ASSERT_EQ(expected.size(), 20000);
+    
+    ParserConfig read_ahead_config;
+    read_ahead_config.read_ahead_buffers = 2;
+    read_ahead_config.read_ahead_buffer_size = ReadAheadReader::kMinBufferSize;
+    EXPECT_EQ(parseWith(read_ahead_config, false), expected);
+    EXPECT_EQ(parseWith(read_ahead_config, true), expected);
+    
+    // EN: Projection and early stop on the read-ahead path
+    // FR: Projection et arrêt anticipé sur le chemin à lecture anticipée
+    read_ahead_config.read_ahead_buffers = 4;
+    read_ahead_config.projected_columns = {"value"};
+    StreamingParser projected(read_ahead_config);
+    size_t seen = 0;
+    projected.setRowViewCallback([&](const RowView& row, ParserError) {
+        EXPECT_EQ(row.getFieldCount(), 1);
+        EXPECT_EQ(row[0], expected[seen][2]);
+        return ++seen < 15000;
+    });
+    EXPECT_EQ(projected.parseFile(path), ParserError::SUCCESS);
+    EXPECT_EQ(seen, 15000);
+    
+    StreamingParser missing(read_ahead_config);
+    EXPECT_EQ(missing.parseFile("/nonexistent/file.csv"), ParserError::FILE_NOT_FOUND);
+}
+
+// EN: Test the row index sidecar: building on every mapped path, seeking by row and splitting into ranges
+// FR: Test de l'index de lignes annexe : construction sur chaque chemin mappé, accès par ligne et découpage en plages
+TEST_F(StreamingParserTest, RowIndexSidecarAndSeek) {
+    // EN: Quoted newlines and CRLF so that naive line counting would land checkpoints mid-row
+    // FR: Fins de ligne quotées et CRLF pour qu'un simple comptage de lignes place les points en milieu de ligne
+    std::string content = "\xEF\xBB\xBFid,text\r\n";
+    for (size_t i = 0; i < 10000; ++i) {
+        content += std::to_string(i) + (i % 7 == 0 ? ",\"two\r\nlines\"" : ",plain") + (i % 2 ? "\r\n" : "\n");
+    }
+    std::string path = writeTempFile(content);
+    std::string sidecar = RowIndex::sidecarPath(path);
+    temp_files_.push_back(sidecar);
+    
+    auto collect = [](StreamingParser& parser, std::vector<std::pair<size_t, std::string>>& rows) {
+        parser.setRowViewCallback([&rows](const RowView& row, ParserError) {
+            rows.emplace_back(row.getRowNumber(), std::string(row.getField(0)));
+            return true;
+        });
+    };
+    
+    ParserConfig config;
+    config.row_index_stride = 100;
+    std::vector<RowIndex> indexes;
+    for (bool parallel : {false, true}) {
+        config.enable_parallel_processing = parallel;
+        config.thread_count = 3;
+        config.parallel_chunk_size = 4096;
+        StreamingParser parser(config);
+        std::vector<std::pair<size_t, std::string>> rows;
+        collect(parser, rows);
+        ASSERT_EQ(parser.parseFile(path), ParserError::SUCCESS);
+        ASSERT_EQ(rows.size(), 10000);
+        indexes.push_back(parser.getRowIndex());
+    }
+    const RowIndex& built = indexes[0];
+    EXPECT_EQ(built.getRowCount(), 10000);
+    ASSERT_EQ(built.getCheckpointCount(), 100);
+    for (size_t i = 0; i < built.getCheckpointCount(); ++i) {
+        EXPECT_EQ(indexes[1].getCheckpointOffset(i), built.getCheckpointOffset(i));
+        EXPECT_EQ(content.compare(built.getCheckpointOffset(i), std::to_string(i * 100).size() + 1,
+                                  std::to_string(i * 100) + ","), 0) << "checkpoint " << i;
+    }
+    
+    // EN: The sidecar round-trips and stays small (delta-encoded varints)
+    // FR: L'annexe fait l'aller-retour et reste petite (deltas en varint)
+    RowIndex loaded;
+    ASSERT_TRUE(loaded.load(sidecar)) << loaded.getLastError();
+    EXPECT_TRUE(loaded.matches(path));
+    EXPECT_EQ(loaded.getRowCount(), built.getRowCount());
+    EXPECT_EQ(loaded.getCheckpointOffset(99), built.getCheckpointOffset(99));
+    EXPECT_LT(std::filesystem::file_size(sidecar), 400u);
+    
+    // EN: Seeking delivers the same rows and row numbers as a full parse
+    // FR: L'accès direct transmet les mêmes lignes et numéros qu'un parsing complet
+    config.enable_parallel_processing = false;
+    config.row_index_stride = 0;
+    {
+        StreamingParser parser(config);
+        std::vector<std::pair<size_t, std::string>> rows;
+        collect(parser, rows);
+        ASSERT_EQ(parser.parseFileFromRow(path, 4321, 5), ParserError::SUCCESS);
+        ASSERT_EQ(rows.size(), 5);
+        EXPECT_EQ(rows[0], std::make_pair(size_t{4323}, std::string("4321")));
+        EXPECT_EQ(rows[4], std::make_pair(size_t{4327}, std::string("4325")));
+        EXPECT_EQ(parser.getHeaders(), std::vector<std::string>({"id", "text"}));
+        EXPECT_EQ(parser.getStatistics().getRowsParsed(), 5);
+    }
+    
+    // EN: Byte-balanced ranges cover every row exactly once
+    // FR: Des plages équilibrées en octets couvrent chaque ligne exactement une fois
+    auto ranges = loaded.split(4);
+    ASSERT_EQ(ranges.size(), 4);
+    std::vector<std::pair<size_t, std::string>> stitched;
+    for (const auto& range : ranges) {
+        StreamingParser parser(config);
+        size_t before = stitched.size();
+        collect(parser, stitched);
+        ASSERT_EQ(parser.parseFileRange(path, range), ParserError::SUCCESS);
+        EXPECT_EQ(stitched.size() - before, range.row_count);
+    }
+    ASSERT_EQ(stitched.size(), 10000);
+    for (size_t i = 0; i < stitched.size(); ++i) {
+        ASSERT_EQ(stitched[i], std::make_pair(i + 2, std::to_string(i)));
+    }
+    
+    // EN: A stale sidecar is ignored and seeking falls back to a linear skip
+    // FR: Une annexe périmée est ignorée et l'accès se replie sur un saut linéaire
+    {
+        std::ofstream append(path, std::ios::binary | std::ios::app);
+        append << "10000,appended\n";
+    }
+    EXPECT_FALSE(loaded.matches(path));
+    StreamingParser parser(config);
+    std::vector<std::pair<size_t, std::string>> rows;
+    collect(parser, rows);
+    ASSERT_EQ(parser.parseFileFromRow(path, 9999), ParserError::SUCCESS);
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_EQ(rows[1], std::make_pair(size_t{10002}, std::string("10000")));
+}
+
 // EN: Main test runner with logger initialization
 // FR: Lanceur de test principal avec initialisation du logger
 int main(int argc, char** argv) {